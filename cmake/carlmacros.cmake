@@ -168,6 +168,16 @@ macro(load_library group name version)
         endif()
 
 		if(LIBNAME MATCHES "Boost")
+			set(_fixed "")
+			foreach(_l ${${LIBNAME}_LIBRARIES})
+				if(TARGET ${_l})
+					get_target_property(_loc ${_l} LOCATION)
+					list(APPEND _fixed ${_loc})
+				else()
+					list(APPEND _fixed ${_l})
+				endif()
+			endforeach()
+			set(${LIBNAME}_LIBRARIES ${_fixed})
 			add_imported_library(${LIBNAME} SHARED "${${LIBNAME}_LIBRARIES}" "${${LIBNAME}_INCLUDE_DIR}" "${BOOST_COMPONENTS}")
 		else()
 			add_imported_library(${LIBNAME} SHARED "${${LIBNAME}_LIBRARY}" "${${LIBNAME}_INCLUDE_DIR}")
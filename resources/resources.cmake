@@ -156,6 +156,13 @@ endif()
 
 
 ##### GTest
+if(EXISTS /usr/lib/x86_64-linux-gnu/libgtest.a)
+	add_imported_library(GTESTCORE STATIC "/usr/lib/x86_64-linux-gnu/libgtest.a" "/usr/include")
+	add_imported_library(GTESTMAIN STATIC "/usr/lib/x86_64-linux-gnu/libgtest_main.a" "/usr/include")
+	set(GTEST_LIBRARIES GTESTCORE_STATIC GTESTMAIN_STATIC pthread dl)
+	set(GTEST_FOUND ON)
+	set(GTEST_VERSION "system")
+endif()
 if(NOT GTEST_FOUND)
 	set(GTEST_VERSION "1.8.0")
 	set(GTEST_ZIPHASH "adfafc8512ab65fd3cf7955ef0100ff5")
@@ -164,7 +171,12 @@ if(NOT GTEST_FOUND)
 endif()
 print_resource_info("GTest" GTESTMAIN_STATIC ${GTEST_VERSION})
 
+if(EXISTS /usr/lib/x86_64-linux-gnu/libbenchmark.so)
+	add_imported_library(GBCORE STATIC "/usr/lib/x86_64-linux-gnu/libbenchmark.so" "/usr/include")
+	add_imported_library(GBMAIN STATIC "/usr/lib/x86_64-linux-gnu/libbenchmark_main.a" "/usr/include")
+else()
 include(resources/google-benchmark.cmake)
+endif()
 
 ##### MPFR
 IF(USE_MPFR_FLOAT)
@@ -13,6 +13,7 @@
 #include "CAD.h"
 
 #include "../core/logging.h"
+#include "../util/Instrumentation.h"
 #include "../interval/IntervalEvaluation.h"
 #include "../formula/model/ran/RealAlgebraicNumberSettings.h"
 #include "../core/rootfinder/RootFinder.h"
@@ -1373,6 +1374,7 @@ cad::Answer CAD<Number>::liftCheck(
 		cad::ConflictGraph<Number>& conflictGraph,
 		std::stack<std::size_t>& satPath
 ) {
+	CARL_TIME_SCOPE("carl.cad.lifting");
 	if (this->anAnswerFound()) {
 		this->interrupted = true;
 		assert(this->sampleTree.isConsistent());
@@ -1639,6 +1641,7 @@ cad::Answer CAD<Number>::liftCheck(
 template<typename Number>
 int CAD<Number>::eliminate(std::size_t level, const BoundMap& bounds, bool boundsActive) {
 	CARL_LOG_FUNC("carl.cad.elimination", level << ", " << bounds);
+	CARL_TIME_SCOPE("carl.cad.projection");
 	while (true) {
 		if (!this->eliminationSets[level].emptyLiftingQueue()) return (int)level;
 		std::size_t l = level;
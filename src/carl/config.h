@@ -0,0 +1,19 @@
+/**
+ * Auto generated file config.h from config.h.in.
+ */ 
+#pragma once
+
+#define CARL_BUILD_RELEASE
+/* #undef LOGGING */
+/* #undef LOGGING_DISABLE_INEFFICIENT */
+/* #undef TIMING */
+/* #undef THREAD_SAFE */
+/* #undef BUCHBERGER_STATISTICS */
+/* #undef USE_BLISS */
+/* #undef USE_CLN_NUMBERS */
+/* #undef USE_COCOA */
+/* #undef USE_GINAC */
+#define BOOST_HAS_STACKTRACE
+
+/* #undef RAN_USE_THOM */
+/* #undef RAN_USE_Z3 */
@@ -0,0 +1,416 @@
+/**
+ * @file CompiledPolynomial.h
+ *
+ * Polynomials compiled into straight-line programs for repeated evaluation.
+ */
+
+#pragma once
+
+#include "MultivariateHorner.h"
+#include "MultivariatePolynomial.h"
+#include "Variable.h"
+#include "../interval/Interval.h"
+#include "../numbers/numbers.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A polynomial compiled into a straight-line program over dense variable slots.
+ *
+ * Evaluating a polynomial with MultivariatePolynomial::evaluate() or IntervalEvaluation looks up every variable in
+ * a map and walks the term list for every single point. If the same polynomial is evaluated over and over, e.g. when
+ * sampling or propagating intervals, it pays off to translate it once into a flat list of instructions.
+ *
+ * The variables are mapped to slots 0, ..., n-1 in the order given by variables(), and a point is a vector holding
+ * the value of every slot. The program works on registers: the first n registers hold the point, the next ones the
+ * (distinct) constants of the polynomial and every instruction writes its result to a new register.
+ * Powers of variables are computed only once, even if they occur in several terms.
+ *
+ * The program can be run on every type T that supports +, * and carl::pow(), in particular on double,
+ * Interval<double> and the coefficient type itself. Use an Evaluator to evaluate at many points, as it converts
+ * the constants to T and allocates its registers only once.
+ */
+template<typename Poly>
+class CompiledPolynomial {
+public:
+	using CoeffType = typename Poly::CoeffType;
+
+	enum class OpCode: std::uint8_t { ADD, MUL, POW };
+
+	/**
+	 * An instruction computing lhs + rhs, lhs * rhs or lhs^rhs.
+	 * The result is stored in the register following the results of all previous instructions.
+	 */
+	struct Instruction {
+		OpCode op;
+		/// Register of the first operand.
+		std::uint32_t lhs;
+		/// Register of the second operand or the exponent.
+		std::uint32_t rhs;
+	};
+
+	template<typename T>
+	class Evaluator;
+private:
+	/// The variables, the index of a variable is its slot.
+	std::vector<Variable> mVariables;
+	/// The constants, they are stored in the registers after the variables.
+	std::vector<CoeffType> mConstants;
+	std::vector<Instruction> mProgram;
+	/// The register holding the result.
+	std::uint32_t mResult = 0;
+
+	/// Translation state, only used while compiling.
+	struct Compiler {
+		CompiledPolynomial& cp;
+		std::map<Variable, std::uint32_t> slots;
+		std::map<CoeffType, std::uint32_t> constants;
+		std::map<std::pair<std::uint32_t, uint>, std::uint32_t> powers;
+		/// The instructions are collected here, as the number of constants is only known in the end.
+		std::vector<Instruction> program;
+
+		explicit Compiler(CompiledPolynomial& p): cp(p) {
+			for (std::uint32_t i = 0; i < cp.mVariables.size(); ++i) {
+				slots.emplace(cp.mVariables[i], i);
+			}
+		}
+		/// Temporary register ids are shifted by this offset until the constants are known.
+		static constexpr std::uint32_t TEMPORARY = std::uint32_t(1) << 31;
+
+		std::uint32_t constant(const CoeffType& c) {
+			auto it = constants.find(c);
+			if (it == constants.end()) {
+				it = constants.emplace(c, std::uint32_t(cp.mVariables.size() + constants.size())).first;
+				cp.mConstants.push_back(c);
+			}
+			return it->second;
+		}
+		std::uint32_t emit(OpCode op, std::uint32_t lhs, std::uint32_t rhs) {
+			program.push_back(Instruction{op, lhs, rhs});
+			return TEMPORARY + std::uint32_t(program.size() - 1);
+		}
+		std::uint32_t power(Variable::Arg v, uint exp) {
+			assert(slots.find(v) != slots.end());
+			std::uint32_t slot = slots.at(v);
+			if (exp == 1) return slot;
+			auto it = powers.find(std::make_pair(slot, exp));
+			if (it != powers.end()) return it->second;
+			std::uint32_t res = emit(OpCode::POW, slot, exp);
+			powers.emplace(std::make_pair(slot, exp), res);
+			return res;
+		}
+		/// Maps temporary register ids to their final position.
+		void finish(std::uint32_t result) {
+			std::uint32_t offset = std::uint32_t(cp.mVariables.size() + cp.mConstants.size());
+			auto fix = [offset](std::uint32_t& r) {
+				if (r >= TEMPORARY) r = r - TEMPORARY + offset;
+			};
+			for (auto& i: program) {
+				fix(i.lhs);
+				if (i.op != OpCode::POW) fix(i.rhs);
+			}
+			fix(result);
+			cp.mProgram = std::move(program);
+			cp.mResult = result;
+		}
+	};
+
+	template<typename Strategy>
+	static void gatherVariables(const MultivariateHorner<Poly, Strategy>& h, std::set<Variable>& vars) {
+		if (h.getVariable() != Variable::NO_VARIABLE) vars.insert(h.getVariable());
+		if (h.getDependent()) gatherVariables(*h.getDependent(), vars);
+		if (h.getIndependent()) gatherVariables(*h.getIndependent(), vars);
+	}
+
+	template<typename Strategy>
+	static std::uint32_t compile(Compiler& c, const MultivariateHorner<Poly, Strategy>& h) {
+		// h = variable^exponent * dependent + independent
+		if (h.getVariable() == Variable::NO_VARIABLE) {
+			return c.constant(h.getIndepConstant());
+		}
+		std::uint32_t res = c.power(h.getVariable(), h.getExponent());
+		if (h.getDependent()) {
+			res = c.emit(OpCode::MUL, res, compile(c, *h.getDependent()));
+		} else if (!carl::isOne(h.getDepConstant())) {
+			res = c.emit(OpCode::MUL, c.constant(h.getDepConstant()), res);
+		}
+		if (h.getIndependent()) {
+			res = c.emit(OpCode::ADD, res, compile(c, *h.getIndependent()));
+		} else if (!carl::isZero(h.getIndepConstant())) {
+			res = c.emit(OpCode::ADD, res, c.constant(h.getIndepConstant()));
+		}
+		return res;
+	}
+
+	static std::vector<Variable> variablesOf(const Poly& p) {
+		std::set<Variable> vars;
+		p.gatherVariables(vars);
+		return std::vector<Variable>(vars.begin(), vars.end());
+	}
+public:
+	/**
+	 * Compiles a polynomial given as a sum of terms.
+	 * @param p Polynomial.
+	 * @param variables Assignment of variables to slots, must contain all variables of p.
+	 */
+	CompiledPolynomial(const Poly& p, std::vector<Variable> variables):
+		mVariables(std::move(variables))
+	{
+		Compiler c(*this);
+		std::uint32_t res = 0;
+		bool first = true;
+		for (const auto& t: p) {
+			std::uint32_t term = 0;
+			bool isConstant = true;
+			if (t.monomial()) {
+				for (const auto& ve: *t.monomial()) {
+					std::uint32_t factor = c.power(ve.first, ve.second);
+					term = isConstant ? factor : c.emit(OpCode::MUL, term, factor);
+					isConstant = false;
+				}
+			}
+			if (isConstant) {
+				term = c.constant(t.coeff());
+			} else if (!carl::isOne(t.coeff())) {
+				term = c.emit(OpCode::MUL, c.constant(t.coeff()), term);
+			}
+			res = first ? term : c.emit(OpCode::ADD, res, term);
+			first = false;
+		}
+		if (first) res = c.constant(CoeffType(0));
+		c.finish(res);
+	}
+	/**
+	 * Compiles a polynomial, the slots are assigned to the variables of p in ascending order.
+	 */
+	explicit CompiledPolynomial(const Poly& p):
+		CompiledPolynomial(p, variablesOf(p))
+	{}
+
+	/**
+	 * Compiles a polynomial given as a multivariate horner scheme.
+	 * @param h Horner scheme.
+	 * @param variables Assignment of variables to slots, must contain all variables of h.
+	 */
+	template<typename Strategy>
+	CompiledPolynomial(const MultivariateHorner<Poly, Strategy>& h, std::vector<Variable> variables):
+		mVariables(std::move(variables))
+	{
+		Compiler c(*this);
+		std::uint32_t res = compile(c, h);
+		c.finish(res);
+	}
+	/**
+	 * Compiles a multivariate horner scheme, the slots are assigned to its variables in ascending order.
+	 */
+	template<typename Strategy>
+	explicit CompiledPolynomial(const MultivariateHorner<Poly, Strategy>& h):
+		mVariables()
+	{
+		std::set<Variable> vars;
+		gatherVariables(h, vars);
+		mVariables.assign(vars.begin(), vars.end());
+		Compiler c(*this);
+		std::uint32_t res = compile(c, h);
+		c.finish(res);
+	}
+
+	/**
+	 * @return The variables in the order of their slots.
+	 */
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	const std::vector<CoeffType>& constants() const {
+		return mConstants;
+	}
+	const std::vector<Instruction>& program() const {
+		return mProgram;
+	}
+	/**
+	 * @return The register holding the result after evaluation.
+	 */
+	std::uint32_t result() const {
+		return mResult;
+	}
+	std::size_t nrRegisters() const {
+		return mVariables.size() + mConstants.size() + mProgram.size();
+	}
+
+	/**
+	 * Expands the program back into a polynomial.
+	 */
+	Poly toPolynomial() const {
+		std::vector<Poly> point;
+		for (const auto& v: mVariables) point.emplace_back(v);
+		return evaluate(point);
+	}
+
+	/**
+	 * Creates an evaluator working on values of type T.
+	 */
+	template<typename T>
+	Evaluator<T> evaluator() const {
+		return Evaluator<T>(*this);
+	}
+
+	/**
+	 * Evaluates at a single point, the value of the i'th variable is point[i].
+	 * Use evaluator() to evaluate at many points.
+	 */
+	template<typename T>
+	T evaluate(const std::vector<T>& point) const {
+		return Evaluator<T>(*this)(point);
+	}
+};
+
+namespace compiled_polynomial_detail {
+	template<typename T, typename Coeff, EnableIf<std::is_same<T, Coeff>> = dummy>
+	const T& convert(const Coeff& c) {
+		return c;
+	}
+	template<typename T, typename Coeff, EnableIf<std::is_same<T, double>> = dummy, DisableIf<std::is_same<T, Coeff>> = dummy>
+	T convert(const Coeff& c) {
+		return carl::toDouble(c);
+	}
+	template<typename T, typename Coeff, DisableIf<std::is_same<T, double>> = dummy, DisableIf<std::is_same<T, Coeff>> = dummy>
+	T convert(const Coeff& c) {
+		return T(c);
+	}
+}
+
+/**
+ * Runs a compiled polynomial on values of type T.
+ * An evaluator holds its own registers, hence it must not be shared between threads, while several evaluators
+ * for the same CompiledPolynomial can be used concurrently.
+ */
+template<typename Poly>
+template<typename T>
+class CompiledPolynomial<Poly>::Evaluator {
+private:
+	const CompiledPolynomial* mCompiled;
+	/// Registers for a single point.
+	std::vector<T> mRegisters;
+	/// Registers for a block of points in batch evaluation, register r of point j is mBlock[r * BLOCK + j].
+	std::vector<T> mBlock;
+	static constexpr std::size_t BLOCK = 64;
+
+	static T apply(OpCode op, const T& lhs, const T& rhs) {
+		switch (op) {
+			case OpCode::ADD: return lhs + rhs;
+			case OpCode::MUL: return lhs * rhs;
+			default: assert(false); return lhs;
+		}
+	}
+public:
+	explicit Evaluator(const CompiledPolynomial& cp):
+		mCompiled(&cp),
+		mRegisters(cp.nrRegisters(), T(0))
+	{
+		std::size_t offset = cp.mVariables.size();
+		for (std::size_t i = 0; i < cp.mConstants.size(); ++i) {
+			mRegisters[offset + i] = compiled_polynomial_detail::convert<T>(cp.mConstants[i]);
+		}
+	}
+
+	/**
+	 * Evaluates at a single point, the value of the i'th variable is point[i].
+	 */
+	const T& operator()(const std::vector<T>& point) {
+		assert(point.size() == mCompiled->mVariables.size());
+		std::copy(point.begin(), point.end(), mRegisters.begin());
+		std::size_t dest = mCompiled->mVariables.size() + mCompiled->mConstants.size();
+		for (const auto& i: mCompiled->mProgram) {
+			if (i.op == OpCode::POW) {
+				mRegisters[dest] = carl::pow(mRegisters[i.lhs], i.rhs);
+			} else {
+				mRegisters[dest] = apply(i.op, mRegisters[i.lhs], mRegisters[i.rhs]);
+			}
+			++dest;
+		}
+		return mRegisters[mCompiled->mResult];
+	}
+
+	/**
+	 * Evaluates at many points at once.
+	 * The points are processed in blocks and every instruction is executed for a whole block before the next one,
+	 * which avoids interpreting the program for every point and gives the compiler vectorizable loops.
+	 * Polynomials without variables must be evaluated with the other operator().
+	 * @param points The points one after another, i.e. the value of variable i at point j is points[j * n + i].
+	 * @param results Is resized to the number of points and receives the values.
+	 */
+	void operator()(const std::vector<T>& points, std::vector<T>& results) {
+		std::size_t n = mCompiled->mVariables.size();
+		assert(n > 0 && points.size() % n == 0);
+		std::size_t count = points.size() / n;
+		results.resize(count);
+		if (mBlock.empty()) {
+			mBlock.resize(mCompiled->nrRegisters() * BLOCK, T(0));
+			for (std::size_t c = 0; c < mCompiled->mConstants.size(); ++c) {
+				std::fill_n(mBlock.begin() + std::ptrdiff_t((n + c) * BLOCK), BLOCK, mRegisters[n + c]);
+			}
+		}
+		for (std::size_t start = 0; start < count; start += BLOCK) {
+			std::size_t size = std::min(BLOCK, count - start);
+			for (std::size_t j = 0; j < size; ++j) {
+				for (std::size_t v = 0; v < n; ++v) {
+					mBlock[v * BLOCK + j] = points[(start + j) * n + v];
+				}
+			}
+			T* dest = mBlock.data() + (n + mCompiled->mConstants.size()) * BLOCK;
+			for (const auto& i: mCompiled->mProgram) {
+				const T* lhs = mBlock.data() + i.lhs * BLOCK;
+				switch (i.op) {
+					case OpCode::ADD: {
+						const T* rhs = mBlock.data() + i.rhs * BLOCK;
+						for (std::size_t j = 0; j < size; ++j) dest[j] = lhs[j] + rhs[j];
+						break;
+					}
+					case OpCode::MUL: {
+						const T* rhs = mBlock.data() + i.rhs * BLOCK;
+						for (std::size_t j = 0; j < size; ++j) dest[j] = lhs[j] * rhs[j];
+						break;
+					}
+					case OpCode::POW:
+						for (std::size_t j = 0; j < size; ++j) dest[j] = carl::pow(lhs[j], i.rhs);
+						break;
+				}
+				dest += BLOCK;
+			}
+			std::copy_n(mBlock.begin() + std::ptrdiff_t(mCompiled->mResult * BLOCK), size, results.begin() + std::ptrdiff_t(start));
+		}
+	}
+};
+
+template<typename Poly>
+inline std::ostream& operator<<(std::ostream& os, const CompiledPolynomial<Poly>& cp) {
+	auto reg = [&cp](std::uint32_t r) {
+		std::stringstream ss;
+		if (r < cp.variables().size()) ss << cp.variables()[r];
+		else if (r < cp.variables().size() + cp.constants().size()) ss << cp.constants()[r - cp.variables().size()];
+		else ss << "r" << r;
+		return ss.str();
+	};
+	std::uint32_t dest = std::uint32_t(cp.variables().size() + cp.constants().size());
+	for (const auto& i: cp.program()) {
+		os << "r" << dest++ << " = " << reg(i.lhs);
+		switch (i.op) {
+			case CompiledPolynomial<Poly>::OpCode::ADD: os << " + " << reg(i.rhs); break;
+			case CompiledPolynomial<Poly>::OpCode::MUL: os << " * " << reg(i.rhs); break;
+			case CompiledPolynomial<Poly>::OpCode::POW: os << "^" << i.rhs; break;
+		}
+		os << "; ";
+	}
+	return os << "return " << reg(cp.result());
+}
+
+}
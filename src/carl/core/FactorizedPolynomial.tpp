@@ -61,9 +61,10 @@ namespace carl
                 //Factorization is not set yet
                 auto ret = mpCache->cache( pfPair );//, &carl::canBeUpdated, &carl::update );
                 mCacheRef = ret.first;
-                mpCache->reg( mCacheRef );
                 if( ret.second )
                 {
+                    // The cache computes the usage of the entry under this lock.
+                    std::lock_guard<std::recursive_mutex> lock( content().mMutex );
                     assert( content().mFactorization.empty() );
                     CARL_LOG_DEBUG("carl.core.factorizedpolynomial", "Adding single factor ( " << poly << " )^1");
                     content().mFactorization.insert( std::make_pair( *this, 1 ) );
@@ -105,7 +106,6 @@ namespace carl
             PolynomialFactorizationPair<P>* pfPair = new PolynomialFactorizationPair<P>( std::move( _factorization ) );
             auto ret = mpCache->cache( pfPair );//, &carl::canBeUpdated, &carl::update );
             mCacheRef = ret.first;
-            mpCache->reg( mCacheRef );
             if( !ret.second )
             {
                 delete pfPair;
@@ -0,0 +1,313 @@
+/**
+ * @file HornerSchemes.h
+ *
+ * Multivariate Horner schemes of many polynomials, stored as a directed acyclic graph with shared subschemes.
+ */
+
+#pragma once
+
+#include "MultivariateHorner.h"
+#include "MultivariatePolynomial.h"
+#include "Variable.h"
+#include "../interval/Interval.h"
+#include "../interval/IntervalBox.h"
+#include "../util/hash.h"
+#include "../util/SFINAE.h"
+
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Heuristics to select the variable that is factored out in every step.
+ */
+enum class HornerVariableSelection {
+	/// Selects the variable that occurs in the most terms, like GREEDY_I of MultivariateHorner.
+	MOST_TERMS,
+	/// Selects the variable that minimizes the arithmetic operations (see arithmeticOperations()) of the resulting
+	/// dependent and independent parts.
+	OPERATION_COUNT
+};
+
+/**
+ * Builds and stores multivariate Horner schemes for many polynomials.
+ *
+ * A scheme has the same form as a MultivariateHorner: every node is `x^e * dependent + independent`, where both parts
+ * are either a constant or another node. Instead of a tree of shared pointers, the nodes are stored in a single
+ * vector and refer to their children by index. Nodes are hash-consed, hence equal subschemes of the same or of
+ * different polynomials are stored only once and are evaluated only once by evaluate().
+ * Every child is stored before its parent.
+ *
+ * The factor x^e always uses the largest power of x that divides all terms of the dependent part, which is what the
+ * simplification of GREEDY_Is does afterwards.
+ */
+template<typename Poly>
+class HornerSchemes {
+public:
+	using CoeffType = typename Poly::CoeffType;
+	using NodeID = std::uint32_t;
+	static constexpr NodeID NONE = std::numeric_limits<NodeID>::max();
+
+	/**
+	 * A node represents `variable^exponent * dependent + independent`, where the dependent (independent) part is the
+	 * node with id dependent (independent), or the constant depConstant (indepConstant) if the id is NONE.
+	 * A constant is represented by a node without a variable whose value is indepConstant.
+	 */
+	struct Node {
+		Variable variable;
+		exponent exp;
+		NodeID dependent;
+		NodeID independent;
+		CoeffType depConstant;
+		CoeffType indepConstant;
+
+		bool isConstant() const {
+			return variable == Variable::NO_VARIABLE;
+		}
+		bool operator==(const Node& n) const {
+			return variable == n.variable && exp == n.exp && dependent == n.dependent && independent == n.independent && depConstant == n.depConstant && indepConstant == n.indepConstant;
+		}
+	};
+private:
+	HornerVariableSelection mSelection;
+	std::vector<Node> mNodes;
+	/// The constants of every node as intervals over double, as converting them on every evaluation is expensive.
+	std::vector<std::pair<Interval<double>, Interval<double>>> mDoubleConstants;
+	/// Maps the hash of a node to the nodes with this hash, such that the key does not store another copy of the node.
+	std::unordered_multimap<std::size_t, NodeID> mUnique;
+
+	NodeID intern(Node&& n) {
+		std::size_t hash = carl::hash_all(n.variable, n.exp, n.dependent, n.independent, n.depConstant, n.indepConstant);
+		auto range = mUnique.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it) {
+			if (mNodes[it->second] == n) return it->second;
+		}
+		assert(mNodes.size() < NONE);
+		NodeID id = NodeID(mNodes.size());
+		mDoubleConstants.emplace_back(Interval<double>(n.depConstant), Interval<double>(n.indepConstant));
+		mNodes.push_back(std::move(n));
+		mUnique.emplace(hash, id);
+		return id;
+	}
+
+	template<typename Number, EnableIf<std::is_same<Number, double>> = dummy>
+	const Interval<double>& constant(NodeID id, bool dependent) const {
+		return dependent ? mDoubleConstants[id].first : mDoubleConstants[id].second;
+	}
+	template<typename Number, DisableIf<std::is_same<Number, double>> = dummy>
+	Interval<Number> constant(NodeID id, bool dependent) const {
+		return Interval<Number>(dependent ? mNodes[id].depConstant : mNodes[id].indepConstant);
+	}
+
+	/// Cost of evaluating a term whose monomial has the given total degree.
+	static std::size_t termCost(std::size_t degree, const CoeffType& coeff) {
+		if (degree == 0) return 0;
+		return degree - 1 + (isOne(coeff) ? 0 : 1);
+	}
+
+	/**
+	 * Selects the variable to factor out and the largest exponent such that variable^exponent divides all terms that
+	 * contain the variable.
+	 */
+	std::pair<Variable, exponent> select(const Poly& p) const {
+		std::set<Variable> vars = p.gatherVariables();
+		Variable best = Variable::NO_VARIABLE;
+		exponent bestExp = 0;
+		std::size_t bestTerms = 0;
+		std::size_t bestCost = std::numeric_limits<std::size_t>::max();
+		for (Variable v: vars) {
+			exponent minExp = std::numeric_limits<exponent>::max();
+			std::size_t terms = 0;
+			for (const auto& t: p) {
+				if (!t.has(v)) continue;
+				minExp = std::min(minExp, t.monomial()->exponentOfVariable(v));
+				terms++;
+			}
+			std::size_t cost = 0;
+			if (mSelection == HornerVariableSelection::OPERATION_COUNT) {
+				std::size_t indepTerms = p.nrTerms() - terms;
+				cost = (terms - 1) + minExp;
+				if (indepTerms > 0) cost += indepTerms;
+				for (const auto& t: p) {
+					if (t.has(v)) cost += termCost(t.tdeg() - minExp, t.coeff());
+					else cost += termCost(t.tdeg(), t.coeff());
+				}
+			}
+			if (cost < bestCost || (cost == bestCost && terms > bestTerms)) {
+				best = v;
+				bestExp = minExp;
+				bestTerms = terms;
+				bestCost = cost;
+			}
+		}
+		return std::make_pair(best, bestExp);
+	}
+
+	NodeID build(const Poly& p) {
+		if (p.isNumber()) {
+			return intern(Node{Variable::NO_VARIABLE, 0, NONE, NONE, constant_zero<CoeffType>::get(), p.constantPart()});
+		} else {
+			auto selected = select(p);
+			Monomial::Arg factor = createMonomial(selected.first, selected.second);
+			// Dividing by a common factor and taking a subsequence both keep the terms ordered.
+			p.makeOrdered();
+			typename Poly::TermsType dependentTerms;
+			typename Poly::TermsType independentTerms;
+			for (const auto& t: p) {
+				if (t.has(selected.first)) {
+					dependentTerms.emplace_back();
+					t.divide(factor, dependentTerms.back());
+				} else {
+					independentTerms.push_back(t);
+				}
+			}
+			Poly dependent(std::move(dependentTerms), false, true);
+			Poly independent(std::move(independentTerms), false, true);
+			Node n{selected.first, selected.second, NONE, NONE, constant_zero<CoeffType>::get(), constant_zero<CoeffType>::get()};
+			if (dependent.isNumber()) n.depConstant = dependent.constantPart();
+			else n.dependent = build(dependent);
+			if (independent.isNumber()) n.indepConstant = independent.constantPart();
+			else n.independent = build(independent);
+			return intern(std::move(n));
+		}
+	}
+
+	/// Marks all nodes that are reachable from the roots.
+	std::vector<bool> reachable(const std::vector<NodeID>& roots) const {
+		std::vector<bool> res(mNodes.size(), false);
+		NodeID max = 0;
+		for (NodeID r: roots) {
+			res[r] = true;
+			max = std::max(max, r);
+		}
+		for (std::size_t i = max + 1; i-- > 0;) {
+			if (!res[i]) continue;
+			const Node& n = mNodes[i];
+			if (n.dependent != NONE) res[n.dependent] = true;
+			if (n.independent != NONE) res[n.independent] = true;
+		}
+		return res;
+	}
+public:
+	explicit HornerSchemes(HornerVariableSelection selection = HornerVariableSelection::OPERATION_COUNT):
+		mSelection(selection)
+	{}
+
+	/**
+	 * Builds the Horner scheme of p, reusing all nodes that already exist.
+	 * Adding the same polynomial twice yields the same node.
+	 * @return The id of the root node.
+	 */
+	NodeID add(const Poly& p) {
+		return build(p);
+	}
+
+	const Node& node(NodeID id) const {
+		assert(id < mNodes.size());
+		return mNodes[id];
+	}
+	/**
+	 * @return The number of distinct nodes.
+	 */
+	std::size_t size() const {
+		return mNodes.size();
+	}
+
+	/**
+	 * Counts the additions and multiplications to evaluate the given schemes, where shared nodes are counted once.
+	 * The power x^e is counted as e multiplications, including the multiplication with the dependent part.
+	 */
+	std::size_t operationCount(const std::vector<NodeID>& roots) const {
+		auto needed = reachable(roots);
+		std::size_t res = 0;
+		for (std::size_t i = 0; i < mNodes.size(); ++i) {
+			if (!needed[i] || mNodes[i].isConstant()) continue;
+			const Node& n = mNodes[i];
+			if (n.dependent != NONE || !isOne(n.depConstant)) res += n.exp;
+			else res += n.exp - 1;
+			if (n.independent != NONE || !isZero(n.indepConstant)) res++;
+		}
+		return res;
+	}
+
+	/**
+	 * Expands the scheme rooted at the given node.
+	 */
+	Poly toPolynomial(NodeID id) const {
+		const Node& n = node(id);
+		if (n.isConstant()) return Poly(n.indepConstant);
+		Poly dependent = n.dependent == NONE ? Poly(n.depConstant) : toPolynomial(n.dependent);
+		Poly independent = n.independent == NONE ? Poly(n.indepConstant) : toPolynomial(n.independent);
+		return dependent * Poly(typename Poly::TermType(constant_one<CoeffType>::get(), n.variable, n.exp)) + independent;
+	}
+
+	/**
+	 * Evaluates the schemes with the given roots on a box.
+	 * Every node that is reachable from the roots is evaluated once, no matter how many schemes share it.
+	 * @param roots Root nodes.
+	 * @param assignment Either a `std::map<Variable, Interval<Number>>` or an IntervalBox<Number>.
+	 * @return The resulting interval for every root.
+	 */
+	template<typename Assignment, typename Number = typename IntervalAssignmentNumber<Assignment>::type>
+	std::vector<Interval<Number>> evaluate(const std::vector<NodeID>& roots, const Assignment& assignment) const {
+		auto needed = reachable(roots);
+		std::vector<Interval<Number>> values(needed.size());
+		for (std::size_t i = 0; i < needed.size(); ++i) {
+			if (!needed[i]) continue;
+			const Node& n = mNodes[i];
+			if (n.isConstant()) {
+				values[i] = constant<Number>(NodeID(i), false);
+				continue;
+			}
+			assert(assignment.count(n.variable) > 0);
+			Interval<Number> res = carl::pow(assignment.at(n.variable), n.exp);
+			if (n.dependent != NONE) res *= values[n.dependent];
+			else if (!isOne(n.depConstant)) res *= constant<Number>(NodeID(i), true);
+			if (n.independent != NONE) res += values[n.independent];
+			else if (!isZero(n.indepConstant)) res += constant<Number>(NodeID(i), false);
+			values[i] = res;
+		}
+		std::vector<Interval<Number>> res;
+		res.reserve(roots.size());
+		for (NodeID r: roots) res.push_back(values[r]);
+		return res;
+	}
+
+	template<typename Assignment, typename Number = typename IntervalAssignmentNumber<Assignment>::type>
+	Interval<Number> evaluate(NodeID root, const Assignment& assignment) const {
+		return evaluate(std::vector<NodeID>({root}), assignment).front();
+	}
+
+	/**
+	 * Prints the scheme rooted at the given node.
+	 */
+	void print(std::ostream& os, NodeID id) const {
+		const Node& n = node(id);
+		if (n.isConstant()) {
+			os << n.indepConstant;
+			return;
+		}
+		os << n.variable;
+		if (n.exp != 1) os << "^" << n.exp;
+		if (n.dependent != NONE) {
+			os << " * (";
+			print(os, n.dependent);
+			os << ")";
+		} else if (!isOne(n.depConstant)) {
+			os << " * " << n.depConstant;
+		}
+		if (n.independent != NONE) {
+			os << " + ";
+			print(os, n.independent);
+		} else if (!isZero(n.indepConstant)) {
+			os << " + " << n.indepConstant;
+		}
+	}
+};
+
+}
@@ -6,6 +6,7 @@
 #include "MonomialPool.h"
 
 #include "../io/streamingOperators.h"
+#include "../util/Instrumentation.h"
 
 namespace carl
 {
@@ -14,10 +15,12 @@ namespace carl
 		for (const auto& pe: mPool) {
 			CARL_LOG_TRACE("carl.core.monomial", "\t" << pe.content << " / " << pe.hash << " / " << pe.monomial.lock().get());
 		}
+		CARL_COUNT("carl.pool.monomial.lookup");
 		MONOMIAL_POOL_LOCK_GUARD
 		auto iter = mPool.insert(std::move(pe));
 		Monomial::Arg res;
 		if (iter.second) {
+			CARL_COUNT("carl.pool.monomial.insert");
 			CARL_LOG_TRACE("carl.core.monomial", "Was newly added");
 			if (iter.first->monomial.expired()) {
 				CARL_LOG_TRACE("carl.core.monomial", "Weakptr is expired");
@@ -39,9 +42,11 @@ namespace carl
 	Monomial::Arg MonomialPool::add( const Monomial::Arg& _monomial ) {
 		assert(_monomial->id() == 0);
 		PoolEntry pe(_monomial->hash(), _monomial->exponents(), _monomial);
+		CARL_COUNT("carl.pool.monomial.lookup");
 		MONOMIAL_POOL_LOCK_GUARD
 		auto iter = mPool.insert(pe);
 		if (iter.second) {
+			CARL_COUNT("carl.pool.monomial.insert");
 			_monomial->mId = mIDs.get();
 			return _monomial;
 		} else {
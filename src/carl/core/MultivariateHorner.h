@@ -19,6 +19,24 @@ namespace carl{
 
 static std::map<Variable, Interval<double>> mMap = {{ Variable::NO_VARIABLE , Interval<double>(0)}};
 
+/**
+ * Counts the arithmetic operations needed to evaluate a polynomial term by term:
+ * the additions of the terms, the multiplications within every monomial and the multiplication with every coefficient other than one.
+ */
+template<typename PolynomialType>
+std::size_t arithmeticOperations(const PolynomialType& p)
+{
+	if (p.nrTerms() == 0) return 0;
+	std::size_t res = p.nrTerms() - 1;
+	for (const auto& t: p)
+	{
+		if (t.isConstant()) continue;
+		res += t.tdeg() - 1;
+		if (!isOne(t.coeff())) res++;
+	}
+	return res;
+}
+
 template<typename PolynomialType, class strategy >
 class MultivariateHorner : public std::enable_shared_from_this<MultivariateHorner<PolynomialType, strategy >> { 
 
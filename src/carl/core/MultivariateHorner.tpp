@@ -18,18 +18,7 @@ namespace carl
 	size_t arithmeticOperationsCounter = 0;
 	if (strategy::use_arithmeticOperationsCounter)
  	{
- 		//Sum of monomials
- 		arithmeticOperationsCounter = inPut.nrTerms() - 1;
-
- 		typename PolynomialType::TermsType::const_iterator polynomialIt;
-		for (polynomialIt = inPut.begin(); polynomialIt != inPut.end(); polynomialIt++)
-		{
-			arithmeticOperationsCounter += polynomialIt->getNrVariables() - 1;
-			arithmeticOperationsCounter += polynomialIt->tdeg() - polynomialIt->getNrVariables();
-			if (polynomialIt->coeff() > 1) arithmeticOperationsCounter++;
-			if (polynomialIt->isConstant()) arithmeticOperationsCounter++;
-
-		}
+ 		arithmeticOperationsCounter = arithmeticOperations(inPut);
  	}
 
 
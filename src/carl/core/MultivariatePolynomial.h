@@ -67,8 +67,8 @@ public:
     using PolyType = MultivariatePolynomial<Coeff, Ordering, Policies>;
     /// The type of the cache. Multivariate polynomials do not need a cache, we set it to something.
     using CACHE = std::vector<int>;
-	/// Type our terms vector.f
-	using TermsType = std::vector<Term<Coeff>>;
+	/// Type our terms vector, using the allocator selected by the policy.
+	using TermsType = std::vector<Term<Coeff>, typename Policies::template allocator<Term<Coeff>>>;
 	
 	template<typename C, typename T>
 	using EnableIfNotSame = typename std::enable_if<!std::is_same<C,T>::value,T>::type;
@@ -370,6 +370,9 @@ public:
 	TermsType& getTerms() {
 		return mTerms;
 	}
+	const TermsType& getTerms() const {
+		return mTerms;
+	}
 
 	/**
 	 * For the polynomial p, the function calculates a polynomial p - lt(p).
@@ -1,4 +1,4 @@
-/** 
+/**
  * @file:   PolynomialAllocator.h
  * @author: Sebastian Junges
  *
@@ -7,10 +7,259 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 namespace carl
 {
+namespace allocation
+{
+	/**
+	 * Allocations of term vectors done through CountingAllocator by the current thread.
+	 */
+	struct Statistics {
+		std::size_t allocations = 0;
+		std::size_t deallocations = 0;
+		std::size_t bytes = 0;
+	};
+
+	inline Statistics& statistics() {
+		thread_local Statistics stats;
+		return stats;
+	}
+
+	/**
+	 * Measures the allocations of the current thread from its construction on, e.g. for a single operation.
+	 */
+	class Counter {
+	private:
+		Statistics mStart;
+	public:
+		Counter(): mStart(statistics()) {}
+		std::size_t allocations() const {
+			return statistics().allocations - mStart.allocations;
+		}
+		std::size_t bytes() const {
+			return statistics().bytes - mStart.bytes;
+		}
+	};
+
+	/**
+	 * A memory region for the temporaries of a single computation, like a gcd or a resultant.
+	 *
+	 * Memory is handed out by bumping a pointer through large chunks, deallocating is (almost) free and all chunks are
+	 * released at once when the arena is destroyed. While an arena exists, it is the active arena of its thread and all
+	 * ArenaAllocator objects created in this thread allocate from it. Arenas nest, the innermost one is active.
+	 *
+	 * Everything allocated from an arena must be destroyed before the arena. Results that should survive the
+	 * computation have to be copied after the arena was deactivated, which is what inArena() does.
+	 */
+	class ComputationArena {
+	private:
+		static constexpr std::size_t CHUNK_SIZE = 64 * 1024;
+
+		std::vector<std::unique_ptr<char[]>> mChunks;
+		char* mCurrent = nullptr;
+		std::size_t mRemaining = 0;
+		/// Number of allocations that were not yet deallocated.
+		std::size_t mLive = 0;
+		std::size_t mBytes = 0;
+		ComputationArena* mPrevious;
+		bool mActive = true;
+
+		static ComputationArena*& current() {
+			thread_local ComputationArena* arena = nullptr;
+			return arena;
+		}
+
+		char* newChunk(std::size_t size) {
+			mChunks.emplace_back(new char[size]);
+			return mChunks.back().get();
+		}
+	public:
+		ComputationArena(): mPrevious(current()) {
+			current() = this;
+		}
+		ComputationArena(const ComputationArena&) = delete;
+		ComputationArena& operator=(const ComputationArena&) = delete;
+		~ComputationArena() {
+			deactivate();
+			assert(mLive == 0 && "Some object outlives the arena it was allocated from.");
+		}
+
+		/// Returns the active arena of the current thread, or nullptr if there is none.
+		static ComputationArena* active() {
+			return current();
+		}
+
+		/// Makes the previously active arena active again, new allocators no longer use this arena.
+		void deactivate() {
+			if (!mActive) return;
+			assert(current() == this);
+			current() = mPrevious;
+			mActive = false;
+		}
+
+		void* allocate(std::size_t size, std::size_t alignment) {
+			mLive++;
+			mBytes += size;
+			if (size > CHUNK_SIZE / 4) {
+				// Large blocks get a chunk of their own, such that they do not waste the rest of the current chunk.
+				return newChunk(size);
+			}
+			std::size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(mCurrent) % alignment) % alignment;
+			if (mCurrent == nullptr || padding + size > mRemaining) {
+				mCurrent = newChunk(CHUNK_SIZE);
+				mRemaining = CHUNK_SIZE;
+				padding = 0;
+			}
+			char* res = mCurrent + padding;
+			mCurrent = res + size;
+			mRemaining -= padding + size;
+			return res;
+		}
+
+		void deallocate(void* p, std::size_t size) {
+			assert(mLive > 0);
+			mLive--;
+			if (static_cast<char*>(p) + size == mCurrent) {
+				// The most recent block can be reused right away.
+				mCurrent = static_cast<char*>(p);
+				mRemaining += size;
+			}
+		}
+
+		/// Number of bytes requested from this arena so far.
+		std::size_t bytes() const {
+			return mBytes;
+		}
+		/// Number of chunks allocated by this arena.
+		std::size_t chunks() const {
+			return mChunks.size();
+		}
+	};
+
+	/**
+	 * Allocates from the arena that was active when the allocator was created, or from the heap if there was none.
+	 * Copies of containers use the arena that is active at the time of copying, hence copying is the way to move
+	 * data out of an arena.
+	 */
+	template<typename T>
+	class ArenaAllocator {
+		template<typename U>
+		friend class ArenaAllocator;
+	private:
+		ComputationArena* mArena;
+	public:
+		using value_type = T;
+		using propagate_on_container_copy_assignment = std::false_type;
+		using propagate_on_container_move_assignment = std::false_type;
+		using propagate_on_container_swap = std::true_type;
+
+		ArenaAllocator() noexcept: mArena(ComputationArena::active()) {}
+		template<typename U>
+		ArenaAllocator(const ArenaAllocator<U>& a) noexcept: mArena(a.mArena) {}
+
+		ArenaAllocator select_on_container_copy_construction() const {
+			return ArenaAllocator();
+		}
+
+		T* allocate(std::size_t n) {
+			if (mArena == nullptr) return std::allocator<T>().allocate(n);
+			return static_cast<T*>(mArena->allocate(n * sizeof(T), alignof(T)));
+		}
+		void deallocate(T* p, std::size_t n) {
+			if (mArena == nullptr) std::allocator<T>().deallocate(p, n);
+			else mArena->deallocate(p, n * sizeof(T));
+		}
+
+		/// Returns the arena this allocator allocates from, nullptr for the heap.
+		ComputationArena* arena() const {
+			return mArena;
+		}
+
+		template<typename U>
+		bool operator==(const ArenaAllocator<U>& a) const {
+			return mArena == a.mArena;
+		}
+		template<typename U>
+		bool operator!=(const ArenaAllocator<U>& a) const {
+			return mArena != a.mArena;
+		}
+	};
+
+	/**
+	 * Allocates from the heap and records every allocation in statistics().
+	 */
+	template<typename T>
+	class CountingAllocator {
+	public:
+		using value_type = T;
+
+		CountingAllocator() noexcept = default;
+		template<typename U>
+		CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+		T* allocate(std::size_t n) {
+			Statistics& stats = statistics();
+			stats.allocations++;
+			stats.bytes += n * sizeof(T);
+			return std::allocator<T>().allocate(n);
+		}
+		void deallocate(T* p, std::size_t n) {
+			statistics().deallocations++;
+			std::allocator<T>().deallocate(p, n);
+		}
+
+		template<typename U>
+		bool operator==(const CountingAllocator<U>&) const {
+			return true;
+		}
+		template<typename U>
+		bool operator!=(const CountingAllocator<U>&) const {
+			return false;
+		}
+	};
+
+	/**
+	 * Runs f within a fresh ComputationArena and returns a copy of its result that lives outside of the arena.
+	 * All temporaries of f are released at once afterwards.
+	 */
+	template<typename F>
+	auto inArena(F&& f) {
+		ComputationArena arena;
+		auto tmp = f();
+		arena.deactivate();
+		decltype(tmp) res(tmp);
+		return res;
+	}
+}
+
+/**
+ * Selects the allocator for the terms of a polynomial within StdMultivariatePolynomialPolicies.
+ * NoAllocator uses the standard allocator.
+ */
 struct NoAllocator
 {
-	
+	template<typename T>
+	using type = std::allocator<T>;
+};
+
+/// Allocates terms from the active allocation::ComputationArena, if any.
+struct ArenaAllocator
+{
+	template<typename T>
+	using type = allocation::ArenaAllocator<T>;
+};
+
+/// Counts the allocations of terms in allocation::statistics().
+struct CountingAllocator
+{
+	template<typename T>
+	using type = allocation::CountingAllocator<T>;
 };
-}
\ No newline at end of file
+}
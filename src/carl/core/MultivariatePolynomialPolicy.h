@@ -29,6 +29,10 @@ namespace carl
 		
 		// Easy access.
 		static const bool has_reasons = ReasonsAdaptor::has_reasons;
+
+		/// The allocator for the terms of a polynomial.
+		template<typename T>
+		using allocator = typename Allocator::template type<T>;
     };
 	
 }
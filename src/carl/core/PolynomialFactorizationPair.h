@@ -7,8 +7,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <map>
 #include <mutex>
+#include <vector>
 
 #include "Monomial.h"
 
@@ -277,8 +280,21 @@ namespace carl
          * Updates the hash.
          */
         void rehash() const;
+
+        template<typename P1>
+        friend std::size_t cacheExternalUsage( const PolynomialFactorizationPair<P1>& _pfPair, const std::function<std::size_t()>& _usage );
         
     };
+
+    /**
+     * The factorization of an irreducible polynomial consists of the polynomial itself, which holds a reference to its
+     * own cache entry. This reference does not keep the entry alive.
+     * @param _pfPair A cached polynomial-factorization pair.
+     * @param _usage Sums the usage counters of its cache entry, called while holding the lock of the pair.
+     * @return The number of references on the pair not held by the pair itself.
+     */
+    template<typename P>
+    std::size_t cacheExternalUsage( const PolynomialFactorizationPair<P>& _pfPair, const std::function<std::size_t()>& _usage );
     
     /**
      * Compute the polynomial from the given polynomial-factorization pair.
@@ -122,6 +122,20 @@ namespace carl
         delete mpPolynomial;
     }
 
+    template<typename P>
+    std::size_t cacheExternalUsage( const PolynomialFactorizationPair<P>& _pfPair, const std::function<std::size_t()>& _usage )
+    {
+        // The cache calls this while holding its own lock, hence blocking could deadlock with a refinement.
+        // A pair which is locked by another thread is in use.
+        std::unique_lock<std::recursive_mutex> lock( _pfPair.mMutex, std::try_to_lock );
+        if( !lock.owns_lock() )
+            return 1;
+        // The reference on itself is added under this lock, hence it is counted in the usage iff it is found here.
+        std::size_t usage = _usage();
+        std::size_t self = !_pfPair.mFactorization.empty() && _pfPair.factorizedTrivially() ? 1 : 0;
+        return usage - std::min( usage, self );
+    }
+
     template<typename P>
     void PolynomialFactorizationPair<P>::rehash() const
     {
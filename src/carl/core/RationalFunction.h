@@ -12,8 +12,27 @@
 
 #include <boost/optional.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
 namespace carl {
 
+/**
+ * A quotient of two polynomials.
+ *
+ * If AutoSimplify is true, common factors of the nominator and the denominator are eliminated after every operation.
+ * With deferSimplification, this is postponed until the rational function is observed, that is compared, hashed,
+ * printed or asked for its nominator or denominator, or until nominator and denominator together exceed
+ * deferThreshold terms. Sums of many rational functions thereby only compute a single gcd instead of one per
+ * addition. If Pol is a FactorizedPolynomial, common denominators are still obtained from the shared factorizations,
+ * otherwise the product of the denominators is used unless they are equal.
+ *
+ * A deferred simplification changes the representation of a const rational function. It is done under a lock, and
+ * raw reads of a rational function whose simplification is pending, e.g. copying it or using it as an operand, take
+ * the same lock. Hence a rational function may be shared between threads as long as it is not modified.
+ */
 template<typename Pol, bool AutoSimplify = false>
 class RationalFunction {
 public:
@@ -21,10 +40,56 @@ public:
 	using CoeffType = typename Pol::CoeffType;
 	using NumberType = typename Pol::NumberType;
 
+	/**
+	 * Postpone the elimination of common factors of rational functions with AutoSimplify until they are observed.
+	 * Observing a shared rational function from several threads is safe, but the switch itself must not be changed
+	 * while other threads use rational functions.
+	 */
+	static inline bool deferSimplification = false;
+	/// Number of terms of nominator and denominator at which a deferred simplification is done nevertheless.
+	static inline std::size_t deferThreshold = 64;
+
 private:
-	boost::optional<std::pair<Pol, Pol>> mPolynomialQuotient;
-	CoeffType mNumberQuotient;
-	bool mIsSimplified;
+	// Mutable, as a deferred simplification may happen when observing a rational function.
+	mutable boost::optional<std::pair<Pol, Pol>> mPolynomialQuotient;
+	mutable CoeffType mNumberQuotient;
+	mutable bool mIsSimplified;
+	/// Whether the elimination of common factors was postponed, it is only reset after the representation is final.
+	mutable std::atomic<bool> mDeferred{false};
+
+	/// The mutex guarding the deferred simplification of the given rational function.
+	static std::recursive_mutex& deferredMutex(const RationalFunction* rf) {
+		static std::array<std::recursive_mutex, 16> mutexes;
+		return mutexes[(reinterpret_cast<std::uintptr_t>(rf) / sizeof(RationalFunction)) % mutexes.size()];
+	}
+
+	/// Locks the representation against a concurrent deferred simplification, if one is pending.
+	std::unique_lock<std::recursive_mutex> lockDeferred() const {
+		if (!mDeferred.load(std::memory_order_acquire)) return std::unique_lock<std::recursive_mutex>();
+		return std::unique_lock<std::recursive_mutex>(deferredMutex(this));
+	}
+
+	/// Eliminates common factors if this was postponed.
+	void normalize() const {
+		if (!mDeferred.load(std::memory_order_acquire)) return;
+		std::lock_guard<std::recursive_mutex> lock(deferredMutex(this));
+		if (!mDeferred.load(std::memory_order_relaxed)) return;
+		eliminateCommonFactor(false);
+		mDeferred.store(false, std::memory_order_release);
+	}
+
+	/// The following accessors do not trigger a deferred simplification.
+	bool isRawConstant() const {
+		return !mPolynomialQuotient;
+	}
+	const Pol& rawNominator() const {
+		assert(!isRawConstant());
+		return mPolynomialQuotient->first;
+	}
+	const Pol& rawDenominator() const {
+		assert(!isRawConstant());
+		return mPolynomialQuotient->second;
+	}
 
 public:
 	RationalFunction()
@@ -71,8 +136,8 @@ public:
 			mIsSimplified = true;
 		} else {
 			mPolynomialQuotient = std::pair<Pol, Pol>(nom, denom);
-			eliminateCommonFactor(!AutoSimplify);
-			assert(isConstant() || !carl::isZero(denominatorAsPolynomial()));
+			simplifyAfterOperation();
+			assert(isRawConstant() || !carl::isZero(rawDenominator()));
 		}
 	}
 
@@ -80,8 +145,8 @@ public:
 		: mPolynomialQuotient(std::pair<Pol, Pol>(std::move(nom), std::move(denom))),
 		  mNumberQuotient(),
 		  mIsSimplified(false) {
-		eliminateCommonFactor(!AutoSimplify);
-		assert(isConstant() || !carl::isZero(denominatorAsPolynomial()));
+		simplifyAfterOperation();
+		assert(isRawConstant() || !carl::isZero(rawDenominator()));
 	}
 
 	explicit RationalFunction(boost::optional<std::pair<Pol, Pol>>&& quotient, const CoeffType& num, bool simplified)
@@ -89,20 +154,43 @@ public:
 		  mNumberQuotient(num),
 		  mIsSimplified(simplified) {}
 
-	RationalFunction(const RationalFunction& _rf) = default;
+	RationalFunction(const RationalFunction& _rf)
+		: mNumberQuotient(),
+		  mIsSimplified(true) {
+		*this = _rf;
+	}
 
-	RationalFunction(RationalFunction&& _rf) = default;
+	RationalFunction(RationalFunction&& _rf)
+		: mPolynomialQuotient(std::move(_rf.mPolynomialQuotient)),
+		  mNumberQuotient(std::move(_rf.mNumberQuotient)),
+		  mIsSimplified(_rf.mIsSimplified),
+		  mDeferred(_rf.mDeferred.load(std::memory_order_relaxed)) {}
 
 	~RationalFunction() noexcept = default;
 
-	RationalFunction& operator=(const RationalFunction& _rf) = default;
+	RationalFunction& operator=(const RationalFunction& _rf) {
+		if (this == &_rf) return *this;
+		auto lock = _rf.lockDeferred();
+		mPolynomialQuotient = _rf.mPolynomialQuotient;
+		mNumberQuotient = _rf.mNumberQuotient;
+		mIsSimplified = _rf.mIsSimplified;
+		mDeferred.store(_rf.mDeferred.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		return *this;
+	}
 
-	RationalFunction& operator=(RationalFunction&& _rf) = default;
+	RationalFunction& operator=(RationalFunction&& _rf) {
+		mPolynomialQuotient = std::move(_rf.mPolynomialQuotient);
+		mNumberQuotient = std::move(_rf.mNumberQuotient);
+		mIsSimplified = _rf.mIsSimplified;
+		mDeferred.store(_rf.mDeferred.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		return *this;
+	}
 
 	/**
 	 * @return The nominator
 	 */
 	Pol nominator() const {
+		normalize();
 		if (isConstant())
 			return Pol(carl::getNum(mNumberQuotient));
 		else
@@ -113,6 +201,7 @@ public:
 	 * @return  The denominator
 	 */
 	Pol denominator() const {
+		normalize();
 		if (isConstant())
 			return Pol(carl::getDenom(mNumberQuotient));
 		return mPolynomialQuotient->second;
@@ -122,23 +211,24 @@ public:
 	 * @return The nominator as a polynomial.
 	 */
 	const Pol& nominatorAsPolynomial() const {
-		assert(!isConstant());
-		return mPolynomialQuotient->first;
+		normalize();
+		return rawNominator();
 	}
 
 	/**
 	 * @return  The denominator as a polynomial.
 	 */
 	const Pol& denominatorAsPolynomial() const {
-		assert(!isConstant());
-		return mPolynomialQuotient->second;
+		normalize();
+		return rawDenominator();
 	}
 
 	/**
 	 * @return The nominator as a polynomial.
 	 */
 	CoeffType nominatorAsNumber() const {
-		assert(isConstant());
+		normalize();
+		assert(isRawConstant());
 		return carl::getNum(mNumberQuotient);
 	}
 
@@ -146,16 +236,18 @@ public:
 	 * @return  The denominator as a polynomial.
 	 */
 	CoeffType denominatorAsNumber() const {
-		assert(isConstant());
+		normalize();
+		assert(isRawConstant());
 		return carl::getDenom(mNumberQuotient);
 	}
 
 	/**
 	 * Checks if this rational function has been simplified since it's last modification.
-	 * Note that if AutoSimplify is true, this should always return true.
+	 * Note that if AutoSimplify is true, this should always return true unless the simplification was deferred.
 	 * @return If this is simplified.
 	 */
 	bool isSimplified() const {
+		auto lock = lockDeferred();
 		return mIsSimplified;
 	}
 
@@ -164,6 +256,7 @@ public:
 			CARL_LOG_WARN("carl.core", "Calling simplify on rational function with AutoSimplify");
 		}
 		eliminateCommonFactor(false);
+		mDeferred = false;
 	}
 
 	/**
@@ -172,10 +265,13 @@ public:
 	 */
 	RationalFunction inverse() const {
 		assert(!this->isZero());
-		if (isConstant()) {
+		auto lock = lockDeferred();
+		if (isRawConstant()) {
 			return RationalFunction(boost::none, 1 / mNumberQuotient, mIsSimplified);
 		} else {
-			return RationalFunction(boost::optional<std::pair<Pol, Pol>>(std::pair<Pol, Pol>(mPolynomialQuotient->second, mPolynomialQuotient->first)), carl::constant_zero<CoeffType>().get(), mIsSimplified);
+			RationalFunction res(boost::optional<std::pair<Pol, Pol>>(std::pair<Pol, Pol>(mPolynomialQuotient->second, mPolynomialQuotient->first)), carl::constant_zero<CoeffType>().get(), mIsSimplified);
+			res.mDeferred.store(mDeferred.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			return res;
 		}
 	}
 
@@ -184,10 +280,12 @@ public:
 	 * @return true if it is
 	 */
 	bool isZero() const {
-		if (isConstant())
+		// A zero nominator is already detected when normalizing.
+		auto lock = lockDeferred();
+		if (isRawConstant())
 			return carl::isZero(mNumberQuotient);
-		assert(!carl::isZero(denominatorAsPolynomial()));
-		return carl::isZero(nominatorAsPolynomial());
+		assert(!carl::isZero(rawDenominator()));
+		return carl::isZero(rawNominator());
 	}
 
 	bool isOne() const {
@@ -198,7 +296,8 @@ public:
 	}
 
 	bool isConstant() const {
-		return !mPolynomialQuotient;
+		normalize();
+		return isRawConstant();
 	}
 
 	CoeffType constantPart() const {
@@ -234,6 +333,7 @@ public:
 	 * @return The result of the substitution
 	 */
 	CoeffType evaluate(const std::map<Variable, CoeffType>& substitutions) const {
+		// Evaluating an unsimplified quotient may yield 0/0.
 		if (isConstant()) {
 			return mNumberQuotient;
 		} else {
@@ -242,10 +342,11 @@ public:
 	}
 
 	RationalFunction substitute(const std::map<Variable, CoeffType>& substitutions) const {
-		if (isConstant())
+		auto lock = lockDeferred();
+		if (isRawConstant())
 			return *this;
 		else {
-			return RationalFunction(nominatorAsPolynomial().substitute(substitutions), denominatorAsPolynomial().substitute(substitutions));
+			return RationalFunction(rawNominator().substitute(substitutions), rawDenominator().substitute(substitutions));
 		}
 	}
 
@@ -265,9 +366,13 @@ public:
 private:
 	/**
 	 * Helper function for simplify which eliminates the common factor.
+	 * It is const as it is also used for deferred simplifications, it only changes the representation.
 	 * @param _justNormalize
 	 */
-	void eliminateCommonFactor(bool _justNormalize);
+	void eliminateCommonFactor(bool _justNormalize) const;
+
+	/// Called after every operation: normalizes and eliminates common factors if AutoSimplify is true and this is not deferred.
+	void simplifyAfterOperation();
 
 	template<bool byInverse = false>
 	RationalFunction& add(const RationalFunction& rhs);
@@ -567,6 +672,7 @@ namespace std {
 template<typename Pol, bool AS>
 struct hash<carl::RationalFunction<Pol, AS>> {
 	std::size_t operator()(const carl::RationalFunction<Pol, AS>& r) const {
+		// isConstant() triggers a deferred simplification, hence equal rational functions have equal hashes.
 		if (r.isConstant())
 			return carl::hash_all(r.nominatorAsNumber(), r.denominatorAsNumber());
 		else
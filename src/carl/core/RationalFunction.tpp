@@ -16,7 +16,8 @@ namespace carl {
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS> RationalFunction<Pol, AS>::derivative(const Variable& x, unsigned nth) const {
 	assert(nth == 1);
-	if (isConstant()) {
+	auto lock = lockDeferred();
+	if (isRawConstant()) {
 		return RationalFunction<Pol, AS>(0);
 	}
 
@@ -24,39 +25,43 @@ RationalFunction<Pol, AS> RationalFunction<Pol, AS>::derivative(const Variable&
 	// TODO specialize if it is just a polynomial.
 	CARL_LOG_INEFFICIENT();
 	// (u/v)' = (u'v - uv')/(v^2)
-	const auto& u = nominatorAsPolynomial();
-	const auto& v = denominatorAsPolynomial();
+	const auto& u = rawNominator();
+	const auto& v = rawDenominator();
 	return RationalFunction<Pol, AS>(u.derivative(x) * v - u * v.derivative(x), v.pow(2));
 }
 
 template<typename Pol, bool AS>
-void RationalFunction<Pol, AS>::eliminateCommonFactor(bool _justNormalize) {
+void RationalFunction<Pol, AS>::eliminateCommonFactor(bool _justNormalize) const {
 	if (mIsSimplified) return;
-	assert(!isConstant());
-	if (carl::isZero(nominatorAsPolynomial())) {
+	assert(!isRawConstant());
+	if (carl::isZero(rawNominator())) {
 		mPolynomialQuotient.reset();
 		mNumberQuotient = std::move(CoeffType(0));
 		mIsSimplified = true;
 		return;
 	}
-	if (nominatorAsPolynomial() == denominatorAsPolynomial()) {
+	if (rawNominator() == rawDenominator()) {
 		mPolynomialQuotient.reset();
 		mNumberQuotient = std::move(CoeffType(1));
 		mIsSimplified = true;
 		return;
 	}
-	CoeffType cpFactorNom(std::move(nominatorAsPolynomial().coprimeFactor()));
-	CoeffType cpFactorDen(std::move(denominatorAsPolynomial().coprimeFactor()));
+	CoeffType cpFactorNom(std::move(rawNominator().coprimeFactor()));
+	CoeffType cpFactorDen(std::move(rawDenominator().coprimeFactor()));
 	mPolynomialQuotient->first *= cpFactorNom;
 	mPolynomialQuotient->second *= cpFactorDen;
 	CoeffType cpFactor(std::move(cpFactorDen / cpFactorNom));
-	if (!_justNormalize && !denominatorAsPolynomial().isConstant()) {
-		carl::gcd(nominatorAsPolynomial(), denominatorAsPolynomial());
-		auto ret = carl::lazyDiv(nominatorAsPolynomial(), denominatorAsPolynomial());
+	if (!_justNormalize && !rawDenominator().isConstant()) {
+		if (needs_cache<Pol>::value) {
+			// Refines the shared factorizations such that lazyDiv finds all common factors.
+			// For other polynomials, lazyDiv computes the gcd itself.
+			carl::gcd(rawNominator(), rawDenominator());
+		}
+		auto ret = carl::lazyDiv(rawNominator(), rawDenominator());
 		mPolynomialQuotient->first = std::move(ret.first);
 		mPolynomialQuotient->second = std::move(ret.second);
-		CoeffType cpFactorNom(nominatorAsPolynomial().coprimeFactor());
-		CoeffType cpFactorDen(denominatorAsPolynomial().coprimeFactor());
+		CoeffType cpFactorNom(rawNominator().coprimeFactor());
+		CoeffType cpFactorDen(rawDenominator().coprimeFactor());
 		mPolynomialQuotient->first *= cpFactorNom;
 		mPolynomialQuotient->second *= cpFactorDen;
 		cpFactor *= cpFactorDen / cpFactorNom;
@@ -64,78 +69,104 @@ void RationalFunction<Pol, AS>::eliminateCommonFactor(bool _justNormalize) {
 	}
 	mPolynomialQuotient->first *= carl::getNum(cpFactor);
 	mPolynomialQuotient->second *= carl::getDenom(cpFactor);
-	if (nominatorAsPolynomial().isConstant() && denominatorAsPolynomial().isConstant()) {
-		mNumberQuotient = std::move(constantPart());
+	if (rawNominator().isConstant() && rawDenominator().isConstant()) {
+		mNumberQuotient = rawNominator().constantPart() / rawDenominator().constantPart();
 		mPolynomialQuotient.reset();
 		mIsSimplified = true;
 	}
 }
 
+template<typename Pol, bool AS>
+void RationalFunction<Pol, AS>::simplifyAfterOperation() {
+	if (AS && deferSimplification && rawNominator().size() + rawDenominator().size() <= deferThreshold) {
+		eliminateCommonFactor(true);
+		mDeferred = !mIsSimplified;
+	} else {
+		eliminateCommonFactor(!AS);
+		mDeferred = false;
+	}
+}
+
 template<typename Pol, bool AS>
 template<bool byInverse>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const RationalFunction<Pol, AS>& rhs) {
-	if (this->isConstant() && rhs.isConstant()) {
+	auto lock = rhs.lockDeferred();
+	if (this->isRawConstant() && rhs.isRawConstant()) {
 		if (byInverse)
 			this->mNumberQuotient -= rhs.mNumberQuotient;
 		else
 			this->mNumberQuotient += rhs.mNumberQuotient;
 		return *this;
-	} else if (this->isConstant()) {
+	} else if (this->isRawConstant()) {
 		CoeffType c = this->mNumberQuotient;
 		if (byInverse)
 			*this = -rhs;
 		else
 			*this = rhs;
 		return *this += c;
-	} else if (rhs.isConstant()) {
+	} else if (rhs.isRawConstant()) {
 		if (byInverse)
 			return *this -= rhs.mNumberQuotient;
 		else
 			return *this += rhs.mNumberQuotient;
 	}
 	mIsSimplified = false;
-	if (denominatorAsPolynomial().isConstant() && rhs.denominatorAsPolynomial().isConstant()) {
-		mPolynomialQuotient->first *= rhs.denominatorAsPolynomial().constantPart();
+	if (rawDenominator().isConstant() && rhs.rawDenominator().isConstant()) {
+		mPolynomialQuotient->first *= rhs.rawDenominator().constantPart();
 		if (byInverse)
-			mPolynomialQuotient->first -= rhs.nominatorAsPolynomial() * denominatorAsPolynomial().constantPart();
+			mPolynomialQuotient->first -= rhs.rawNominator() * rawDenominator().constantPart();
 		else
-			mPolynomialQuotient->first += rhs.nominatorAsPolynomial() * denominatorAsPolynomial().constantPart();
-		mPolynomialQuotient->second *= rhs.denominatorAsPolynomial().constantPart();
+			mPolynomialQuotient->first += rhs.rawNominator() * rawDenominator().constantPart();
+		mPolynomialQuotient->second *= rhs.rawDenominator().constantPart();
 	} else {
-		if (denominatorAsPolynomial().isConstant()) {
+		if (rawDenominator().isConstant()) {
 			// TODO use more efficient elimination
-			mPolynomialQuotient->first *= rhs.denominatorAsPolynomial();
+			mPolynomialQuotient->first *= rhs.rawDenominator();
 			if (byInverse)
-				mPolynomialQuotient->first -= rhs.nominatorAsPolynomial() * denominatorAsPolynomial().constantPart();
+				mPolynomialQuotient->first -= rhs.rawNominator() * rawDenominator().constantPart();
 			else
-				mPolynomialQuotient->first += rhs.nominatorAsPolynomial() * denominatorAsPolynomial().constantPart();
+				mPolynomialQuotient->first += rhs.rawNominator() * rawDenominator().constantPart();
 			// TODO use info that it is faster
-			mPolynomialQuotient->second *= rhs.denominatorAsPolynomial();
-		} else if (rhs.denominatorAsPolynomial().isConstant()) {
-			mPolynomialQuotient->first *= rhs.denominatorAsPolynomial().constantPart();
+			mPolynomialQuotient->second *= rhs.rawDenominator();
+		} else if (rhs.rawDenominator().isConstant()) {
+			mPolynomialQuotient->first *= rhs.rawDenominator().constantPart();
+			if (byInverse)
+				mPolynomialQuotient->first -= rhs.rawNominator() * rawDenominator();
+			else
+				mPolynomialQuotient->first += rhs.rawNominator() * rawDenominator();
+			mPolynomialQuotient->second *= rhs.rawDenominator().constantPart();
+		} else if (rawDenominator() == rhs.rawDenominator()) {
 			if (byInverse)
-				mPolynomialQuotient->first -= rhs.nominatorAsPolynomial() * denominatorAsPolynomial();
+				mPolynomialQuotient->first -= rhs.rawNominator();
 			else
-				mPolynomialQuotient->first += rhs.nominatorAsPolynomial() * denominatorAsPolynomial();
-			mPolynomialQuotient->second *= rhs.denominatorAsPolynomial().constantPart();
+				mPolynomialQuotient->first += rhs.rawNominator();
+		} else if (AS && deferSimplification && !needs_cache<Pol>::value) {
+			// Computing the lcm needs a gcd, the common factors are eliminated later on anyway.
+			mPolynomialQuotient->first *= rhs.rawDenominator();
+			if (byInverse)
+				mPolynomialQuotient->first -= rhs.rawNominator() * rawDenominator();
+			else
+				mPolynomialQuotient->first += rhs.rawNominator() * rawDenominator();
+			mPolynomialQuotient->second *= rhs.rawDenominator();
 		} else {
-			Pol leastCommonMultiple(std::move(carl::lcm(this->denominatorAsPolynomial(), rhs.denominatorAsPolynomial())));
+			// For factorized polynomials, the lcm is mostly obtained by matching the factors.
+			Pol leastCommonMultiple(std::move(carl::lcm(this->rawDenominator(), rhs.rawDenominator())));
 			if (byInverse) {
-				mPolynomialQuotient->first = std::move(this->nominatorAsPolynomial() * quotient(leastCommonMultiple, this->denominatorAsPolynomial()) - rhs.nominatorAsPolynomial() * quotient(leastCommonMultiple, rhs.denominatorAsPolynomial()));
+				mPolynomialQuotient->first = std::move(this->rawNominator() * quotient(leastCommonMultiple, this->rawDenominator()) - rhs.rawNominator() * quotient(leastCommonMultiple, rhs.rawDenominator()));
 			} else {
-				mPolynomialQuotient->first = std::move(this->nominatorAsPolynomial() * quotient(leastCommonMultiple, this->denominatorAsPolynomial()) + rhs.nominatorAsPolynomial() * quotient(leastCommonMultiple, rhs.denominatorAsPolynomial()));
+				mPolynomialQuotient->first = std::move(this->rawNominator() * quotient(leastCommonMultiple, this->rawDenominator()) + rhs.rawNominator() * quotient(leastCommonMultiple, rhs.rawDenominator()));
 			}
 			mPolynomialQuotient->second = std::move(leastCommonMultiple);
 		}
 	}
-	eliminateCommonFactor(!AS);
+	simplifyAfterOperation();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 template<bool byInverse>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const Pol& rhs) {
-	if (this->isConstant()) {
+	if (this->isRawConstant()) {
 		CoeffType c = this->mNumberQuotient;
 		Pol resultNum(std::move(byInverse ? (rhs * CoeffType(getDenom(c)) - CoeffType(getNum(c))) : (rhs * CoeffType(getDenom(c)) + CoeffType(getNum(c)))));
 		*this = std::move(RationalFunction<Pol, AS>(std::move(resultNum), std::move(Pol(CoeffType(getDenom(c))))));
@@ -143,17 +174,17 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const Pol& rhs) {
 	}
 	mIsSimplified = false;
 	if (byInverse)
-		mPolynomialQuotient->first -= std::move(rhs * denominatorAsPolynomial());
+		mPolynomialQuotient->first -= std::move(rhs * rawDenominator());
 	else
-		mPolynomialQuotient->first += std::move(rhs * denominatorAsPolynomial());
-	eliminateCommonFactor(!AS);
+		mPolynomialQuotient->first += std::move(rhs * rawDenominator());
+	simplifyAfterOperation();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 template<bool byInverse, typename P, DisableIf<needs_cache<P>>>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(Variable rhs) {
-	if (this->isConstant()) {
+	if (this->isRawConstant()) {
 		CoeffType c(this->mNumberQuotient);
 		Pol resultNum(rhs);
 		resultNum *= CoeffType(getDenom(c));
@@ -166,17 +197,17 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(Variable rhs) {
 	}
 	mIsSimplified = false;
 	if (byInverse)
-		mPolynomialQuotient->first -= std::move(rhs * denominatorAsPolynomial());
+		mPolynomialQuotient->first -= std::move(rhs * rawDenominator());
 	else
-		mPolynomialQuotient->first += std::move(rhs * denominatorAsPolynomial());
-	eliminateCommonFactor(!AS);
+		mPolynomialQuotient->first += std::move(rhs * rawDenominator());
+	simplifyAfterOperation();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 template<bool byInverse>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const typename Pol::CoeffType& rhs) {
-	if (this->isConstant()) {
+	if (this->isRawConstant()) {
 		if (byInverse)
 			this->mNumberQuotient -= rhs;
 		else
@@ -185,35 +216,36 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const typename Pol::Co
 	}
 	mIsSimplified = false;
 	if (byInverse)
-		mPolynomialQuotient->first -= std::move(rhs * denominatorAsPolynomial());
+		mPolynomialQuotient->first -= std::move(rhs * rawDenominator());
 	else
-		mPolynomialQuotient->first += std::move(rhs * denominatorAsPolynomial());
-	eliminateCommonFactor(!AS);
+		mPolynomialQuotient->first += std::move(rhs * rawDenominator());
+	simplifyAfterOperation();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(const RationalFunction<Pol, AS>& rhs) {
-	if (this->isConstant() && rhs.isConstant()) {
+	auto lock = rhs.lockDeferred();
+	if (this->isRawConstant() && rhs.isRawConstant()) {
 		this->mNumberQuotient *= rhs.mNumberQuotient;
 		return *this;
-	} else if (this->isConstant()) {
+	} else if (this->isRawConstant()) {
 		CoeffType c(this->mNumberQuotient);
 		*this = rhs;
 		return *this *= c;
-	} else if (rhs.isConstant()) {
+	} else if (rhs.isRawConstant()) {
 		return *this *= rhs.mNumberQuotient;
 	}
 	mIsSimplified = false;
-	mPolynomialQuotient->first *= rhs.nominatorAsPolynomial();
-	mPolynomialQuotient->second *= rhs.denominatorAsPolynomial();
-	eliminateCommonFactor(!AS);
+	mPolynomialQuotient->first *= rhs.rawNominator();
+	mPolynomialQuotient->second *= rhs.rawDenominator();
+	simplifyAfterOperation();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(const Pol& rhs) {
-	if (this->isConstant()) {
+	if (this->isRawConstant()) {
 		CoeffType c = this->mNumberQuotient;
 		Pol resultNum(rhs);
 		resultNum *= CoeffType(getNum(c));
@@ -222,14 +254,14 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(const Pol& rhs)
 	}
 	mIsSimplified = false;
 	mPolynomialQuotient->first *= rhs;
-	eliminateCommonFactor(!AS);
+	simplifyAfterOperation();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 template<typename P, DisableIf<needs_cache<P>>>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(Variable rhs) {
-	if (this->isConstant()) {
+	if (this->isRawConstant()) {
 		CoeffType c(this->mNumberQuotient);
 		Pol resultNum(rhs);
 		resultNum *= CoeffType(getNum(c));
@@ -238,20 +270,20 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(Variable rhs) {
 	}
 	mIsSimplified = false;
 	mPolynomialQuotient->first *= rhs;
-	eliminateCommonFactor(!AS);
+	simplifyAfterOperation();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(const typename Pol::CoeffType& rhs) {
 	// TODO handle rhs == 0
-	if (this->isConstant()) {
+	if (this->isRawConstant()) {
 		this->mNumberQuotient *= rhs;
 		return *this;
 	}
 	mIsSimplified = false;
 	mPolynomialQuotient->first *= rhs;
-	eliminateCommonFactor(!AS);
+	simplifyAfterOperation();
 	return *this;
 }
 
@@ -262,29 +294,30 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(carl::sint rhs)
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const RationalFunction<Pol, AS>& rhs) {
-	if (this->isConstant() && rhs.isConstant()) {
+	auto lock = rhs.lockDeferred();
+	if (this->isRawConstant() && rhs.isRawConstant()) {
 		this->mNumberQuotient /= rhs.mNumberQuotient;
 		return *this;
-	} else if (this->isConstant()) {
+	} else if (this->isRawConstant()) {
 		CoeffType c(this->mNumberQuotient);
 		*this = rhs.inverse();
 		return *this *= c;
-	} else if (rhs.isConstant()) {
+	} else if (rhs.isRawConstant()) {
 		return *this /= rhs.mNumberQuotient;
 	}
 	mIsSimplified = false;
-	if (carl::isOne(rhs.denominatorAsPolynomial())) {
-		return *this /= rhs.nominatorAsPolynomial();
+	if (carl::isOne(rhs.rawDenominator())) {
+		return *this /= rhs.rawNominator();
 	}
-	mPolynomialQuotient->first *= rhs.denominatorAsPolynomial();
-	mPolynomialQuotient->second *= rhs.nominatorAsPolynomial();
-	eliminateCommonFactor(!AS);
+	mPolynomialQuotient->first *= rhs.rawDenominator();
+	mPolynomialQuotient->second *= rhs.rawNominator();
+	simplifyAfterOperation();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const Pol& rhs) {
-	if (this->isConstant()) {
+	if (this->isRawConstant()) {
 		CoeffType c(this->mNumberQuotient);
 		Pol resultNum(rhs);
 		resultNum *= CoeffType(getDenom(c));
@@ -296,7 +329,7 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const Pol& rhs)
 		mPolynomialQuotient->first /= rhs.constantPart();
 	} else {
 		mPolynomialQuotient->second *= rhs;
-		eliminateCommonFactor(!AS);
+		simplifyAfterOperation();
 	}
 	return *this;
 }
@@ -304,7 +337,7 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const Pol& rhs)
 template<typename Pol, bool AS>
 template<typename P, DisableIf<needs_cache<P>>>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(Variable rhs) {
-	if (this->isConstant()) {
+	if (this->isRawConstant()) {
 		CoeffType c(this->mNumberQuotient);
 		Pol resultNum(rhs);
 		resultNum *= CoeffType(getDenom(c));
@@ -313,13 +346,13 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(Variable rhs) {
 	}
 	mIsSimplified = false;
 	mPolynomialQuotient->second *= rhs;
-	eliminateCommonFactor(!AS);
+	simplifyAfterOperation();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(unsigned long rhs) {
-	if (this->isConstant()) {
+	if (this->isRawConstant()) {
 		this->mNumberQuotient /= CoeffType(rhs);
 		return *this;
 	}
@@ -330,7 +363,7 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(unsigned long r
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const typename Pol::CoeffType& rhs) {
-	if (this->isConstant()) {
+	if (this->isRawConstant()) {
 		this->mNumberQuotient /= rhs;
 		return *this;
 	}
@@ -341,35 +374,40 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const typename
 
 template<typename Pol, bool AS>
 bool operator==(const RationalFunction<Pol, AS>& lhs, const RationalFunction<Pol, AS>& rhs) {
-	if (lhs.isConstant()) {
-		if (rhs.isConstant())
+	lhs.normalize();
+	rhs.normalize();
+	if (lhs.isRawConstant()) {
+		if (rhs.isRawConstant())
 			return lhs.mNumberQuotient == rhs.mNumberQuotient;
 		else
 			return false;
 	}
-	if (rhs.isConstant())
+	if (rhs.isRawConstant())
 		return false;
-	return lhs.nominatorAsPolynomial() == rhs.nominatorAsPolynomial() && lhs.denominatorAsPolynomial() == rhs.denominatorAsPolynomial();
+	return lhs.rawNominator() == rhs.rawNominator() && lhs.rawDenominator() == rhs.rawDenominator();
 }
 
 template<typename Pol, bool AS>
 bool operator<(const RationalFunction<Pol, AS>& lhs, const RationalFunction<Pol, AS>& rhs) {
-	if (lhs.isConstant()) {
-		if (rhs.isConstant())
+	lhs.normalize();
+	rhs.normalize();
+	if (lhs.isRawConstant()) {
+		if (rhs.isRawConstant())
 			return lhs.mNumberQuotient < rhs.mNumberQuotient;
 		else
 			return true;
 	}
-	if (rhs.isConstant())
+	if (rhs.isRawConstant())
 		return false;
-	return lhs.nominatorAsPolynomial() * rhs.denominatorAsPolynomial() < rhs.nominatorAsPolynomial() * lhs.denominatorAsPolynomial();
+	return lhs.rawNominator() * rhs.rawDenominator() < rhs.rawNominator() * lhs.rawDenominator();
 }
 
 template<typename Pol, bool AS>
 std::string RationalFunction<Pol, AS>::toString(bool infix, bool friendlyNames) const {
+	normalize();
 
-	std::string numeratorString = isConstant() ? carl::toString(nominatorAsNumber()) : nominatorAsPolynomial().toString(infix, friendlyNames);
-	std::string denominatorString = isConstant() ? carl::toString(denominatorAsNumber()) : denominatorAsPolynomial().toString(infix, friendlyNames);
+	std::string numeratorString = isRawConstant() ? carl::toString(nominatorAsNumber()) : rawNominator().toString(infix, friendlyNames);
+	std::string denominatorString = isRawConstant() ? carl::toString(denominatorAsNumber()) : rawDenominator().toString(infix, friendlyNames);
 
 	if (denominator().isOne()) {
 		return numeratorString;
@@ -384,8 +422,9 @@ std::string RationalFunction<Pol, AS>::toString(bool infix, bool friendlyNames)
 
 template<typename Pol, bool AS>
 std::ostream& operator<<(std::ostream& os, const RationalFunction<Pol, AS>& rhs) {
-	if (rhs.isConstant())
+	rhs.normalize();
+	if (rhs.isRawConstant())
 		return os << rhs.mNumberQuotient;
-	return os << "(" << rhs.nominatorAsPolynomial() << ")/(" << rhs.denominatorAsPolynomial() << ")";
+	return os << "(" << rhs.rawNominator() << ")/(" << rhs.rawDenominator() << ")";
 }
 } // namespace carl
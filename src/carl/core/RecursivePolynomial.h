@@ -0,0 +1,523 @@
+/**
+ * @file RecursivePolynomial.h
+ * @ingroup multirp
+ *
+ * A sparse recursive representation of multivariate polynomials together with the algorithms that recurse on the
+ * main variable: pseudo-remainders, exact division, contents, gcds and resultants.
+ */
+
+#pragma once
+
+#include "../numbers/numbers.h"
+#include "Monomial.h"
+#include "MultivariatePolynomial.h"
+#include "UnivariatePolynomial.h"
+#include "Variable.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A polynomial in sparse recursive representation.
+ *
+ * A polynomial is either a number or a polynomial in its main variable, whose coefficients are again recursive
+ * polynomials in strictly smaller variables with respect to the order of Variable. Hence the main variable is always
+ * the largest variable of the polynomial. Only nonzero coefficients are stored, sorted by their exponents.
+ * The representation is canonical: if the main variable only occurs with exponent zero, the polynomial is that
+ * coefficient itself.
+ *
+ * As opposed to UnivariatePolynomial<MultivariatePolynomial>, coefficients are never converted to the distributed
+ * form, hence recursive algorithms like gcd() and resultant() neither sort nor pool any terms.
+ * The algorithms assume that Number is a field, e.g. mpq_class.
+ */
+template<typename Number>
+class RecursivePolynomial {
+public:
+	/// A coefficient together with the exponent of the main variable.
+	using TermType = std::pair<exponent, RecursivePolynomial>;
+private:
+	/// The main variable, NO_VARIABLE for numbers.
+	Variable mVar = Variable::NO_VARIABLE;
+	/// The value of a nonzero number, empty for zero and for polynomials such that inner nodes do not carry a number.
+	std::optional<Number> mConstant;
+	/// The nonzero coefficients ordered by increasing exponents, empty for numbers.
+	std::vector<TermType> mTerms;
+
+	/// Restores the invariants after the terms have been modified.
+	void normalize() {
+		mTerms.erase(std::remove_if(mTerms.begin(), mTerms.end(), [](const TermType& t){ return t.second.isZero(); }), mTerms.end());
+		if (mTerms.empty()) {
+			*this = RecursivePolynomial();
+		} else if (mTerms.size() == 1 && mTerms.front().first == 0) {
+			RecursivePolynomial c = std::move(mTerms.front().second);
+			*this = std::move(c);
+		}
+	}
+
+	/// A term of a distributed polynomial whose exponent vector is truncated to its first length entries.
+	struct DistributedTerm {
+		const Number* coeff;
+		const Monomial::Content* content;
+		std::size_t length;
+	};
+
+	/// Groups the terms by the exponent of the largest variable and recurses on the groups.
+	static RecursivePolynomial build(std::vector<DistributedTerm>& terms) {
+		Variable v = Variable::NO_VARIABLE;
+		for (const auto& t: terms) {
+			if (t.length > 0) v = std::max(v, (*t.content)[t.length - 1].first);
+		}
+		if (v == Variable::NO_VARIABLE) {
+			Number sum = constant_zero<Number>::get();
+			for (const auto& t: terms) sum += *t.coeff;
+			return RecursivePolynomial(sum);
+		}
+		std::map<exponent, std::vector<DistributedTerm>> groups;
+		for (const auto& t: terms) {
+			if (t.length > 0 && (*t.content)[t.length - 1].first == v) {
+				groups[(*t.content)[t.length - 1].second].push_back(DistributedTerm{ t.coeff, t.content, t.length - 1 });
+			} else {
+				groups[0].push_back(t);
+			}
+		}
+		RecursivePolynomial res;
+		res.mVar = v;
+		for (auto& g: groups) {
+			res.mTerms.emplace_back(g.first, build(g.second));
+		}
+		res.normalize();
+		return res;
+	}
+
+	/// Adds rhs, or subtracts it if negate is set, without creating a negated copy of rhs.
+	RecursivePolynomial& add(const RecursivePolynomial& rhs, bool negate) {
+		if (rhs.isZero()) return *this;
+		if (isZero()) return *this = negate ? -rhs : rhs;
+		if (mVar < rhs.mVar) {
+			RecursivePolynomial res = negate ? -rhs : rhs;
+			res += *this;
+			return *this = std::move(res);
+		}
+		if (mVar == rhs.mVar) {
+			if (isNumber()) {
+				if (negate) *mConstant -= *rhs.mConstant;
+				else *mConstant += *rhs.mConstant;
+				if (carl::isZero(*mConstant)) mConstant.reset();
+				return *this;
+			}
+			std::vector<TermType> res;
+			res.reserve(mTerms.size() + rhs.mTerms.size());
+			auto it = rhs.mTerms.begin();
+			auto copy = [negate](const TermType& t){ return negate ? TermType(t.first, -t.second) : t; };
+			for (auto& t: mTerms) {
+				for (; it != rhs.mTerms.end() && it->first < t.first; ++it) res.push_back(copy(*it));
+				if (it != rhs.mTerms.end() && it->first == t.first) {
+					t.second.add(it->second, negate);
+					++it;
+				}
+				res.push_back(std::move(t));
+			}
+			for (; it != rhs.mTerms.end(); ++it) res.push_back(copy(*it));
+			mTerms = std::move(res);
+			normalize();
+			return *this;
+		}
+		// rhs is a coefficient with respect to the main variable.
+		if (mTerms.front().first == 0) {
+			mTerms.front().second.add(rhs, negate);
+			normalize();
+		} else {
+			mTerms.insert(mTerms.begin(), TermType(0, negate ? -rhs : rhs));
+		}
+		return *this;
+	}
+
+public:
+	/// Constructs zero.
+	RecursivePolynomial() = default;
+
+	explicit RecursivePolynomial(const Number& n) {
+		if (!carl::isZero(n)) mConstant = n;
+	}
+
+	/// Constructs the polynomial v^e.
+	explicit RecursivePolynomial(Variable v, exponent e = 1) {
+		if (e == 0) {
+			mConstant = constant_one<Number>::get();
+		} else {
+			mVar = v;
+			mTerms.emplace_back(e, RecursivePolynomial(constant_one<Number>::get()));
+		}
+	}
+
+	/**
+	 * Constructs a polynomial in v from its coefficients.
+	 * The coefficients must not contain variables larger or equal to v, terms with equal exponents are added.
+	 */
+	RecursivePolynomial(Variable v, std::vector<TermType>&& terms): mVar(v), mTerms(std::move(terms)) {
+		assert(v != Variable::NO_VARIABLE);
+		std::sort(mTerms.begin(), mTerms.end(), [](const TermType& a, const TermType& b){ return a.first < b.first; });
+		std::vector<TermType> merged;
+		for (auto& t: mTerms) {
+			assert(t.second.mainVar() < v);
+			if (!merged.empty() && merged.back().first == t.first) merged.back().second += t.second;
+			else merged.push_back(std::move(t));
+		}
+		mTerms = std::move(merged);
+		normalize();
+	}
+
+	/// Converts a distributed polynomial, without creating any intermediate monomials.
+	template<typename O, typename P>
+	explicit RecursivePolynomial(const MultivariatePolynomial<Number, O, P>& p) {
+		static const Monomial::Content empty;
+		std::vector<DistributedTerm> terms;
+		terms.reserve(p.nrTerms());
+		for (const auto& t: p) {
+			const Monomial::Content* content = t.monomial() ? &t.monomial()->exponents() : &empty;
+			terms.push_back(DistributedTerm{ &t.coeff(), content, content->size() });
+		}
+		*this = build(terms);
+	}
+
+	/// Converts a univariate polynomial whose coefficients do not contain variables larger or equal to its main variable.
+	template<typename Poly>
+	explicit RecursivePolynomial(const UnivariatePolynomial<Poly>& p) {
+		std::vector<TermType> terms;
+		for (std::size_t e = 0; e < p.coefficients().size(); ++e) {
+			if (carl::isZero(p.coefficients()[e])) continue;
+			terms.emplace_back(exponent(e), RecursivePolynomial(p.coefficients()[e]));
+		}
+		if (terms.empty()) return;
+		*this = RecursivePolynomial(p.mainVar(), std::move(terms));
+	}
+
+	/// The main variable, i.e. the largest variable, or NO_VARIABLE for numbers.
+	Variable mainVar() const {
+		return mVar;
+	}
+	bool isNumber() const {
+		return mVar == Variable::NO_VARIABLE;
+	}
+	bool isZero() const {
+		return isNumber() && !mConstant;
+	}
+	bool isOne() const {
+		return isNumber() && mConstant && carl::isOne(*mConstant);
+	}
+	/// The value of a number.
+	const Number& constantPart() const {
+		assert(isNumber());
+		static const Number zero = constant_zero<Number>::get();
+		return mConstant ? *mConstant : zero;
+	}
+	/// The degree in the main variable, zero for numbers.
+	exponent degree() const {
+		return isNumber() ? 0 : mTerms.back().first;
+	}
+	/// The degree in v, provided that v is not smaller than the main variable.
+	exponent degree(Variable v) const {
+		assert(mVar <= v);
+		return mVar == v ? degree() : 0;
+	}
+	/// The nonzero coefficients with respect to the main variable.
+	const std::vector<TermType>& terms() const {
+		return mTerms;
+	}
+	/// The leading coefficient with respect to the main variable, the number itself for numbers.
+	const RecursivePolynomial& lcoeff() const {
+		return isNumber() ? *this : mTerms.back().second;
+	}
+	/// The leading coefficient with respect to v, provided that v is not smaller than the main variable.
+	const RecursivePolynomial& lcoeff(Variable v) const {
+		assert(mVar <= v);
+		return mVar == v ? lcoeff() : *this;
+	}
+	/// The coefficient of the leading term with respect to the recursive order.
+	const Number& numericLcoeff() const {
+		return isNumber() ? constantPart() : lcoeff().numericLcoeff();
+	}
+
+	/// Converts to the distributed representation.
+	template<typename Poly>
+	Poly toMultivariatePolynomial() const {
+		if (isNumber()) return Poly(constantPart());
+		Poly res;
+		for (const auto& t: mTerms) {
+			Poly c = t.second.template toMultivariatePolynomial<Poly>();
+			if (t.first > 0) c *= Poly(Term<Number>(constant_one<Number>::get(), mVar, t.first));
+			res += c;
+		}
+		return res;
+	}
+
+	/// Converts to a univariate polynomial in the main variable, which must not be a number.
+	template<typename Poly>
+	UnivariatePolynomial<Poly> toUnivariatePolynomial() const {
+		assert(!isNumber());
+		std::vector<Poly> coeffs(degree() + 1);
+		for (const auto& t: mTerms) {
+			coeffs[t.first] = t.second.template toMultivariatePolynomial<Poly>();
+		}
+		return UnivariatePolynomial<Poly>(mVar, std::move(coeffs));
+	}
+
+	RecursivePolynomial operator-() const {
+		RecursivePolynomial res(*this);
+		if (res.mConstant) *res.mConstant = -*res.mConstant;
+		for (auto& t: res.mTerms) t.second = -t.second;
+		return res;
+	}
+
+	RecursivePolynomial& operator+=(const RecursivePolynomial& rhs) {
+		return add(rhs, false);
+	}
+	RecursivePolynomial& operator-=(const RecursivePolynomial& rhs) {
+		return add(rhs, true);
+	}
+	RecursivePolynomial& operator*=(const Number& rhs) {
+		if (carl::isZero(rhs)) return *this = RecursivePolynomial();
+		if (mConstant) *mConstant *= rhs;
+		for (auto& t: mTerms) t.second *= rhs;
+		return *this;
+	}
+	RecursivePolynomial& operator*=(const RecursivePolynomial& rhs) {
+		return *this = *this * rhs;
+	}
+
+	friend RecursivePolynomial operator+(RecursivePolynomial lhs, const RecursivePolynomial& rhs) {
+		return lhs += rhs;
+	}
+	friend RecursivePolynomial operator-(RecursivePolynomial lhs, const RecursivePolynomial& rhs) {
+		return lhs -= rhs;
+	}
+	friend RecursivePolynomial operator*(RecursivePolynomial lhs, const Number& rhs) {
+		return lhs *= rhs;
+	}
+	friend RecursivePolynomial operator*(const RecursivePolynomial& lhs, const RecursivePolynomial& rhs) {
+		if (lhs.isZero() || rhs.isZero()) return RecursivePolynomial();
+		if (lhs.mVar < rhs.mVar) return rhs * lhs;
+		if (rhs.isNumber()) return lhs * *rhs.mConstant;
+		RecursivePolynomial res;
+		res.mVar = lhs.mVar;
+		if (lhs.mVar > rhs.mVar) {
+			// rhs is a coefficient with respect to the main variable, products of nonzero polynomials are nonzero.
+			res.mTerms.reserve(lhs.mTerms.size());
+			for (const auto& t: lhs.mTerms) res.mTerms.emplace_back(t.first, t.second * rhs);
+			return res;
+		}
+		// The degrees are small, hence the products are accumulated densely.
+		std::vector<RecursivePolynomial> products(lhs.degree() + rhs.degree() + 1);
+		for (const auto& l: lhs.mTerms) {
+			for (const auto& r: rhs.mTerms) {
+				products[l.first + r.first] += l.second * r.second;
+			}
+		}
+		for (std::size_t e = 0; e < products.size(); ++e) {
+			if (!products[e].isZero()) res.mTerms.emplace_back(exponent(e), std::move(products[e]));
+		}
+		res.normalize();
+		return res;
+	}
+
+	friend bool operator==(const RecursivePolynomial& lhs, const RecursivePolynomial& rhs) {
+		if (lhs.mVar != rhs.mVar) return false;
+		if (lhs.isNumber()) return lhs.mConstant == rhs.mConstant;
+		return lhs.mTerms == rhs.mTerms;
+	}
+	friend bool operator!=(const RecursivePolynomial& lhs, const RecursivePolynomial& rhs) {
+		return !(lhs == rhs);
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const RecursivePolynomial& p) {
+		if (p.isNumber()) return os << p.constantPart();
+		bool first = true;
+		for (auto it = p.mTerms.rbegin(); it != p.mTerms.rend(); ++it) {
+			if (!first) os << " + ";
+			first = false;
+			os << "(" << it->second << ")";
+			if (it->first > 0) os << "*" << p.mVar << "^" << it->first;
+		}
+		return os;
+	}
+};
+
+template<typename Number>
+RecursivePolynomial<Number> pow(const RecursivePolynomial<Number>& p, exponent e) {
+	RecursivePolynomial<Number> res(constant_one<Number>::get());
+	RecursivePolynomial<Number> base = p;
+	while (e > 0) {
+		if (e % 2 == 1) res *= base;
+		e /= 2;
+		if (e > 0) base *= base;
+	}
+	return res;
+}
+
+namespace recursive_detail {
+	/// Returns c * v^e, where c must not contain variables larger or equal to v.
+	template<typename Number>
+	RecursivePolynomial<Number> shift(const RecursivePolynomial<Number>& c, Variable v, exponent e) {
+		if (e == 0 || c.isZero()) return c;
+		std::vector<typename RecursivePolynomial<Number>::TermType> terms;
+		terms.emplace_back(e, c);
+		return RecursivePolynomial<Number>(v, std::move(terms));
+	}
+}
+
+/**
+ * Computes the pseudo-remainder of a divided by b with respect to the main variable x of b, that is
+ * lcoeff(b)^(deg(a)-deg(b)+1) * a modulo b, or a itself if deg(a) < deg(b).
+ * The main variable of a must not be larger than x.
+ */
+template<typename Number>
+RecursivePolynomial<Number> prem(const RecursivePolynomial<Number>& a, const RecursivePolynomial<Number>& b) {
+	assert(!b.isZero());
+	Variable x = b.mainVar();
+	assert(a.mainVar() <= x);
+	exponent db = b.degree();
+	if (a.degree(x) < db) return a;
+	const RecursivePolynomial<Number>& lb = b.lcoeff();
+	exponent k = a.degree(x) - db + 1;
+	RecursivePolynomial<Number> r = a;
+	while (!r.isZero() && r.degree(x) >= db) {
+		RecursivePolynomial<Number> t = recursive_detail::shift(r.lcoeff(x), x, r.degree(x) - db);
+		r *= lb;
+		r -= t * b;
+		--k;
+	}
+	return r * pow(lb, k);
+}
+
+/**
+ * Divides a by b, asserting that the division is exact.
+ */
+template<typename Number>
+RecursivePolynomial<Number> divide(const RecursivePolynomial<Number>& a, const RecursivePolynomial<Number>& b) {
+	assert(!b.isZero());
+	using Poly = RecursivePolynomial<Number>;
+	if (a.isZero()) return Poly();
+	if (b.isNumber()) return a * (constant_one<Number>::get() / b.constantPart());
+	Variable x = b.mainVar();
+	assert(a.mainVar() >= x);
+	if (a.mainVar() > x) {
+		std::vector<typename Poly::TermType> terms;
+		for (const auto& t: a.terms()) terms.emplace_back(t.first, divide(t.second, b));
+		return Poly(a.mainVar(), std::move(terms));
+	}
+	Poly q;
+	Poly r = a;
+	while (!r.isZero()) {
+		assert(r.mainVar() == x && r.degree() >= b.degree());
+		Poly t = recursive_detail::shift(divide(r.lcoeff(), b.lcoeff()), x, r.degree() - b.degree());
+		q += t;
+		r -= t * b;
+	}
+	return q;
+}
+
+/// Makes the numeric leading coefficient of p positive.
+template<typename Number>
+RecursivePolynomial<Number> normalizeSign(const RecursivePolynomial<Number>& p) {
+	if (p.isZero() || carl::isPositive(p.numericLcoeff())) return p;
+	return -p;
+}
+
+template<typename Number>
+RecursivePolynomial<Number> gcd(const RecursivePolynomial<Number>& a, const RecursivePolynomial<Number>& b);
+
+/**
+ * The content of p with respect to its main variable, i.e. the gcd of its coefficients.
+ * Its sign is chosen such that the primitive part has a positive numeric leading coefficient.
+ */
+template<typename Number>
+RecursivePolynomial<Number> content(const RecursivePolynomial<Number>& p) {
+	if (p.isNumber()) return p;
+	RecursivePolynomial<Number> res;
+	for (const auto& t: p.terms()) {
+		res = gcd(res, t.second);
+	}
+	if (carl::isNegative(p.numericLcoeff())) return -res;
+	return res;
+}
+
+/// The primitive part of p with respect to its main variable.
+template<typename Number>
+RecursivePolynomial<Number> primitivePart(const RecursivePolynomial<Number>& p) {
+	if (p.isZero()) return p;
+	return divide(p, content(p));
+}
+
+/**
+ * The greatest common divisor of a and b, computed recursively by a primitive polynomial remainder sequence.
+ * The numeric leading coefficient of the result is positive. Over the rationals, the gcd of numbers is the rational
+ * gcd of their numerators and denominators as for carl::gcd.
+ */
+template<typename Number>
+RecursivePolynomial<Number> gcd(const RecursivePolynomial<Number>& a, const RecursivePolynomial<Number>& b) {
+	using Poly = RecursivePolynomial<Number>;
+	if (a.isZero()) return normalizeSign(b);
+	if (b.isZero()) return normalizeSign(a);
+	if (a.isNumber() && b.isNumber()) return Poly(carl::abs(carl::gcd(a.constantPart(), b.constantPart())));
+	if (a.mainVar() < b.mainVar()) return gcd(b, a);
+	if (a.mainVar() > b.mainVar()) return gcd(content(a), b);
+	Variable x = a.mainVar();
+	Poly c = gcd(content(a), content(b));
+	Poly A = primitivePart(a);
+	Poly B = primitivePart(b);
+	if (A.degree() < B.degree()) std::swap(A, B);
+	while (true) {
+		Poly R = prem(A, B);
+		if (R.isZero()) break;
+		if (R.degree(x) == 0) return c;
+		A = std::move(B);
+		B = primitivePart(R);
+	}
+	return c * primitivePart(B);
+}
+
+/**
+ * The resultant of a and b with respect to the larger of their main variables, computed by the subresultant
+ * polynomial remainder sequence. Contents are not removed beforehand, as computing them usually costs more than the
+ * smaller intermediate coefficients save.
+ */
+template<typename Number>
+RecursivePolynomial<Number> resultant(const RecursivePolynomial<Number>& a, const RecursivePolynomial<Number>& b) {
+	using Poly = RecursivePolynomial<Number>;
+	Variable x = std::max(a.mainVar(), b.mainVar());
+	assert(x != Variable::NO_VARIABLE);
+	if (a.isZero() || b.isZero()) return Poly();
+	if (a.degree(x) == 0) return pow(a, b.degree(x));
+	if (b.degree(x) == 0) return pow(b, a.degree(x));
+	Poly A = a;
+	Poly B = b;
+	Number s = constant_one<Number>::get();
+	if (A.degree() < B.degree()) {
+		std::swap(A, B);
+		if (A.degree() % 2 == 1 && B.degree() % 2 == 1) s = -s;
+	}
+	Poly g(constant_one<Number>::get());
+	Poly h(constant_one<Number>::get());
+	while (true) {
+		exponent delta = A.degree() - B.degree();
+		if (A.degree() % 2 == 1 && B.degree() % 2 == 1) s = -s;
+		Poly R = prem(A, B);
+		A = std::move(B);
+		B = divide(R, g * pow(h, delta));
+		g = A.lcoeff();
+		if (delta > 0) h = divide(pow(g, delta), pow(h, delta - 1));
+		if (B.degree(x) == 0) break;
+	}
+	if (B.isZero()) return Poly();
+	h = divide(pow(B, A.degree()), pow(h, A.degree() - 1));
+	return h * s;
+}
+
+}
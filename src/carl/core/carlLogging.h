@@ -7,18 +7,21 @@
 #include "carlLoggingHelper.h"
 #include "config.h"
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <sstream>
-#ifdef THREAD_SAFE
 #include <thread>
-#endif
+#include <unordered_map>
 #include <utility>
 
 
@@ -67,6 +70,14 @@ namespace carl {
  * <li>`CARLLOG_ASSERT(channel, condition, msg)` checks the condition and if it fails calls `CARLLOG_FATAL(channel, msg)` and asserts the condition.</li>
  * </ul>
  * Any message (`msg` or `args`) can be an arbitrary expression that one would stream to an `std::ostream` like `stream << (msg);`. No final newline is needed.
+ * 
+ * Every log statement has a LogSite that caches the minimal visible LogLevel of its channel, hence the channel has to be a string literal.
+ * Whenever a Filter or the set of Sinks changes, all LogSite objects are invalidated.
+ * Thus a log statement that is not visible only costs a single comparison.
+ * 
+ * By default, messages are written to the sinks synchronously.
+ * After `logger().asynchronous(true)`, messages are formatted by the logging thread and passed through a lock-free queue to a background thread that writes them.
+ * Sinks and filters should then be configured before logging starts.
  */
 namespace logging {
 
@@ -166,6 +177,8 @@ public:
 class Filter {
 	/// Mapping from channels to (minimal) log levels.
 	std::map<std::string, LogLevel> mData;
+	/// Called whenever a rule changes.
+	std::function<void()> mOnChange;
 public:
 	/**
 	 * Constructor.
@@ -189,15 +202,22 @@ public:
 	 */
 	Filter& operator()(const std::string& channel, LogLevel level) {
 		mData[channel] = level;
+		if (mOnChange) mOnChange();
 		return *this;
 	}
 	/**
-	 * Checks if the given log level is sufficient for the log message to be forwarded.
+	 * Sets a callback that is called whenever a rule changes.
+	 * @param onChange Callback.
+	 */
+	void onChange(std::function<void()> onChange) {
+		mOnChange = std::move(onChange);
+	}
+	/**
+	 * Returns the minimal log level for some channel, using the rule of the closest parent channel if there is none for the channel itself.
 	 * @param channel Channel name.
-	 * @param level LogLevel.
-	 * @return If the message shall be forwarded.
+	 * @return Minimal LogLevel.
 	 */
-	bool check(const std::string& channel, LogLevel level) const noexcept {
+	LogLevel level(const std::string& channel) const noexcept {
 		auto tmp = channel;
 		auto it = mData.find(tmp);
 		while (!tmp.empty() && it == mData.end()) {
@@ -207,10 +227,18 @@ public:
 		}
 		if (it == mData.end()) {
 			std::cout << "Did not find something for \"" << channel << "\"" << std::endl;
-			return true;
+			return LogLevel::LVL_ALL;
 		}
-		assert(it != mData.end());
-		return level >= it->second;
+		return it->second;
+	}
+	/**
+	 * Checks if the given log level is sufficient for the log message to be forwarded.
+	 * @param channel Channel name.
+	 * @param level LogLevel.
+	 * @return If the message shall be forwarded.
+	 */
+	bool check(const std::string& channel, LogLevel level) const noexcept {
+		return level >= this->level(channel);
 	}
 	/**
 	 * Streaming operator for a Filter.
@@ -300,19 +328,220 @@ public:
 	}
 };
 
+class Logger;
+
+/**
+ * The state of a single log statement.
+ * It caches the minimal visible LogLevel of its channel, such that checking whether a message is visible does not need to consult the filters.
+ * A LogSite is a static object created by the logging macros and is constant-initialized, hence it does not need a guard either.
+ */
+class LogSite {
+	friend class Logger;
+	/// Channel name.
+	const char* mChannel;
+	/// Zero if unknown, otherwise one plus the minimal visible LogLevel.
+	std::atomic<unsigned> mThreshold;
+	/// Next site known to the Logger.
+	LogSite* mNext = nullptr;
+	/// Whether this site is known to the Logger.
+	bool mRegistered = false;
+
+	bool update(LogLevel level);
+public:
+	/**
+	 * Creates a LogSite for a channel, which has to be a string literal.
+	 * @param channel Channel name.
+	 */
+	template<std::size_t N>
+	constexpr explicit LogSite(const char (&channel)[N]) noexcept: mChannel(channel), mThreshold(0) {}
+	LogSite(const LogSite&) = delete;
+	LogSite& operator=(const LogSite&) = delete;
+
+	const char* channel() const noexcept {
+		return mChannel;
+	}
+	/**
+	 * Checks whether a message of the given level is visible.
+	 * @param level LogLevel.
+	 */
+	bool visible(LogLevel level) noexcept {
+		unsigned threshold = mThreshold.load(std::memory_order_relaxed);
+		if (static_cast<unsigned>(level) + 1 < threshold) return false;
+		return threshold != 0 || update(level);
+	}
+};
+
+/**
+ * Lock-free queue of formatted messages that are written to their sinks by a background thread.
+ * Producers only perform an atomic exchange, following the intrusive multi-producer single-consumer queue by Dmitry Vyukov.
+ */
+class AsyncWriter {
+	struct Node {
+		std::shared_ptr<Sink> sink;
+		std::string text;
+		std::atomic<Node*> next;
+		Node(): next(nullptr) {}
+		Node(std::shared_ptr<Sink> s, std::string t): sink(std::move(s)), text(std::move(t)), next(nullptr) {}
+	};
+	/// The most recently pushed node.
+	std::atomic<Node*> mHead;
+	/// The next node to be popped, only used by the writer.
+	Node* mTail;
+	Node mStub;
+	std::atomic<std::size_t> mPushed;
+	std::atomic<std::size_t> mWritten;
+	std::atomic<bool> mStop;
+	std::mutex mWakeupMutex;
+	std::condition_variable mWakeup;
+	std::thread mThread;
+
+	void push(Node* n) noexcept {
+		n->next.store(nullptr, std::memory_order_relaxed);
+		Node* prev = mHead.exchange(n, std::memory_order_acq_rel);
+		prev->next.store(n, std::memory_order_release);
+	}
+	Node* pop() noexcept {
+		Node* tail = mTail;
+		Node* next = tail->next.load(std::memory_order_acquire);
+		if (tail == &mStub) {
+			if (next == nullptr) return nullptr;
+			mTail = next;
+			tail = next;
+			next = next->next.load(std::memory_order_acquire);
+		}
+		if (next != nullptr) {
+			mTail = next;
+			return tail;
+		}
+		// tail is the last node, unless a producer is in the middle of push().
+		if (tail != mHead.load(std::memory_order_acquire)) return nullptr;
+		push(&mStub);
+		next = tail->next.load(std::memory_order_acquire);
+		if (next != nullptr) {
+			mTail = next;
+			return tail;
+		}
+		return nullptr;
+	}
+	void run() {
+		while (true) {
+			std::size_t written = 0;
+			std::shared_ptr<Sink> last;
+			while (Node* n = pop()) {
+				n->sink->log() << n->text;
+				if (last && last != n->sink) last->log().flush();
+				last = std::move(n->sink);
+				delete n;
+				written++;
+			}
+			if (last) last->log().flush();
+			if (written > 0) {
+				mWritten.fetch_add(written, std::memory_order_release);
+				continue;
+			}
+			if (mStop.load(std::memory_order_acquire) && mWritten.load() == mPushed.load()) return;
+			std::unique_lock<std::mutex> lock(mWakeupMutex);
+			// Producers do not lock, hence a notification may get lost and we only wait briefly.
+			mWakeup.wait_for(lock, std::chrono::milliseconds(10));
+		}
+	}
+public:
+	AsyncWriter(): mHead(&mStub), mTail(&mStub), mPushed(0), mWritten(0), mStop(false), mThread([this](){ run(); }) {}
+	~AsyncWriter() {
+		mStop.store(true, std::memory_order_release);
+		mWakeup.notify_one();
+		mThread.join();
+	}
+	AsyncWriter(const AsyncWriter&) = delete;
+	AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+	/**
+	 * Enqueues a message for the given sink.
+	 * @param sink Sink.
+	 * @param text Formatted message.
+	 */
+	void write(std::shared_ptr<Sink> sink, std::string text) {
+		mPushed.fetch_add(1, std::memory_order_relaxed);
+		push(new Node(std::move(sink), std::move(text)));
+		mWakeup.notify_one();
+	}
+	/**
+	 * Waits until all messages that were enqueued before are written.
+	 */
+	void flush() {
+		std::size_t pushed = mPushed.load();
+		while (mWritten.load(std::memory_order_acquire) < pushed) {
+			mWakeup.notify_one();
+			std::this_thread::yield();
+		}
+	}
+};
+
 /**
  * Main logger class.
  */
 class Logger: public carl::Singleton<Logger> {
 	friend carl::Singleton<Logger>;
+	friend class LogSite;
 	/// Mapping from channels to associated logging classes.
 	std::map<std::string, std::tuple<std::shared_ptr<Sink>, Filter, std::shared_ptr<Formatter>>> mData;
-	/// Logging mutex to ensure thread-safe logging.
+	/// Logging mutex to ensure thread-safe synchronous logging.
 	std::mutex mMutex;
 	/// Timer to track program runtime.
 	carl::Timer mTimer;
+	/// Protects the list of sites and the cached channel levels.
+	std::mutex mSiteMutex;
+	/// All sites that have been used.
+	LogSite* mSites = nullptr;
+	/// Minimal visible level for every channel that has been used.
+	std::unordered_map<std::string, LogLevel> mChannelLevels;
+	/// Writer for asynchronous logging, if enabled.
+	std::unique_ptr<AsyncWriter> mWriter;
+
+	/**
+	 * Computes the minimal level that is visible for some sink.
+	 * Assumes that mSiteMutex is locked.
+	 */
+	LogLevel channelLevel(const std::string& channel) {
+		auto it = mChannelLevels.find(channel);
+		if (it != mChannelLevels.end()) return it->second;
+		LogLevel res = LogLevel::LVL_OFF;
+		for (const auto& t: mData) {
+			res = std::min(res, std::get<1>(t.second).level(channel));
+		}
+		mChannelLevels.emplace(channel, res);
+		return res;
+	}
+	/**
+	 * Registers a site and computes its threshold.
+	 * @return If a message of the given level is visible at the site.
+	 */
+	bool update(LogSite& site, LogLevel level) {
+		std::lock_guard<std::mutex> lock(mSiteMutex);
+		if (!site.mRegistered) {
+			site.mNext = mSites;
+			mSites = &site;
+			site.mRegistered = true;
+		}
+		LogLevel min = channelLevel(site.channel());
+		site.mThreshold.store(static_cast<unsigned>(min) + 1, std::memory_order_relaxed);
+		return level >= min;
+	}
+	/**
+	 * Resets the cached thresholds of all sites, they are recomputed when they are used next.
+	 */
+	void invalidate() {
+		std::lock_guard<std::mutex> lock(mSiteMutex);
+		mChannelLevels.clear();
+		for (LogSite* site = mSites; site != nullptr; site = site->mNext) {
+			site->mThreshold.store(0, std::memory_order_relaxed);
+		}
+	}
 
 public:
+	~Logger() {
+		mWriter.reset();
+	}
 	/**
 	 * Check if a Sink with the given id has been installed.
 	 * @param id Sink identifier.
@@ -328,8 +557,12 @@ public:
 	 * @param sink Sink.
 	 */
 	void configure(const std::string& id, std::shared_ptr<Sink> sink) {
-		std::lock_guard<std::mutex> lock(mMutex);
-		mData[id] = std::make_tuple(std::move(sink), Filter(), std::make_shared<Formatter>());
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mData[id] = std::make_tuple(std::move(sink), Filter(), std::make_shared<Formatter>());
+			std::get<1>(mData[id]).onChange([this](){ invalidate(); });
+		}
+		invalidate();
 	}
 	/**
 	 * Installs a FileSink.
@@ -347,8 +580,21 @@ public:
 	void configure(const std::string& id, std::ostream& os) {
 		configure(id, std::make_shared<StreamSink>(os));
 	}
+	/**
+	 * Removes the Sink with the given id, if present.
+	 * @param id Sink identifier.
+	 */
+	void remove(const std::string& id) {
+		flush();
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mData.erase(id);
+		}
+		invalidate();
+	}
 	/**
 	 * Retrieves the Filter for some Sink.
+	 * Changes to the Filter invalidate the cached levels of all log statements.
 	 * @param id Sink identifier.
 	 * @return Filter.
 	 */
@@ -387,19 +633,32 @@ public:
 			std::get<2>(t.second)->configure(std::get<1>(t.second));
 		}
 	}
+	/**
+	 * Enables or disables asynchronous logging.
+	 * If enabled, messages are formatted by the logging thread and written by a background thread.
+	 * Disabling waits until all pending messages are written.
+	 * @param enable Whether to log asynchronously.
+	 */
+	void asynchronous(bool enable) {
+		if (enable && !mWriter) mWriter = std::make_unique<AsyncWriter>();
+		else if (!enable) mWriter.reset();
+	}
+	/**
+	 * Waits until all messages are written, if logging asynchronously.
+	 */
+	void flush() {
+		if (mWriter) mWriter->flush();
+	}
 	/**
 	 * Checks whether a log message would be visible for some sink.
 	 * If this is not the case, we do not need to render it at all.
+	 * The logging macros use LogSite::visible() instead, which caches the result.
 	 * @param level LogLevel.
 	 * @param channel Channel name.
 	 */
-	bool visible(LogLevel level, const std::string& channel) const noexcept {
-		for (const auto& t: mData) {
-			if (std::get<1>(t.second).check(channel, level)) {
-				return true;
-			}
-		}
-		return false;
+	bool visible(LogLevel level, const std::string& channel) noexcept {
+		std::lock_guard<std::mutex> lock(mSiteMutex);
+		return level >= channelLevel(channel);
 	}
 	/**
 	 * Logs a message.
@@ -409,6 +668,19 @@ public:
 	 * @param info Auxiliary information.
 	 */
 	void log(LogLevel level, const std::string& channel, const std::stringstream& ss, const RecordInfo& info) {
+		if (mWriter) {
+			for (auto& t: mData) {
+				if (!std::get<1>(t.second).check(channel, level)) continue;
+				std::ostringstream os;
+				std::get<2>(t.second)->prefix(os, mTimer, channel, level, info);
+				os << ss.str();
+				std::get<2>(t.second)->suffix(os);
+				mWriter->write(std::get<0>(t.second), os.str());
+			}
+			// The program is likely to terminate, make sure the message is written.
+			if (level == LogLevel::LVL_FATAL) mWriter->flush();
+			return;
+		}
 		std::lock_guard<std::mutex> lock(mMutex);
 		for (auto& t: mData) {
 			if (!std::get<1>(t.second).check(channel, level)) continue;
@@ -419,6 +691,10 @@ public:
 	}
 };
 
+inline bool LogSite::update(LogLevel level) {
+	return Logger::getInstance().update(*this, level);
+}
+
 /**
  * Returns the single global instance of a Logger.
  * 
@@ -437,15 +713,17 @@ inline Logger& logger() {
 #define __CARL_LOG_RECORD ::carl::logging::RecordInfo{__FILE__, __func__, __LINE__}
 /// Create a record info without function name.
 #define __CARL_LOG_RECORD_NOFUNC ::carl::logging::RecordInfo{__FILE__, "", __LINE__}
-/// Basic logging macro.
+/// Basic logging macro. The channel has to be a string literal.
 #define __CARL_LOG(level, channel, expr) { \
-	if (::carl::logging::Logger::getInstance().visible(level, channel)) { \
+	static ::carl::logging::LogSite __carl_log_site(channel); \
+	if (__carl_log_site.visible(level)) { \
 		std::stringstream __ss; __ss << expr; ::carl::logging::Logger::getInstance().log(level, channel, __ss, __CARL_LOG_RECORD); \
 	}}
 
-/// Basic logging macro without function name.
+/// Basic logging macro without function name. The channel has to be a string literal.
 #define __CARL_LOG_NOFUNC(level, channel, expr) { \
-	if (::carl::logging::Logger::getInstance().visible(level, channel)) { \
+	static ::carl::logging::LogSite __carl_log_site(channel); \
+	if (__carl_log_site.visible(level)) { \
 		std::stringstream __ss; __ss << expr; ::carl::logging::Logger::getInstance().log(level, channel, __ss, __CARL_LOG_RECORD_NOFUNC); \
 	}}
 
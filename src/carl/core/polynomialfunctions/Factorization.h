@@ -4,6 +4,7 @@
 #include "../../converter/CoCoAAdaptor.h"
 #include "../../converter/OldGinacConverter.h"
 #include "../../util/Common.h"
+#include "../../util/StoredResult.h"
 
 namespace carl {
 
@@ -48,6 +49,7 @@ namespace helper {
 /**
  * Try to factorize a multivariate polynomial..
  * Uses CoCoALib and GiNaC, if available, depending on the coefficient type of the polynomial.
+ * Their results are looked up in the active ResultStore, if any.
  */
 template<typename C, typename O, typename P>
 Factors<MultivariatePolynomial<C,O,P>> factorization(const MultivariatePolynomial<C,O,P>& p, bool includeConstants = true) {
@@ -70,9 +72,17 @@ Factors<MultivariatePolynomial<C,O,P>> factorization(const MultivariatePolynomia
 	#endif
 	};
 
-	auto factors = s(p);
-	helper::sanitizeFactors(p, factors);
-	return factors;
+	auto compute = [&s, &p](){
+		auto factors = s(p);
+		helper::sanitizeFactors(p, factors);
+		return factors;
+	};
+	#if defined USE_COCOA || defined USE_GINAC
+		return storedResult<Factors<MultivariatePolynomial<C,O,P>>>("factorization", compute, p, includeConstants);
+	#else
+		// Only trivial factorizations are available, which are cheaper than a lookup.
+		return compute();
+	#endif
 }
 
 /**
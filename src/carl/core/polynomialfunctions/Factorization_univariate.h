@@ -5,6 +5,7 @@
 
 #include "../logging.h"
 #include "../UnivariatePolynomial.h"
+#include "../../util/StoredResult.h"
 
 namespace carl {
 
@@ -79,77 +80,88 @@ CLANG_WARNING_RESET
 	return result;
 }
 
-template<typename Coeff>
-FactorMap<Coeff> factorization(const UnivariatePolynomial<Coeff>& p) {
-    CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: " << p);
-	FactorMap<Coeff> result;
-	if(p.isConstant()) // Constant.
-	{
-		CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << p << ")^" << 1 );
-		result.emplace(p, 1);
-		return result;
-	}
-	// Make the polynomial's coefficients coprime (integral and with gcd 1).
-	UnivariatePolynomial<Coeff> remainingPoly(p.mainVar());
-	Coeff factor = p.coprimeFactor();
-	if(factor == 1)
-	{
-		remainingPoly = p;
-	}
-	else
-	{
-		// Store the rational factor and make the polynomial's coefficients coprime.
-		CARL_LOG_TRACE("carl.core", "UnivFactor: add the factor (" << UnivariatePolynomial<Coeff>(p.mainVar(), constant_one<Coeff>::get() / factor) << ")^" << 1 );
-		result.emplace(UnivariatePolynomial<Coeff>(p.mainVar(), constant_one<Coeff>::get() / factor), 1);
-        std::vector<Coeff> remaining;
-        remaining.reserve(p.coefficients().size());
-		for(const Coeff& coeff : p.coefficients())
+namespace helper {
+	template<typename Coeff>
+	FactorMap<Coeff> univariateFactorization(const UnivariatePolynomial<Coeff>& p) {
+	    CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: " << p);
+		FactorMap<Coeff> result;
+		if(p.isConstant()) // Constant.
 		{
-			remaining.push_back(coeff * factor);
+			CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << p << ")^" << 1 );
+			result.emplace(p, 1);
+			return result;
 		}
-        remainingPoly = UnivariatePolynomial<Coeff>(p.mainVar(), std::move(remaining));
-	}
-	assert(p.coefficients().size() > 1);
-	// Exclude the factors  (x-r)^i  with  r rational.
-	remainingPoly = UnivariatePolynomial<Coeff>::excludeLinearFactors(remainingPoly, result, static_cast<carl::sint>(INT_MAX));
-	assert(!remainingPoly.isConstant() || remainingPoly.lcoeff() == (Coeff)1);
-	if(!remainingPoly.isConstant())
-	{
-		CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: Calculating square-free factorization of " << remainingPoly);
-		// Calculate the square free factorization.
-		auto sff = carl::squareFreeFactorization(remainingPoly);
-//		factor = (Coeff) 1;
-		for(auto expFactorPair = sff.begin(); expFactorPair != sff.end(); ++expFactorPair)
+		// Make the polynomial's coefficients coprime (integral and with gcd 1).
+		UnivariatePolynomial<Coeff> remainingPoly(p.mainVar());
+		Coeff factor = p.coprimeFactor();
+		if(factor == 1)
+		{
+			remainingPoly = p;
+		}
+		else
+		{
+			// Store the rational factor and make the polynomial's coefficients coprime.
+			CARL_LOG_TRACE("carl.core", "UnivFactor: add the factor (" << UnivariatePolynomial<Coeff>(p.mainVar(), constant_one<Coeff>::get() / factor) << ")^" << 1 );
+			result.emplace(UnivariatePolynomial<Coeff>(p.mainVar(), constant_one<Coeff>::get() / factor), 1);
+	        std::vector<Coeff> remaining;
+	        remaining.reserve(p.coefficients().size());
+			for(const Coeff& coeff : p.coefficients())
+			{
+				remaining.push_back(coeff * factor);
+			}
+	        remainingPoly = UnivariatePolynomial<Coeff>(p.mainVar(), std::move(remaining));
+		}
+		assert(p.coefficients().size() > 1);
+		// Exclude the factors  (x-r)^i  with  r rational.
+		remainingPoly = UnivariatePolynomial<Coeff>::excludeLinearFactors(remainingPoly, result, static_cast<carl::sint>(INT_MAX));
+		assert(!remainingPoly.isConstant() || remainingPoly.lcoeff() == (Coeff)1);
+		if(!remainingPoly.isConstant())
 		{
-//			Coeff cpf = expFactorPair->second.coprimeFactor();
-//			if(cpf != (Coeff) 1)
-//			{
-//				factor *= pow(expFactorPair->second.coprimeFactor(), expFactorPair->first);
-//				expFactorPair->second /= cpf;
-//			}
-			if(!expFactorPair->second.isConstant() || !carl::isOne(expFactorPair->second.lcoeff()))
+			CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: Calculating square-free factorization of " << remainingPoly);
+			// Calculate the square free factorization.
+			auto sff = carl::squareFreeFactorization(remainingPoly);
+	//		factor = (Coeff) 1;
+			for(auto expFactorPair = sff.begin(); expFactorPair != sff.end(); ++expFactorPair)
 			{
-				auto retVal = result.emplace(expFactorPair->second, expFactorPair->first);
-				CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << expFactorPair->second << ")^" << expFactorPair->first );
-				if(!retVal.second)
+	//			Coeff cpf = expFactorPair->second.coprimeFactor();
+	//			if(cpf != (Coeff) 1)
+	//			{
+	//				factor *= pow(expFactorPair->second.coprimeFactor(), expFactorPair->first);
+	//				expFactorPair->second /= cpf;
+	//			}
+				if(!expFactorPair->second.isConstant() || !carl::isOne(expFactorPair->second.lcoeff()))
 				{
-					retVal.first->second += expFactorPair->first;
+					auto retVal = result.emplace(expFactorPair->second, expFactorPair->first);
+					CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << expFactorPair->second << ")^" << expFactorPair->first );
+					if(!retVal.second)
+					{
+						retVal.first->second += expFactorPair->first;
+					}
 				}
 			}
+	//		if(factor != (Coeff) 1)
+	//		{
+	//			CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << UnivariatePolynomial<Coeff>(mainVar(), {factor}) << ")^" << 1 );
+	//			// Add the constant factor to the factors.
+	//			if( result.begin()->first.isConstant() )
+	//			{
+	//				factor *= result.begin()->first.lcoeff();
+	//				result.erase( result.begin() );
+	//			}
+	//			result.insert(result.begin(), std::pair<UnivariatePolynomial<Coeff>, unsigned>(UnivariatePolynomial<Coeff>(mainVar(), {factor}), 1));
+	//		}
 		}
-//		if(factor != (Coeff) 1)
-//		{
-//			CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: add the factor (" << UnivariatePolynomial<Coeff>(mainVar(), {factor}) << ")^" << 1 );
-//			// Add the constant factor to the factors.
-//			if( result.begin()->first.isConstant() )
-//			{
-//				factor *= result.begin()->first.lcoeff();
-//				result.erase( result.begin() );
-//			}
-//			result.insert(result.begin(), std::pair<UnivariatePolynomial<Coeff>, unsigned>(UnivariatePolynomial<Coeff>(mainVar(), {factor}), 1));
-//		}
+		return result;
 	}
-	return result;
+}
+
+/**
+ * Factorizes p into a constant factor, rational linear factors and square-free factors.
+ * The result is looked up in the active ResultStore, if any.
+ */
+template<typename Coeff>
+FactorMap<Coeff> factorization(const UnivariatePolynomial<Coeff>& p) {
+	return storedResult<FactorMap<Coeff>>("factorization", [&p](){ return helper::univariateFactorization(p); }, p);
 }
 
 }
\ No newline at end of file
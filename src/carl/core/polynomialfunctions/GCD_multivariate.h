@@ -4,6 +4,7 @@
 #include "PrimitiveEuclidean.h"
 #include "../MultivariatePolynomial.h"
 #include "../../numbers/typetraits.h"
+#include "../../util/Instrumentation.h"
 
 #include "../../converter/CoCoAAdaptor.h"
 #include "../../converter/OldGinacConverter.h"
@@ -45,6 +46,7 @@ namespace gcd_detail {
 template<typename C, typename O, typename P>
 MultivariatePolynomial<C,O,P> gcd(const MultivariatePolynomial<C,O,P>& a, const MultivariatePolynomial<C,O,P>& b) {
 	CARL_LOG_DEBUG("carl.core.gcd", "gcd(" << a << ", " << b << ")");
+	CARL_TIME_SCOPE("carl.core.gcd.multivariate");
 	assert(!isZero(a));
 	assert(!isZero(b));
 
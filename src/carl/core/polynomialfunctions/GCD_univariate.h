@@ -2,6 +2,7 @@
 
 #include "../UnivariatePolynomial.h"
 #include "../Variable.h"
+#include "../../util/Instrumentation.h"
 
 namespace carl {
 
@@ -99,6 +100,7 @@ UnivariatePolynomial<Coeff> extended_gcd(const UnivariatePolynomial<Coeff>& a, c
  */
 template<typename Coeff>
 UnivariatePolynomial<Coeff> gcd(const UnivariatePolynomial<Coeff>& a, const UnivariatePolynomial<Coeff>& b) {
+	CARL_TIME_SCOPE("carl.core.gcd.univariate");
 	// We want degree(b) <= degree(a).
 	assert(!carl::isZero(a));
 	assert(!carl::isZero(b));
@@ -3,6 +3,7 @@
 #include "Content.h"
 #include "Derivative.h"
 #include "PrimitivePart.h"
+#include "../../util/Instrumentation.h"
 
 #include <list>
 #include <vector>
@@ -26,6 +27,7 @@ UnivariatePolynomial<Coeff> discriminant(const UnivariatePolynomial<Coeff>&, Sub
 }
 
 #include "../UnivariatePolynomial.h"
+#include "../../util/StoredResult.h"
 
 namespace carl {
 
@@ -286,8 +288,13 @@ UnivariatePolynomial<Coeff> resultant(
 		SubresultantStrategy strategy
 ) {
 	assert(p.mainVar() == q.mainVar());
+	CARL_TIME_SCOPE("carl.core.resultant");
 	if (carl::isZero(p) || carl::isZero(q)) return UnivariatePolynomial<Coeff>(p.mainVar());
-	UnivariatePolynomial<Coeff> resultant = subresultants(p.normalized(), q.normalized(), strategy).front();
+	UnivariatePolynomial<Coeff> pn = p.normalized();
+	UnivariatePolynomial<Coeff> qn = q.normalized();
+	UnivariatePolynomial<Coeff> resultant = storedResult<UnivariatePolynomial<Coeff>>(
+		"resultant", [&](){ return subresultants(pn, qn, strategy).front(); }, pn, qn, static_cast<int>(strategy)
+	);
 	CARL_LOG_TRACE("carl.core.resultant", "resultant(" << p << ", " << q << ") = " << resultant);
 	if (resultant.isConstant()) {
 		return resultant;
@@ -5,6 +5,7 @@
 #include "../../interval/Interval.h"
 #include "../logging.h"
 #include "../Sign.h"
+#include "../../util/Instrumentation.h"
 #include "../UnivariatePolynomial.h"
 #include "IncrementalRootFinder.h"
 
@@ -34,6 +35,7 @@ std::vector<RealAlgebraicNumber<Number>> realRoots(
 		SplittingStrategy pivoting = SplittingStrategy::DEFAULT
 ) {
 	CARL_LOG_DEBUG("carl.core.rootfinder", polynomial << " within " << interval);
+	CARL_TIME_SCOPE("carl.core.rootfinder");
 	#ifdef RAN_USE_Z3
 	auto r = realRootsZ3(polynomial, interval);
 	#else
@@ -0,0 +1,431 @@
+/**
+ * @file CNFConverter.h
+ */
+
+#pragma once
+
+#include "ClauseArray.h"
+#include "Formula.h"
+#include "FormulaPool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace carl {
+
+namespace cnf {
+	/// Which directions of the definition of a Tseitin variable x of a formula f are encoded.
+	enum Polarity: unsigned char {
+		NONE = 0,
+		/// x implies f, needed if f occurs positively.
+		POSITIVE = 1,
+		/// f implies x, needed if f occurs negatively.
+		NEGATIVE = 2,
+		BOTH = 3
+	};
+	inline Polarity flip(Polarity p) {
+		return Polarity(((p & POSITIVE) << 1) | ((p & NEGATIVE) >> 1));
+	}
+
+	enum class VariableKind {
+		/// Stands for an atom, i.e. a Boolean variable, a constraint or the constant true.
+		ATOM,
+		/// Stands for a Boolean combination.
+		TSEITIN,
+		/// Intermediate result of an n-ary xor.
+		AUXILIARY
+	};
+
+	/// Identifies a variable by the id of its formula and, for auxiliary variables, an index.
+	struct Key {
+		std::size_t id;
+		std::size_t index;
+		bool operator==(const Key& k) const {
+			return id == k.id && index == k.index;
+		}
+	};
+	struct KeyHash {
+		std::size_t operator()(const Key& k) const {
+			return k.id * 31 + k.index;
+		}
+	};
+	/// The key of the variable that stands for true.
+	constexpr Key constantKey = {std::numeric_limits<std::size_t>::max(), 0};
+}
+
+/**
+ * Converts formulas to CNF using the Plaisted-Greenbaum encoding.
+ *
+ * Every Boolean combination below the top-level conjunction and disjunctions is replaced by a Tseitin variable. Only
+ * the directions of its definition that are needed for the polarities it occurs with are encoded. The formula is
+ * traversed as a DAG: a subformula that occurs several times gets one variable and its definition is encoded once per
+ * polarity, also across successive calls of convert(). The traversal is iterative, hence arbitrarily deep formulas are
+ * fine.
+ *
+ * The result is a ClauseArray, where atoms and Tseitin variables are numbered in the order of their first occurrence.
+ * toFormula() turns clauses back into formulas, using the Tseitin variables of the FormulaPool.
+ *
+ * The top-level conjuncts may be converted by several threads. The workers only read the formulas and never copy them,
+ * as the reference counts of formulas are not synchronized. Their results are merged in order; a subformula shared by
+ * conjuncts of different workers gets a single variable, but its definition may be encoded more than once.
+ */
+template<typename Pol>
+class CNFConverter {
+private:
+	/// Conjuncts that a thread should convert at least to amortize its start.
+	static constexpr std::size_t minConjunctsPerThread = 256;
+
+	std::size_t mThreads;
+	std::unordered_map<cnf::Key, int, cnf::KeyHash> mVariables;
+	/// For variable i, its kind, definition and encoded polarities are at index i-1.
+	std::vector<cnf::VariableKind> mKinds;
+	std::vector<Formula<Pol>> mDefinitions;
+	std::vector<cnf::Polarity> mEncoded;
+	/// The formula for every variable, created lazily by toFormula().
+	std::vector<Formula<Pol>> mFormulas;
+
+	/// Converts some conjuncts into clauses, where variables larger than mBase are local to this worker.
+	class Worker {
+	public:
+		struct Job {
+			const Formula<Pol>* formula;
+			int variable;
+			cnf::Polarity polarity;
+		};
+
+		const CNFConverter& mParent;
+		int mBase;
+		std::unordered_map<cnf::Key, int, cnf::KeyHash> mLocal;
+		/// For local variable mBase+1+i, its key, kind and definition are at index i.
+		std::vector<cnf::Key> mKeys;
+		std::vector<cnf::VariableKind> mKinds;
+		std::vector<const Formula<Pol>*> mDefinitions;
+		std::vector<cnf::Polarity> mEncoded;
+		/// Polarities of global variables that are encoded by this worker or before.
+		std::unordered_map<int, cnf::Polarity> mEncodedGlobal;
+		std::vector<Job> mJobs;
+		ClauseArray mClauses;
+		std::vector<int> mClause;
+
+		explicit Worker(const CNFConverter& parent): mParent(parent), mBase(int(parent.mKinds.size())) {}
+
+		int variable(const cnf::Key& key, cnf::VariableKind kind, const Formula<Pol>* definition) {
+			auto global = mParent.mVariables.find(key);
+			if (global != mParent.mVariables.end()) return global->second;
+			auto res = mLocal.emplace(key, mBase + int(mKeys.size()) + 1);
+			if (res.second) {
+				mKeys.push_back(key);
+				mKinds.push_back(kind);
+				mDefinitions.push_back(definition);
+				mEncoded.push_back(cnf::NONE);
+				if (definition == nullptr) {
+					// The constant true.
+					int v = res.first->second;
+					mClauses.add(&v, &v + 1);
+				}
+			}
+			return res.first->second;
+		}
+
+		cnf::Polarity& encoded(int v) {
+			if (v > mBase) return mEncoded[std::size_t(v - mBase - 1)];
+			auto it = mEncodedGlobal.find(v);
+			if (it == mEncodedGlobal.end()) {
+				it = mEncodedGlobal.emplace(v, mParent.mEncoded[std::size_t(v - 1)]).first;
+			}
+			return it->second;
+		}
+
+		/// Schedules the encoding of the directions of the definition of v that are not yet encoded.
+		void request(const Formula<Pol>& f, int v, cnf::Polarity polarity) {
+			// Every direction of an xor needs both directions of its subformulas anyway.
+			if (f.getType() == FormulaType::XOR) polarity = cnf::BOTH;
+			cnf::Polarity& done = encoded(v);
+			cnf::Polarity missing = cnf::Polarity(polarity & ~done);
+			if (missing == cnf::NONE) return;
+			done = cnf::Polarity(done | missing);
+			mJobs.push_back(Job{&f, v, missing});
+		}
+
+		/// Returns the literal for f, which occurs with the given polarity.
+		int literal(const Formula<Pol>& f, cnf::Polarity polarity) {
+			const Formula<Pol>* g = &f;
+			bool negated = false;
+			while (g->getType() == FormulaType::NOT) {
+				negated = !negated;
+				g = &g->subformula();
+			}
+			if (negated) polarity = cnf::flip(polarity);
+			int v = 0;
+			switch (g->getType()) {
+				case FormulaType::FALSE:
+					negated = !negated;
+					[[fallthrough]];
+				case FormulaType::TRUE:
+					v = variable(cnf::constantKey, cnf::VariableKind::ATOM, nullptr);
+					break;
+				case FormulaType::AND:
+				case FormulaType::OR:
+				case FormulaType::IMPLIES:
+				case FormulaType::IFF:
+				case FormulaType::XOR:
+				case FormulaType::ITE:
+					v = variable(cnf::Key{g->getId(), 0}, cnf::VariableKind::TSEITIN, g);
+					request(*g, v, polarity);
+					break;
+				default:
+					v = variable(cnf::Key{g->getId(), 0}, cnf::VariableKind::ATOM, g);
+			}
+			return negated ? -v : v;
+		}
+
+		void clause(std::initializer_list<int> literals) {
+			mClauses.add(literals.begin(), literals.end());
+		}
+
+		/// Encodes z <-> (a xor b).
+		void encodeXor(int z, int a, int b) {
+			clause({-z, a, b});
+			clause({-z, -a, -b});
+			clause({z, -a, b});
+			clause({z, a, -b});
+		}
+
+		void encode(const Job& job) {
+			const Formula<Pol>& f = *job.formula;
+			int x = job.variable;
+			bool positive = (job.polarity & cnf::POSITIVE) != 0;
+			bool negative = (job.polarity & cnf::NEGATIVE) != 0;
+			switch (f.getType()) {
+				case FormulaType::AND:
+					if (positive) {
+						for (const auto& sub: f.subformulas()) clause({-x, literal(sub, cnf::POSITIVE)});
+					}
+					if (negative) {
+						mClause.assign(1, x);
+						for (const auto& sub: f.subformulas()) mClause.push_back(-literal(sub, cnf::NEGATIVE));
+						mClauses.add(mClause.begin(), mClause.end());
+					}
+					break;
+				case FormulaType::OR:
+					if (positive) {
+						mClause.assign(1, -x);
+						for (const auto& sub: f.subformulas()) mClause.push_back(literal(sub, cnf::POSITIVE));
+						mClauses.add(mClause.begin(), mClause.end());
+					}
+					if (negative) {
+						for (const auto& sub: f.subformulas()) clause({x, -literal(sub, cnf::NEGATIVE)});
+					}
+					break;
+				case FormulaType::IMPLIES:
+					if (positive) {
+						clause({-x, -literal(f.premise(), cnf::NEGATIVE), literal(f.conclusion(), cnf::POSITIVE)});
+					}
+					if (negative) {
+						clause({x, literal(f.premise(), cnf::POSITIVE)});
+						clause({x, -literal(f.conclusion(), cnf::NEGATIVE)});
+					}
+					break;
+				case FormulaType::ITE:
+					if (positive) {
+						clause({-x, -literal(f.condition(), cnf::NEGATIVE), literal(f.firstCase(), cnf::POSITIVE)});
+						clause({-x, literal(f.condition(), cnf::POSITIVE), literal(f.secondCase(), cnf::POSITIVE)});
+					}
+					if (negative) {
+						clause({x, -literal(f.condition(), cnf::NEGATIVE), -literal(f.firstCase(), cnf::NEGATIVE)});
+						clause({x, literal(f.condition(), cnf::POSITIVE), -literal(f.secondCase(), cnf::NEGATIVE)});
+					}
+					break;
+				case FormulaType::IFF: {
+					std::vector<int> subs;
+					for (const auto& sub: f.subformulas()) subs.push_back(literal(sub, cnf::BOTH));
+					if (positive) {
+						// All subformulas are equal to the first one.
+						for (std::size_t i = 1; i < subs.size(); ++i) {
+							clause({-x, -subs[0], subs[i]});
+							clause({-x, subs[0], -subs[i]});
+						}
+					}
+					if (negative) {
+						// If all are true or all are false, x holds.
+						mClause.assign(1, x);
+						for (int s: subs) mClause.push_back(-s);
+						mClauses.add(mClause.begin(), mClause.end());
+						mClause.assign(1, x);
+						mClause.insert(mClause.end(), subs.begin(), subs.end());
+						mClauses.add(mClause.begin(), mClause.end());
+					}
+					break;
+				}
+				case FormulaType::XOR: {
+					// A chain of binary xors, whose intermediate results are auxiliary variables.
+					const auto& subs = f.subformulas();
+					int y = literal(subs[0], cnf::BOTH);
+					if (subs.size() == 1) {
+						clause({-x, y});
+						clause({x, -y});
+						break;
+					}
+					for (std::size_t i = 1; i < subs.size(); ++i) {
+						int z = i + 1 == subs.size() ? x : variable(cnf::Key{f.getId(), i}, cnf::VariableKind::AUXILIARY, &f);
+						encodeXor(z, y, literal(subs[i], cnf::BOTH));
+						y = z;
+					}
+					break;
+				}
+				default:
+					assert(false);
+			}
+		}
+
+		void run(const std::vector<const Formula<Pol>*>& conjuncts, std::size_t begin, std::size_t end) {
+			for (std::size_t i = begin; i < end; ++i) {
+				const Formula<Pol>& c = *conjuncts[i];
+				if (c.isTrue()) continue;
+				if (c.getType() == FormulaType::OR) {
+					// Top-level disjunctions are clauses, no need for a Tseitin variable.
+					std::vector<int> lits;
+					for (const auto& sub: c.subformulas()) lits.push_back(literal(sub, cnf::POSITIVE));
+					mClauses.add(lits.begin(), lits.end());
+				} else {
+					int l = literal(c, cnf::POSITIVE);
+					mClauses.add(&l, &l + 1);
+				}
+				while (!mJobs.empty()) {
+					Job job = mJobs.back();
+					mJobs.pop_back();
+					encode(job);
+				}
+			}
+		}
+	};
+
+	/// Makes the variables of the worker global and appends its clauses, renaming its local variables.
+	void merge(const Worker& worker, ClauseArray& result) {
+		std::vector<int> renaming(worker.mKeys.size());
+		for (std::size_t i = 0; i < worker.mKeys.size(); ++i) {
+			auto res = mVariables.emplace(worker.mKeys[i], int(mKinds.size()) + 1);
+			if (res.second) {
+				mKinds.push_back(worker.mKinds[i]);
+				if (worker.mDefinitions[i] == nullptr) mDefinitions.emplace_back(FormulaType::TRUE);
+				else mDefinitions.push_back(*worker.mDefinitions[i]);
+				mEncoded.push_back(cnf::NONE);
+			}
+			renaming[i] = res.first->second;
+			auto& encoded = mEncoded[std::size_t(renaming[i] - 1)];
+			encoded = cnf::Polarity(encoded | worker.mEncoded[i]);
+		}
+		for (const auto& e: worker.mEncodedGlobal) {
+			auto& encoded = mEncoded[std::size_t(e.first - 1)];
+			encoded = cnf::Polarity(encoded | e.second);
+		}
+		std::size_t base = result.literals.size();
+		result.literals.reserve(base + worker.mClauses.literals.size());
+		for (int l: worker.mClauses.literals) {
+			int v = l < 0 ? -l : l;
+			if (v > worker.mBase) v = renaming[std::size_t(v - worker.mBase - 1)];
+			result.literals.push_back(l < 0 ? -v : v);
+		}
+		for (std::size_t i = 1; i < worker.mClauses.offsets.size(); ++i) {
+			result.offsets.push_back(base + worker.mClauses.offsets[i]);
+		}
+	}
+
+public:
+	/**
+	 * @param threads Maximum number of threads that convert the top-level conjuncts.
+	 */
+	explicit CNFConverter(std::size_t threads = 1): mThreads(std::max(std::size_t(1), threads)) {}
+
+	/**
+	 * Converts the formula to clauses.
+	 * Definitions that were encoded by previous calls are not repeated, hence the clauses of all calls together are
+	 * equisatisfiable to the conjunction of all converted formulas.
+	 * @return The clauses, whose number of variables is the number of variables of this converter.
+	 */
+	ClauseArray convert(const Formula<Pol>& formula) {
+		std::vector<const Formula<Pol>*> conjuncts;
+		std::vector<const Formula<Pol>*> stack = {&formula};
+		while (!stack.empty()) {
+			const Formula<Pol>* f = stack.back();
+			stack.pop_back();
+			if (f->getType() == FormulaType::AND) {
+				for (auto it = f->subformulas().rbegin(); it != f->subformulas().rend(); ++it) stack.push_back(&*it);
+			} else {
+				conjuncts.push_back(f);
+			}
+		}
+		std::size_t threads = std::max(std::size_t(1), std::min(mThreads, conjuncts.size() / minConjunctsPerThread));
+		std::vector<Worker> workers(threads, Worker(*this));
+		std::vector<std::thread> running;
+		for (std::size_t t = 1; t < threads; ++t) {
+			running.emplace_back([&workers, &conjuncts, t, threads]() {
+				workers[t].run(conjuncts, conjuncts.size() * t / threads, conjuncts.size() * (t + 1) / threads);
+			});
+		}
+		workers[0].run(conjuncts, 0, conjuncts.size() / threads);
+		for (auto& t: running) t.join();
+
+		ClauseArray result;
+		for (const auto& w: workers) merge(w, result);
+		result.variables = mKinds.size();
+		return result;
+	}
+
+	/**
+	 * Converts clauses of this converter into a conjunction of disjunctions, creating the clauses as one batch.
+	 * Tseitin variables are taken from the FormulaPool, hence they coincide with the ones of Formula::toCNF().
+	 */
+	Formula<Pol> toFormula(const ClauseArray& clauses) {
+		while (mFormulas.size() < mKinds.size()) {
+			std::size_t i = mFormulas.size();
+			switch (mKinds[i]) {
+				case cnf::VariableKind::ATOM:
+					mFormulas.push_back(mDefinitions[i]);
+					break;
+				case cnf::VariableKind::TSEITIN:
+					mFormulas.push_back(FormulaPool<Pol>::getInstance().createTseitinVar(mDefinitions[i]));
+					break;
+				case cnf::VariableKind::AUXILIARY:
+					mFormulas.emplace_back(freshBooleanVariable());
+					break;
+			}
+		}
+		std::vector<Formulas<Pol>> batch(clauses.size());
+		for (std::size_t i = 0; i < clauses.size(); ++i) {
+			batch[i].reserve(std::size_t(clauses.end(i) - clauses.begin(i)));
+			for (const int* l = clauses.begin(i); l != clauses.end(i); ++l) {
+				if (*l > 0) batch[i].push_back(mFormulas[std::size_t(*l - 1)]);
+				else batch[i].push_back(mFormulas[std::size_t(-*l - 1)].negated());
+			}
+		}
+		return Formula<Pol>(FormulaType::AND, FormulaPool<Pol>::getInstance().createBatch(FormulaType::OR, std::move(batch), mThreads));
+	}
+
+	/// Converts the formula to an equisatisfiable formula in CNF.
+	Formula<Pol> toCNF(const Formula<Pol>& formula) {
+		return toFormula(convert(formula));
+	}
+
+	/// @return The number of variables.
+	std::size_t size() const {
+		return mKinds.size();
+	}
+	cnf::VariableKind kind(int variable) const {
+		return mKinds[std::size_t(variable - 1)];
+	}
+	/**
+	 * @return The atom a variable stands for, the formula a Tseitin variable stands for, or the xor an auxiliary
+	 * variable belongs to.
+	 */
+	const Formula<Pol>& definition(int variable) const {
+		return mDefinitions[std::size_t(variable - 1)];
+	}
+};
+
+}
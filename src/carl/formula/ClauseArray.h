@@ -0,0 +1,40 @@
+/**
+ * @file ClauseArray.h
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace carl {
+
+/**
+ * The clauses of a CNF in a single array of literals, without any Formula objects.
+ * Clause i consists of the literals from offsets[i] to offsets[i+1], every literal is a DIMACS literal, i.e. a
+ * nonzero integer whose absolute value is the variable and whose sign is the polarity.
+ */
+struct ClauseArray {
+	/// The number of variables, i.e. the largest variable that may occur.
+	std::size_t variables = 0;
+	std::vector<int> literals;
+	std::vector<std::size_t> offsets = {0};
+
+	std::size_t size() const {
+		return offsets.size() - 1;
+	}
+	const int* begin(std::size_t clause) const {
+		return literals.data() + offsets[clause];
+	}
+	const int* end(std::size_t clause) const {
+		return literals.data() + offsets[clause + 1];
+	}
+	/// Appends the clause consisting of the literals in [begin, end).
+	template<typename It>
+	void add(It begin, It end) {
+		literals.insert(literals.end(), begin, end);
+		offsets.push_back(literals.size());
+	}
+};
+
+}
@@ -338,6 +338,16 @@ namespace carl
             const ConstraintContent<Pol>* mpContent;
             
             explicit Constraint( const ConstraintContent<Pol>* _content );
+
+            /**
+             * Tag type to indicate that the usage of the content was already increased for this constraint, as is done
+             * by the create methods of the ConstraintPool.
+             */
+            struct adopt_usage {};
+
+            Constraint( adopt_usage, const ConstraintContent<Pol>* _content ):
+                mpContent( _content )
+            {}
             
             #ifdef THREAD_SAFE
             #define VARINFOMAP_LOCK_GUARD std::lock_guard<std::mutex> lock1( mpContent->mVarInfoMapMutex );
@@ -249,17 +249,17 @@ namespace carl
     
     template<typename Pol>
     Constraint<Pol>::Constraint( bool _valid ):
-        Constraint( ConstraintPool<Pol>::getInstance().create( _valid ) )
+        Constraint( adopt_usage(), ConstraintPool<Pol>::getInstance().create( _valid ) )
     {}
     
     template<typename Pol>
     Constraint<Pol>::Constraint( carl::Variable::Arg _var, Relation _rel, const typename Pol::NumberType& _bound ):
-        Constraint( ConstraintPool<Pol>::getInstance().create( _var, _rel, _bound ) )
+        Constraint( adopt_usage(), ConstraintPool<Pol>::getInstance().create( _var, _rel, _bound ) )
     {}
             
     template<typename Pol>
     Constraint<Pol>::Constraint( const Pol& _lhs, Relation _rel ):
-        Constraint( ConstraintPool<Pol>::getInstance().create( _lhs, _rel ) )
+        Constraint( adopt_usage(), ConstraintPool<Pol>::getInstance().create( _lhs, _rel ) )
     {
 		CARL_LOG_DEBUG("carl.formula.constraint", _lhs << " " << _rel << " 0  ->  " << *this);
 	}
@@ -267,7 +267,7 @@ namespace carl
     template<typename Pol>
     template<typename P, EnableIf<needs_cache<P>>>
     Constraint<Pol>::Constraint( const typename P::PolyType& _lhs, Relation _rel ):
-        Constraint( ConstraintPool<Pol>::getInstance().create( _lhs, _rel ) )
+        Constraint( adopt_usage(), ConstraintPool<Pol>::getInstance().create( _lhs, _rel ) )
     {}
     
     template<typename Pol>
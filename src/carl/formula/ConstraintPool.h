@@ -9,14 +9,23 @@
 
 #pragma once
 
+#include "../util/Instrumentation.h"
 #include "../util/Singleton.h"
 #include "../util/Common.h"
+#include "../util/StripedPointerSet.h"
 #include "Constraint.h"
+#include "PoolStatistics.h"
+#include <atomic>
 #include <limits>
 #include <mutex>
 
 namespace carl
 {
+    /**
+     * Stores all constraints, such that equal constraints share their content.
+     * The pool is split into stripes with a lock each (if carl is built with THREAD_SAFE), hence constraints can be
+     * constructed and released concurrently and only contend if they happen to fall into the same stripe.
+     */
     template<typename Pol>
     class ConstraintPool : public Singleton<ConstraintPool<Pol>>
     {
@@ -25,29 +34,20 @@ namespace carl
             // Members:
 
             /// A flag indicating whether the last constraint which has been tried to add to the pool, was already an element of it.
-            bool mLastConstructedConstraintWasKnown;
+            std::atomic<bool> mLastConstructedConstraintWasKnown;
             /// id allocator
-            unsigned mIdAllocator;
+            std::atomic<unsigned> mIdAllocator;
             /// The constraint (0=0) representing a valid constraint.
             const ConstraintContent<Pol>* mConsistentConstraint;
             /// The constraint (0>0) representing an inconsistent constraint.
             const ConstraintContent<Pol>* mInconsistentConstraint;
-            /// Mutex to avoid multiple access to the pool
-            mutable std::recursive_mutex mMutexPool;
-            /// The constraint pool.
-            FastPointerSet<ConstraintContent<Pol>> mConstraints;
+            /// The constraint pool, every constraint is guarded by the lock of its stripe.
+            StripedPointerSet<ConstraintContent<Pol>> mConstraints;
             /// Pointer to the polynomial cache, if cache is needed of the polynomial type, otherwise, it is nullptr.
             std::shared_ptr<typename Pol::CACHE> mpPolynomialCache;
             
-            #ifdef THREAD_SAFE
-            #define CONSTRAINT_POOL_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock1( mMutexPool );
-            #define CONSTRAINT_POOL_LOCK mMutexPool.lock();
-            #define CONSTRAINT_POOL_UNLOCK mMutexPool.unlock();
-            #else
-            #define CONSTRAINT_POOL_LOCK_GUARD
-            #define CONSTRAINT_POOL_LOCK
-            #define CONSTRAINT_POOL_UNLOCK
-            #endif
+            /// Locks the stripe of the pool that stores constraints equal to the given one.
+            #define CONSTRAINT_POOL_LOCK_GUARD( _cc ) auto lock1 = mConstraints.lock( _cc );
             
             /**
              * Creates a normalized constraint, which has the same solutions as the constraint consisting of the given
@@ -114,40 +114,41 @@ namespace carl
             ~ConstraintPool();
 
             /**
-             * @return An iterator to the first constraint in this pool.
+             * Calls the given function on all constraints in this pool.
+             * Note: The function must not construct or release constraints.
              */
-            typename FastPointerSet<ConstraintContent<Pol>>::const_iterator begin() const
+            template<typename F>
+            void forEach( F&& _f ) const
             {
-                // TODO: Will begin() be valid if we insert elements?
-                CONSTRAINT_POOL_LOCK_GUARD
-                auto result = mConstraints.begin();
-                return result;
+                mConstraints.forEach( std::forward<F>( _f ) );
             }
 
             /**
-             * @return An iterator to the end of the container of the constraints in this pool.
+             * @return The number of constraint in this pool.
              */
-            typename FastPointerSet<ConstraintContent<Pol>>::const_iterator end() const
+            size_t size() const
             {
-                // TODO: Will end() be changed if we insert elements?
-                CONSTRAINT_POOL_LOCK_GUARD
-                auto result = mConstraints.end();
-                return result;
+                return mConstraints.size();
             }
-
+            
             /**
-             * @return The number of constraint in this pool.
+             * Counts the constraints in this pool.
+             * All of them are live, as a constraint is deleted as soon as it is not used anymore.
              */
-            size_t size() const
+            PoolStatistics statistics() const
             {
-                CONSTRAINT_POOL_LOCK_GUARD
-                size_t result = mConstraints.size();
-                return result;
+                PoolStatistics res( "ConstraintPool" );
+                mConstraints.forEach( [&res]( const ConstraintContent<Pol>* )
+                {
+                    res.addLive( sizeof( ConstraintContent<Pol> ) );
+                } );
+                return res;
             }
             
             /**
              * @return true, the last constraint which has been tried to add to the pool, was already an element of it;
              *         false, otherwise.
+             * Note: If constraints are constructed concurrently, this refers to the one that was finished last.
              */
             bool lastConstructedConstraintWasKnown() const
             {
@@ -166,13 +167,12 @@ namespace carl
             std::size_t maxDegree() const
             {
                 std::size_t result = 0;
-                CONSTRAINT_POOL_LOCK_GUARD
-                for( auto constraint = mConstraints.begin(); constraint != mConstraints.end(); ++constraint )
+                mConstraints.forEach( [&result]( const ConstraintContent<Pol>* constraint )
                 {
-                    std::size_t maxdeg = isZero((*constraint)->mLhs) ? 0 : (*constraint)->mLhs.totalDegree();
+                    std::size_t maxdeg = isZero(constraint->mLhs) ? 0 : constraint->mLhs.totalDegree();
                     if(maxdeg > result) 
                         result = maxdeg;
-                }
+                } );
                 return result;
             }
             
@@ -183,12 +183,11 @@ namespace carl
             unsigned nrNonLinearConstraints() const
             {
                 unsigned nonlinear = 0;
-                CONSTRAINT_POOL_LOCK_GUARD
-                for( auto constraint = mConstraints.begin(); constraint != mConstraints.end(); ++constraint )
+                mConstraints.forEach( [&nonlinear]( const ConstraintContent<Pol>* constraint )
                 {
-                    if( !(*constraint)->mLhs.isLinear() ) 
+                    if( !constraint->mLhs.isLinear() ) 
                         ++nonlinear;
-                }
+                } );
                 return nonlinear;
             }
             
@@ -230,7 +229,7 @@ namespace carl
              */
             const ConstraintContent<Pol>* create( bool _true )
             {
-                return _true ? consistentConstraint() : inconsistentConstraint();
+                return acquire( _true ? consistentConstraint() : inconsistentConstraint() );
             }
             
             const ConstraintContent<Pol>* create( carl::Variable::Arg _var, Relation _rel )
@@ -246,22 +245,43 @@ namespace carl
             
             void free( const ConstraintContent<Pol>* _cc ) noexcept
             {
-                CONSTRAINT_POOL_LOCK_GUARD
-                assert( _cc->mUsages > 0 );
-                --_cc->mUsages;
-                if( _cc->mUsages == 0 )
                 {
+                    CONSTRAINT_POOL_LOCK_GUARD( _cc )
+                    assert( _cc->mUsages > 0 );
+                    --_cc->mUsages;
+                    if( _cc->mUsages > 0 )
+                        return;
                     mConstraints.erase( _cc );
-                    delete _cc;
                 }
+                // Deleting outside of the lock keeps the critical section short.
+                delete _cc;
             }
             
             void reg( const ConstraintContent<Pol>* _cc ) const
             {
-                CONSTRAINT_POOL_LOCK_GUARD
+                CONSTRAINT_POOL_LOCK_GUARD( _cc )
+                regLocked( _cc );
+            }
+
+            /**
+             * Increases the usages of the given constraint, the lock of its stripe must be held.
+             */
+            void regLocked( const ConstraintContent<Pol>* _cc ) const
+            {
                 assert( _cc->mUsages < std::numeric_limits<size_t>::max() );
                 ++_cc->mUsages;
             }
+
+            /**
+             * Registers a constraint that is returned by one of the create methods although it was not created by them.
+             * The create methods return constraints whose usage is already increased, which the caller adopts.
+             * Otherwise, another thread could release the last usage before the caller registers the constraint.
+             */
+            const ConstraintContent<Pol>* acquire( const ConstraintContent<Pol>* _cc ) const
+            {
+                reg( _cc );
+                return _cc;
+            }
             
             /**
              * Prints all constraints in the constraint pool on the given stream.
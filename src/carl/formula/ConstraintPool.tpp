@@ -56,39 +56,41 @@ namespace carl
     template<typename Pol>
     void ConstraintPool<Pol>::clear()
     {
-        CONSTRAINT_POOL_LOCK_GUARD
         mIdAllocator = 3;
     }
     
     template<typename Pol>
     const ConstraintContent<Pol>* ConstraintPool<Pol>::create( const Variable& _var, const Relation _rel, const typename Pol::NumberType& _bound )
     {
-        CONSTRAINT_POOL_LOCK_GUARD
         ConstraintContent<Pol>* constraint = createNormalizedBound( _var, _rel, _bound );
-        auto iterBoolPair = mConstraints.insert( constraint );
-        if( iterBoolPair.second )
+        std::pair<const ConstraintContent<Pol>*, bool> elemBoolPair;
+        CARL_COUNT("carl.pool.constraint.lookup");
         {
-            constraint->mVariables.insert(_var);
-            constraint->initEager();
-            constraint->mID = mIdAllocator;
-            ++mIdAllocator;
-            mLastConstructedConstraintWasKnown = false;
+            CONSTRAINT_POOL_LOCK_GUARD( constraint )
+            elemBoolPair = mConstraints.insert( constraint );
+            if( elemBoolPair.second )
+            {
+                CARL_COUNT("carl.pool.constraint.insert");
+                // Initialize while holding the lock, as other threads can find the constraint once it is inserted.
+                constraint->mVariables.insert(_var);
+                constraint->initEager();
+                constraint->mID = mIdAllocator++;
+            }
+            // The caller adopts this usage.
+            regLocked( elemBoolPair.first );
         }
-        else
-        {
-            mLastConstructedConstraintWasKnown = true;
+        mLastConstructedConstraintWasKnown = !elemBoolPair.second;
+        if( !elemBoolPair.second )
             delete constraint;
-        }
-        return *iterBoolPair.first;
+        return elemBoolPair.first;
     }
 
     template<typename Pol>
     const ConstraintContent<Pol>* ConstraintPool<Pol>::create( const Pol& _lhs, Relation _rel )
     {
-        CONSTRAINT_POOL_LOCK_GUARD
         if( _lhs.isConstant() ) {
 			CARL_LOG_DEBUG("carl.formula.constraint", _lhs << " is constant, we simply evaluate.");
-            return evaluate( _lhs.constantPart(), _rel ) ? mConsistentConstraint : mInconsistentConstraint;
+            return acquire( evaluate( _lhs.constantPart(), _rel ) ? mConsistentConstraint : mInconsistentConstraint );
 		}
         if( _lhs.totalDegree() == 1 && (_rel != Relation::EQ && _rel != Relation::NEQ) && _lhs.isUnivariate() )
         {
@@ -249,61 +251,72 @@ namespace carl
 		///@todo Use appropriate constant instead of 2.
         if( constraintConsistent == 2 ) // Constraint contains variables.
         {
-            auto iterBoolPair = mConstraints.insert( _constraint );
-            if( !iterBoolPair.second ) // Constraint has already been generated.
+            std::pair<const ConstraintContent<Pol>*, bool> elemBoolPair;
+            ConstraintContent<Pol>* constraint = nullptr;
+            CARL_COUNT("carl.pool.constraint.lookup");
             {
-                mLastConstructedConstraintWasKnown = true;
-                delete _constraint;
-            }
-            else
-            {
-                ConstraintContent<Pol>* constraint = _constraint->simplify();
-                if( constraint != nullptr ) // Constraint could be simplified.
+                CONSTRAINT_POOL_LOCK_GUARD( _constraint )
+                elemBoolPair = mConstraints.insert( _constraint );
+                if( elemBoolPair.second )
                 {
-                    mConstraints.erase( iterBoolPair.first );
-                    delete _constraint;
-                    auto iterBoolPairB = mConstraints.insert( constraint );
-                    if( !iterBoolPairB.second ) // Simplified version already exists
-                    {
-                        mLastConstructedConstraintWasKnown = true;
-                        delete constraint;
-                    }
-                    else // Simplified version has not been generated before.
+                    CARL_COUNT("carl.pool.constraint.insert");
+                    constraint = _constraint->simplify();
+                    if( constraint != nullptr ) // Constraint could be simplified.
+                        mConstraints.erase( _constraint );
+                    else // Constraint could not be simplified.
                     {
-                        constraint->initLazy();
-                        constraint->initEager();
-                        constraint->mID = mIdAllocator;
-                        ++mIdAllocator;
+                        _constraint->initEager();
+                        _constraint->mID = mIdAllocator++;
                     }
-                    assert( (*iterBoolPairB.first)->mUsages < std::numeric_limits<size_t>::max() );
-                    ++(*iterBoolPairB.first)->mUsages;
-                    return *iterBoolPairB.first;
                 }
-                else // Constraint could not be simplified.
+                // The caller adopts this usage, unless the constraint is replaced by its simplification.
+                if( constraint == nullptr )
+                    regLocked( elemBoolPair.first );
+            }
+            if( !elemBoolPair.second ) // Constraint has already been generated.
+            {
+                mLastConstructedConstraintWasKnown = true;
+                delete _constraint;
+                return elemBoolPair.first;
+            }
+            if( constraint == nullptr )
+                return elemBoolPair.first;
+            delete _constraint;
+            // The simplified constraint is stored in another stripe, hence the first lock has to be released before.
+            const ConstraintContent<Pol>* result;
+            {
+                CONSTRAINT_POOL_LOCK_GUARD( constraint )
+                auto elemBoolPairB = mConstraints.insert( constraint );
+                if( elemBoolPairB.second ) // Simplified version has not been generated before.
                 {
-                    _constraint->initEager();
-                    _constraint->mID = mIdAllocator;
-                    ++mIdAllocator;
+                    constraint->initLazy();
+                    constraint->initEager();
+                    constraint->mID = mIdAllocator++;
                 }
+                result = elemBoolPairB.first;
+                regLocked( result );
+                mLastConstructedConstraintWasKnown = !elemBoolPairB.second;
             }
-            return *iterBoolPair.first;
+            if( result != constraint ) // Simplified version already exists
+                delete constraint;
+            return result;
         }
         else // Constraint contains no variables.
         {
             mLastConstructedConstraintWasKnown = true;
             delete _constraint;
-            const ConstraintContent<Pol>* result = (constraintConsistent ? mConsistentConstraint : mInconsistentConstraint );
-            return result;
+            return acquire( constraintConsistent ? mConsistentConstraint : mInconsistentConstraint );
         }
     }
 
     template<typename Pol>
     void ConstraintPool<Pol>::print( std::ostream& _out ) const
     {
-        CONSTRAINT_POOL_LOCK_GUARD
         _out << "Constraint pool:" << std::endl;
-        for( auto constraint = mConstraints.begin(); constraint != mConstraints.end(); ++constraint )
-            _out << "    " << **constraint << "  [id=" << (*constraint)->mID << ", hash=" << (*constraint)->hash() << ", usages=" << (*constraint)->mUsages << "]" << std::endl;
+        mConstraints.forEach( [&_out]( const ConstraintContent<Pol>* constraint )
+        {
+            _out << "    " << *constraint << "  [id=" << constraint->mID << ", hash=" << constraint->hash() << ", usages=" << constraint->mUsages << "]" << std::endl;
+        } );
         _out << "---------------------------------------------------" << std::endl;
     }
 
@@ -76,6 +76,16 @@ namespace carl
                     FormulaPool<Pol>::getInstance().reg( _content );
             }
 
+            /**
+             * Tag type to indicate that the usage of the content was already increased for this formula, as is done by
+             * the create methods of the FormulaPool.
+             */
+            struct adopt_usage {};
+
+            Formula( adopt_usage, const FormulaContent<Pol>* _content ):
+                mpContent( _content )
+            {}
+
             #ifdef THREAD_SAFE
             #define ACTIVITY_LOCK_GUARD std::lock_guard<std::mutex> lock1( mpContent->mActivityMutex );
             #define DIFFICULTY_LOCK_GUARD std::lock_guard<std::mutex> lock2( mpContent->mDifficultyMutex );
@@ -95,80 +105,80 @@ namespace carl
             static void init( FormulaContent<Pol>& _content );
 
             explicit Formula( FormulaType _type = FALSE ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _type ) )
             {}
 
             explicit Formula( Variable::Arg _booleanVar ):
-                Formula( FormulaPool<Pol>::getInstance().create( _booleanVar ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _booleanVar ) )
             {}
 
             explicit Formula( const Pol& _pol, Relation _rel ):
-                Formula( FormulaPool<Pol>::getInstance().create( Constraint<Pol>( _pol, _rel ) ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( Constraint<Pol>( _pol, _rel ) ) )
             {}
 
             explicit Formula( const Constraint<Pol>& _constraint ):
-                Formula( FormulaPool<Pol>::getInstance().create( _constraint ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _constraint ) )
             {}
 
 			explicit Formula( const VariableComparison<Pol>& _variableComparison ):
-				Formula( FormulaPool<Pol>::getInstance().create( _variableComparison ) )
+				Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _variableComparison ) )
 			{}
 
 			explicit Formula( const VariableAssignment<Pol>& _variableAssignment ):
-				Formula( FormulaPool<Pol>::getInstance().create( _variableAssignment ) )
+				Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _variableAssignment ) )
 			{}
 
             explicit Formula( const BVConstraint& _constraint ):
-                Formula( FormulaPool<Pol>::getInstance().create( _constraint ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _constraint ) )
             {}
 
             explicit Formula( FormulaType _type, Formula&& _subformula ):
-                Formula(FormulaPool<Pol>::getInstance().create(_type, std::move(_subformula)))
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create(_type, std::move(_subformula)))
             {}
 
             explicit Formula( FormulaType _type, const Formula& _subformula ):
-                Formula(FormulaPool<Pol>::getInstance().create(_type, std::move(Formula(_subformula))))
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create(_type, std::move(Formula(_subformula))))
             {}
 
             explicit Formula( FormulaType _type, const Formula& _subformulaA, const Formula& _subformulaB ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, {_subformulaA, _subformulaB} ))
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _type, {_subformulaA, _subformulaB} ))
             {
                 assert( _type == FormulaType::AND || _type == FormulaType::IFF || _type == FormulaType::IMPLIES || _type == FormulaType::OR || _type == FormulaType::XOR );
             }
 
             explicit Formula( FormulaType _type, const Formula& _subformulaA, const Formula& _subformulaB, const Formula& _subformulaC):
-                Formula( FormulaPool<Pol>::getInstance().create(_type, {_subformulaA, _subformulaB, _subformulaC}))
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create(_type, {_subformulaA, _subformulaB, _subformulaC}))
             {}
 
             explicit Formula( FormulaType _type, const FormulasMulti<Pol>& _subformulas ):
-                Formula( FormulaPool<Pol>::getInstance().create( _subformulas ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _subformulas ) )
             {
                 assert( _type == FormulaType::XOR );
             }
 
             explicit Formula( FormulaType _type, const Formulas<Pol>& _subasts ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, _subasts ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _type, _subasts ) )
             {}
 
             explicit Formula( FormulaType _type, Formulas<Pol>&& _subasts ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, std::move(_subasts) ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _type, std::move(_subasts) ) )
             {}
 
             explicit Formula( FormulaType _type, const std::initializer_list<Formula<Pol>>& _subasts ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ))
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ))
             {}
 
             explicit Formula( FormulaType _type, const FormulaSet<Pol>& _subasts ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ))
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ))
             {}
 
             // TODO: Does the following constructor anything more efficient than the one before?
             explicit Formula( FormulaType _type, FormulaSet<Pol>&& _subasts ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ))
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ))
             {}
 
             explicit Formula( FormulaType _type, std::vector<Variable>&& _vars, const Formula& _term ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, std::move( _vars ), _term ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _type, std::move( _vars ), _term ) )
             {}
 
             explicit Formula( FormulaType _type, const std::vector<Variable>& _vars, const Formula& _term ):
@@ -176,15 +186,15 @@ namespace carl
             {}
 
             explicit Formula( const UTerm& _lhs, const UTerm& _rhs, bool _negated ):
-                Formula( FormulaPool<Pol>::getInstance().create( _lhs, _rhs, _negated ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( _lhs, _rhs, _negated ) )
             {}
 
             explicit Formula( UEquality&& _eq ):
-                Formula( FormulaPool<Pol>::getInstance().create( std::move( _eq ) ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( std::move( _eq ) ) )
             {}
 
             explicit Formula( const UEquality& _eq ):
-                Formula( FormulaPool<Pol>::getInstance().create( std::move( UEquality( _eq ) ) ) )
+                Formula( adopt_usage(), FormulaPool<Pol>::getInstance().create( std::move( UEquality( _eq ) ) ) )
             {}
 
             Formula( const Formula& _formula ):
@@ -1032,6 +1042,7 @@ namespace carl
              * @param _tseitinWithEquivalence A flag, which is true, if variables, which are introduced by the tseitin encoding
              *                                are set to be equivalent to the formula they represent. Otherwise, they imply the formula,
              *                                which is also valid, as the current formula context is in NNF.
+             * @see CNFConverter for a polarity-aware conversion that shares common subformulas and can produce plain clauses.
              */
             Formula toCNF( bool _keepConstraints = true, bool _simplifyConstraintCombinations = false, bool _tseitinWithEquivalence = true ) const;
 
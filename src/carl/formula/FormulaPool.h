@@ -7,12 +7,19 @@
 
 #pragma once
 
+#include "../util/Instrumentation.h"
 #include "../util/Singleton.h"
+#include "../util/StripedPointerSet.h"
 #include "../core/VariablePool.h"
 #include "Formula.h"
 #include "ConstraintPool.h"
+#include "PoolStatistics.h"
+#include <algorithm>
+#include <atomic>
 #include <mutex>
 #include <limits>
+#include <thread>
+#include <vector>
 #include <boost/variant.hpp>
 #include "bitvector/BVConstraintPool.h"
 #include "bitvector/BVConstraint.h"
@@ -22,6 +29,13 @@
 namespace carl
 {
 
+    /**
+     * Stores all formulas, such that equal formulas share their content.
+     * The pool is split into stripes with a lock each (if carl is built with THREAD_SAFE), hence formulas can be
+     * constructed and released concurrently and only contend if they happen to fall into the same stripe.
+     * The Tseitin variables have a lock of their own, which is always acquired before any stripe lock.
+     * Contents are deleted only after all locks are released, as deleting a formula releases its sub-formulas.
+     */
     template<typename Pol>
     class FormulaPool : public Singleton<FormulaPool<Pol>>
     {
@@ -32,28 +46,28 @@ namespace carl
 
             // Members:
             /// id allocator
-            unsigned mIdAllocator;
+            std::atomic<unsigned> mIdAllocator;
             /// The unique formula representing true.
             FormulaContent<Pol>* mpTrue;
             /// The unique formula representing false.
             FormulaContent<Pol>* mpFalse;
-            /// The formula pool.
-            FastPointerSet<FormulaContent<Pol>> mPool;
-            /// Mutex to avoid multiple access to the pool
-            mutable std::recursive_mutex mMutexPool;
+            /// The formula pool, every formula is guarded by the lock of its stripe.
+            StripedPointerSet<FormulaContent<Pol>> mPool;
+            /// Mutex to avoid multiple access to the Tseitin variables
+            mutable std::mutex mMutexTseitin;
             ///
             FastPointerMap<FormulaContent<Pol>,const FormulaContent<Pol>*> mTseitinVars;
             ///
             FastPointerMap<FormulaContent<Pol>,typename FastPointerMap<FormulaContent<Pol>,const FormulaContent<Pol>*>::iterator> mTseitinVarToFormula;
+            /// The size of mTseitinVars, such that releasing a formula only needs the Tseitin lock if there are any.
+            std::atomic<std::size_t> mNrTseitinVars;
 
+            /// Locks the stripe of the pool that stores formulas equal to the given one.
+            #define FORMULA_POOL_LOCK_GUARD( _elem ) auto lock = mPool.lock( _elem );
             #ifdef THREAD_SAFE
-            #define FORMULA_POOL_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock( mMutexPool );
-            #define FORMULA_POOL_LOCK mMutexPool.lock();
-            #define FORMULA_POOL_UNLOCK mMutexPool.unlock();
+            #define TSEITIN_LOCK_GUARD std::lock_guard<std::mutex> lockTseitin( mMutexTseitin );
             #else
-            #define FORMULA_POOL_LOCK_GUARD
-            #define FORMULA_POOL_LOCK
-            #define FORMULA_POOL_UNLOCK
+            #define TSEITIN_LOCK_GUARD
             #endif
 
         protected:
@@ -81,12 +95,112 @@ namespace carl
                 return mPool.size();
             }
 
+            /**
+             * Creates many formulas of the same n-ary type at once, e.g. all clauses of a CNF.
+             * The pool is reserved for all of them up front. If carl is built with THREAD_SAFE, the formulas are
+             * created by up to the given number of threads, as the pool is locked per stripe. Otherwise, they are
+             * created sequentially.
+             * @param _type AND, OR, XOR or IFF.
+             * @param _batch The subformulas of every formula to create.
+             * @param _threads Maximum number of threads.
+             * @return The created formulas, in the order of their subformulas.
+             */
+            Formulas<Pol> createBatch(FormulaType _type, std::vector<Formulas<Pol>>&& _batch, std::size_t _threads = 1);
+
+            /**
+             * Counts the live and dead formulas.
+             * A formula is dead if it is only kept, because it or its Tseitin variable is stored in the Tseitin maps.
+             * The bytes include the negation of every formula.
+             */
+            PoolStatistics statistics() const
+            {
+                PoolStatistics res("FormulaPool");
+                mPool.forEach([this, &res](const FormulaContent<Pol>* ele) {
+                    if (ele->mUsages > 1 || ele == mpTrue || ele == mpFalse)
+                        res.addLive(2 * sizeof(FormulaContent<Pol>));
+                    else
+                        res.addDead(2 * sizeof(FormulaContent<Pol>));
+                });
+                return res;
+            }
+
+            /**
+             * Deletes all dead formulas, see statistics(), and forgets the Tseitin variables of these formulas.
+             * Deleting a formula releases its sub-formulas, hence this is repeated until no dead formula is left.
+             * Note: A formula that is constructed again afterwards gets a fresh Tseitin variable.
+             * @return The statistics before the collection, that is the dead formulas are the deleted ones.
+             */
+            PoolStatistics collectGarbage()
+            {
+                PoolStatistics res = statistics();
+                std::vector<const FormulaContent<Pol>*> garbage;
+                do {
+                    garbage.clear();
+                    {
+                        TSEITIN_LOCK_GUARD
+                        for( auto iter = mTseitinVars.begin(); iter != mTseitinVars.end(); )
+                        {
+                            const FormulaContent<Pol>* formula = getBaseFormula( iter->first );
+                            const FormulaContent<Pol>* tseitinVar = iter->second;
+                            // Holding two stripe locks is fine, as this is serialized by the Tseitin lock.
+                            FORMULA_POOL_LOCK_GUARD( formula )
+                            auto lockVar = mPool.lock( tseitinVar );
+                            bool formulaDead = formula->mUsages == 1;
+                            bool tseitinVarDead = tseitinVar->mUsages == 1;
+                            if( !formulaDead && !tseitinVarDead )
+                            {
+                                ++iter;
+                                continue;
+                            }
+                            mTseitinVarToFormula.erase( tseitinVar );
+                            iter = mTseitinVars.erase( iter );
+                            --mNrTseitinVars;
+                            // A formula may be stored twice, as itself and as its negation.
+                            if( formulaDead && mPool.erase( formula ) > 0 )
+                                garbage.push_back( formula );
+                            if( tseitinVarDead && mPool.erase( tseitinVar ) > 0 )
+                                garbage.push_back( tseitinVar );
+                        }
+                    }
+                    for( const FormulaContent<Pol>* elem : garbage )
+                    {
+                        delete elem->mNegation;
+                        delete elem;
+                    }
+                } while( !garbage.empty() );
+                return res;
+            }
+
+            /**
+             * Collects the bit vector constraints and uninterpreted equalities of all formulas in the pool.
+             * These are the roots of the bit vector and uninterpreted function pools for a garbage collection.
+             */
+            void collectTheoryAtoms( std::vector<BVConstraint>& _bvConstraints, std::vector<UEquality>& _uequalities ) const
+            {
+                mPool.forEach([&](const FormulaContent<Pol>* ele) {
+                    if (ele->mType == FormulaType::BITVECTOR) {
+#ifdef __VS
+                        _bvConstraints.push_back(*ele->mpBVConstraintVS);
+#else
+                        _bvConstraints.push_back(ele->mBVConstraint);
+#endif
+                    } else if (ele->mType == FormulaType::UEQ) {
+#ifdef __VS
+                        _uequalities.push_back(*ele->mpUIEqualityVS);
+#else
+                        _uequalities.push_back(ele->mUIEquality);
+#endif
+                    }
+                });
+            }
+
             void print() const
             {
                 std::cout << "Formula pool contains:" << std::endl;
-                for (const auto& ele: mPool) {
+                mPool.forEach([](const FormulaContent<Pol>* ele) {
                     std::cout << ele->mId << " @ " << static_cast<const void*>(ele) << " [usages=" << ele->mUsages << "]: " << *ele << ", negation " << static_cast<const void*>(ele->mNegation) << std::endl;
-                }
+                });
+                TSEITIN_LOCK_GUARD
                 std::cout << "Tseitin variables:" << std::endl;
                 for( const auto& tvVar : mTseitinVars )
                 {
@@ -110,23 +224,27 @@ namespace carl
 
             Formula<Pol> getTseitinVar( const Formula<Pol>& _formula )
             {
+                TSEITIN_LOCK_GUARD
                 auto iter = mTseitinVars.find( _formula.mpContent );
                 if( iter != mTseitinVars.end() )
                 {
                     return Formula<Pol>( iter->second );
                 }
-                return trueFormula();
+                return Formula<Pol>( trueFormula() );
             }
 
             Formula<Pol> createTseitinVar( const Formula<Pol>& _formula )
             {
+                TSEITIN_LOCK_GUARD
                 auto iter = mTseitinVars.insert( std::make_pair( _formula.mpContent, nullptr ) );
                 if( iter.second )
                 {
+                    ++mNrTseitinVars;
                     const FormulaContent<Pol>* hi = create( carl::freshBooleanVariable() );
                     hi->mDifficulty = _formula.difficulty();
                     iter.first->second = hi;
                     mTseitinVarToFormula[hi] = iter.first;
+                    return Formula<Pol>( typename Formula<Pol>::adopt_usage(), hi );
                 }
                 return Formula<Pol>( iter.first->second );
             }
@@ -236,7 +354,7 @@ namespace carl
              */
             const FormulaContent<Pol>* create(FormulaType _type) {
                 assert(_type == TRUE || _type == FALSE);
-                return (_type == TRUE) ? trueFormula() : falseFormula();
+                return acquire((_type == TRUE) ? trueFormula() : falseFormula());
             }
 
             /**
@@ -255,8 +373,8 @@ namespace carl
             const FormulaContent<Pol>* create(Constraint<Pol>&& _constraint) {
                 #ifdef SIMPLIFY_FORMULA
                 switch (_constraint.isConsistent()) {
-                    case 0: return falseFormula();
-                    case 1: return trueFormula();
+                    case 0: return acquire(falseFormula());
+                    case 1: return acquire(trueFormula());
                     default: ;
                 }
                 #endif
@@ -294,8 +412,8 @@ namespace carl
 
             const FormulaContent<Pol>* create(BVConstraint&& _constraint) {
                 #ifdef SIMPLIFY_FORMULA
-                if (_constraint.isAlwaysConsistent()) return trueFormula();
-                if (_constraint.isAlwaysInconsistent()) return falseFormula();
+                if (_constraint.isAlwaysConsistent()) return acquire(trueFormula());
+                if (_constraint.isAlwaysInconsistent()) return acquire(falseFormula());
                 #endif
                 return add(new FormulaContent<Pol>(std::move(_constraint)));
             }
@@ -323,13 +441,13 @@ namespace carl
                     case BOOL:
                         assert(false); break;
                     case NOT:
-                        return _subFormula.mpContent->mNegation;
+                        return acquire(_subFormula.mpContent->mNegation);
                     case IMPLIES:
                         assert(false); break;
                     case AND:
                     case OR:
                     case XOR:
-                        return _subFormula.mpContent;
+                        return acquire(_subFormula.mpContent);
                     case IFF:
                         return create(TRUE);
 
@@ -412,7 +530,7 @@ namespace carl
 			const FormulaContent<Pol>* create(FormulaType _type, std::vector<Variable>&& _vars, const Formula<Pol>& _term) {
 				assert(_type == FormulaType::EXISTS || _type == FormulaType::FORALL);
 				if (_vars.empty()) {
-					return _term.mpContent;
+					return acquire(_term.mpContent);
 				} else {
 					return add( new FormulaContent<Pol>(_type, std::move(_vars), _term ) );
 				}
@@ -424,10 +542,10 @@ namespace carl
              */
             const FormulaContent<Pol>* create( const FormulasMulti<Pol>& _subformulas )
             {
-                if( _subformulas.empty() ) return falseFormula();
+                if( _subformulas.empty() ) return acquire(falseFormula());
                 if( _subformulas.size() == 1 )
                 {
-                    return _subformulas.begin()->mpContent;
+                    return acquire(_subformulas.begin()->mpContent);
                 }
                 Formulas<Pol> subFormulas;
                 auto lastSubFormula = _subformulas.begin();
@@ -462,8 +580,8 @@ namespace carl
 			{
                 #ifdef SIMPLIFY_FORMULA
 				if (_lhs == _rhs) {
-					if (_negated) return falseFormula();
-					else return trueFormula();
+					if (_negated) return acquire(falseFormula());
+					else return acquire(trueFormula());
 				}
 				#endif
 				return create(UEquality(_lhs, _rhs, _negated));
@@ -478,12 +596,58 @@ namespace carl
                 }
 			}
 
+            /**
+             * Registers a formula that is returned by one of the create methods although it was not created by them.
+             * The create methods return formulas whose usage is already increased, which the caller adopts. Otherwise,
+             * another thread could release the last usage before the caller registers the formula.
+             */
+            const FormulaContent<Pol>* acquire( const FormulaContent<Pol>* _elem ) const
+            {
+                reg( _elem );
+                return _elem;
+            }
+
             void free( const FormulaContent<Pol>* _elem )
             {
-                FORMULA_POOL_LOCK_GUARD
                 const FormulaContent<Pol>* tmp = getBaseFormula(_elem);
 				assert(tmp == getBaseFormula(tmp));
 				assert(isBaseFormula(tmp));
+                std::vector<const FormulaContent<Pol>*> garbage;
+                bool released = false;
+                {
+                    FORMULA_POOL_LOCK_GUARD( tmp )
+                    // Only if the formula may be deleted, its Tseitin variables have to be checked, which needs the Tseitin lock.
+                    // The counter is only increased under the Tseitin lock, before the new Tseitin variable is published.
+                    // A Tseitin variable for tmp can not be created concurrently, as this would need another usage of tmp.
+                    if( tmp->mUsages > 2 || mNrTseitinVars.load( std::memory_order_acquire ) == 0 )
+                    {
+                        release( _elem, tmp, false, garbage );
+                        released = true;
+                    }
+                }
+                if( !released )
+                {
+                    TSEITIN_LOCK_GUARD
+                    FORMULA_POOL_LOCK_GUARD( tmp )
+                    release( _elem, tmp, true, garbage );
+                }
+                for( const FormulaContent<Pol>* elem : garbage )
+                {
+                    delete elem->mNegation;
+                    delete elem;
+                }
+            }
+
+            /**
+             * Decreases the usages of the base formula tmp and removes it from the pool, if it is not used anymore.
+             * Note, that the lock of the stripe of tmp must be held and, if checkTseitin is true, also the Tseitin lock.
+             * @param _elem The released formula, only used for logging.
+             * @param tmp The base formula of _elem.
+             * @param checkTseitin If the Tseitin variables of tmp must be checked.
+             * @param garbage Collects the removed formulas, which are deleted by the caller.
+             */
+            void release( const FormulaContent<Pol>* _elem, const FormulaContent<Pol>* tmp, bool checkTseitin, std::vector<const FormulaContent<Pol>*>& garbage )
+            {
                 assert( tmp->mUsages > 0 );
                 --tmp->mUsages;
 				CARL_LOG_TRACE("carl.formula", "Usage of " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " (coming from " << static_cast<const void*>(_elem) << "): " << tmp->mUsages);
@@ -491,39 +655,43 @@ namespace carl
                 {
 					CARL_LOG_DEBUG("carl.formula", "Actually freeing " << *tmp << " from pool");
                     bool stillStoredAsTseitinVariable = false;
-                    if( freeTseitinVariable( tmp ) )
-                        stillStoredAsTseitinVariable = true;
-                    if( freeTseitinVariable( tmp->mNegation ) )
-                        stillStoredAsTseitinVariable = true;
+                    if( checkTseitin )
+                    {
+                        if( freeTseitinVariable( tmp, garbage ) )
+                            stillStoredAsTseitinVariable = true;
+                        if( freeTseitinVariable( tmp->mNegation, garbage ) )
+                            stillStoredAsTseitinVariable = true;
+                    }
                     if( !stillStoredAsTseitinVariable )
                     {
 						CARL_LOG_TRACE("carl.formula", "Deleting " << tmp << " / " << tmp->mNegation << " from pool");
-                        mPool.erase( tmp->mNegation );
+						// The negation is never stored in the pool.
 						mPool.erase( tmp );
-                        delete tmp->mNegation;
-                        delete tmp;
+                        garbage.push_back( tmp );
                     }
                 }
             }
 
-            bool freeTseitinVariable( const FormulaContent<Pol>* _toDelete )
+            bool freeTseitinVariable( const FormulaContent<Pol>* _toDelete, std::vector<const FormulaContent<Pol>*>& garbage )
             {
                 bool stillStoredAsTseitinVariable = false;
                 auto tvIter = mTseitinVars.find( _toDelete );
                 if( tvIter != mTseitinVars.end() )
                 {
                     // if this formula HAS a tseitin variable
-                    if( tvIter->second->mUsages == 1 )
+                    const FormulaContent<Pol>* tmp = tvIter->second;
+                    // Holding two stripe locks is fine, as this is serialized by the Tseitin lock.
+                    FORMULA_POOL_LOCK_GUARD( tmp )
+                    if( tmp->mUsages == 1 )
                     {
                         // the tseitin variable is not used -> delete it
-                        const FormulaContent<Pol>* tmp = tvIter->second;
                         mTseitinVars.erase( tvIter );
+                        --mNrTseitinVars;
                         assert( mTseitinVarToFormula.find( tmp ) != mTseitinVarToFormula.end() );
                         mTseitinVarToFormula.erase( tmp );
 						CARL_LOG_TRACE("carl.formula", "Deleting " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " from pool");
                         mPool.erase( tmp );
-                        delete tmp->mNegation;
-                        delete tmp;
+                        garbage.push_back( tmp );
                     }
                     else // the tseitin variable is used, so we cannot delete the formula
                         stillStoredAsTseitinVariable = true;
@@ -534,18 +702,18 @@ namespace carl
                     if( tmpTVIter != mTseitinVarToFormula.end() )
                     {
                         const FormulaContent<Pol>* fcont = tmpTVIter->second->first;
+                        const FormulaContent<Pol>* tmp = getBaseFormula(fcont);
+                        FORMULA_POOL_LOCK_GUARD( tmp )
                         // if this formula IS a tseitin variable
                         if( fcont->mUsages == 1 )
                         {
                             // the formula variable is not used -> delete it
-                            const FormulaContent<Pol>* tmp = getBaseFormula(fcont);
-                            //const FormulaContent<Pol>* tmp = fcont->mType == FormulaType::NOT ? fcont->mNegation : fcont;
                             mTseitinVars.erase( tmpTVIter->second );
+                            --mNrTseitinVars;
                             mTseitinVarToFormula.erase( tmpTVIter );
 							CARL_LOG_TRACE("carl.formula", "Deleting " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " from pool");
                             mPool.erase( tmp );
-                            delete tmp->mNegation;
-                            delete tmp;
+                            garbage.push_back( tmp );
                         }
                         else // the formula is used, so we cannot delete the tseitin variable
                             stillStoredAsTseitinVariable = true;
@@ -556,9 +724,18 @@ namespace carl
 
             void reg( const FormulaContent<Pol>* _elem ) const
             {
-                FORMULA_POOL_LOCK_GUARD
                 const FormulaContent<Pol>* tmp = getBaseFormula(_elem);
-                //const FormulaContent<Pol>* tmp = _elem->mType == FormulaType::NOT ? _elem->mNegation : _elem;
+                FORMULA_POOL_LOCK_GUARD( tmp )
+                regLocked( _elem, tmp );
+            }
+
+            /**
+             * Increases the usages of the base formula tmp, the lock of its stripe must be held.
+             * @param _elem The registered formula, only used for logging.
+             * @param tmp The base formula of _elem.
+             */
+            void regLocked( const FormulaContent<Pol>* _elem, const FormulaContent<Pol>* tmp ) const
+            {
                 assert( tmp != nullptr );
                 assert( tmp->mUsages < std::numeric_limits<size_t>::max() );
                 ++tmp->mUsages;
@@ -573,23 +750,21 @@ namespace carl
             template<typename ArgType>
             void forallDo( void (*_func)( ArgType*, const Formula<Pol>& ), ArgType* _arg ) const
             {
-                FORMULA_POOL_LOCK_GUARD
-                for( const FormulaContent<Pol>* formula : mPool )
+                mPool.forEach( [&]( const FormulaContent<Pol>* formula )
                 {
                     (*_func)( _arg, Formula<Pol>( formula ) );
                     if( formula != mpFalse )
                     {
                         (*_func)( _arg, Formula<Pol>( formula->mNegation ) );
                     }
-                }
+                } );
             }
 
             template<typename ReturnType, typename ArgType>
             std::map<const Formula<Pol>,ReturnType> forallDo( ReturnType (*_func)( ArgType*, const Formula<Pol>& ), ArgType* _arg ) const
             {
-                FORMULA_POOL_LOCK_GUARD
                 std::map<const Formula<Pol>,ReturnType> result;
-                for( const FormulaContent<Pol>* elem : mPool )
+                mPool.forEach( [&]( const FormulaContent<Pol>* elem )
                 {
                     Formula<Pol> form(elem);
                     result[form] = (*_func)( _arg, form );
@@ -598,7 +773,7 @@ namespace carl
                         Formula<Pol> form2(elem->mNegation);
                         result[form2] = (*_func)( _arg, form2 );
                     }
-                }
+                } );
                 return result;
             }
 
@@ -619,17 +794,9 @@ namespace carl
 
     private:
 
-            /**
-             * Inserts the given formula to the pool, if it does not yet occur in there.
-             * @param _formula The formula to add to the pool.
-             * @return The position of the given formula in the pool and true, if it did not yet occur in the pool;
-             *         The position of the equivalent formula in the pool and false, otherwise.
-             */
-            std::pair<typename FastPointerSet<FormulaContent<Pol>>::iterator,bool> insert( FormulaContent<Pol>* _formula );
-
             /**
              * Adds the given formula to the pool, if it does not yet occur in there.
-             * Note, that this method uses the allocator which is locked before calling.
+             * @sideeffect The given formula will be deleted, if it already occurs in the pool.
              * @param _formula The formula to add to the pool.
              * @return The given formula, if it did not yet occur in the pool;
              *         The equivalent formula already occurring in the pool, otherwise.
@@ -19,7 +19,8 @@ namespace carl
         mpFalse( new FormulaContent<Pol>( FALSE, 2 ) ),
         mPool(),
         mTseitinVars(),
-        mTseitinVarToFormula()
+        mTseitinVarToFormula(),
+        mNrTseitinVars( 0 )
     {
 		logging::logger();
 		VariablePool::getInstance();
@@ -45,47 +46,44 @@ namespace carl
     }
     
     template<typename Pol>
-    std::pair<typename FastPointerSet<FormulaContent<Pol>>::iterator,bool> FormulaPool<Pol>::insert( FormulaContent<Pol>* _element )
+    const FormulaContent<Pol>* FormulaPool<Pol>::add( FormulaContent<Pol>* _element )
     {
+        assert( _element->mType != FormulaType::NOT );
 		CARL_LOG_DEBUG("carl.formula", "Inserting " << static_cast<const void*>(_element));
-        auto iterBoolPair = mPool.insert( _element );
-        if( !iterBoolPair.second ) // Formula has already been generated.
+        std::pair<const FormulaContent<Pol>*,bool> elemBoolPair;
+        CARL_COUNT("carl.pool.formula.lookup");
         {
-			CARL_LOG_DEBUG("carl.formula", "Deleting " << static_cast<const void*>(_element) << " as it was already part of the pool");
-	        delete _element;
+            FORMULA_POOL_LOCK_GUARD( _element )
+            elemBoolPair = mPool.insert( _element );
+            if( elemBoolPair.second ) // Formula has not yet been generated.
+            {
+                CARL_COUNT("carl.pool.formula.insert");
+				CARL_LOG_DEBUG("carl.formula", "Just added " << static_cast<const void*>(_element) << " to the pool");
+				// Add also the negation of the formula to the pool in order to ensure that it
+                // has the next id and hence would occur next to the formula in a set of sub-formula,
+                // which is sorted by the ids.
+                unsigned id = mIdAllocator.fetch_add( 2 );
+                _element->mId = id;
+                Formula<Pol>::init( *_element );
+                auto negation = createNegatedContent(_element);
+                _element->mNegation = negation;
+                negation->mId = id + 1;
+                negation->mNegation = _element;
+                Formula<Pol>::init( *negation );
+				CARL_LOG_DEBUG("carl.formula", "Added " << _element << " / " << negation << " to pool");
+            }
+            // The caller adopts this usage, the formula may be released by other threads as soon as the lock is released.
+            regLocked( elemBoolPair.first, elemBoolPair.first );
         }
-        return iterBoolPair;
-    }
-    
-    template<typename Pol>
-    const FormulaContent<Pol>* FormulaPool<Pol>::add( FormulaContent<Pol>* _element )
-    {
-        assert( _element->mType != FormulaType::NOT );
-        FORMULA_POOL_LOCK_GUARD
-        auto iterBoolPair = this->insert( _element );
-        if( iterBoolPair.second ) // Formula has not yet been generated.
+        if( !elemBoolPair.second ) // Formula has already been generated.
         {
-			CARL_LOG_DEBUG("carl.formula", "Just added " << static_cast<const void*>(_element) << " / " << static_cast<const void*>(*iterBoolPair.first) << " to the pool");
-			// Add also the negation of the formula to the pool in order to ensure that it
-            // has the next id and hence would occur next to the formula in a set of sub-formula,
-            // which is sorted by the ids.
-            _element->mId = mIdAllocator; 
-            Formula<Pol>::init( *_element );
-            ++mIdAllocator;
-            auto negation = createNegatedContent(_element);
-			assert(mPool.find(negation) == mPool.end());
-			//auto negation = new FormulaContent<Pol>(NOT, std::move( Formula<Pol>( *iterBoolPair.first ) ) );
-            _element->mNegation = negation;
-            negation->mId = mIdAllocator; 
-            negation->mNegation = _element;
-            Formula<Pol>::init( *negation );
-            ++mIdAllocator;
-			CARL_LOG_DEBUG("carl.formula", "Added " << _element << " / " << negation << " to pool");
-        } else {
-			CARL_LOG_TRACE("carl.formula", "Found " << static_cast<const void*>(*iterBoolPair.first) << " in pool");
+			CARL_LOG_DEBUG("carl.formula", "Deleting " << static_cast<const void*>(_element) << " as it was already part of the pool");
+			// Deleting releases the sub-formulas, hence the lock must not be held anymore.
+	        delete _element;
+			CARL_LOG_TRACE("carl.formula", "Found " << static_cast<const void*>(elemBoolPair.first) << " in pool");
 		}
-		CARL_LOG_TRACE("carl.formula", "Returning " << static_cast<const void*>(*iterBoolPair.first));
-        return *iterBoolPair.first;
+		CARL_LOG_TRACE("carl.formula", "Returning " << static_cast<const void*>(elemBoolPair.first));
+        return elemBoolPair.first;
     }
     
     template<typename Pol>
@@ -127,7 +125,7 @@ namespace carl
         }
         #endif
         if (_subformulas.empty()) {
-            return conclusion.mpContent;
+            return acquire(conclusion.mpContent);
         }
         Formula<Pol> premise(AND, std::move(_subformulas));
         return add(new FormulaContent<Pol>(IMPLIES, {premise, conclusion}));
@@ -144,7 +142,7 @@ namespace carl
         if( _subformulas.size() == 1 )
         {
 			CARL_LOG_TRACE("carl.formula", "Only a single subformula, eliminating " << _type);
-            return _subformulas[0].mpContent;
+            return acquire(_subformulas[0].mpContent);
         }
         if( _type != FormulaType::IFF )
         {
@@ -180,7 +178,7 @@ namespace carl
                     negateResult = !negateResult;
                     break;
                 case FormulaType::OR:
-                    return trueFormula();
+                    return acquire(trueFormula());
                 default:
                     assert( _type == FormulaType::AND || _type == FormulaType::IFF );
             }
@@ -192,11 +190,11 @@ namespace carl
             {
                 case FormulaType::IFF:
                     if( _subformulas[0].isTrue() )
-                        return falseFormula();
+                        return acquire(falseFormula());
                     negateResult = true;
                     break;
                 case FormulaType::AND:
-                    return falseFormula();
+                    return acquire(falseFormula());
                 default:
                     assert( _type == FormulaType::OR || _type == FormulaType::XOR );
             }
@@ -225,11 +223,11 @@ namespace carl
                     switch( _type )
                     {
                         case FormulaType::AND:
-                            return falseFormula();
+                            return acquire(falseFormula());
                         case FormulaType::OR:
-                            return trueFormula();
+                            return acquire(trueFormula());
                         case FormulaType::IFF:
-                            return falseFormula();
+                            return acquire(falseFormula());
                         default:
                             assert( _type == FormulaType::XOR );
                             negateResult = !negateResult;
@@ -252,15 +250,15 @@ namespace carl
         if( subformulas.empty() )
         {
             if( negateResult || _type == FormulaType::AND || _type == FormulaType::IFF )
-                return trueFormula();
-            return falseFormula();
+                return acquire(trueFormula());
+            return acquire(falseFormula());
         }
         const FormulaContent<Pol>* result;
         if( subformulas.size() == 1 )
         {
             if( _type == FormulaType::IFF && _subformulas[0] == *subformulas.begin() )
-                return trueFormula();
-            result = subformulas.begin()->mpContent;
+                return acquire(trueFormula());
+            result = acquire(subformulas.begin()->mpContent);
         }
         else
         {
@@ -269,6 +267,33 @@ namespace carl
         return negateResult ? result->mNegation : result;
     }
     
+    template<typename Pol>
+    Formulas<Pol> FormulaPool<Pol>::createBatch(FormulaType _type, std::vector<Formulas<Pol>>&& _batch, std::size_t _threads)
+    {
+        assert( _type == FormulaType::AND || _type == FormulaType::OR || _type == FormulaType::XOR || _type == FormulaType::IFF );
+        mPool.reserve( mPool.size() + _batch.size() );
+        Formulas<Pol> result( _batch.size() );
+        auto work = [&]( std::size_t _begin, std::size_t _end )
+        {
+            for( std::size_t i = _begin; i < _end; ++i )
+                result[i] = Formula<Pol>( typename Formula<Pol>::adopt_usage(), createNAry( _type, std::move( _batch[i] ) ) );
+        };
+        #ifdef THREAD_SAFE
+        // Every thread should create enough formulas to amortize its start.
+        _threads = std::max( std::size_t(1), std::min( _threads, _batch.size() / 1024 ) );
+        std::vector<std::thread> threads;
+        for( std::size_t t = 1; t < _threads; ++t )
+            threads.emplace_back( work, _batch.size() * t / _threads, _batch.size() * (t + 1) / _threads );
+        work( 0, _batch.size() / _threads );
+        for( auto& t : threads )
+            t.join();
+        #else
+        (void)_threads;
+        work( 0, _batch.size() );
+        #endif
+        return result;
+    }
+
     template<typename Pol>
     const FormulaContent<Pol>* FormulaPool<Pol>::createITE(Formulas<Pol>&& _subformulas) {
         assert(_subformulas.size() == 3);
@@ -277,9 +302,9 @@ namespace carl
         Formula<Pol>& thencase = _subformulas[1];
         Formula<Pol>& elsecase = _subformulas[2];
         
-        if (condition.isTrue()) return thencase.mpContent;
-        if (condition.isFalse()) return elsecase.mpContent;
-        if (thencase == elsecase) return thencase.mpContent;
+        if (condition.isTrue()) return acquire(thencase.mpContent);
+        if (condition.isFalse()) return acquire(elsecase.mpContent);
+        if (thencase == elsecase) return acquire(thencase.mpContent);
         
         if (condition.getType() == FormulaType::NOT) {
             _subformulas[0] = condition.subformula();
@@ -0,0 +1,140 @@
+/**
+ * @file GarbageCollection.h
+ *
+ * Reclaims the memory of formulas and their atoms that are not used anymore.
+ */
+
+#pragma once
+
+#include "FormulaPool.h"
+#include "PoolStatistics.h"
+#include "bitvector/BVConstraintPool.h"
+#include "bitvector/BVTermContent.h"
+#include "bitvector/BVTermPool.h"
+#include "uninterpreted/UFInstanceManager.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A mark-and-sweep garbage collector for the pools of formulas, constraints, bit vector terms and constraints, and
+ * uninterpreted function instances.
+ *
+ * Formulas and constraints count their references and are mostly deleted as soon as they are not used anymore.
+ * The only exception are formulas that are kept alive by the Tseitin variables of the FormulaPool.
+ * Bit vector terms and constraints and uninterpreted function instances are never deleted by their pools, as they are
+ * not reference counted.
+ * A collection
+ * - deletes the formulas that are only kept by Tseitin variables, and then
+ * - deletes all bit vector terms and constraints and uninterpreted function instances that are not reachable from
+ *   any formula in the FormulaPool.
+ *
+ * As the latter are not reference counted, a collection must only be done at a point where no bit vector term or
+ * constraint and no uninterpreted function instance is used outside of a formula, e.g. between two queries of an
+ * incremental solver. Similarly, no other thread may use the pools during a collection.
+ *
+ * Besides collect(), collectIfNeeded() only collects if the estimated memory of all pools exceeds a threshold and has
+ * at least doubled since its last collection.
+ */
+template<typename Pol>
+class GarbageCollector {
+private:
+	/// Estimated memory in bytes above which collectIfNeeded() collects, zero to never collect.
+	std::size_t mThreshold;
+	/// Estimated memory right after the last collection by collectIfNeeded().
+	std::size_t mLastLive = 0;
+
+	struct Roots {
+		std::vector<BVConstraint> bvConstraints;
+		std::vector<BVTerm> bvTerms;
+		std::vector<UFInstance> ufInstances;
+	};
+
+	static Roots roots() {
+		Roots res;
+		std::vector<UEquality> uequalities;
+		FormulaPool<Pol>::getInstance().collectTheoryAtoms(res.bvConstraints, uequalities);
+		for (const auto& c: res.bvConstraints) {
+			res.bvTerms.push_back(c.lhs());
+			res.bvTerms.push_back(c.rhs());
+		}
+		for (const auto& ueq: uequalities) {
+			for (const UTerm* t: {&ueq.lhs(), &ueq.rhs()}) {
+				if (t->isUFInstance()) res.ufInstances.push_back(t->asUFInstance());
+			}
+		}
+		return res;
+	}
+public:
+	explicit GarbageCollector(std::size_t threshold = 0):
+		mThreshold(threshold)
+	{}
+
+	std::size_t threshold() const {
+		return mThreshold;
+	}
+	void setThreshold(std::size_t threshold) {
+		mThreshold = threshold;
+	}
+
+	/**
+	 * Estimates the memory of all pools from their sizes, which is cheap compared to statistics().
+	 */
+	std::size_t estimatedBytes() const {
+		return FormulaPool<Pol>::getInstance().size() * 2 * sizeof(FormulaContent<Pol>)
+			+ ConstraintPool<Pol>::getInstance().size() * sizeof(ConstraintContent<Pol>)
+			+ BVTermPool::getInstance().size() * sizeof(BVTermContent)
+			+ BVConstraintPool::getInstance().size() * sizeof(BVConstraint)
+			+ UFInstanceManager::getInstance().size() * sizeof(UFInstanceContent);
+	}
+
+	/**
+	 * @return The live and dead elements of every pool.
+	 */
+	std::vector<PoolStatistics> statistics() const {
+		Roots r = roots();
+		return {
+			FormulaPool<Pol>::getInstance().statistics(),
+			ConstraintPool<Pol>::getInstance().statistics(),
+			BVConstraintPool::getInstance().statistics(r.bvConstraints),
+			BVTermPool::getInstance().statistics(r.bvTerms),
+			UFInstanceManager::getInstance().statistics(r.ufInstances)
+		};
+	}
+
+	/**
+	 * Deletes all dead elements of all pools.
+	 * @return The statistics of every pool before the collection, that is the dead elements are the deleted ones.
+	 */
+	std::vector<PoolStatistics> collect() {
+		std::vector<PoolStatistics> res;
+		res.push_back(FormulaPool<Pol>::getInstance().collectGarbage());
+		res.push_back(ConstraintPool<Pol>::getInstance().statistics());
+		// The formulas are collected first, as their atoms are the roots of the other pools.
+		Roots r = roots();
+		res.push_back(BVConstraintPool::getInstance().collectGarbage(r.bvConstraints));
+		res.push_back(BVTermPool::getInstance().collectGarbage(r.bvTerms));
+		res.push_back(UFInstanceManager::getInstance().collectGarbage(r.ufInstances));
+		for (const auto& s: res) {
+			CARL_LOG_DEBUG("carl.formula", "Collected " << s);
+		}
+		return res;
+	}
+
+	/**
+	 * Collects, if the estimated memory of all pools exceeds the threshold and twice the memory that was left after
+	 * the last collection. The latter avoids collecting again and again if most of the memory is live.
+	 * @return If a collection was done.
+	 */
+	bool collectIfNeeded() {
+		if (mThreshold == 0) return false;
+		if (estimatedBytes() <= std::max(mThreshold, 2 * mLastLive)) return false;
+		collect();
+		mLastLive = estimatedBytes();
+		return true;
+	}
+};
+
+}
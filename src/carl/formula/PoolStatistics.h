@@ -0,0 +1,47 @@
+/**
+ * @file PoolStatistics.h
+ *
+ * Memory statistics of the pools that store formulas and their atoms.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace carl {
+
+/**
+ * Numbers of live and dead elements of a pool and the memory they use.
+ *
+ * An element is dead if it is still stored in the pool, but is not reachable from any live formula (or, for pools
+ * that count references, not referenced anymore). Dead elements are only freed by a garbage collection.
+ * The bytes are an estimate: they include the element itself, but not the heap memory of its members.
+ */
+struct PoolStatistics {
+	/// Name of the pool.
+	std::string name;
+	std::size_t live = 0;
+	std::size_t dead = 0;
+	std::size_t liveBytes = 0;
+	std::size_t deadBytes = 0;
+
+	PoolStatistics() = default;
+	explicit PoolStatistics(std::string n): name(std::move(n)) {}
+
+	void addLive(std::size_t bytes) {
+		live++;
+		liveBytes += bytes;
+	}
+	void addDead(std::size_t bytes) {
+		dead++;
+		deadBytes += bytes;
+	}
+};
+
+inline std::ostream& operator<<(std::ostream& os, const PoolStatistics& s) {
+	return os << s.name << ": " << s.live << " live (" << s.liveBytes << " bytes), " << s.dead << " dead (" << s.deadBytes << " bytes)";
+}
+
+}
@@ -7,6 +7,8 @@
 
 #include "BVConstraint.h"
 
+#include <unordered_set>
+
 namespace carl
 {
     BVConstraintPool::ConstConstraintPtr BVConstraintPool::create(bool _consistent)
@@ -64,4 +66,18 @@ namespace carl
         _constraint->mId = _id;
     }
 
+    PoolStatistics BVConstraintPool::statistics(const std::vector<BVConstraint>& _roots) const
+    {
+        std::unordered_set<std::size_t> live;
+        for (const auto& c: _roots) live.insert(c.id());
+        return Pool<Constraint>::statistics("BVConstraintPool", [&live](ConstConstraintPtr _constraint){ return live.count(_constraint->id()) > 0; });
+    }
+
+    PoolStatistics BVConstraintPool::collectGarbage(const std::vector<BVConstraint>& _roots)
+    {
+        std::unordered_set<std::size_t> live;
+        for (const auto& c: _roots) live.insert(c.id());
+        return sweep("BVConstraintPool", [&live](ConstConstraintPtr _constraint){ return live.count(_constraint->id()) > 0; });
+    }
+
 }
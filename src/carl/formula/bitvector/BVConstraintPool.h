@@ -7,6 +7,8 @@
 
 #include "Pool.h"
 
+#include <vector>
+
 namespace carl
 {
 	// Forward declaration
@@ -30,6 +32,17 @@ namespace carl
 			const BVTerm& _lhs, const BVTerm& _rhs);
 
 		void assignId(ConstraintPtr _constraint, std::size_t _id) override;
+
+		/**
+		 * Counts the constraints that are (not) equal to one of the given constraints.
+		 */
+		PoolStatistics statistics(const std::vector<BVConstraint>& _roots) const;
+
+		/**
+		 * Deletes all constraints that are not equal to one of the given constraints.
+		 * @return The statistics before the collection, that is the dead constraints are the deleted ones.
+		 */
+		PoolStatistics collectGarbage(const std::vector<BVConstraint>& _roots);
 	};
 }
 
@@ -177,6 +177,40 @@ namespace carl
     {
         _term->mId = _id;
     }
+
+    std::unordered_set<BVTermPool::ConstTermPtr> BVTermPool::reachable(const std::vector<BVTerm>& _roots) const
+    {
+        std::unordered_set<ConstTermPtr> res;
+        std::vector<ConstTermPtr> stack;
+        stack.push_back(mpInvalid);
+        for (const auto& root: _roots) stack.push_back(root.mpContent);
+        while (!stack.empty()) {
+            ConstTermPtr term = stack.back();
+            stack.pop_back();
+            if (!res.insert(term).second) continue;
+            if (const auto* c = std::get_if<BVUnaryContent>(&term->mContent)) {
+                stack.push_back(c->mOperand.mpContent);
+            } else if (const auto* c = std::get_if<BVBinaryContent>(&term->mContent)) {
+                stack.push_back(c->mFirst.mpContent);
+                stack.push_back(c->mSecond.mpContent);
+            } else if (const auto* c = std::get_if<BVExtractContent>(&term->mContent)) {
+                stack.push_back(c->mOperand.mpContent);
+            }
+        }
+        return res;
+    }
+
+    PoolStatistics BVTermPool::statistics(const std::vector<BVTerm>& _roots) const
+    {
+        auto live = reachable(_roots);
+        return Pool<Term>::statistics("BVTermPool", [&live](ConstTermPtr _term){ return live.count(_term) > 0; });
+    }
+
+    PoolStatistics BVTermPool::collectGarbage(const std::vector<BVTerm>& _roots)
+    {
+        auto live = reachable(_roots);
+        return sweep("BVTermPool", [&live](ConstTermPtr _term){ return live.count(_term) > 0; });
+    }
 }
 
 #define BV_TERM_POOL BVTermPool::getInstance()
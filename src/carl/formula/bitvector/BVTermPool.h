@@ -8,6 +8,9 @@
 #include "Pool.h"
 #include "BVTerm.h"
 
+#include <unordered_set>
+#include <vector>
+
 namespace carl
 {
 	class BVTermPool : public Singleton<BVTermPool>, public Pool<BVTermContent>
@@ -22,6 +25,11 @@ namespace carl
 
 		ConstTermPtr mpInvalid;
 
+		/**
+		 * @return All terms that are reachable from the given terms, including the invalid term.
+		 */
+		std::unordered_set<ConstTermPtr> reachable(const std::vector<BVTerm>& _roots) const;
+
 	public:
 
 		BVTermPool();
@@ -41,6 +49,18 @@ namespace carl
 		ConstTermPtr create(BVTermType _type, const BVTerm& _operand, std::size_t _first, std::size_t _last);
 
 		void assignId(TermPtr _term, std::size_t _id) override;
+
+		/**
+		 * Counts the terms that are (not) reachable from the given terms.
+		 */
+		PoolStatistics statistics(const std::vector<BVTerm>& _roots) const;
+
+		/**
+		 * Deletes all terms that are not reachable from the given terms.
+		 * Note, that all other terms become invalid.
+		 * @return The statistics before the collection, that is the dead terms are the deleted ones.
+		 */
+		PoolStatistics collectGarbage(const std::vector<BVTerm>& _roots);
 	};
 }
 
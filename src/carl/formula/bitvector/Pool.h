@@ -9,8 +9,10 @@
 
 #include "../../util/Common.h"
 #include "../../util/Singleton.h"
+#include "../PoolStatistics.h"
 
 #include <mutex>
+#include <string>
 
 namespace carl
 {
@@ -102,6 +104,58 @@ namespace carl
 			return iterBoolPair;
 		}
 
+		/**
+		 * @return The number of elements in the pool.
+		 */
+		std::size_t size() const
+		{
+			POOL_LOCK_GUARD
+			return mPool.size();
+		}
+
+		/**
+		 * Counts the live and dead elements of the pool.
+		 * @param _name The name of the pool.
+		 * @param _isLive Decides whether an element is live.
+		 */
+		template<typename IsLive>
+		PoolStatistics statistics(const std::string& _name, IsLive&& _isLive) const
+		{
+			POOL_LOCK_GUARD
+			PoolStatistics res(_name);
+			for(ConstElementPtr element : mPool) {
+				if(_isLive(element)) res.addLive(sizeof(Element));
+				else res.addDead(sizeof(Element));
+			}
+			return res;
+		}
+
+		/**
+		 * Deletes all elements that are not live.
+		 * Note, that all references to the deleted elements become invalid.
+		 * @param _name The name of the pool.
+		 * @param _isLive Decides whether an element is live.
+		 * @return The statistics before the deletion, that is the dead elements are the deleted ones.
+		 */
+		template<typename IsLive>
+		PoolStatistics sweep(const std::string& _name, IsLive&& _isLive)
+		{
+			POOL_LOCK_GUARD
+			PoolStatistics res(_name);
+			for(auto it = mPool.begin(); it != mPool.end();) {
+				ConstElementPtr element = *it;
+				if(_isLive(element)) {
+					res.addLive(sizeof(Element));
+					++it;
+				} else {
+					res.addDead(sizeof(Element));
+					it = mPool.erase(it);
+					delete element;
+				}
+			}
+			return res;
+		}
+
 		/**
 		 * Adds the given element to the pool, if it does not yet occur in there.
 		 * Note, that this method uses the allocator which is locked before calling.
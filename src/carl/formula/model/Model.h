@@ -5,6 +5,8 @@
 #include "ModelVariable.h"
 #include "ModelValue.h"
 
+#include <atomic>
+
 namespace carl
 {
 	/**
@@ -15,6 +17,11 @@ namespace carl
 	 * Most notably, a value can be a "carl::ModelSubstitution" whose value depends
 	 * on the values of other variables in the Model. If such other variables are
 	 * erased from the model, this substitution is evaluated and replaced by the result.
+	 *
+	 * Every modification increments the revision of the model and records it for the modified variable. A cached
+	 * value of a substitution is only recomputed if one of the variables it depends on was modified after the cache
+	 * was filled, instead of dropping all caches on every modification. As revisions of different models are not
+	 * comparable, caches also store the id of the model, which is unique for every model, copy and assignment.
 	 */
 	template<typename Rational, typename Poly>
 	class Model {
@@ -26,13 +33,20 @@ namespace carl
 		static_assert(std::is_same<mapped_type, typename Map::mapped_type>::value, "Should be the same type");
 	private:
 		Map mData;
-		std::map<key_type, std::size_t> mUsedInSubstitution;
-		void resetCaches() const {
-			for (const auto& d: mData) {
-				if (d.second.isSubstitution()) {
-					d.second.asSubstitution()->resetCache();
-				}
-			}
+		/// Revision of the last modification.
+		std::size_t mRevision = 0;
+		/// Revision of the last call to clear().
+		std::size_t mCleared = 0;
+		/// Revision of the last modification of every variable.
+		std::map<key_type, std::size_t> mChanged;
+		/// Unique id of this model.
+		std::size_t mId = freshId();
+		void changed(const key_type& key) {
+			mChanged[key] = ++mRevision;
+		}
+		static std::size_t freshId() {
+			static std::atomic<std::size_t> ids(0);
+			return ids.fetch_add(1, std::memory_order_relaxed) + 1;
 		}
 	public:
 		// Element access
@@ -57,33 +71,35 @@ namespace carl
 		// Modifiers
 		void clear() {
 			mData.clear();
+			mCleared = ++mRevision;
 		}
 		template<typename P>
 		auto insert(const P& pair) {
-			resetCaches();
-			return mData.insert(pair);
+			auto res = mData.insert(pair);
+			if (res.second) changed(res.first->first);
+			return res;
 		}
 		template<typename P>
 		auto insert(typename Map::const_iterator it, const P& pair) {
-			resetCaches();
-			return mData.insert(it, pair);
+			auto res = mData.insert(it, pair);
+			changed(res->first);
+			return res;
 		}
 		template<typename... Args>
 		auto emplace(const key_type& key, Args&& ...args) {
-			resetCaches();
-			return mData.emplace(key,std::forward<Args>(args)...);
+			auto res = mData.emplace(key,std::forward<Args>(args)...);
+			if (res.second) changed(key);
+			return res;
 		}
 		template<typename... Args>
 		auto emplace_hint(typename Map::const_iterator it, const key_type& key, Args&& ...args) {
-			resetCaches();
+			changed(key);
 			return mData.emplace_hint(it, key,std::forward<Args>(args)...);
 		}
 		typename Map::iterator erase(const ModelVariable& variable) {
-			resetCaches();
 			return erase(mData.find(variable));
 		}
 		typename Map::iterator erase(const typename Map::iterator& it) {
-			resetCaches();
 			return erase(typename Map::const_iterator(it));
 		}
 		typename Map::iterator erase(const typename Map::const_iterator& it) {
@@ -99,6 +115,7 @@ namespace carl
 					m.second = tmp;
 				}
 			}
+			changed(it->first);
 			return mData.erase(it);
 		}
         void clean() {
@@ -114,12 +131,42 @@ namespace carl
 		auto find(const typename Map::key_type& key) const {
 			return mData.find(key);
 		}
+		/**
+		 * Values that are changed through the returned iterator are not tracked, cached values of substitutions
+		 * depending on them are not invalidated. Use assign() to change a value.
+		 */
 		auto find(const typename Map::key_type& key) {
 			return mData.find(key);
 		}
 		
 		// Additional (w.r.t. std::map)
 		Model() = default;
+		/// A copy gets a fresh id, the revisions of both models diverge from here on.
+		Model(const Model& m):
+			mData(m.mData), mRevision(m.mRevision), mCleared(m.mCleared), mChanged(m.mChanged)
+		{}
+		Model(Model&& m):
+			mData(std::move(m.mData)), mRevision(m.mRevision), mCleared(m.mCleared), mChanged(std::move(m.mChanged))
+		{
+			m.mId = freshId();
+		}
+		Model& operator=(const Model& m) {
+			mData = m.mData;
+			mRevision = m.mRevision;
+			mCleared = m.mCleared;
+			mChanged = m.mChanged;
+			mId = freshId();
+			return *this;
+		}
+		Model& operator=(Model&& m) {
+			mData = std::move(m.mData);
+			mRevision = m.mRevision;
+			mCleared = m.mCleared;
+			mChanged = std::move(m.mChanged);
+			mId = freshId();
+			m.mId = freshId();
+			return *this;
+		}
 		Model(const std::map<Variable, Rational>& assignment) {
 			for (const auto& a: assignment) {
 				mData.emplace(a.first, a.second);
@@ -137,6 +184,7 @@ namespace carl
 			auto it = mData.find(key);
 			if (it == mData.end()) mData.emplace(key, t);
 			else it->second = t;
+			changed(key);
 		}
 		void update(const Model& model, bool disjoint = true) {
 			for (const auto& m: model) {
@@ -148,7 +196,33 @@ namespace carl
 						res.first->second = m.second;
 					}
 				}
+				changed(m.first);
+			}
+		}
+		/// Returns the id of this model, which no other model shares.
+		std::size_t id() const {
+			return mId;
+		}
+		/// Returns the current revision, it is incremented by every modification.
+		std::size_t revision() const {
+			return mRevision;
+		}
+		/**
+		 * Checks whether some variable the substitution depends on, directly or through other substitutions, was
+		 * modified after the given revision. If the dependencies are unknown, any modification counts.
+		 */
+		bool changedSince(const ModelSubstitution<Rational,Poly>& subs, std::size_t revision) const {
+			if (revision >= mRevision) return false;
+			if (mCleared > revision) return true;
+			const auto* deps = subs.dependencies();
+			if (deps == nullptr) return true;
+			for (const auto& d: *deps) {
+				auto it = mChanged.find(d);
+				if (it != mChanged.end() && it->second > revision) return true;
+				auto dit = mData.find(d);
+				if (dit != mData.end() && dit->second.isSubstitution() && changedSince(*dit->second.asSubstitution(), revision)) return true;
 			}
+			return false;
 		}
 		/**
 		 * Return the ModelValue for the given key, evaluated if it's a ModelSubstitution and evaluatable,
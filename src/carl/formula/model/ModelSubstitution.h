@@ -3,6 +3,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <boost/optional.hpp>
 
@@ -21,22 +22,36 @@ namespace carl {
 	 * Represent a expression for a ModelValue with variables as placeholders,
 	 * where the final expression's value depends on the bindings/values of these
 	 * variables. The values are given in the (abstract) form of a "carl::Model".
+	 *
+	 * The value is cached together with the id and the revision of the model it was computed for. The cache stays valid as
+	 * long as none of the variables this substitution (transitively) depends on is changed in the model.
 	 */
 	template<typename Rational, typename Poly>
 	class ModelSubstitution {
 	private:
 		mutable boost::optional<ModelValue<Rational, Poly>> mCachedValue;
+		/// The id of the model the value was computed for, where 0 is no model.
+		mutable std::size_t mCachedModel = 0;
+		mutable std::size_t mCachedRevision = 0;
+		mutable boost::optional<std::vector<ModelVariable>> mDependencies;
+		mutable bool mDependenciesCollected = false;
 		
 	protected:
 		/// Evaluate this substitution with respect to the given model.
 		virtual ModelValue<Rational, Poly> evaluateSubstitution(const Model<Rational, Poly>& model) const = 0;
+		/// Collect the model variables this substitution depends on, return false if they are not known.
+		virtual bool collectDependencies(std::vector<ModelVariable>&) const {
+			return false;
+		}
 	public:
 		ModelSubstitution() = default;
 		virtual ~ModelSubstitution() noexcept = default;
 		
 		const ModelValue<Rational, Poly>& evaluate(const Model<Rational, Poly>& model) const {
-			if (mCachedValue == boost::none) {
+			if (mCachedValue == boost::none || mCachedModel != model.id() || model.changedSince(*this, mCachedRevision)) {
 				mCachedValue = evaluateSubstitution(model);
+				mCachedModel = model.id();
+				mCachedRevision = model.revision();
 			}
 			return *mCachedValue;
 		}
@@ -44,6 +59,16 @@ namespace carl {
 			mCachedValue = boost::none;
 		}
 		
+		/// Returns the model variables this substitution depends on, or nullptr if they are not known.
+		const std::vector<ModelVariable>* dependencies() const {
+			if (!mDependenciesCollected) {
+				std::vector<ModelVariable> deps;
+				if (collectDependencies(deps)) mDependencies = std::move(deps);
+				mDependenciesCollected = true;
+			}
+			return mDependencies.get_ptr();
+		}
+		
 		/// Check if this substitution needs the given model variable.
 		virtual bool dependsOn(const ModelVariable&) const {
 			return true;
@@ -0,0 +1,311 @@
+#pragma once
+
+#include "../../Formula.h"
+#include "../Model.h"
+#include "ModelEvaluation.h"
+#include "../ran/RealAlgebraicNumberEvaluation.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace carl {
+namespace model {
+
+/**
+ * Evaluates a fixed formula over a model that changes in small steps.
+ *
+ * The formula is flattened into a DAG where shared subformulas are represented only once, and every atom is watched
+ * by the variables it mentions. After the model has changed, update() re-evaluates only the atoms that mention one of
+ * the changed variables and propagates new truth values upwards, stopping wherever a value does not change.
+ *
+ * Truth values are three-valued as for satisfiedBy(): 0 is false, 1 is true and 2 is unknown, for example if some
+ * variable is not assigned. Constraints and Boolean variables are evaluated without creating new formulas; all other
+ * atoms fall back to satisfiedBy(). If the formula evaluates to unknown, which only happens if the model does not
+ * assign all variables, the result is determined by satisfiedBy() on the whole formula, as the simplifications done
+ * while substituting may still decide it.
+ *
+ * If a variable is assigned a ModelSubstitution, the atoms mentioning it are only re-evaluated if the variable itself
+ * is reported as changed, hence the caller also has to report it if a variable the substitution depends on changes.
+ */
+template<typename Rational, typename Poly>
+class IncrementalEvaluator {
+private:
+	struct Node {
+		FormulaType type;
+		bool atom;
+		/// The formula itself, only stored for atoms.
+		Formula<Poly> formula;
+		std::vector<std::size_t> children;
+		std::vector<std::size_t> parents;
+		unsigned value = 2;
+		/// Number of children that are false, true or unknown.
+		std::size_t counts[3] = { 0, 0, 0 };
+	};
+	/// All nodes, the children of a node always have smaller indices than the node itself.
+	std::vector<Node> mNodes;
+	Formula<Poly> mFormula;
+	std::size_t mRoot;
+	/// Atoms that mention a variable.
+	std::unordered_map<Variable, std::vector<std::size_t>> mWatches;
+	/// Atoms whose variables are not tracked, for example uninterpreted equalities. They are always re-evaluated.
+	std::vector<std::size_t> mUnwatched;
+	std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> mQueue;
+	std::vector<bool> mQueued;
+	bool mEvaluated = false;
+	std::size_t mAtomEvaluations = 0;
+
+	static Formulas<Poly> children(const Formula<Poly>& f) {
+		switch (f.getType()) {
+			case FormulaType::NOT: return { f.subformula() };
+			case FormulaType::IMPLIES: return { f.premise(), f.conclusion() };
+			case FormulaType::ITE: return { f.condition(), f.firstCase(), f.secondCase() };
+			case FormulaType::AND:
+			case FormulaType::OR:
+			case FormulaType::XOR:
+			case FormulaType::IFF:
+				return f.subformulas();
+			default:
+				return {};
+		}
+	}
+	static bool isAtom(const Formula<Poly>& f) {
+		switch (f.getType()) {
+			case FormulaType::NOT:
+			case FormulaType::IMPLIES:
+			case FormulaType::ITE:
+			case FormulaType::AND:
+			case FormulaType::OR:
+			case FormulaType::XOR:
+			case FormulaType::IFF:
+				return false;
+			default:
+				return true;
+		}
+	}
+
+	void watch(std::size_t id) {
+		const Formula<Poly>& f = mNodes[id].formula;
+		switch (f.getType()) {
+			case FormulaType::TRUE:
+			case FormulaType::FALSE:
+				break;
+			case FormulaType::BOOL:
+				mWatches[f.boolean()].push_back(id);
+				break;
+			case FormulaType::CONSTRAINT:
+				for (auto v: f.constraint().variables()) mWatches[v].push_back(id);
+				break;
+			case FormulaType::VARCOMPARE:
+			case FormulaType::VARASSIGN:
+				for (auto v: f.variables()) mWatches[v].push_back(id);
+				break;
+			default:
+				mUnwatched.push_back(id);
+		}
+	}
+
+	/// Creates the nodes for f in post-order without recursion.
+	std::size_t build(const Formula<Poly>& f) {
+		std::unordered_map<std::size_t, std::size_t> index;
+		std::vector<std::pair<Formula<Poly>, bool>> stack = { std::make_pair(f, false) };
+		while (!stack.empty()) {
+			auto cur = stack.back();
+			stack.pop_back();
+			if (index.find(cur.first.getId()) != index.end()) continue;
+			Formulas<Poly> subs = children(cur.first);
+			if (!cur.second) {
+				stack.emplace_back(cur.first, true);
+				for (const auto& sub: subs) {
+					if (index.find(sub.getId()) == index.end()) stack.emplace_back(sub, false);
+				}
+				continue;
+			}
+			std::size_t id = mNodes.size();
+			mNodes.push_back(Node{ cur.first.getType(), isAtom(cur.first), Formula<Poly>(), {}, {} });
+			for (const auto& sub: subs) {
+				std::size_t child = index.at(sub.getId());
+				mNodes[id].children.push_back(child);
+				mNodes[child].parents.push_back(id);
+			}
+			if (mNodes[id].atom) {
+				mNodes[id].formula = cur.first;
+				watch(id);
+			}
+			index.emplace(cur.first.getId(), id);
+		}
+		return index.at(f.getId());
+	}
+
+	unsigned evaluateConstraint(const Formula<Poly>& f, const Model<Rational,Poly>& m) const {
+		const Constraint<Poly>& c = f.constraint();
+		std::map<Variable, Rational> rationals;
+		RealAlgebraicNumberEvaluation::RANMap<Rational> rans;
+		for (auto v: c.variables()) {
+			if (m.find(v) == m.end()) return 2;
+			const ModelValue<Rational,Poly>& value = m.evaluated(v);
+			if (value.isRational()) {
+				rationals.emplace(v, value.asRational());
+			} else if (value.isRAN()) {
+				rans.emplace(v, value.asRAN());
+			} else {
+				return satisfiedBy(f, m);
+			}
+		}
+		if (rans.empty()) {
+			return carl::evaluate(c.lhs().evaluate(rationals), c.relation()) ? 1 : 0;
+		}
+		for (const auto& r: rationals) {
+			rans.emplace(r.first, RealAlgebraicNumber<Rational>(r.second));
+		}
+		return RealAlgebraicNumberEvaluation::evaluate(c, rans) ? 1 : 0;
+	}
+
+	unsigned evaluateAtom(const Node& n, const Model<Rational,Poly>& m) {
+		++mAtomEvaluations;
+		switch (n.type) {
+			case FormulaType::TRUE: return 1;
+			case FormulaType::FALSE: return 0;
+			case FormulaType::BOOL: {
+				if (m.find(n.formula.boolean()) == m.end()) return 2;
+				const ModelValue<Rational,Poly>& value = m.evaluated(n.formula.boolean());
+				if (!value.isBool()) return 2;
+				return value.asBool() ? 1 : 0;
+			}
+			case FormulaType::CONSTRAINT:
+				return evaluateConstraint(n.formula, m);
+			default:
+				return satisfiedBy(n.formula, m);
+		}
+	}
+
+	/// Computes the value of a connective from the values or the counts of its children.
+	unsigned combine(const Node& n) const {
+		auto value = [this,&n](std::size_t i) { return mNodes[n.children[i]].value; };
+		switch (n.type) {
+			case FormulaType::NOT: {
+				unsigned v = value(0);
+				return v == 2 ? 2 : 1 - v;
+			}
+			case FormulaType::IMPLIES: {
+				unsigned premise = value(0);
+				unsigned conclusion = value(1);
+				if (premise == 0 || conclusion == 1) return 1;
+				if (premise == 1 && conclusion == 0) return 0;
+				return 2;
+			}
+			case FormulaType::ITE: {
+				unsigned condition = value(0);
+				if (condition == 1) return value(1);
+				if (condition == 0) return value(2);
+				return value(1) == value(2) ? value(1) : 2;
+			}
+			case FormulaType::AND:
+				if (n.counts[0] > 0) return 0;
+				return n.counts[2] > 0 ? 2 : 1;
+			case FormulaType::OR:
+				if (n.counts[1] > 0) return 1;
+				return n.counts[2] > 0 ? 2 : 0;
+			case FormulaType::XOR:
+				if (n.counts[2] > 0) return 2;
+				return unsigned(n.counts[1] % 2);
+			case FormulaType::IFF:
+				if (n.counts[0] > 0 && n.counts[1] > 0) return 0;
+				return n.counts[2] > 0 ? 2 : 1;
+			default:
+				assert(false);
+				return 2;
+		}
+	}
+
+	void schedule(std::size_t id) {
+		if (mQueued[id]) return;
+		mQueued[id] = true;
+		mQueue.push(id);
+	}
+
+	unsigned result(const Model<Rational,Poly>& m) const {
+		if (value() != 2) return value();
+		return satisfiedBy(mFormula, m);
+	}
+
+	void propagate(const Model<Rational,Poly>& m) {
+		while (!mQueue.empty()) {
+			std::size_t id = mQueue.top();
+			mQueue.pop();
+			mQueued[id] = false;
+			Node& n = mNodes[id];
+			unsigned value = n.atom ? evaluateAtom(n, m) : combine(n);
+			if (value == n.value) continue;
+			for (auto p: n.parents) {
+				mNodes[p].counts[n.value]--;
+				mNodes[p].counts[value]++;
+				schedule(p);
+			}
+			n.value = value;
+		}
+	}
+
+public:
+	explicit IncrementalEvaluator(const Formula<Poly>& f) {
+		mFormula = f;
+		mRoot = build(f);
+		mQueued.assign(mNodes.size(), false);
+	}
+
+	/**
+	 * Evaluates the whole formula over the model.
+	 * @return The truth value of the formula.
+	 */
+	unsigned evaluate(const Model<Rational,Poly>& m) {
+		for (std::size_t id = 0; id < mNodes.size(); ++id) {
+			Node& n = mNodes[id];
+			std::fill(std::begin(n.counts), std::end(n.counts), 0);
+			for (auto c: n.children) n.counts[mNodes[c].value]++;
+			n.value = n.atom ? evaluateAtom(n, m) : combine(n);
+		}
+		mEvaluated = true;
+		return result(m);
+	}
+
+	/**
+	 * Re-evaluates the formula after the values of the given variables have changed in the model.
+	 * Changed variables include variables that were added to or removed from the model.
+	 * @return The truth value of the formula.
+	 */
+	template<typename Container>
+	unsigned update(const Model<Rational,Poly>& m, const Container& changed) {
+		if (!mEvaluated) return evaluate(m);
+		for (const auto& v: changed) {
+			auto it = mWatches.find(v);
+			if (it == mWatches.end()) continue;
+			for (auto id: it->second) schedule(id);
+		}
+		for (auto id: mUnwatched) schedule(id);
+		propagate(m);
+		return result(m);
+	}
+	unsigned update(const Model<Rational,Poly>& m, Variable changed) {
+		return update(m, std::initializer_list<Variable>{ changed });
+	}
+
+	/// Returns the three-valued truth value computed by the last call to evaluate() or update().
+	unsigned value() const {
+		return mNodes[mRoot].value;
+	}
+
+	/// Number of distinct subformulas.
+	std::size_t size() const {
+		return mNodes.size();
+	}
+	/// Number of atom evaluations so far.
+	std::size_t atomEvaluations() const {
+		return mAtomEvaluations;
+	}
+};
+
+}
+}
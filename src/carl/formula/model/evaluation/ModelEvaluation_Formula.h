@@ -14,12 +14,23 @@ namespace model {
 	void substituteSubformulas(Formula<Poly>& f, const Model<Rational,Poly>& m) {
 		CARL_LOG_DEBUG("carl.model.evaluation", "Evaluating " << f << " on " << m);
 		Formulas<Poly> res = f.subformulas();
+		bool modified = false;
 		for (auto& r: res) {
 			CARL_LOG_DEBUG("carl.model.evaluation", "Evaluating " << r << " on " << m);
-			r = substitute(r, m);
-			CARL_LOG_DEBUG("carl.model.evaluation", "Result: " << r);
+			Formula<Poly> sub = substitute(r, m);
+			CARL_LOG_DEBUG("carl.model.evaluation", "Result: " << sub);
+			// A single decisive subformula determines a conjunction or disjunction.
+			if ((f.getType() == FormulaType::AND && sub.isFalse()) || (f.getType() == FormulaType::OR && sub.isTrue())) {
+				f = sub;
+				return;
+			}
+			if (sub != r) {
+				r = std::move(sub);
+				modified = true;
+			}
 		}
-		f = Formula<Poly>(f.getType(), std::move(res));
+		// Only construct a new formula if some subformula has changed.
+		if (modified) f = Formula<Poly>(f.getType(), std::move(res));
 		CARL_LOG_DEBUG("carl.model.evaluation", "Result: " << f);
 	}
 
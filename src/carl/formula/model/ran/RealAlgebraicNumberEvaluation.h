@@ -16,6 +16,7 @@
 #include "RealAlgebraicPoint.h"
 
 
+#include "../../../core/CompiledPolynomial.h"
 #include "../../../core/MultivariatePolynomial.h"
 #include "../../../core/polynomialfunctions/Resultant.h"
 #include "../../../interval/IntervalEvaluation.h"
@@ -60,6 +61,14 @@ auto overload_on_map(F&& f, const RANMap<Number>& map) {
 template<typename Number, typename Coeff>
 RealAlgebraicNumber<Number> evaluate(const MultivariatePolynomial<Coeff>& p, const RealAlgebraicPoint<Number>& point, const std::vector<Variable>& variables);
 
+/**
+ * Evaluate the compiled polynomial 'cp' at the given point, the i'th component of 'point' is the value of the i'th slot.
+ * If all components have a numeric representation, the compiled program is run on these numbers.
+ * Otherwise, the polynomial is expanded and passed on to <code>evaluate(MultivariatePolynomial, RealAlgebraicPoint, std::vector<Variable>)</code>.
+ */
+template<typename Number, typename Poly>
+RealAlgebraicNumber<Number> evaluate(const CompiledPolynomial<Poly>& cp, const RealAlgebraicPoint<Number>& point);
+
 /**
  * Evaluate the given polynomial 'p' at the point represented by the variable-to-nummber-mapping 'm'.
  * If a variable is assigned a numeric representation, the corresponding value is directly plugged in.
@@ -139,6 +148,20 @@ RealAlgebraicNumber<Number> evaluate(const MultivariatePolynomial<Coeff>& p, con
 	return evaluate(pol, RANs);
 }
 
+template<typename Number, typename Poly>
+RealAlgebraicNumber<Number> evaluate(const CompiledPolynomial<Poly>& cp, const RealAlgebraicPoint<Number>& point) {
+	assert(point.dim() == cp.variables().size());
+	std::vector<Number> values;
+	values.reserve(point.dim());
+	for (std::size_t i = 0; i < point.dim(); i++) {
+		if (!point[i].isNumeric()) {
+			return evaluate(cp.toPolynomial(), point, cp.variables());
+		}
+		values.emplace_back(point[i].value());
+	}
+	return RealAlgebraicNumber<Number>(cp.template evaluate<Number>(values));
+}
+
 // This is called by smtrat::CAD implementation (from CAD.h)
 template<typename Number>
 RealAlgebraicNumber<Number> evaluate(const MultivariatePolynomial<Number>& p, const RANMap<Number>& m) {
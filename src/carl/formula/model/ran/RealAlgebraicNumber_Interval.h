@@ -8,6 +8,7 @@
 
 #include "../../../interval/Interval.h"
 #include "../../../interval/IntervalEvaluation.h"
+#include "../../../util/Instrumentation.h"
 
 #include <list>
 
@@ -192,6 +193,7 @@ namespace ran {
 				}
 			}
 			refinementCount()++;
+			CARL_COUNT("carl.ran.refinement");
 			assert(interval().isConsistent());
 		}
 			
@@ -217,6 +219,7 @@ namespace ran {
 						interval().setUpper(n);
 					}
 					refinementCount()++;
+					CARL_COUNT("carl.ran.refinement");
 				} else if (interval().lower() != n && interval().upper() != n) {
 					return false;
 				}
@@ -270,6 +273,7 @@ namespace ran {
 						interval().setLower(n);
 					}
 					refinementCount()++;
+					CARL_COUNT("carl.ran.refinement");
 				} else if (interval().lower() != n && interval().upper() != n) {
 					return false;
 				}
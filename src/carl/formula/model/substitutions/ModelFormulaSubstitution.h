@@ -36,6 +36,13 @@ namespace carl {
 			}
 			return false;
 		}
+		virtual bool collectDependencies(std::vector<ModelVariable>& vars) const {
+			if (mFormula.propertyHolds(PROP_CONTAINS_BITVECTOR) || mFormula.propertyHolds(PROP_CONTAINS_UNINTERPRETED_EQUATIONS)) {
+				return false;
+			}
+			for (auto v: mFormula.variables()) vars.emplace_back(v);
+			return true;
+		}
 		virtual void print(std::ostream& os) const {
 			os << mFormula;
 		}
@@ -30,6 +30,10 @@ namespace carl {
 			if (!var.isVariable()) return false;
 			return mRoot.poly().degree(var.asVariable()) > 0;
 		}
+		virtual bool collectDependencies(std::vector<ModelVariable>& vars) const {
+			for (auto v: mRoot.gatherVariables()) vars.emplace_back(v);
+			return true;
+		}
 		virtual void print(std::ostream& os) const {
 			os << mRoot;
 		}
@@ -17,9 +17,11 @@ namespace carl {
 		}
 		virtual void multiplyBy(const Rational& n) {
 			mPoly *= n;
+			Super::resetCache();
 		}
 		virtual void add(const Rational& n) {
 			mPoly += n;
+			Super::resetCache();
 		}
 
 		virtual ModelSubstitutionPtr<Rational,Poly> clone() const {
@@ -37,6 +39,10 @@ namespace carl {
 			if (!var.isVariable()) return false;
 			return mPoly.degree(var.asVariable()) > 0;
 		}
+		virtual bool collectDependencies(std::vector<ModelVariable>& vars) const {
+			for (auto v: mPoly.gatherVariables()) vars.emplace_back(v);
+			return true;
+		}
 		virtual void print(std::ostream& os) const {
 			os << mPoly;
 		}
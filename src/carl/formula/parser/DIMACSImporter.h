@@ -1,95 +1,241 @@
 #pragma once
 
-#include <fstream>
-#include <iostream>
-#include <sstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
+#include "../ClauseArray.h"
 #include "../Formula.h"
+#include "../FormulaPool.h"
 #include "../../core/logging.h"
+#include "../../util/LineChunks.h"
+#include "../../util/MappedFile.h"
 
+namespace carl {
 
-#ifdef USE_BOOST_REGEX
-#include <boost/regex.hpp>
-namespace benchmax {
-	using boost::regex;
-	using boost::regex_match;
-	using boost::smatch;
-	using boost::regex_iterator;
-}
-#else
-#include <stdexcept>
-#include <regex>
-namespace benchmax {
-	using std::regex;
-	using std::regex_match;
-	using std::smatch;
-	using std::sregex_iterator;
+namespace dimacs {
+
+/// The literals of a part of a DIMACS file that consists of whole lines.
+struct Chunk {
+	std::vector<int> literals;
+	/// For every zero that terminates a clause, the number of literals before it.
+	std::vector<std::size_t> ends;
+	std::size_t maxVariable = 0;
+	/// Number of invalid characters and of literals exceeding the range of int that were skipped.
+	std::size_t errors = 0;
+};
+
+/**
+ * Parses the literals of [begin, end), skipping comment and header lines.
+ * A clause may start in one chunk and end in a later one, hence the chunks are only meaningful in sequence.
+ */
+inline void parseChunk(const char* begin, const char* end, Chunk& chunk) {
+	// Most literals take more than four characters including the separator.
+	chunk.literals.reserve(std::size_t(end - begin) / 4);
+	bool lineStart = true;
+	for (const char* cur = begin; cur != end;) {
+		char c = *cur;
+		if (c == '\n') {
+			lineStart = true;
+			++cur;
+			continue;
+		}
+		if (c == ' ' || c == '\t' || c == '\r') {
+			++cur;
+			continue;
+		}
+		if (lineStart && (c == 'c' || c == 'p')) {
+			const char* nl = static_cast<const char*>(std::memchr(cur, '\n', std::size_t(end - cur)));
+			cur = nl == nullptr ? end : nl;
+			continue;
+		}
+		lineStart = false;
+		bool negative = c == '-';
+		if (negative) ++cur;
+		if (cur == end || *cur < '0' || *cur > '9') {
+			chunk.errors++;
+			if (!negative) ++cur;
+			continue;
+		}
+		long long value = 0;
+		bool tooLarge = false;
+		while (cur != end && *cur >= '0' && *cur <= '9') {
+			if (!tooLarge) {
+				value = value * 10 + (*cur - '0');
+				tooLarge = value > std::numeric_limits<int>::max();
+			}
+			++cur;
+		}
+		if (tooLarge) {
+			chunk.errors++;
+		} else if (value == 0) {
+			chunk.ends.push_back(chunk.literals.size());
+		} else {
+			chunk.maxVariable = std::max(chunk.maxVariable, std::size_t(value));
+			chunk.literals.push_back(int(negative ? -value : value));
+		}
+	}
 }
-#endif
 
-namespace carl {
+}
 
+/**
+ * Imports CNF formulas in the DIMACS format.
+ *
+ * The file is mapped into memory and split into chunks of whole lines, which are parsed in parallel into a
+ * ClauseArray. A file may contain several formulas separated by lines "reset", which are read one after another.
+ * Clients that need Formula objects use next(), which creates all clauses through FormulaPool::createBatch(); clients
+ * that only need the clauses use nextClauses().
+ */
 template<typename Pol>
 class DIMACSImporter {
 private:
-	std::ifstream in;
+	/// Files smaller than this are parsed by a single thread.
+	static constexpr std::size_t minChunkSize = 1 << 20;
+
+	MappedFile mFile;
+	const char* mPos;
+	std::size_t mThreads;
 	std::vector<Formula<Pol>> variables;
-	regex headerRegex;
-	
-	Formula<Pol> parseLine(const std::string& line) const {
-		std::vector<Formula<Pol>> vars;
-		const char* begin = line.c_str();
-		char* end = nullptr;
-		long long id;
-		while (true) {
-			id = std::strtoll(begin, &end, 10);
-			begin = end;
-			if (id == 0) break;
-			Formula<Pol> v = variables.at(std::size_t(std::abs(id)-1));
-			if (id > 0) vars.emplace_back(v);
-			else vars.emplace_back(NOT, v);
-		}
-		return std::move(Formula<Pol>(OR, std::move(vars)));
+	std::vector<Formula<Pol>> negatedVariables;
+
+	/// Finds the end of the current formula, i.e. a line "reset" or a line starting with '%' (used by SATLIB).
+	const char* formulaEnd(const char*& next) const {
+		std::string_view rest(mPos, std::size_t(mFile.end() - mPos));
+		std::size_t end = std::string_view::npos;
+		for (std::string_view marker: {"\nreset", "\n%"}) {
+			std::size_t pos = rest.find(marker);
+			if (pos < end) end = pos;
+		}
+		if (rest.substr(0, 5) == "reset" || rest.substr(0, 1) == "%") end = 0;
+		else if (end != std::string_view::npos) end++;
+		if (end == std::string_view::npos) {
+			next = mFile.end();
+			return mFile.end();
+		}
+		if (rest[end] == '%') {
+			// Everything after '%' is ignored.
+			next = mFile.end();
+		} else {
+			std::size_t nl = rest.find('\n', end);
+			next = nl == std::string_view::npos ? mFile.end() : mPos + nl + 1;
+		}
+		return mPos + end;
 	}
-	
-	Formula<Pol> parseFormula() {
-		std::string line;
-		std::vector<Formula<Pol>> formulas;
-		while (!in.eof()) {
-			std::getline(in, line);
-			if (line == "") continue;
-			if (line == "reset") break;
-			if (line.front() == 'c') continue;
-			if (line.front() == 'p') {
-				smatch m;
-				if (!regex_match(line, m, headerRegex)) {
-					CARL_LOG_ERROR("carl.formula", "DIMACS line starting with \"p\" does not match header format: \"" << line << "\".");
-				}
-				std::size_t varCount = std::stoull(m[1]);
-				variables.reserve(varCount);
-				while (variables.size() < varCount) {
-					variables.emplace_back(freshBooleanVariable());
-				}
-				continue;
-			}
-			formulas.push_back(parseLine(line));
+
+	/// Reads the number of variables from the header "p cnf <variables> <clauses>".
+	std::size_t parseHeader(const char* begin, const char* end) const {
+		std::string_view text(begin, std::size_t(end - begin));
+		std::size_t pos = text.substr(0, 1) == "p" ? 0 : text.find("\np");
+		if (pos == std::string_view::npos) return 0;
+		if (text[pos] == '\n') pos++;
+		std::string_view line = text.substr(pos, text.find('\n', pos) - pos);
+		const char* cur = line.data() + 1;
+		const char* lineEnd = line.data() + line.size();
+		while (cur != lineEnd && *cur == ' ') ++cur;
+		if (std::string_view(cur, std::size_t(lineEnd - cur)).substr(0, 3) != "cnf") {
+			CARL_LOG_ERROR("carl.formula", "DIMACS line starting with \"p\" does not match header format: \"" << line << "\".");
+			return 0;
+		}
+		char* numEnd = nullptr;
+		unsigned long long vars = std::strtoull(cur + 3, &numEnd, 10);
+		if (numEnd == cur + 3) {
+			CARL_LOG_ERROR("carl.formula", "DIMACS line starting with \"p\" does not match header format: \"" << line << "\".");
+			return 0;
+		}
+		return std::size_t(vars);
+	}
+
+	void ensureVariables(std::size_t count) {
+		while (variables.size() < count) {
+			variables.emplace_back(freshBooleanVariable());
+			negatedVariables.push_back(variables.back().negated());
 		}
-		return Formula<Pol>(AND, std::move(formulas));
 	}
-	
 public:
-	DIMACSImporter(const std::string& filename):
-		in(filename),
-		headerRegex("p cnf (\\d+) (\\d+)")
+	/**
+	 * @param filename The file to import.
+	 * @param threads Maximum number of threads, zero to use all hardware threads.
+	 */
+	explicit DIMACSImporter(const std::string& filename, std::size_t threads = 0):
+		mFile(filename),
+		mPos(mFile.begin()),
+		mThreads(threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threads)
 	{}
-	
+
 	bool hasNext() const {
-		return !in.eof();
+		return mPos != mFile.end();
+	}
+
+	/**
+	 * Parses the clauses of the next formula.
+	 */
+	ClauseArray nextClauses() {
+		const char* next = nullptr;
+		const char* end = formulaEnd(next);
+		ClauseArray res;
+		res.variables = parseHeader(mPos, end);
+		auto chunks = splitAtLines(mPos, end, mThreads, minChunkSize);
+		std::vector<dimacs::Chunk> parsed(chunks.size());
+		forEachChunk(chunks, [&parsed](std::size_t i, const LineChunk& c) {
+			dimacs::parseChunk(c.first, c.second, parsed[i]);
+		});
+		mPos = next;
+
+		std::size_t literals = 0;
+		std::size_t clauses = 0;
+		for (const auto& c: parsed) {
+			literals += c.literals.size();
+			clauses += c.ends.size();
+			res.variables = std::max(res.variables, c.maxVariable);
+			if (c.errors > 0) {
+				CARL_LOG_ERROR("carl.formula", "Skipped " << c.errors << " invalid characters or literals in DIMACS input.");
+			}
+		}
+		res.literals.reserve(literals);
+		res.offsets.reserve(clauses + 1);
+		for (const auto& c: parsed) {
+			std::size_t base = res.literals.size();
+			res.literals.insert(res.literals.end(), c.literals.begin(), c.literals.end());
+			for (std::size_t e: c.ends) res.offsets.push_back(base + e);
+		}
+		if (res.offsets.back() != res.literals.size()) {
+			CARL_LOG_WARN("carl.formula", "The last clause of the DIMACS input is not terminated by 0.");
+			res.offsets.push_back(res.literals.size());
+		}
+		return res;
+	}
+
+	/**
+	 * Converts clauses into a conjunction of disjunctions, creating the clauses as one batch.
+	 */
+	Formula<Pol> toFormula(const ClauseArray& clauses) {
+		ensureVariables(clauses.variables);
+		std::vector<Formulas<Pol>> batch(clauses.size());
+		for (std::size_t i = 0; i < clauses.size(); ++i) {
+			batch[i].reserve(std::size_t(clauses.end(i) - clauses.begin(i)));
+			for (const int* l = clauses.begin(i); l != clauses.end(i); ++l) {
+				if (*l > 0) batch[i].push_back(variables[std::size_t(*l - 1)]);
+				else batch[i].push_back(negatedVariables[std::size_t(-*l - 1)]);
+			}
+		}
+		return Formula<Pol>(AND, FormulaPool<Pol>::getInstance().createBatch(OR, std::move(batch), mThreads));
 	}
-	
+
 	Formula<Pol> next() {
-		return parseFormula();
+		return toFormula(nextClauses());
+	}
+
+	/**
+	 * @return The Boolean variables, where the DIMACS variable i is at index i-1.
+	 */
+	const std::vector<Formula<Pol>>& getVariables() const {
+		return variables;
 	}
 };
 
@@ -1,100 +1,239 @@
 #include "OPBImporter.h"
 
-#include "SpiritHelper.h"
+#include "../../util/LineChunks.h"
+#include "../../util/MappedFile.h"
 
-#include <tuple>
-#include <vector>
-
-#define BOOST_SPIRIT_USE_PHOENIX_V3
-#include <boost/fusion/adapted/std_tuple.hpp>
-#include <boost/fusion/include/std_pair.hpp>
-#include <boost/spirit/include/phoenix.hpp>
-#include <boost/spirit/include/qi.hpp>
-#include <boost/spirit/include/qi_parse.hpp>
-#include <boost/spirit/include/support_line_pos_iterator.hpp>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 
 namespace carl {
-	namespace spirit = boost::spirit;
-	namespace qi = boost::spirit::qi;
-	namespace px = boost::phoenix;
-
-	using BaseIteratorType = spirit::istream_iterator;
-	using PositionIteratorType = spirit::line_pos_iterator<BaseIteratorType>;
-	using Iterator = PositionIteratorType;
-	using ErrorHandler = carl::parser::ErrorHandler;
-	
-	struct Skipper: public qi::grammar<Iterator> {
-		Skipper(): Skipper::base_type(main, "skipper") {
-			main = (qi::space | (qi::lit("*") > *(qi::char_ - qi::eol) > qi::eol));
-		};
-		qi::rule<Iterator> main;
+
+namespace {
+	/// Inputs smaller than this are tokenized by a single thread.
+	constexpr std::size_t minChunkSize = 1 << 20;
+
+	struct Token {
+		enum class Type { NUMBER, NAME, RELATION, MINIMIZE, SEMICOLON };
+		Type type;
+		const char* position;
+		std::string_view name;
+		int number = 0;
+		Relation relation = Relation::EQ;
 	};
-	
-	struct OPBParser: public qi::grammar<Iterator, OPBFile(), Skipper> {
-		OPBParser(): OPBParser::base_type(mMain, "OPBFile") {
-			mRelation.add
-				("=", Relation::EQ)
-				("!=", Relation::NEQ)
-				("<", Relation::LESS)
-				("<=", Relation::LEQ)
-				(">", Relation::GREATER)
-				(">=", Relation::GEQ)
-			;
-			mVarname = qi::lexeme[ qi::alpha > *(qi::alnum | qi::char_("_"))];
-			mNewVarWrapper = mVarname[qi::_val = px::bind(&OPBParser::addVariable, px::ref(*this), qi::_1)];
-			mTerm = qi::int_ >> (qi::lexeme[mVariables >> !(qi::alnum | qi::char_("_"))] | mNewVarWrapper);
-			mPolynomial = +mTerm;
-			mConstraint = mPolynomial > mRelation > qi::int_;
-			mObjective = -(qi::lit("min:") > mPolynomial > qi::lit(";"));
-			mMain = (mObjective >> *(mConstraint > ";"))[qi::_val = px::bind(&OPBParser::createFile, px::ref(*this), qi::_1, qi::_2)];
-			qi::on_error<qi::fail>(mMain, errorHandler(qi::_1, qi::_2, qi::_3, qi::_4));
-		}
-		std::optional<OPBFile> parse(std::istream& in) {
-			in.unsetf(std::ios::skipws);
-			Skipper skipper;
-			BaseIteratorType basebegin(in);
-			Iterator begin(basebegin);
-			Iterator end;
-			OPBFile res;
-			if (qi::phrase_parse(begin, end, *this, skipper, res)) {
-				if (begin != end) {
-					std::cout << "Failed to parse:" << std::endl;
-					std::cout << "\"" << std::string(begin, end) << "\"" << std::endl;
-					return std::nullopt;
+
+	struct Chunk {
+		std::vector<Token> tokens;
+		/// Position of the first invalid character or nullptr.
+		const char* error = nullptr;
+		const char* message = nullptr;
+	};
+
+	bool isNameStart(char c) {
+		return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+	}
+	bool isNameChar(char c) {
+		return isNameStart(c) || (c >= '0' && c <= '9') || c == '_';
+	}
+
+	/**
+	 * Splits [begin, end) into tokens. Comments start with '*' and extend to the end of the line, hence a chunk of whole
+	 * lines can be tokenized independently of all others.
+	 */
+	void tokenize(const char* begin, const char* end, Chunk& chunk) {
+		chunk.tokens.reserve(std::size_t(end - begin) / 4);
+		auto fail = [&chunk](const char* pos, const char* msg) {
+			chunk.error = pos;
+			chunk.message = msg;
+		};
+		for (const char* cur = begin; cur != end;) {
+			char c = *cur;
+			if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+				++cur;
+			} else if (c == '*') {
+				const char* nl = static_cast<const char*>(std::memchr(cur, '\n', std::size_t(end - cur)));
+				cur = nl == nullptr ? end : nl;
+			} else if (c == ';') {
+				chunk.tokens.push_back(Token{Token::Type::SEMICOLON, cur, {}});
+				++cur;
+			} else if (c == '+' || c == '-' || (c >= '0' && c <= '9')) {
+				Token t{Token::Type::NUMBER, cur, {}};
+				bool negative = c == '-';
+				if (c == '+' || c == '-') ++cur;
+				if (cur == end || *cur < '0' || *cur > '9') return fail(t.position, "expected a number");
+				long long value = 0;
+				for (; cur != end && *cur >= '0' && *cur <= '9'; ++cur) {
+					value = value * 10 + (*cur - '0');
+					if (value > static_cast<long long>(INT_MAX) + 1) return fail(t.position, "number out of range");
+				}
+				if (negative) value = -value;
+				if (value > INT_MAX) return fail(t.position, "number out of range");
+				t.number = int(value);
+				chunk.tokens.push_back(t);
+			} else if (isNameStart(c)) {
+				const char* start = cur;
+				while (cur != end && isNameChar(*cur)) ++cur;
+				std::string_view name(start, std::size_t(cur - start));
+				if (name == "min" && cur != end && *cur == ':') {
+					chunk.tokens.push_back(Token{Token::Type::MINIMIZE, start, {}});
+					++cur;
+				} else {
+					chunk.tokens.push_back(Token{Token::Type::NAME, start, name});
 				}
-				return res;
 			} else {
-				std::cout << "Failed to parse:" << std::endl;
-				std::cout << "\"" << std::string(begin, end) << "\"" << std::endl;
-				return std::nullopt;
+				Token t{Token::Type::RELATION, cur, {}};
+				bool twoChars = cur + 1 != end && cur[1] == '=';
+				switch (c) {
+					case '=': t.relation = Relation::EQ; break;
+					case '!':
+						if (!twoChars) return fail(cur, "expected \"!=\"");
+						t.relation = Relation::NEQ;
+						break;
+					case '<': t.relation = twoChars ? Relation::LEQ : Relation::LESS; break;
+					case '>': t.relation = twoChars ? Relation::GEQ : Relation::GREATER; break;
+					default: return fail(cur, "unexpected character");
+				}
+				cur += (twoChars && c != '=') ? 2 : 1;
+				chunk.tokens.push_back(t);
 			}
 		}
-		
+	}
+
+	/// Assembles the tokens of all chunks into an OPBFile.
+	class Assembler {
 	private:
-		Variable addVariable(const std::string& s) {
-			carl::Variable var = freshIntegerVariable(s);
-			mVariables.add(s, var);
-			return var;
+		const char* mInput;
+		const std::vector<Chunk>& mChunks;
+		std::size_t mChunk = 0;
+		std::size_t mToken = 0;
+		std::unordered_map<std::string_view, Variable> mVariables;
+		const char* mErrorPosition = nullptr;
+		const char* mError = nullptr;
+
+		const Token* peek() {
+			while (mChunk < mChunks.size() && mToken == mChunks[mChunk].tokens.size()) {
+				mChunk++;
+				mToken = 0;
+			}
+			if (mChunk == mChunks.size()) return nullptr;
+			return &mChunks[mChunk].tokens[mToken];
+		}
+		bool accept(Token::Type type) {
+			const Token* t = peek();
+			if (t == nullptr || t->type != type) return false;
+			mToken++;
+			return true;
+		}
+		bool fail(const char* msg) {
+			const Token* t = peek();
+			mErrorPosition = t == nullptr ? nullptr : t->position;
+			mError = msg;
+			return false;
 		}
-		OPBFile createFile(const OPBPolynomial& obj, const std::vector<OPBConstraint>& constraints) {
-			return OPBFile(obj, constraints);
+		Variable variable(std::string_view name) {
+			auto it = mVariables.find(name);
+			if (it == mVariables.end()) {
+				it = mVariables.emplace(name, freshIntegerVariable(std::string(name))).first;
+			}
+			return it->second;
+		}
+		/// Parses a nonempty sequence of terms "<number> <name>".
+		bool polynomial(OPBPolynomial& poly) {
+			while (true) {
+				const Token* t = peek();
+				if (t == nullptr || t->type != Token::Type::NUMBER) break;
+				std::size_t chunk = mChunk;
+				std::size_t token = mToken;
+				mToken++;
+				const Token* n = peek();
+				if (n == nullptr || n->type != Token::Type::NAME) {
+					// This number is the right hand side.
+					mChunk = chunk;
+					mToken = token;
+					break;
+				}
+				mToken++;
+				poly.emplace_back(t->number, variable(n->name));
+			}
+			if (poly.empty()) return fail("expected a term");
+			return true;
+		}
+	public:
+		Assembler(const char* input, const std::vector<Chunk>& chunks): mInput(input), mChunks(chunks) {}
+
+		bool parse(OPBFile& file) {
+			if (accept(Token::Type::MINIMIZE)) {
+				if (!polynomial(file.objective)) return false;
+				if (!accept(Token::Type::SEMICOLON)) return fail("expected \";\"");
+			}
+			while (peek() != nullptr) {
+				OPBPolynomial lhs;
+				if (!polynomial(lhs)) return false;
+				const Token* rel = peek();
+				if (!accept(Token::Type::RELATION)) return fail("expected a relation");
+				const Token* rhs = peek();
+				if (!accept(Token::Type::NUMBER)) return fail("expected a number");
+				if (!accept(Token::Type::SEMICOLON)) return fail("expected \";\"");
+				file.constraints.emplace_back(std::move(lhs), rel->relation, rhs->number);
+			}
+			return true;
 		}
 
-		qi::symbols<char, Relation> mRelation;
-		qi::symbols<char, Variable> mVariables;
-		qi::rule<Iterator, std::string(), Skipper> mVarname;
-		qi::rule<Iterator, Variable(), Skipper> mNewVarWrapper;
-		qi::rule<Iterator, std::pair<int,Variable>(), Skipper> mTerm;
-		qi::rule<Iterator, OPBPolynomial(), Skipper> mPolynomial;
-		qi::rule<Iterator, OPBConstraint(), Skipper> mConstraint;
-		qi::rule<Iterator, OPBPolynomial(), Skipper> mObjective;
-		qi::rule<Iterator, OPBFile(), Skipper> mMain;
-		px::function<ErrorHandler> errorHandler;
+		void reportError(const char* position, const char* message) const {
+			if (position == nullptr) {
+				CARL_LOG_ERROR("carl.formula", "Failed to parse OPB input: unexpected end of input, " << message);
+				return;
+			}
+			std::size_t line = std::size_t(std::count(mInput, position, '\n')) + 1;
+			CARL_LOG_ERROR("carl.formula", "Failed to parse OPB input in line " << line << ": " << message);
+		}
+		void reportError() const {
+			reportError(mErrorPosition, mError);
+		}
 	};
+}
+
+std::optional<OPBFile> parseOPB(const char* begin, const char* end, std::size_t threads) {
+	if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+	auto chunks = splitAtLines(begin, end, threads, minChunkSize);
+	std::vector<Chunk> tokens(chunks.size());
+	forEachChunk(chunks, [&tokens](std::size_t i, const LineChunk& c) {
+		tokenize(c.first, c.second, tokens[i]);
+	});
+	Assembler assembler(begin, tokens);
+	for (const auto& c: tokens) {
+		if (c.error != nullptr) {
+			assembler.reportError(c.error, c.message);
+			return std::nullopt;
+		}
+	}
+	OPBFile res;
+	if (!assembler.parse(res)) {
+		assembler.reportError();
+		return std::nullopt;
+	}
+	return res;
+}
 
-	std::optional<OPBFile> parseOPBFile(std::ifstream& in) {
-		OPBParser parser;
-		return parser.parse(in);
+std::optional<OPBFile> parseOPBFile(std::ifstream& in) {
+	std::string input((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	return parseOPB(input.data(), input.data() + input.size());
+}
+
+std::optional<OPBFile> parseOPBFile(const std::string& filename, std::size_t threads) {
+	try {
+		MappedFile file(filename);
+		return parseOPB(file.begin(), file.end(), threads);
+	} catch (const std::runtime_error& e) {
+		CARL_LOG_ERROR("carl.formula", e.what());
+		return std::nullopt;
 	}
+}
 
 }
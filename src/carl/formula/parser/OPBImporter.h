@@ -7,6 +7,7 @@
 #include <iostream>
 #include <map>
 #include <optional>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -18,56 +19,72 @@ using OPBConstraint = std::tuple<OPBPolynomial, Relation, int>;
 struct OPBFile {
 	OPBPolynomial objective;
 	std::vector<OPBConstraint> constraints;
-	
+
 	OPBFile() = default;
 	explicit OPBFile(OPBPolynomial obj): objective(std::move(obj)) {}
 	OPBFile(OPBPolynomial obj, std::vector<OPBConstraint> cons): objective(std::move(obj)), constraints(std::move(cons)) {}
 };
 
+/**
+ * Parses a pseudo-Boolean problem in the OPB format from [begin, end).
+ * The input is split into chunks of whole lines that are tokenized by up to the given number of threads, the tokens are
+ * then assembled sequentially. Variables are created as integer variables in the order of their first occurrence.
+ * @param threads Maximum number of threads, zero to use all hardware threads.
+ * @return The parsed file or std::nullopt if the input is malformed.
+ */
+std::optional<OPBFile> parseOPB(const char* begin, const char* end, std::size_t threads = 1);
 std::optional<OPBFile> parseOPBFile(std::ifstream& in);
+/**
+ * Maps the given file into memory and parses it with parseOPB().
+ */
+std::optional<OPBFile> parseOPBFile(const std::string& filename, std::size_t threads = 0);
 
 template<typename Pol>
 class OPBImporter {
 private:
 	using Number = typename UnderlyingNumberType<Pol>::type;
-	std::ifstream mIn;
+	std::string mFilename;
+	std::size_t mThreads;
 
 	std::map<carl::Variable, carl::Variable> variableCache; // maps old int variables to bool
 
-	carl::MultivariatePolynomial<Number> convert(const std::vector<std::pair<int,carl::Variable>>& poly) {
-		Pol lhs;
-		for (const auto& term: poly) {
-			auto it = variableCache.find(term.second);
-			if (it == variableCache.end()) {
-				// We haven't seen this variable, yet. Create a new map entry for it.
-				carl::Variable boolVar = carl::freshBooleanVariable();
-				variableCache[term.second] = boolVar;
-			}
-
-			const carl::Variable& booleanVariable = variableCache[term.second];
-			lhs += Pol(Number(term.first)) * Pol(booleanVariable);
+	const carl::Variable& booleanVariable(carl::Variable v) {
+		auto it = variableCache.find(v);
+		if (it == variableCache.end()) {
+			// We haven't seen this variable, yet. Create a new map entry for it.
+			it = variableCache.emplace(v, carl::freshBooleanVariable()).first;
 		}
+		return it->second;
+	}
 
-		return lhs;
+	/// Constructs poly - rhs at once instead of summing up the terms.
+	Pol convert(const OPBPolynomial& poly, const Number& rhs) {
+		typename Pol::TermsType terms;
+		terms.reserve(poly.size() + 1);
+		for (const auto& term: poly) {
+			terms.emplace_back(Number(term.first), booleanVariable(term.second), 1);
+		}
+		if (!carl::isZero(rhs)) terms.emplace_back(-rhs);
+		return Pol(std::move(terms));
 	}
 
 public:
-	explicit OPBImporter(const std::string& filename):
-		mIn(filename)
+	/**
+	 * @param filename The file to import.
+	 * @param threads Maximum number of threads, zero to use all hardware threads.
+	 */
+	explicit OPBImporter(const std::string& filename, std::size_t threads = 0):
+		mFilename(filename),
+		mThreads(threads)
 	{}
-	
-	std::optional<std::pair<Formula<Pol>,Pol>> parse() {
-		if (!mIn.is_open()) return std::nullopt;
 
-		auto file = parseOPBFile(mIn);
+	std::optional<std::pair<Formula<Pol>,Pol>> parse() {
+		auto file = parseOPBFile(mFilename, mThreads);
 		if (!file) return std::nullopt;
 		Formulas<Pol> constraints;
+		constraints.reserve(file->constraints.size());
 		for (const auto& cons: file->constraints) {
-			auto lhs = convert(std::get<0>(cons));
-			Relation rel = std::get<1>(cons);
-			Number rhs = std::get<2>(cons);
-			Constraint<Pol> pbc(lhs - Pol(rhs), rel);
-			constraints.emplace_back(std::move(pbc));
+			constraints.emplace_back(convert(std::get<0>(cons), Number(std::get<2>(cons))), std::get<1>(cons));
 		}
 		Formula<Pol> resC(FormulaType::AND, std::move(constraints));
 		Pol objective;
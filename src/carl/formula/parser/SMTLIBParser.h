@@ -0,0 +1,1039 @@
+/**
+ * @file SMTLIBParser.h
+ *
+ * A parser for SMT-LIB 2 scripts that builds formulas directly through the pools.
+ */
+
+#pragma once
+
+#include "../Formula.h"
+#include "../SortManager.h"
+#include "../bitvector/BVConstraint.h"
+#include "../bitvector/BVTerm.h"
+#include "../uninterpreted/UFInstanceManager.h"
+#include "../uninterpreted/UFManager.h"
+#include "../../core/logging.h"
+#include "../../core/VariablePool.h"
+#include "../../util/MappedFile.h"
+
+#include <cctype>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+namespace carl {
+namespace smtlib {
+
+enum class Token { LPAREN, RPAREN, SYMBOL, KEYWORD, NUMERAL, DECIMAL, HEXADECIMAL, BINARY, STRING, END };
+
+/**
+ * Splits a contiguous buffer into SMT-LIB tokens without copying.
+ * The text of a token is a view into the buffer: the digits of a numeral, the symbol without the bars of a quoted
+ * symbol, the keyword without the colon, the digits of #b and #x literals and the string without the quotes.
+ */
+class Lexer {
+private:
+	const char* mBegin;
+	const char* mCur;
+	const char* mEnd;
+	Token mPeeked = Token::END;
+	std::string_view mPeekedText;
+	bool mHasPeeked = false;
+	std::string_view mText;
+
+	static bool isSymbolChar(char c) {
+		if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) return true;
+		return c != '\0' && std::strchr("~!@$%^&*_-+=<>.?/", c) != nullptr;
+	}
+	static bool isDigit(char c) {
+		return c >= '0' && c <= '9';
+	}
+
+	void skipWhitespace() {
+		while (mCur != mEnd) {
+			char c = *mCur;
+			if (c == ';') {
+				while (mCur != mEnd && *mCur != '\n') ++mCur;
+			} else if (c == ' ' || c == '\n' || c == '\t' || c == '\r') {
+				++mCur;
+			} else {
+				break;
+			}
+		}
+	}
+
+	Token lex(std::string_view& text) {
+		skipWhitespace();
+		if (mCur == mEnd) {
+			text = std::string_view();
+			return Token::END;
+		}
+		const char* start = mCur;
+		char c = *mCur++;
+		switch (c) {
+			case '(': text = std::string_view(start, 1); return Token::LPAREN;
+			case ')': text = std::string_view(start, 1); return Token::RPAREN;
+			case '|': {
+				while (mCur != mEnd && *mCur != '|') ++mCur;
+				if (mCur == mEnd) error(start, "Unterminated quoted symbol");
+				text = std::string_view(start + 1, std::size_t(mCur - start - 1));
+				++mCur;
+				return Token::SYMBOL;
+			}
+			case '"': {
+				while (true) {
+					while (mCur != mEnd && *mCur != '"') ++mCur;
+					if (mCur == mEnd) error(start, "Unterminated string literal");
+					++mCur;
+					// A doubled quote is an escaped quote.
+					if (mCur == mEnd || *mCur != '"') break;
+					++mCur;
+				}
+				text = std::string_view(start + 1, std::size_t(mCur - start - 2));
+				return Token::STRING;
+			}
+			case ':': {
+				while (mCur != mEnd && isSymbolChar(*mCur)) ++mCur;
+				text = std::string_view(start + 1, std::size_t(mCur - start - 1));
+				return Token::KEYWORD;
+			}
+			case '#': {
+				if (mCur == mEnd || (*mCur != 'b' && *mCur != 'x')) error(start, "Invalid literal");
+				bool binary = *mCur++ == 'b';
+				const char* digits = mCur;
+				while (mCur != mEnd && (binary ? (*mCur == '0' || *mCur == '1') : std::isxdigit(static_cast<unsigned char>(*mCur)))) ++mCur;
+				if (mCur == digits) error(start, "Empty literal");
+				text = std::string_view(digits, std::size_t(mCur - digits));
+				return binary ? Token::BINARY : Token::HEXADECIMAL;
+			}
+			default: break;
+		}
+		if (isDigit(c)) {
+			while (mCur != mEnd && isDigit(*mCur)) ++mCur;
+			Token res = Token::NUMERAL;
+			if (mCur != mEnd && *mCur == '.') {
+				++mCur;
+				while (mCur != mEnd && isDigit(*mCur)) ++mCur;
+				res = Token::DECIMAL;
+			}
+			text = std::string_view(start, std::size_t(mCur - start));
+			return res;
+		}
+		if (!isSymbolChar(c)) error(start, std::string("Unexpected character '") + c + "'");
+		while (mCur != mEnd && isSymbolChar(*mCur)) ++mCur;
+		text = std::string_view(start, std::size_t(mCur - start));
+		return Token::SYMBOL;
+	}
+public:
+	Lexer(const char* begin, const char* end):
+		mBegin(begin), mCur(begin), mEnd(end)
+	{}
+
+	/**
+	 * Reads the next token.
+	 */
+	Token next() {
+		if (mHasPeeked) {
+			mHasPeeked = false;
+			mText = mPeekedText;
+			return mPeeked;
+		}
+		return lex(mText);
+	}
+	/**
+	 * @return The next token without consuming it.
+	 */
+	Token peek() {
+		if (!mHasPeeked) {
+			mPeeked = lex(mPeekedText);
+			mHasPeeked = true;
+		}
+		return mPeeked;
+	}
+	/**
+	 * @return The text of the token returned by the last call to next().
+	 */
+	std::string_view text() const {
+		return mText;
+	}
+	/**
+	 * @return The position right after the last token returned by next().
+	 */
+	const char* position() const {
+		return mHasPeeked ? mPeekedText.data() : mCur;
+	}
+
+	void expect(Token t, const char* what) {
+		if (next() != t) error(std::string("Expected ") + what + " but got \"" + std::string(mText) + "\"");
+	}
+	std::string_view expectSymbol() {
+		expect(Token::SYMBOL, "a symbol");
+		return mText;
+	}
+	std::size_t expectNumeral() {
+		expect(Token::NUMERAL, "a numeral");
+		return std::stoul(std::string(mText));
+	}
+
+	/**
+	 * Skips an s-expression whose opening parenthesis, if any, was already read.
+	 * @param depth Number of parentheses that are already open.
+	 */
+	void skip(std::size_t depth) {
+		while (depth > 0) {
+			Token t = next();
+			if (t == Token::END) error("Unexpected end of input");
+			if (t == Token::LPAREN) depth++;
+			else if (t == Token::RPAREN) depth--;
+		}
+	}
+
+	[[noreturn]] void error(const std::string& msg) const {
+		error(mText.data() == nullptr ? mCur : mText.data(), msg);
+	}
+	[[noreturn]] void error(const char* pos, const std::string& msg) const {
+		std::size_t line = 1;
+		const char* lineStart = mBegin;
+		for (const char* c = mBegin; c < pos; ++c) {
+			if (*c == '\n') {
+				line++;
+				lineStart = c + 1;
+			}
+		}
+		std::string res = std::to_string(line) + ":" + std::to_string(pos - lineStart + 1) + ": " + msg;
+		CARL_LOG_ERROR("carl.formula", res);
+		throw std::runtime_error(res);
+	}
+};
+
+}
+
+/**
+ * A command of an SMT-LIB script.
+ */
+template<typename Pol>
+struct SMTLIBCommand {
+	enum class Type { SET_LOGIC, SET_INFO, SET_OPTION, DECLARE_SORT, DECLARE_FUN, DEFINE_FUN, ASSERT, CHECK_SAT, PUSH, POP, EXIT, OTHER };
+	Type type = Type::OTHER;
+	/// The logic, the keyword of an option or info, the declared or defined symbol or the name of another command.
+	std::string name;
+	/// The asserted formula.
+	Formula<Pol> formula;
+	/// The number of levels to push or pop.
+	std::size_t levels = 0;
+};
+
+/**
+ * Parses SMT-LIB 2 scripts of the logics QF_LRA, QF_LIA, QF_NRA, QF_NIA, QF_BV and QF_UF.
+ *
+ * The parser reads one command at a time with next(), such that a script is processed as a stream: the input is
+ * never converted into an intermediate syntax tree, but every term is directly built as a Formula, a polynomial, a
+ * BVTerm or a UTerm through the respective pools. The input is a contiguous buffer, usually a MappedFile, and all
+ * symbols refer into this buffer, hence the buffer must outlive the parser.
+ *
+ * Terms are parsed iteratively with an explicit stack, such that deeply nested terms do not overflow the call stack.
+ * A let binding stores the term that was built for it, hence every occurrence of the bound symbol shares this term
+ * instead of building it again. The same holds for define-fun without arguments, while functions with arguments are
+ * expanded by parsing their body again with the arguments bound.
+ *
+ * Some constructs can not be represented directly:
+ * - An ite whose branches are not Boolean is replaced by a fresh variable v together with the formula
+ *   (ite c (= v a) (= v b)), which is added to every assertion that contains v. Hence the definition is not lost
+ *   if v is introduced by define-fun or within a scope that is popped before v is used again.
+ * - A Boolean uninterpreted function f is declared with a special uninterpreted codomain, and an application
+ *   (f x) is represented as the equality of (f x) with a special constant that represents true.
+ *
+ * Declarations and definitions are scoped by push and pop.
+ * Errors are reported by throwing a std::runtime_error that contains the line and column.
+ */
+template<typename Pol>
+class SMTLIBParser {
+public:
+	using Command = SMTLIBCommand<Pol>;
+	using Rational = typename Pol::CoeffType;
+	/// A term is either a Boolean, an arithmetic, a bit vector or an uninterpreted term.
+	using Value = std::variant<Formula<Pol>, Pol, BVTerm, UTerm>;
+private:
+	enum ValueKind { BOOLEAN = 0, ARITHMETIC = 1, BITVECTOR = 2, UNINTERPRETED = 3 };
+
+	struct SortInfo {
+		ValueKind kind;
+		bool integer = false;
+		std::size_t width = 0;
+		Sort sort;
+	};
+	/// A function with arguments defined by define-fun.
+	struct Definition {
+		std::vector<std::string_view> parameters;
+		std::vector<SortInfo> sorts;
+		const char* bodyBegin;
+		const char* bodyEnd;
+	};
+	using Symbol = std::variant<Value, UninterpretedFunction, Definition, SortInfo>;
+
+	/// A partially parsed term on the stack of parseTerm().
+	struct Frame {
+		enum Kind { APPLY, LET_BINDING, LET_BODY, ANNOTATION };
+		Kind kind;
+		std::string_view name;
+		std::vector<std::size_t> indices;
+		std::vector<Value> args;
+		/// For LET_BINDING, the names of the bindings whose values are in args.
+		std::vector<std::string_view> names;
+	};
+
+	std::string mInput;
+	smtlib::Lexer mLexer;
+
+	std::unordered_map<std::string_view, Symbol> mSymbols;
+	/// Undo log for push and pop: the symbols declared since the respective push.
+	std::vector<std::string_view> mDeclared;
+	std::vector<std::size_t> mScopes;
+	/// Let bindings, where the back of every vector is the innermost binding.
+	std::unordered_map<std::string_view, std::vector<Value>> mBindings;
+	/// Definitions of fresh variables introduced for ite terms, which are not scoped.
+	std::unordered_map<Variable, Formula<Pol>> mAuxiliary;
+
+	Sort mBitVectorSort;
+	Sort mUFBoolSort;
+	UTerm mUFTrue;
+
+	[[noreturn]] void error(const std::string& msg) const {
+		mLexer.error(msg);
+	}
+
+	// Symbols and sorts.
+
+	void declare(std::string_view name, Symbol&& s) {
+		auto res = mSymbols.emplace(name, std::move(s));
+		if (!res.second) error("Symbol " + std::string(name) + " is already declared");
+		mDeclared.push_back(name);
+	}
+
+	Sort uninterpretedSort(const std::string& name) {
+		auto& sm = SortManager::getInstance();
+		sm.declare(name, 0);
+		return sm.getSort(name);
+	}
+	Sort bitvectorSort(std::size_t width) {
+		if (mBitVectorSort == Sort()) {
+			mBitVectorSort = uninterpretedSort("BitVec");
+			SortManager::getInstance().makeSortIndexable(mBitVectorSort, 1, VariableType::VT_BITVECTOR);
+		}
+		return SortManager::getInstance().index(mBitVectorSort, {width});
+	}
+	void initUFBool() {
+		if (mUFBoolSort != Sort()) return;
+		mUFBoolSort = uninterpretedSort("__uf_bool");
+		mUFTrue = UTerm(UVariable(freshUninterpretedVariable("__uf_true"), mUFBoolSort));
+	}
+
+	SortInfo parseSort(smtlib::Lexer& lex) {
+		smtlib::Token t = lex.next();
+		if (t == smtlib::Token::LPAREN) {
+			lex.expect(smtlib::Token::SYMBOL, "_");
+			if (lex.text() != "_" || lex.expectSymbol() != "BitVec") error("Only the indexed sort (_ BitVec n) is supported");
+			std::size_t width = lex.expectNumeral();
+			lex.expect(smtlib::Token::RPAREN, ")");
+			if (width == 0) error("Bit vectors must have a positive width");
+			return SortInfo{BITVECTOR, false, width, bitvectorSort(width)};
+		}
+		if (t != smtlib::Token::SYMBOL) error("Expected a sort");
+		std::string_view name = lex.text();
+		if (name == "Bool") return SortInfo{BOOLEAN, false, 0, Sort()};
+		if (name == "Real") return SortInfo{ARITHMETIC, false, 0, Sort()};
+		if (name == "Int") return SortInfo{ARITHMETIC, true, 0, Sort()};
+		auto it = mSymbols.find(name);
+		if (it == mSymbols.end() || !std::holds_alternative<SortInfo>(it->second)) error("Unknown sort " + std::string(name));
+		return std::get<SortInfo>(it->second);
+	}
+
+	Value freshConstant(const SortInfo& s, const std::string& name) {
+		switch (s.kind) {
+			case BOOLEAN: return Formula<Pol>(name.empty() ? freshBooleanVariable() : freshBooleanVariable(name));
+			case ARITHMETIC: {
+				VariableType vt = s.integer ? VariableType::VT_INT : VariableType::VT_REAL;
+				return Pol(name.empty() ? freshVariable(vt) : freshVariable(name, vt));
+			}
+			case BITVECTOR: {
+				Variable v = name.empty() ? freshBitvectorVariable() : freshBitvectorVariable(name);
+				return BVTerm(BVTermType::VARIABLE, BVVariable(v, s.sort));
+			}
+			default: {
+				Variable v = name.empty() ? freshUninterpretedVariable() : freshUninterpretedVariable(name);
+				return UTerm(UVariable(v, s.sort));
+			}
+		}
+	}
+
+	// Literals.
+
+	static Rational parseInteger(std::string_view digits) {
+		if (digits.size() <= 18) {
+			carl::uint n = 0;
+			for (char c: digits) n = n * 10 + carl::uint(c - '0');
+			return carl::fromInt<Rational>(n);
+		}
+		return carl::parse<Rational>(std::string(digits));
+	}
+	static Rational parseDecimal(std::string_view text) {
+		std::size_t dot = text.find('.');
+		std::string digits(text.substr(0, dot));
+		digits.append(text.substr(dot + 1));
+		return parseInteger(digits) / carl::pow(Rational(10), std::size_t(text.size() - dot - 1));
+	}
+	static BVValue parseHexadecimal(std::string_view digits) {
+		std::string bits;
+		bits.reserve(4 * digits.size());
+		for (char c: digits) {
+			int d = std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : std::tolower(static_cast<unsigned char>(c)) - 'a' + 10;
+			for (int i = 3; i >= 0; --i) bits.push_back(((d >> i) & 1) ? '1' : '0');
+		}
+		return BVValue(bits);
+	}
+
+	// Conversions of values.
+
+	static const char* kindName(std::size_t kind) {
+		switch (kind) {
+			case BOOLEAN: return "Boolean";
+			case ARITHMETIC: return "arithmetic";
+			case BITVECTOR: return "bit vector";
+			default: return "uninterpreted";
+		}
+	}
+	void expectKind(const Frame& f, ValueKind kind) const {
+		for (const auto& v: f.args) {
+			if (v.index() != std::size_t(kind)) error(std::string(f.name) + " expects " + kindName(kind) + " arguments, but an argument is " + kindName(v.index()));
+		}
+	}
+	void expectArity(const Frame& f, std::size_t min, std::size_t max) const {
+		if (f.args.size() < min || f.args.size() > max) error("Wrong number of arguments for " + std::string(f.name));
+	}
+	void expectSameKind(const Frame& f) const {
+		expectArity(f, 2, std::numeric_limits<std::size_t>::max());
+		expectKind(f, ValueKind(f.args.front().index()));
+	}
+	template<typename T>
+	static std::vector<T> as(std::vector<Value>& args) {
+		std::vector<T> res;
+		res.reserve(args.size());
+		for (auto& v: args) res.emplace_back(std::move(std::get<T>(v)));
+		return res;
+	}
+
+	static bool isIntegral(const Pol& p) {
+		for (const auto& t: p) {
+			if (!carl::isInteger(t.coeff())) return false;
+			if (t.monomial() == nullptr) continue;
+			for (const auto& e: *t.monomial()) {
+				if (e.first.type() != VariableType::VT_INT) return false;
+			}
+		}
+		return true;
+	}
+
+	/// Builds the equality of two terms of the same kind.
+	Formula<Pol> equal(const Value& a, const Value& b, bool negated) const {
+		switch (a.index()) {
+			case BOOLEAN: {
+				Formula<Pol> res(IFF, std::get<Formula<Pol>>(a), std::get<Formula<Pol>>(b));
+				return negated ? res.negated() : res;
+			}
+			case ARITHMETIC:
+				return Formula<Pol>(std::get<Pol>(a) - std::get<Pol>(b), negated ? Relation::NEQ : Relation::EQ);
+			case BITVECTOR:
+				return Formula<Pol>(BVConstraint::create(negated ? BVCompareRelation::NEQ : BVCompareRelation::EQ, std::get<BVTerm>(a), std::get<BVTerm>(b)));
+			default:
+				return Formula<Pol>(std::get<UTerm>(a), std::get<UTerm>(b), negated);
+		}
+	}
+
+	// Applications.
+
+	Value applyArithmetic(Frame& f) {
+		expectKind(f, ARITHMETIC);
+		std::vector<Pol> args = as<Pol>(f.args);
+		if (f.name == "+") {
+			typename Pol::TermsType terms;
+			for (const auto& p: args) terms.insert(terms.end(), p.begin(), p.end());
+			return Pol(std::move(terms));
+		}
+		if (f.name == "-") {
+			if (args.size() == 1) return -args.front();
+			typename Pol::TermsType terms(args.front().begin(), args.front().end());
+			for (auto it = std::next(args.begin()); it != args.end(); ++it) {
+				for (const auto& t: *it) terms.push_back(-t);
+			}
+			return Pol(std::move(terms));
+		}
+		if (f.name == "*") return Pol(Pol::ConstructorOperation::MUL, args);
+		if (f.name == "/") {
+			for (auto it = std::next(args.begin()); it != args.end(); ++it) {
+				if (!it->isConstant()) error("Division is only supported by constants");
+				if (carl::isZero(it->constantPart())) error("Division by zero");
+			}
+			return Pol(Pol::ConstructorOperation::DIV, args);
+		}
+		assert(f.name == "to_real");
+		return args.front();
+	}
+
+	Value applyRelation(Frame& f, Relation rel) {
+		expectKind(f, ARITHMETIC);
+		Formulas<Pol> res;
+		for (std::size_t i = 0; i + 1 < f.args.size(); ++i) {
+			res.emplace_back(std::get<Pol>(f.args[i]) - std::get<Pol>(f.args[i + 1]), rel);
+		}
+		if (res.size() == 1) return res.front();
+		return Formula<Pol>(AND, std::move(res));
+	}
+
+	Value applyBitvector(Frame& f, BVTermType type) {
+		expectKind(f, BITVECTOR);
+		std::vector<BVTerm> args = as<BVTerm>(f.args);
+		if (typeIsUnary(type)) {
+			expectArity(f, 1, 1);
+			switch (type) {
+				case BVTermType::NOT:
+				case BVTermType::NEG:
+					return BVTerm(type, args.front());
+				default:
+					if (f.indices.size() != 1) error(std::string(f.name) + " expects one index");
+					return BVTerm(type, args.front(), f.indices.front());
+			}
+		}
+		expectArity(f, 2, (type == BVTermType::CONCAT || type == BVTermType::AND || type == BVTermType::OR || type == BVTermType::XOR || type == BVTermType::ADD || type == BVTermType::MUL) ? std::numeric_limits<std::size_t>::max() : 2);
+		for (std::size_t i = 1; i < args.size(); ++i) {
+			if (type != BVTermType::CONCAT && args[i].width() != args.front().width()) error("Bit vectors of different widths in " + std::string(f.name));
+		}
+		BVTerm res = args.front();
+		for (std::size_t i = 1; i < args.size(); ++i) res = BVTerm(type, res, args[i]);
+		return res;
+	}
+
+	Value applyBitvectorRelation(Frame& f, BVCompareRelation rel) {
+		expectKind(f, BITVECTOR);
+		expectArity(f, 2, 2);
+		const BVTerm& lhs = std::get<BVTerm>(f.args[0]);
+		const BVTerm& rhs = std::get<BVTerm>(f.args[1]);
+		if (lhs.width() != rhs.width()) error("Bit vectors of different widths in " + std::string(f.name));
+		return Formula<Pol>(BVConstraint::create(rel, lhs, rhs));
+	}
+
+	Value applyIte(Frame& f) {
+		expectArity(f, 3, 3);
+		if (f.args[0].index() != BOOLEAN) error("The condition of ite must be Boolean");
+		if (f.args[1].index() != f.args[2].index()) error("The branches of ite must have the same sort");
+		const Formula<Pol>& cond = std::get<Formula<Pol>>(f.args[0]);
+		if (f.args[1].index() == BOOLEAN) {
+			return Formula<Pol>(ITE, cond, std::get<Formula<Pol>>(f.args[1]), std::get<Formula<Pol>>(f.args[2]));
+		}
+		SortInfo s{ValueKind(f.args[1].index())};
+		switch (s.kind) {
+			case ARITHMETIC:
+				s.integer = isIntegral(std::get<Pol>(f.args[1])) && isIntegral(std::get<Pol>(f.args[2]));
+				break;
+			case BITVECTOR:
+				s.width = std::get<BVTerm>(f.args[1]).width();
+				if (s.width != std::get<BVTerm>(f.args[2]).width()) error("The branches of ite must have the same sort");
+				s.sort = bitvectorSort(s.width);
+				break;
+			default:
+				s.sort = std::get<UTerm>(f.args[1]).domain();
+				break;
+		}
+		Value res = freshConstant(s, "");
+		Variable v;
+		switch (s.kind) {
+			case ARITHMETIC: v = std::get<Pol>(res).lmon()->getSingleVariable(); break;
+			case BITVECTOR: v = std::get<BVTerm>(res).variable().variable(); break;
+			default: v = std::get<UTerm>(res).asUVariable().variable(); break;
+		}
+		mAuxiliary.emplace(v, Formula<Pol>(ITE, cond, equal(res, f.args[1], false), equal(res, f.args[2], false)));
+		return res;
+	}
+
+	Value applyFunction(Frame& f, const UninterpretedFunction& uf) {
+		if (f.args.size() != uf.domain().size()) error("Wrong number of arguments for " + std::string(f.name));
+		expectKind(f, UNINTERPRETED);
+		UFInstance res = newUFInstance(uf, as<UTerm>(f.args));
+		if (uf.codomain() == mUFBoolSort) return Formula<Pol>(UTerm(res), mUFTrue, false);
+		return UTerm(res);
+	}
+
+	Value expand(Frame& f, const Definition& d) {
+		if (f.args.size() != d.parameters.size()) error("Wrong number of arguments for " + std::string(f.name));
+		// The body only sees the parameters, not the let bindings of the context.
+		std::unordered_map<std::string_view, std::vector<Value>> bindings;
+		std::swap(bindings, mBindings);
+		for (std::size_t i = 0; i < d.parameters.size(); ++i) {
+			if (f.args[i].index() != std::size_t(d.sorts[i].kind)) {
+				std::swap(bindings, mBindings);
+				error("Wrong sort of argument " + std::to_string(i + 1) + " of " + std::string(f.name));
+			}
+			mBindings[d.parameters[i]].push_back(std::move(f.args[i]));
+		}
+		smtlib::Lexer lex(d.bodyBegin, d.bodyEnd);
+		try {
+			Value res = parseTerm(lex);
+			std::swap(bindings, mBindings);
+			return res;
+		} catch (...) {
+			std::swap(bindings, mBindings);
+			throw;
+		}
+	}
+
+	Value apply(Frame& f) {
+		const std::string_view& n = f.name;
+		if (f.args.empty()) error("Missing arguments for " + std::string(n));
+		if (n == "not") {
+			expectArity(f, 1, 1);
+			expectKind(f, BOOLEAN);
+			return std::get<Formula<Pol>>(f.args.front()).negated();
+		}
+		if (n == "and" || n == "or" || n == "xor") {
+			expectKind(f, BOOLEAN);
+			if (f.args.size() == 1) return f.args.front();
+			return Formula<Pol>(n == "and" ? AND : (n == "or" ? OR : XOR), as<Formula<Pol>>(f.args));
+		}
+		if (n == "=>") {
+			expectKind(f, BOOLEAN);
+			Formula<Pol> res = std::get<Formula<Pol>>(f.args.back());
+			for (std::size_t i = f.args.size() - 1; i-- > 0;) {
+				res = Formula<Pol>(IMPLIES, std::get<Formula<Pol>>(f.args[i]), res);
+			}
+			return res;
+		}
+		if (n == "=") {
+			expectSameKind(f);
+			if (f.args.front().index() == BOOLEAN) return Formula<Pol>(IFF, as<Formula<Pol>>(f.args));
+			if (f.args.front().index() == ARITHMETIC) return applyRelation(f, Relation::EQ);
+			Formulas<Pol> res;
+			for (std::size_t i = 0; i + 1 < f.args.size(); ++i) res.push_back(equal(f.args[i], f.args[i + 1], false));
+			if (res.size() == 1) return res.front();
+			return Formula<Pol>(AND, std::move(res));
+		}
+		if (n == "distinct") {
+			expectSameKind(f);
+			Formulas<Pol> res;
+			for (std::size_t i = 0; i < f.args.size(); ++i) {
+				for (std::size_t j = i + 1; j < f.args.size(); ++j) res.push_back(equal(f.args[i], f.args[j], true));
+			}
+			if (res.size() == 1) return res.front();
+			return Formula<Pol>(AND, std::move(res));
+		}
+		if (n == "ite") return applyIte(f);
+		if (n == "+" || n == "-" || n == "*" || n == "/" || n == "to_real") return applyArithmetic(f);
+		if (n == "<") return applyRelation(f, Relation::LESS);
+		if (n == "<=") return applyRelation(f, Relation::LEQ);
+		if (n == ">") return applyRelation(f, Relation::GREATER);
+		if (n == ">=") return applyRelation(f, Relation::GEQ);
+		if (n.size() > 2 && n[0] == 'b' && n[1] == 'v') {
+			static const std::unordered_map<std::string_view, BVCompareRelation> relations = {
+				{"bvult", BVCompareRelation::ULT}, {"bvule", BVCompareRelation::ULE}, {"bvugt", BVCompareRelation::UGT}, {"bvuge", BVCompareRelation::UGE},
+				{"bvslt", BVCompareRelation::SLT}, {"bvsle", BVCompareRelation::SLE}, {"bvsgt", BVCompareRelation::SGT}, {"bvsge", BVCompareRelation::SGE}
+			};
+			auto rel = relations.find(n);
+			if (rel != relations.end()) return applyBitvectorRelation(f, rel->second);
+		}
+		static const std::unordered_map<std::string_view, BVTermType> operations = {
+			{"concat", BVTermType::CONCAT}, {"bvnot", BVTermType::NOT}, {"bvneg", BVTermType::NEG},
+			{"bvand", BVTermType::AND}, {"bvor", BVTermType::OR}, {"bvxor", BVTermType::XOR},
+			{"bvnand", BVTermType::NAND}, {"bvnor", BVTermType::NOR}, {"bvxnor", BVTermType::XNOR},
+			{"bvadd", BVTermType::ADD}, {"bvsub", BVTermType::SUB}, {"bvmul", BVTermType::MUL},
+			{"bvudiv", BVTermType::DIV_U}, {"bvsdiv", BVTermType::DIV_S}, {"bvurem", BVTermType::MOD_U},
+			{"bvsrem", BVTermType::MOD_S1}, {"bvsmod", BVTermType::MOD_S2}, {"bvcomp", BVTermType::EQ},
+			{"bvshl", BVTermType::LSHIFT}, {"bvlshr", BVTermType::RSHIFT_LOGIC}, {"bvashr", BVTermType::RSHIFT_ARITH},
+			{"rotate_left", BVTermType::LROTATE}, {"rotate_right", BVTermType::RROTATE},
+			{"zero_extend", BVTermType::EXT_U}, {"sign_extend", BVTermType::EXT_S}, {"repeat", BVTermType::REPEAT}
+		};
+		if (n == "extract") {
+			expectArity(f, 1, 1);
+			expectKind(f, BITVECTOR);
+			if (f.indices.size() != 2) error("extract expects two indices");
+			const BVTerm& t = std::get<BVTerm>(f.args.front());
+			if (f.indices[0] < f.indices[1] || f.indices[0] >= t.width()) error("Invalid indices for extract");
+			return BVTerm(BVTermType::EXTRACT, t, f.indices[0], f.indices[1]);
+		}
+		auto op = operations.find(n);
+		if (op != operations.end()) return applyBitvector(f, op->second);
+
+		auto it = mSymbols.find(n);
+		if (it != mSymbols.end()) {
+			if (std::holds_alternative<UninterpretedFunction>(it->second)) return applyFunction(f, std::get<UninterpretedFunction>(it->second));
+			if (std::holds_alternative<Definition>(it->second)) return expand(f, std::get<Definition>(it->second));
+		}
+		error("Unknown or unsupported function " + std::string(n));
+	}
+
+	// Terms.
+
+	Value lookup(std::string_view name) {
+		auto b = mBindings.find(name);
+		if (b != mBindings.end() && !b->second.empty()) return b->second.back();
+		auto it = mSymbols.find(name);
+		if (it != mSymbols.end() && std::holds_alternative<Value>(it->second)) return std::get<Value>(it->second);
+		if (name == "true") return Formula<Pol>(TRUE);
+		if (name == "false") return Formula<Pol>(FALSE);
+		error("Unknown constant " + std::string(name));
+	}
+
+	Value atom(smtlib::Lexer& lex, smtlib::Token t) {
+		switch (t) {
+			case smtlib::Token::SYMBOL: return lookup(lex.text());
+			case smtlib::Token::NUMERAL: return Pol(parseInteger(lex.text()));
+			case smtlib::Token::DECIMAL: return Pol(parseDecimal(lex.text()));
+			case smtlib::Token::BINARY: return BVTerm(BVTermType::CONSTANT, BVValue(std::string(lex.text())));
+			case smtlib::Token::HEXADECIMAL: return BVTerm(BVTermType::CONSTANT, parseHexadecimal(lex.text()));
+			case smtlib::Token::END: error("Unexpected end of input");
+			default: error("Unexpected token \"" + std::string(lex.text()) + "\"");
+		}
+	}
+
+	/// Reads the rest of an indexed identifier (_ name indices...), whose "(_" was already read.
+	void indexed(smtlib::Lexer& lex, Frame& f) {
+		f.name = lex.expectSymbol();
+		while (lex.peek() == smtlib::Token::NUMERAL) f.indices.push_back(lex.expectNumeral());
+		lex.expect(smtlib::Token::RPAREN, ")");
+	}
+
+	void bind(Frame& f) {
+		for (std::size_t i = 0; i < f.names.size(); ++i) {
+			mBindings[f.names[i]].push_back(std::move(f.args[i]));
+		}
+		f.args.clear();
+		f.kind = Frame::LET_BODY;
+	}
+	void unbind(const Frame& f) {
+		for (const auto& n: f.names) mBindings[n].pop_back();
+	}
+
+	/**
+	 * Reads the attributes of an annotation up to the closing parenthesis and handles :named.
+	 */
+	void annotate(smtlib::Lexer& lex, const Value& v) {
+		while (true) {
+			smtlib::Token t = lex.next();
+			if (t == smtlib::Token::RPAREN) return;
+			if (t != smtlib::Token::KEYWORD) error("Expected an attribute");
+			if (lex.text() == "named") {
+				declare(lex.expectSymbol(), Symbol(v));
+			} else if (lex.peek() == smtlib::Token::LPAREN) {
+				lex.next();
+				lex.skip(1);
+			} else if (lex.peek() != smtlib::Token::KEYWORD && lex.peek() != smtlib::Token::RPAREN) {
+				lex.next();
+			}
+		}
+	}
+
+	/**
+	 * Parses a term without recursion, except for the expansion of defined functions.
+	 */
+	Value parseTerm(smtlib::Lexer& lex) {
+		std::vector<Frame> stack;
+		while (true) {
+			// An empty polynomial, which is cheaper to construct than a formula.
+			Value v(std::in_place_index<ARITHMETIC>);
+			smtlib::Token t = lex.next();
+			if (t != smtlib::Token::LPAREN) {
+				v = atom(lex, t);
+			} else {
+				t = lex.next();
+				Frame f;
+				f.kind = Frame::APPLY;
+				if (t == smtlib::Token::LPAREN) {
+					lex.expect(smtlib::Token::SYMBOL, "_");
+					if (lex.text() != "_") error("Expected an indexed identifier");
+					indexed(lex, f);
+					stack.push_back(std::move(f));
+					continue;
+				}
+				if (t != smtlib::Token::SYMBOL) error("Expected a function symbol");
+				std::string_view name = lex.text();
+				if (name == "_") {
+					indexed(lex, f);
+					if (f.name.size() <= 2 || f.name.substr(0, 2) != "bv" || f.indices.size() != 1) error("Unknown indexed constant " + std::string(f.name));
+					if (f.indices.front() == 0) error("Bit vectors must have a positive width");
+					v = BVTerm(BVTermType::CONSTANT, BVValue(f.indices.front(), mpz_class(std::string(f.name.substr(2)))));
+				} else if (name == "let") {
+					lex.expect(smtlib::Token::LPAREN, "(");
+					lex.expect(smtlib::Token::LPAREN, "(");
+					f.kind = Frame::LET_BINDING;
+					f.names.push_back(lex.expectSymbol());
+					stack.push_back(std::move(f));
+					continue;
+				} else if (name == "!") {
+					f.kind = Frame::ANNOTATION;
+					stack.push_back(std::move(f));
+					continue;
+				} else if (name == "forall" || name == "exists") {
+					error("Quantifiers are not supported");
+				} else {
+					f.name = name;
+					stack.push_back(std::move(f));
+					continue;
+				}
+			}
+			// Pass the complete term v to the enclosing frames, as long as they are complete as well.
+			while (true) {
+				if (stack.empty()) return v;
+				Frame& f = stack.back();
+				if (f.kind == Frame::APPLY) {
+					f.args.push_back(std::move(v));
+					if (lex.peek() != smtlib::Token::RPAREN) break;
+					lex.next();
+					v = apply(f);
+				} else if (f.kind == Frame::LET_BINDING) {
+					f.args.push_back(std::move(v));
+					lex.expect(smtlib::Token::RPAREN, ")");
+					smtlib::Token next = lex.next();
+					if (next == smtlib::Token::LPAREN) {
+						f.names.push_back(lex.expectSymbol());
+						break;
+					}
+					if (next != smtlib::Token::RPAREN) error("Expected a binding");
+					bind(f);
+					break;
+				} else if (f.kind == Frame::LET_BODY) {
+					lex.expect(smtlib::Token::RPAREN, ")");
+					unbind(f);
+				} else {
+					annotate(lex, v);
+				}
+				stack.pop_back();
+			}
+		}
+	}
+
+	Formula<Pol> parseFormula() {
+		Value v = parseTerm(mLexer);
+		if (v.index() != BOOLEAN) error("Expected a Boolean term");
+		return std::get<Formula<Pol>>(v);
+	}
+
+	// Commands.
+
+	void declareFun(Command& cmd, bool constant) {
+		std::string_view name = mLexer.expectSymbol();
+		cmd.name = std::string(name);
+		std::vector<SortInfo> domain;
+		if (!constant) {
+			mLexer.expect(smtlib::Token::LPAREN, "(");
+			while (mLexer.peek() != smtlib::Token::RPAREN) domain.push_back(parseSort(mLexer));
+			mLexer.next();
+		}
+		SortInfo codomain = parseSort(mLexer);
+		mLexer.expect(smtlib::Token::RPAREN, ")");
+		if (domain.empty()) {
+			declare(name, Symbol(freshConstant(codomain, cmd.name)));
+			return;
+		}
+		std::vector<Sort> sorts;
+		for (const auto& s: domain) {
+			if (s.kind != UNINTERPRETED) error("Functions are only supported over uninterpreted sorts");
+			sorts.push_back(s.sort);
+		}
+		if (codomain.kind == BOOLEAN) {
+			initUFBool();
+			codomain.sort = mUFBoolSort;
+		} else if (codomain.kind != UNINTERPRETED) {
+			error("Functions must have an uninterpreted or Boolean codomain");
+		}
+		declare(name, Symbol(newUninterpretedFunction(cmd.name, std::move(sorts), codomain.sort)));
+	}
+
+	void defineFun() {
+		std::string_view name = mLexer.expectSymbol();
+		Definition d;
+		mLexer.expect(smtlib::Token::LPAREN, "(");
+		smtlib::Token t;
+		while ((t = mLexer.next()) == smtlib::Token::LPAREN) {
+			d.parameters.push_back(mLexer.expectSymbol());
+			d.sorts.push_back(parseSort(mLexer));
+			mLexer.expect(smtlib::Token::RPAREN, ")");
+		}
+		if (t != smtlib::Token::RPAREN) error("Expected a sorted variable");
+		SortInfo sort = parseSort(mLexer);
+		if (d.parameters.empty()) {
+			Value v = parseTerm(mLexer);
+			if (v.index() != std::size_t(sort.kind)) error("The definition of " + std::string(name) + " does not match its sort");
+			declare(name, Symbol(std::move(v)));
+		} else {
+			// The body is parsed when the function is applied.
+			if (mLexer.peek() == smtlib::Token::END) error("Unexpected end of input");
+			d.bodyBegin = mLexer.position();
+			if (mLexer.next() == smtlib::Token::LPAREN) mLexer.skip(1);
+			d.bodyEnd = mLexer.position();
+			declare(name, Symbol(std::move(d)));
+		}
+		mLexer.expect(smtlib::Token::RPAREN, ")");
+	}
+
+	/**
+	 * Adds the definitions of the fresh ite variables the formula depends on, including the variables these
+	 * definitions depend on.
+	 */
+	Formula<Pol> addAuxiliary(Formula<Pol>&& formula) const {
+		Formulas<Pol> res;
+		const auto& vars = formula.variables();
+		std::vector<Variable> pending(vars.begin(), vars.end());
+		std::unordered_set<Variable> added;
+		while (!pending.empty()) {
+			Variable v = pending.back();
+			pending.pop_back();
+			auto it = mAuxiliary.find(v);
+			if (it == mAuxiliary.end() || !added.insert(v).second) continue;
+			res.push_back(it->second);
+			pending.insert(pending.end(), it->second.variables().begin(), it->second.variables().end());
+		}
+		if (res.empty()) return std::move(formula);
+		res.push_back(std::move(formula));
+		return Formula<Pol>(AND, std::move(res));
+	}
+
+	void pop(std::size_t levels) {
+		if (levels > mScopes.size()) error("Can not pop more levels than were pushed");
+		std::size_t size = mScopes[mScopes.size() - levels];
+		mScopes.resize(mScopes.size() - levels);
+		while (mDeclared.size() > size) {
+			mSymbols.erase(mDeclared.back());
+			mDeclared.pop_back();
+		}
+	}
+
+	/// Reads the argument of set-info or set-option up to the closing parenthesis.
+	void skipAttributeValue() {
+		smtlib::Token t = mLexer.next();
+		if (t == smtlib::Token::RPAREN) return;
+		if (t == smtlib::Token::LPAREN) mLexer.skip(1);
+		mLexer.skip(1);
+	}
+public:
+	/**
+	 * Parses the given buffer, which must outlive the parser.
+	 */
+	SMTLIBParser(const char* data, std::size_t size):
+		mLexer(data, data + size)
+	{}
+	/**
+	 * Parses the given stream, which is read completely into memory.
+	 */
+	explicit SMTLIBParser(std::istream& in):
+		mInput(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()),
+		mLexer(mInput.data(), mInput.data() + mInput.size())
+	{}
+	SMTLIBParser(const SMTLIBParser&) = delete;
+	SMTLIBParser& operator=(const SMTLIBParser&) = delete;
+
+	/**
+	 * Reads the next command.
+	 * @param cmd Is set to the command that was read.
+	 * @return false, if the input is exhausted.
+	 */
+	bool next(Command& cmd) {
+		cmd = Command();
+		smtlib::Token t = mLexer.next();
+		if (t == smtlib::Token::END) return false;
+		if (t != smtlib::Token::LPAREN) error("Expected a command");
+		std::string_view name = mLexer.expectSymbol();
+		if (name == "assert") {
+			cmd.type = Command::Type::ASSERT;
+			cmd.formula = parseFormula();
+			mLexer.expect(smtlib::Token::RPAREN, ")");
+			if (!mAuxiliary.empty()) cmd.formula = addAuxiliary(std::move(cmd.formula));
+		} else if (name == "declare-fun" || name == "declare-const") {
+			cmd.type = Command::Type::DECLARE_FUN;
+			declareFun(cmd, name == "declare-const");
+		} else if (name == "define-fun") {
+			cmd.type = Command::Type::DEFINE_FUN;
+			defineFun();
+		} else if (name == "declare-sort") {
+			cmd.type = Command::Type::DECLARE_SORT;
+			std::string_view sort = mLexer.expectSymbol();
+			cmd.name = std::string(sort);
+			if (mLexer.peek() == smtlib::Token::NUMERAL && mLexer.expectNumeral() != 0) error("Only sorts of arity zero are supported");
+			mLexer.expect(smtlib::Token::RPAREN, ")");
+			declare(sort, Symbol(SortInfo{UNINTERPRETED, false, 0, uninterpretedSort(cmd.name)}));
+		} else if (name == "push" || name == "pop") {
+			cmd.type = name == "push" ? Command::Type::PUSH : Command::Type::POP;
+			cmd.levels = mLexer.peek() == smtlib::Token::NUMERAL ? mLexer.expectNumeral() : 1;
+			mLexer.expect(smtlib::Token::RPAREN, ")");
+			if (cmd.type == Command::Type::PUSH) mScopes.insert(mScopes.end(), cmd.levels, mDeclared.size());
+			else pop(cmd.levels);
+		} else if (name == "set-logic") {
+			cmd.type = Command::Type::SET_LOGIC;
+			cmd.name = std::string(mLexer.expectSymbol());
+			mLexer.expect(smtlib::Token::RPAREN, ")");
+		} else if (name == "set-info" || name == "set-option") {
+			cmd.type = name == "set-info" ? Command::Type::SET_INFO : Command::Type::SET_OPTION;
+			mLexer.expect(smtlib::Token::KEYWORD, "a keyword");
+			cmd.name = std::string(mLexer.text());
+			skipAttributeValue();
+		} else if (name == "check-sat") {
+			cmd.type = Command::Type::CHECK_SAT;
+			mLexer.expect(smtlib::Token::RPAREN, ")");
+		} else if (name == "exit") {
+			cmd.type = Command::Type::EXIT;
+			mLexer.expect(smtlib::Token::RPAREN, ")");
+		} else {
+			cmd.name = std::string(name);
+			mLexer.skip(1);
+		}
+		return true;
+	}
+
+	/**
+	 * @return The term of a constant that was declared or defined without arguments.
+	 */
+	const Value& constant(std::string_view name) const {
+		auto it = mSymbols.find(name);
+		if (it == mSymbols.end() || !std::holds_alternative<Value>(it->second)) throw std::out_of_range("Unknown constant " + std::string(name));
+		return std::get<Value>(it->second);
+	}
+
+	/**
+	 * Parses a single term, for example the value of a (get-value) query, with the current declarations.
+	 */
+	Value term() {
+		return parseTerm(mLexer);
+	}
+};
+
+/**
+ * Parses an SMT-LIB file and returns the conjunction of all assertions.
+ * The file must not contain push or pop.
+ */
+template<typename Pol>
+Formula<Pol> parseSMTLIBFile(const std::string& filename) {
+	MappedFile file(filename);
+	SMTLIBParser<Pol> parser(file.data(), file.size());
+	typename SMTLIBParser<Pol>::Command cmd;
+	Formulas<Pol> assertions;
+	while (parser.next(cmd)) {
+		switch (cmd.type) {
+			case SMTLIBParser<Pol>::Command::Type::ASSERT:
+				assertions.push_back(std::move(cmd.formula));
+				break;
+			case SMTLIBParser<Pol>::Command::Type::PUSH:
+			case SMTLIBParser<Pol>::Command::Type::POP:
+				throw std::runtime_error("parseSMTLIBFile does not support push and pop");
+			default:
+				break;
+		}
+		if (cmd.type == SMTLIBParser<Pol>::Command::Type::EXIT) break;
+	}
+	return Formula<Pol>(AND, std::move(assertions));
+}
+
+}
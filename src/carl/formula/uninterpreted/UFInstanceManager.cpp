@@ -24,6 +24,51 @@ namespace carl
         return ufi;
     }
 
+    std::vector<bool> UFInstanceManager::reachable(const std::vector<UFInstance>& roots) const {
+        std::vector<bool> res(mUFInstances.size(), false);
+        std::vector<std::size_t> stack;
+        for (const auto& r: roots) stack.push_back(r.id());
+        while (!stack.empty()) {
+            std::size_t id = stack.back();
+            stack.pop_back();
+            if (id == 0 || res[id]) continue;
+            assert(mUFInstances[id] != nullptr);
+            res[id] = true;
+            for (const auto& arg: mUFInstances[id]->args()) {
+                if (arg.isUFInstance()) stack.push_back(arg.asUFInstance().id());
+            }
+        }
+        return res;
+    }
+
+    PoolStatistics UFInstanceManager::statistics(const std::vector<UFInstance>& roots) const {
+        PoolStatistics res("UFInstanceManager");
+        auto live = reachable(roots);
+        for (std::size_t id = 1; id < mUFInstances.size(); ++id) {
+            if (mUFInstances[id] == nullptr) continue;
+            if (live[id]) res.addLive(bytes(*mUFInstances[id]));
+            else res.addDead(bytes(*mUFInstances[id]));
+        }
+        return res;
+    }
+
+    PoolStatistics UFInstanceManager::collectGarbage(const std::vector<UFInstance>& roots) {
+        PoolStatistics res("UFInstanceManager");
+        auto live = reachable(roots);
+        for (std::size_t id = 1; id < mUFInstances.size(); ++id) {
+            if (mUFInstances[id] == nullptr) continue;
+            if (live[id]) {
+                res.addLive(bytes(*mUFInstances[id]));
+                continue;
+            }
+            res.addDead(bytes(*mUFInstances[id]));
+            mUFInstanceIdMap.erase(mUFInstances[id]);
+            delete mUFInstances[id];
+            mUFInstances[id] = nullptr;
+        }
+        return res;
+    }
+
     bool UFInstanceManager::argsCorrect(const UFInstanceContent& ufic) {
         if(!(ufic.uninterpretedFunction().domain().size() == ufic.args().size())) {
             return false;
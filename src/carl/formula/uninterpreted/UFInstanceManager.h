@@ -10,6 +10,7 @@
 #include "../../util/Common.h"
 #include "../../util/Singleton.h"
 #include "../../util/hash.h"
+#include "../PoolStatistics.h"
 #include "../Sort.h"
 #include "UFInstance.h"
 #include "UVariable.h"
@@ -176,6 +177,15 @@ class UFInstanceManager : public Singleton<UFInstanceManager> {
          */
         UFInstance newUFInstance(const UFInstanceContent* ufic);
 
+        /**
+         * @return For every id, whether the instance is reachable from the given instances.
+         */
+        std::vector<bool> reachable(const std::vector<UFInstance>& roots) const;
+
+        static std::size_t bytes(const UFInstanceContent& ufic) {
+            return sizeof(UFInstanceContent) + ufic.args().capacity() * sizeof(UTerm);
+        }
+
     public:
         /**
          * @param ufi An uninterpreted function instance.
@@ -184,6 +194,7 @@ class UFInstanceManager : public Singleton<UFInstanceManager> {
         const UninterpretedFunction& getUninterpretedFunction(const UFInstance& ufi) const {
             assert(ufi.id() != 0);
             assert(ufi.id() < mUFInstances.size());
+            assert(mUFInstances[ufi.id()] != nullptr);
             return mUFInstances[ufi.id()]->uninterpretedFunction();
         }
 
@@ -194,9 +205,31 @@ class UFInstanceManager : public Singleton<UFInstanceManager> {
         const std::vector<UTerm>& getArgs(const UFInstance& ufi) const {
             assert(ufi.id() != 0);
             assert(ufi.id() < mUFInstances.size());
+            assert(mUFInstances[ufi.id()] != nullptr);
             return mUFInstances[ufi.id()]->args();
         }
 
+        /**
+         * @return The number of stored uninterpreted function instances.
+         */
+        std::size_t size() const {
+            return mUFInstanceIdMap.size();
+        }
+
+        /**
+         * Counts the uninterpreted function instances that are (not) reachable from the given ones, also via their
+         * arguments.
+         */
+        PoolStatistics statistics(const std::vector<UFInstance>& roots) const;
+
+        /**
+         * Deletes all uninterpreted function instances that are not reachable from the given ones.
+         * The ids of the deleted instances are not reused, all other instances keep their ids.
+         * Note, that the deleted instances must not be used anymore.
+         * @return The statistics before the collection, that is the dead instances are the deleted ones.
+         */
+        PoolStatistics collectGarbage(const std::vector<UFInstance>& roots);
+
         /**
          * Gets the uninterpreted function instance with the given name, domain, arguments and codomain.
          * @param uf The underlying function of the uninterpreted function instance to get.
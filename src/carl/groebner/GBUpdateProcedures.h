@@ -6,6 +6,12 @@
 
 #pragma once
 
+#include "../config.h"
+
+#ifdef BUCHBERGER_STATISTICS
+#include "gb-buchberger/BuchbergerStats.h"
+#endif
+
 namespace carl
 {
 
@@ -72,7 +78,7 @@ public:
 			assert(!p.isConstant());
 			Polynomial q(p.lmon()->separablePart());
 #ifdef BUCHBERGER_STATISTICS
-			if(q.lterm().tdeg() != p.lterm().tdeg()) mStats->SingleTermSFP();
+			if(q.lterm().tdeg() != p.lterm().tdeg()) BuchbergerStats::getInstance()->SingleTermSFP();
 #endif
 			q.setReasons(p.getReasons());
 			size_t index = gb->addGenerator(q);
@@ -83,7 +89,7 @@ public:
 			if(p.hasConstantTerm())
 			{
 #ifdef BUCHBERGER_STATISTICS
-				if(p.nrOfTerms() > 1) mStats->TSQWithConstant();
+				if(p.nrTerms() > 1) BuchbergerStats::getInstance()->TSQWithConstant();
 #endif
 				gb->clear();
 				Polynomial q(1);
@@ -94,14 +100,14 @@ public:
 			else
 			{
 #ifdef BUCHBERGER_STATISTICS
-				mStats->TSQWithoutConstant();
+				BuchbergerStats::getInstance()->TSQWithoutConstant();
 #endif
 				Polynomial remainder(p);
 				while(!carl::isZero(remainder))
 				{
 					Polynomial r1(remainder.lmon()->separablePart());
 #ifdef BUCHBERGER_STATISTICS
-					if(remainder.lterm().tdeg() != r1.lterm().tdeg()) mStats->SingleTermSFP();
+					if(remainder.lterm().tdeg() != r1.lterm().tdeg()) BuchbergerStats::getInstance()->SingleTermSFP();
 #endif
 					r1.setReasons(p.getReasons());
 					remainder.stripLT();
@@ -113,7 +119,7 @@ public:
 		else if(p.isReducibleIdentity())
 		{
 #ifdef BUCHBERGER_STATISTICS
-			mStats->ReducibleIdentity();
+			BuchbergerStats::getInstance()->ReducibleIdentity();
 #endif
 			Polynomial r;
 			CARL_LOG_NOTIMPLEMENTED();
@@ -46,6 +46,46 @@ std::vector<MultivariatePolynomial<C, O, P>> cyclic3()
 
 
 
+/**
+ * Constructs the cyclic-n system for an arbitrary number of variables.
+ * For k = 1, ..., n-1 it contains the sum over all k consecutive (cyclic) products of the variables,
+ * and finally the product of all variables minus one.
+ * @param n Number of variables.
+ * @return The cyclic-n system.
+ */
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> cyclicN(std::size_t n)
+{
+	using Poly = MultivariatePolynomial<C, O, P>;
+	std::vector<Variable> vars;
+	for(std::size_t i = 0; i < n; ++i)
+	{
+		vars.push_back(freshRealVariable("x" + std::to_string(i)));
+	}
+	std::vector<Poly> res;
+	for(std::size_t k = 1; k < n; ++k)
+	{
+		Poly sum;
+		for(std::size_t i = 0; i < n; ++i)
+		{
+			Poly prod(C(1));
+			for(std::size_t j = 0; j < k; ++j)
+			{
+				prod *= vars[(i + j) % n];
+			}
+			sum += prod;
+		}
+		res.push_back(sum);
+	}
+	Poly prod(C(1));
+	for(const Variable& v: vars)
+	{
+		prod *= v;
+	}
+	res.push_back(prod - C(1));
+	return res;
+}
+
 #define run_cyclic_case(INDEX)	case INDEX: return cyclic##INDEX<C, O, P>()
 	
 template<typename C, typename O, typename P>
@@ -55,15 +95,10 @@ std::vector<MultivariatePolynomial<C, O, P>> cyclic(unsigned index)
 	{
 		run_cyclic_case(2);
 		run_cyclic_case(3);
-		//run_katsura_case(4);
-		//run_katsura_case(5);
-		//run_katsura_case(6);
-		//run_katsura_case(4);
 		default:
 			assert(index > 1);
-			assert(index < 4);
 	}
-	return std::vector<MultivariatePolynomial<C, O, P>>();
+	return cyclicN<C, O, P>(index);
 }
 	
 
@@ -0,0 +1,59 @@
+/**
+ * @file   eco.h
+ * @ingroup gb
+ *
+ * Generator for the eco-n benchmark family from economic modelling.
+ */
+
+#pragma once
+
+#include <cassert>
+#include "../../core/MultivariatePolynomial.h"
+
+namespace carl
+{
+namespace benchmarks
+{
+
+/**
+ * Constructs the eco-n system in the variables x_1, ..., x_n.
+ * For k = 1, ..., n-1 it contains (x_k + sum_{i=1}^{n-k-1} x_i * x_{i+k}) * x_n - k,
+ * and finally the linear equation x_1 + ... + x_{n-1} + 1.
+ * @param index Number of variables, at least two.
+ * @return The eco-n system.
+ */
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> eco(unsigned index)
+{
+	assert(index > 1);
+	using Poly = MultivariatePolynomial<C, O, P>;
+	std::vector<Variable> vars;
+	for(unsigned i = 1; i <= index; ++i)
+	{
+		vars.push_back(freshRealVariable("x" + std::to_string(i)));
+	}
+	// Access with the one-based indices used in the definition.
+	auto x = [&vars](unsigned i) {
+		return vars[i - 1];
+	};
+	std::vector<Poly> res;
+	for(unsigned k = 1; k < index; ++k)
+	{
+		Poly inner(x(k));
+		for(unsigned i = 1; i + k < index; ++i)
+		{
+			inner += Poly(x(i)) * x(i + k);
+		}
+		res.push_back(inner * x(index) - C(k));
+	}
+	Poly linear(C(1));
+	for(unsigned i = 1; i < index; ++i)
+	{
+		linear += x(i);
+	}
+	res.push_back(linear);
+	return res;
+}
+
+}
+}
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <cassert>
+#include <cstdlib>
 #include "../../core/MultivariatePolynomial.h"
 #include "../../util/stringparser.h"
 
@@ -87,6 +88,47 @@ std::vector<MultivariatePolynomial<C, O, P>> katsura5()
 
 
 
+/**
+ * Constructs the katsura system for an arbitrary number of variables u_0, ..., u_{n-1}.
+ * It consists of the linear equation u_0 + 2*u_1 + ... + 2*u_{n-1} - 1
+ * and for m = 0, ..., n-2 the equations sum_{l=-n+1}^{n-1} u_|l| * u_|m-l| - u_m,
+ * where all u_i with i >= n are zero.
+ * @param n Number of variables.
+ * @return The katsura system with n variables.
+ */
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> katsuraN(std::size_t n)
+{
+	using Poly = MultivariatePolynomial<C, O, P>;
+	std::vector<Variable> vars;
+	for(std::size_t i = 0; i < n; ++i)
+	{
+		vars.push_back(freshRealVariable("u" + std::to_string(i)));
+	}
+	auto u = [&vars](long i) {
+		return vars[std::size_t(std::abs(i))];
+	};
+	long size = long(n);
+	std::vector<Poly> res;
+	Poly linear(vars[0]);
+	for(std::size_t i = 1; i < n; ++i)
+	{
+		linear += C(2) * Poly(vars[i]);
+	}
+	res.push_back(linear - C(1));
+	for(long m = 0; m < size - 1; ++m)
+	{
+		Poly sum;
+		for(long l = -size + 1; l < size; ++l)
+		{
+			if(std::abs(m - l) >= size) continue;
+			sum += Poly(u(l)) * u(m - l);
+		}
+		res.push_back(sum - Poly(u(m)));
+	}
+	return res;
+}
+
 #define run_katsura_case(INDEX)	case INDEX: return katsura##INDEX<C, O, P>()
 	
 template<typename C, typename O, typename P>
@@ -98,13 +140,10 @@ std::vector<MultivariatePolynomial<C, O, P>> katsura(unsigned index)
 		run_katsura_case(3);
 		run_katsura_case(4);
 		run_katsura_case(5);
-		//run_katsura_case(6);
-		//run_katsura_case(4);
 		default:
 			assert(index > 1);
-			assert(index < 6);
 	}
-	return std::vector<MultivariatePolynomial<C, O, P>>();
+	return katsuraN<C, O, P>(index);
 }
 	
 	
@@ -0,0 +1,50 @@
+/**
+ * @file   noon.h
+ * @ingroup gb
+ *
+ * Generator for the noon-n benchmark family from neural network modelling.
+ */
+
+#pragma once
+
+#include <cassert>
+#include "../../core/MultivariatePolynomial.h"
+
+namespace carl
+{
+namespace benchmarks
+{
+
+/**
+ * Constructs the noon-n system in the variables x_1, ..., x_n.
+ * For every i it contains x_i * (sum_{j != i} x_j^2) - 11/10 * x_i + 1,
+ * scaled by ten to obtain integral coefficients.
+ * @param index Number of variables, at least two.
+ * @return The noon-n system.
+ */
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> noon(unsigned index)
+{
+	assert(index > 1);
+	using Poly = MultivariatePolynomial<C, O, P>;
+	std::vector<Variable> vars;
+	for(unsigned i = 1; i <= index; ++i)
+	{
+		vars.push_back(freshRealVariable("x" + std::to_string(i)));
+	}
+	std::vector<Poly> res;
+	for(std::size_t i = 0; i < vars.size(); ++i)
+	{
+		Poly squares;
+		for(std::size_t j = 0; j < vars.size(); ++j)
+		{
+			if(i == j) continue;
+			squares += Poly(vars[j]) * vars[j];
+		}
+		res.push_back(C(10) * squares * vars[i] - C(11) * Poly(vars[i]) + C(10));
+	}
+	return res;
+}
+
+}
+}
@@ -0,0 +1,97 @@
+/**
+ * @file   random.h
+ * @ingroup gb
+ *
+ * Generator for reproducible random polynomial systems.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <functional>
+#include <random>
+#include "../../core/MultivariatePolynomial.h"
+
+namespace carl
+{
+namespace benchmarks
+{
+
+/**
+ * Constructs a random system of polynomials.
+ * Every polynomial considers all monomials up to the given total degree and keeps each of them with the given density.
+ * Hence, a density of one yields dense polynomials while small densities yield sparse polynomials.
+ * The coefficients are nonzero integers from [-coefficientBound, coefficientBound].
+ * The system only depends on the arguments, in particular on the seed, which makes results reproducible.
+ * @param nrVariables Number of variables.
+ * @param nrPolynomials Number of polynomials.
+ * @param degree Maximal total degree of the monomials.
+ * @param density Probability for every monomial to occur.
+ * @param coefficientBound Bound for the absolute value of the coefficients.
+ * @param seed Seed for the random number generator.
+ * @return The random system.
+ */
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> randomSystem(std::size_t nrVariables, std::size_t nrPolynomials, unsigned degree, double density, long coefficientBound = 100, unsigned seed = 42)
+{
+	assert(nrVariables > 0);
+	assert(density > 0 && density <= 1);
+	assert(coefficientBound > 0);
+	using Poly = MultivariatePolynomial<C, O, P>;
+	std::vector<Variable> vars;
+	for(std::size_t i = 0; i < nrVariables; ++i)
+	{
+		vars.push_back(freshRealVariable("r" + std::to_string(i)));
+	}
+	// Enumerate all exponent vectors with total degree at most degree.
+	std::vector<std::vector<unsigned>> exponents;
+	std::vector<unsigned> current(nrVariables, 0);
+	std::function<void(std::size_t,unsigned)> enumerate = [&](std::size_t var, unsigned remaining) {
+		if(var == nrVariables)
+		{
+			exponents.push_back(current);
+			return;
+		}
+		for(unsigned e = 0; e <= remaining; ++e)
+		{
+			current[var] = e;
+			enumerate(var + 1, remaining - e);
+		}
+		current[var] = 0;
+	};
+	enumerate(0, degree);
+
+	std::mt19937 rng(seed);
+	std::bernoulli_distribution keep(density);
+	std::uniform_int_distribution<long> coeff(1, coefficientBound);
+	std::bernoulli_distribution negative(0.5);
+	std::vector<Poly> res;
+	for(std::size_t p = 0; p < nrPolynomials; ++p)
+	{
+		Poly poly;
+		for(const auto& exps: exponents)
+		{
+			if(!keep(rng)) continue;
+			long c = coeff(rng);
+			Poly term(C(negative(rng) ? -c : c));
+			for(std::size_t v = 0; v < nrVariables; ++v)
+			{
+				for(unsigned e = 0; e < exps[v]; ++e)
+				{
+					term *= vars[v];
+				}
+			}
+			poly += term;
+		}
+		if(poly.isConstant())
+		{
+			// Make sure that every polynomial actually depends on some variable.
+			poly += vars[p % nrVariables];
+		}
+		res.push_back(poly);
+	}
+	return res;
+}
+
+}
+}
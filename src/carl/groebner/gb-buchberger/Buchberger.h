@@ -28,13 +28,16 @@
  */
 
 #pragma once
-//#define BUCHBERGER_STATISTICS
 
+#include "../../config.h"
 
 #include "../GBUpdateProcedures.h"
 #include "../Ideal.h"
 #include "../Reductor.h"
 #include "CriticalPairs.h"
+#ifdef BUCHBERGER_STATISTICS
+#include "BuchbergerStats.h"
+#endif
 
 #include <list>
 #include <unordered_map>
@@ -88,7 +91,7 @@ protected:
     std::shared_ptr<CritPairs> pCritPairs;
 	UpdateFnct<Buchberger<Polynomial, AddingPolicy>> mUpdateCallBack;
 #ifdef BUCHBERGER_STATISTICS
-	BuchbergerStats* mStats;
+	BuchbergerStats* mStats = BuchbergerStats::getInstance();
 #endif
 
 
@@ -71,6 +71,10 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
             assert( pGb->getGenerators()[critPair.mP1].nrTerms() != 0 );
             assert( pGb->getGenerators()[critPair.mP2].nrTerms() != 0 );
 			Polynomial spol = carl::SPolynomial(pGb->getGenerators()[critPair.mP1], pGb->getGenerators()[critPair.mP2]);
+#ifdef BUCHBERGER_STATISTICS
+			mStats->TreatSPair();
+			mStats->TermCount(spol.nrTerms());
+#endif
 			spol.setReasons(pGb->getGenerators()[critPair.mP1].getReasons() | pGb->getGenerators()[critPair.mP2].getReasons());
 			CARL_LOG_DEBUG("carl.gb.buchberger", "SPol: " << spol);
 			// Schedules the S-polynomial for reduction
@@ -81,6 +85,10 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 			// If it is not zero, we should add this one to our GB
 			if(!isZero(remainder))
 			{
+#ifdef BUCHBERGER_STATISTICS
+				mStats->NonZeroReduction();
+				mStats->TermCount(remainder.nrTerms());
+#endif
 				// If it is constant, we are done and can return {1} as GB.
 				if(remainder.isConstant())
 				{
@@ -28,6 +28,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace carl
 {
 
@@ -83,6 +85,29 @@ public:
         mNrOfNonZeroReductions++;
     }
 
+    /**
+     * Record the number of terms of a polynomial occurring during the computation.
+     * Only the maximum over all recorded values is kept.
+     */
+    void TermCount( std::size_t nrTerms )
+    {
+        if( nrTerms > mPeakTermCount ) mPeakTermCount = nrTerms;
+    }
+
+    /**
+     * Set all counters back to zero, e.g. before measuring another Groebner basis computation.
+     */
+    void reset( )
+    {
+        mNrOfTSQWithConstant = 0;
+        mNrOfTSQWithoutConstant = 0;
+        mNrOfSingleTermSFP = 0;
+        mNrOfReducibleIdentities = 0;
+        mNrOfReductions = 0;
+        mNrOfNonZeroReductions = 0;
+        mPeakTermCount = 0;
+    }
+
     unsigned getNrTSQWithConstant( ) const
     {
         return mNrOfTSQWithConstant;
@@ -102,6 +127,26 @@ public:
     {
         return mNrOfReducibleIdentities;
     }
+
+    unsigned getNrReductions( ) const
+    {
+        return mNrOfReductions;
+    }
+
+    unsigned getNrNonZeroReductions( ) const
+    {
+        return mNrOfNonZeroReductions;
+    }
+
+    unsigned getNrZeroReductions( ) const
+    {
+        return mNrOfReductions - mNrOfNonZeroReductions;
+    }
+
+    std::size_t getPeakTermCount( ) const
+    {
+        return mPeakTermCount;
+    }
 protected:
 
     BuchbergerStats( ) :
@@ -110,7 +155,8 @@ protected:
     mNrOfSingleTermSFP( 0 ),
     mNrOfReducibleIdentities( 0 ),
     mNrOfReductions( 0 ),
-    mNrOfNonZeroReductions( 0 )
+    mNrOfNonZeroReductions( 0 ),
+    mPeakTermCount( 0 )
     {
     }
     unsigned mNrOfTSQWithConstant;
@@ -119,6 +165,7 @@ protected:
     unsigned mNrOfReducibleIdentities;
     unsigned mNrOfReductions;
     unsigned mNrOfNonZeroReductions;
+    std::size_t mPeakTermCount;
 
 private:
     static BuchbergerStats* instance;
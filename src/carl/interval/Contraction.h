@@ -12,6 +12,7 @@
 #include "../core/MultivariateHorner.h"
 #include "IntervalEvaluation.h"
 #include <algorithm>
+#include <memory>
 
 //#define CONTRACTION_DEBUG
 //#define USE_HORNER
@@ -193,11 +194,12 @@ namespace carl {
              * @param resB The second interval of the result.
              * @return true, if the second interval is not empty. (the first interval must then be also nonempty)
              */
-            std::vector<Interval<double>> evaluate(const Interval<double>::evalintervalmap& intervals) const
+            template<typename Assignment>
+            std::vector<Interval<double>> evaluate(const Assignment& intervals) const
             {
                 // evaluate monomial
                 std::vector<Interval<double>> result;
-                assert( intervals.find(mVar) != intervals.end() );
+                assert( intervals.count(mVar) > 0 );
                 const Interval<double>& varInterval = intervals.at(mVar);
                 Interval<double> numerator = IntervalEvaluation::evaluate(mNumerator, intervals);
 				CARL_LOG_DEBUG("carl.contraction", mNumerator << " -> " << numerator);
@@ -245,14 +247,48 @@ namespace carl {
         Polynomial mConstraint; // Todo: Should be a reference.
         Polynomial* mpOriginal;
         #ifdef USE_HORNER
+        using Derivative = MultivariateHorner<Polynomial, strategy>;
         MultivariateHorner<Polynomial, strategy> mHornerForm;
-        std::map<Variable, MultivariateHorner<Polynomial,strategy>> mDerivatives;
         #else
-        std::map<Variable, Polynomial> mDerivatives;
+        using Derivative = Polynomial;
         #endif
-        std::map<Variable, VarSolutionFormula<Polynomial>> mVarSolutionFormulas;
+        /// Derivatives and solution formulas are created on demand and stored by denseIndex() of the variable.
+        std::vector<std::unique_ptr<Derivative>> mDerivatives;
+        std::vector<std::unique_ptr<VarSolutionFormula<Polynomial>>> mVarSolutionFormulas;
         std::map<Polynomial, MultivariateHorner<Polynomial,strategy>> mHornerSchemes;
 
+        template<typename T>
+        static std::unique_ptr<T>& slot(std::vector<std::unique_ptr<T>>& cache, Variable::Arg variable)
+        {
+            std::size_t index = denseIndex(variable);
+            if( index >= cache.size() )
+                cache.resize(index + 1);
+            return cache[index];
+        }
+
+        const Derivative& getDerivative(Variable::Arg variable)
+        {
+            auto& deriv = slot(mDerivatives, variable);
+            if( deriv == nullptr )
+            {
+                #ifdef USE_HORNER
+                //Deriviate and convert to Horner
+                deriv = std::make_unique<Derivative>(polynomial().derivative(variable));
+                #else
+                deriv = std::make_unique<Derivative>(derivative(polynomial(), variable));
+                #endif
+            }
+            return *deriv;
+        }
+
+        const VarSolutionFormula<Polynomial>& getVarSolutionFormula(Variable::Arg variable)
+        {
+            auto& formula = slot(mVarSolutionFormulas, variable);
+            if( formula == nullptr )
+                formula = std::make_unique<VarSolutionFormula<Polynomial>>(mConstraint, variable);
+            return *formula;
+        }
+
     public:
         Contraction() = delete;
         Contraction(const Polynomial& constraint):
@@ -308,41 +344,30 @@ namespace carl {
             return mpOriginal == nullptr ? mConstraint : *mpOriginal;
         }
 
-        bool operator()(const Interval<double>::evalintervalmap& intervals, Variable::Arg variable, Interval<double>& resA, Interval<double>& resB, bool useNiceCenter = false, bool usePropagation = false)
+        /**
+         * Contracts the interval of the given variable.
+         * @param intervals The box, either a `std::map<Variable, Interval<double>>` or an IntervalBox<double>.
+         * @param variable The variable to contract.
+         * @param resA The first resulting interval.
+         * @param resB The second resulting interval, which is empty if no split occurred.
+         * @return true, if a split occurred.
+         */
+        template<typename Assignment>
+        bool operator()(const Assignment& intervals, Variable::Arg variable, Interval<double>& resA, Interval<double>& resB, bool useNiceCenter = false, bool usePropagation = false)
         {
             bool splitOccurredInContraction = false;
             if( !usePropagation || mpOriginal == nullptr || !mConstraint.isLinear() )
             {
-                #ifdef USE_HORNER
-                typename std::map<Variable, MultivariateHorner<Polynomial,strategy>>::const_iterator it = mDerivatives.find(variable);
-                #else
-                typename std::map<Variable, Polynomial>::const_iterator it = mDerivatives.find(variable);
-                #endif
-
-                if( it == mDerivatives.end() )
-                {
-                    #ifdef USE_HORNER
-                    //Deriviate and convert to Horner
-                    if( mpOriginal == nullptr )
-                        it = mDerivatives.emplace(variable, std::move(MultivariateHorner<Polynomial, strategy>( mConstraint.derivative(variable)))).first;
-                    else
-                        it = mDerivatives.emplace(variable, std::move(MultivariateHorner<Polynomial, strategy>( mpOriginal->derivative(variable)))).first;
-                    #else
-                    if( mpOriginal == nullptr )
-                        it = mDerivatives.emplace(variable, derivative(mConstraint, variable)).first;
-                    else
-                        it = mDerivatives.emplace(variable, derivative(*mpOriginal, variable)).first;
-                    #endif
-                }
+                const auto& deriv = getDerivative(variable);
 
                 #ifdef CONTRACTION_DEBUG
                 std::cout << __func__ << ": contraction of " << variable << " with " << intervals << " in " << mConstraint << " mpOriginal: " << mpOriginal << std::endl;
                 #endif
 
                 #ifdef USE_HORNER
-                splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, mHornerForm, (*it).second, resA, resB, useNiceCenter);
+                splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, mHornerForm, deriv, resA, resB, useNiceCenter);
                 #else
-                splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, (mpOriginal == nullptr ? mConstraint : *mpOriginal), (*it).second, resA, resB, useNiceCenter);
+                splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, (mpOriginal == nullptr ? mConstraint : *mpOriginal), deriv, resA, resB, useNiceCenter);
                 #endif
             }
             else
@@ -357,14 +382,8 @@ namespace carl {
 
             if( usePropagation )
             {
-                typename std::map<Variable, VarSolutionFormula<Polynomial>>::const_iterator const_iterator_VarSolutionFormula = mVarSolutionFormulas.find(variable);
-                if( const_iterator_VarSolutionFormula == mVarSolutionFormulas.end() )
-                {
-                    const_iterator_VarSolutionFormula = mVarSolutionFormulas.emplace(variable, std::move(VarSolutionFormula<Polynomial>(mConstraint,variable))).first;
-                }
-                
                 // calculate result of propagation
-                std::vector<Interval<double>> resultPropagation = const_iterator_VarSolutionFormula->second.evaluate( intervals );
+                std::vector<Interval<double>> resultPropagation = getVarSolutionFormula(variable).evaluate( intervals );
                 
                 #ifdef CONTRACTION_DEBUG
                 std::cout << "  propagation result: " << resultPropagation << std::endl;
@@ -484,14 +503,31 @@ namespace carl {
             }
             return splitOccurredInContraction;
         }
+
+        /**
+         * Contracts the interval of the given variable on many boxes at once.
+         * Splits are not reported, instead the result holds the convex hull of both parts.
+         * @param intervals The boxes, the k'th box assigns the k'th interval of every batch.
+         * @param variable The variable to contract.
+         * @param result The contracted intervals of the variable, empty for boxes that contain no solution.
+         */
+        void operator()(const std::map<Variable, IntervalBatch>& intervals, Variable::Arg variable, IntervalBatch& result)
+        {
+            const auto& deriv = getDerivative(variable);
+            #ifdef USE_HORNER
+            Operator<Polynomial>::contract(intervals, variable, mHornerForm, deriv, result);
+            #else
+            Operator<Polynomial>::contract(intervals, variable, (mpOriginal == nullptr ? mConstraint : *mpOriginal), deriv, result);
+            #endif
+        }
     };
 
     template<typename Polynomial>
     class SimpleNewton {
     public:
         
-        template <typename evalType>
-        bool contract(const Interval<double>::evalintervalmap& intervals, 
+        template <typename Assignment, typename evalType>
+        bool contract(const Assignment& intervals, 
             Variable::Arg variable, 
             const evalType& constraint, 
             const evalType& derivative, 
@@ -517,7 +553,7 @@ namespace carl {
 			#endif
 			
             // Create map for replacement of variables by intervals and replacement of center by point interval
-            typename Interval<double>::evalintervalmap substitutedIntervalMap = intervals;
+            Assignment substitutedIntervalMap = intervals;
             substitutedIntervalMap[variable] = centerInterval;
 
             Interval<double> numerator (0);
@@ -594,6 +630,44 @@ namespace carl {
             }
             return splitOccurred;
         }
+
+        /**
+         * Applies the interval Newton operator on many boxes at once.
+         * Where the derivative contains zero, the extended division would split the result. As the batch holds a
+         * single interval per box, it then keeps the original interval instead.
+         */
+        template <typename evalType>
+        void contract(const std::map<Variable, IntervalBatch>& intervals,
+            Variable::Arg variable,
+            const evalType& constraint,
+            const evalType& derivative,
+            IntervalBatch& result)
+        {
+            const IntervalBatch& varIntervals = intervals.at(variable);
+            std::size_t size = varIntervals.size();
+            IntervalBatch centers(size);
+            std::vector<bool> unbounded(size);
+            for (std::size_t k = 0; k < size; ++k) {
+                double center = 0.5 * varIntervals.lower()[k] + 0.5 * varIntervals.upper()[k];
+                unbounded[k] = !std::isfinite(center);
+                centers.lower()[k] = centers.upper()[k] = unbounded[k] ? 0.0 : center;
+            }
+
+            std::map<Variable, IntervalBatch> substitutedIntervalMap = intervals;
+            substitutedIntervalMap[variable] = centers;
+            IntervalBatch numerator = IntervalEvaluation::evaluate(constraint, substitutedIntervalMap);
+            IntervalBatch denominator = IntervalEvaluation::evaluate(derivative, intervals);
+
+            result = set_intersection(varIntervals, centers - numerator / denominator);
+            for (std::size_t k = 0; k < size; ++k) {
+                if (unbounded[k] && !varIntervals.isEmpty(k)) {
+                    result.set(k, varIntervals[k]);
+                }
+                if (variable.type() == VariableType::VT_INT && !result.isEmpty(k)) {
+                    result.set(k, result[k].integralPart());
+                }
+            }
+        }
     };
 
     typedef Contraction<SimpleNewton, Polynomial> SimpleNewtonContraction;
@@ -132,9 +132,11 @@ public:
 	 * - Transform relation into an interval (e.g. < 0 to = (-oo, 0))
 	 * - Transform constraint to equality (e.g. p*x - q < 0 to p*x - q = h)
 	 * - Evaluate with respect to interval h (e.g. x = (q + h) / p)
+	 *
+	 * The assignment is either a `std::map<Variable, Interval<Number>>` or an IntervalBox<Number>.
 	 */
-	template<typename Number>
-	std::vector<Interval<Number>> evaluate(const std::map<Variable, Interval<Number>>& assignment, const Interval<Number>& h = Interval<Number>(0,0)) const {
+	template<typename Assignment, typename Number = typename IntervalAssignmentNumber<Assignment>::type>
+	std::vector<Interval<Number>> evaluate(const Assignment& assignment, const Interval<Number>& h = Interval<Number>(0,0)) const {
 		std::vector<Interval<Number>> res;
 		CARL_LOG_DEBUG("carl.contractor", "Evaluating on " << assignment);
 		auto num = IntervalEvaluation::evaluate(numerator(), assignment);
@@ -228,15 +230,17 @@ public:
 		return mOrigin;
 	}
 
-	std::vector<Interval<Number>> evaluate(const std::map<Variable, Interval<Number>>& assignment) const {
+	template<typename Assignment>
+	std::vector<Interval<Number>> evaluate(const Assignment& assignment) const {
 		CARL_LOG_DEBUG("carl.contractor", "Evaluating " << mEvaluation << " on " << assignment);
 		return mEvaluation.evaluate(assignment, mRelation);
 	}
 
-	std::vector<Interval<Number>> contract(const std::map<Variable, Interval<Number>>& assignment) const {
+	template<typename Assignment>
+	std::vector<Interval<Number>> contract(const Assignment& assignment) const {
 		auto res = evaluate(assignment);
-		assert(assignment.find(mEvaluation.var()) != assignment.end());
-		auto cur = assignment.find(mEvaluation.var())->second;
+		assert(assignment.count(mEvaluation.var()) > 0);
+		const auto& cur = assignment.at(mEvaluation.var());
 		CARL_LOG_DEBUG("carl.contractor", "Intersecting " << res << " with " << cur);
 
 		std::size_t last = 0;
@@ -0,0 +1,192 @@
+/**
+ * @file IntervalBatch.cpp
+ *
+ * This file must be compiled with -frounding-math, otherwise the compiler may assume round-to-nearest and fold
+ * -((-a) - b) into a + b.
+ */
+
+#include "IntervalBatch.h"
+
+#include <algorithm>
+#include <cfenv>
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define CARL_BATCH_KERNEL __attribute__((target_clones("avx2", "default")))
+#else
+#define CARL_BATCH_KERNEL
+#endif
+
+namespace carl {
+namespace interval_batch {
+
+namespace {
+	/// Switches to upward rounding for the lifetime of this object.
+	class RoundUpward {
+		int mOld;
+	public:
+		RoundUpward(): mOld(std::fegetround()) {
+			std::fesetround(FE_UPWARD);
+		}
+		~RoundUpward() {
+			std::fesetround(mOld);
+		}
+		RoundUpward(const RoundUpward&) = delete;
+		RoundUpward& operator=(const RoundUpward&) = delete;
+	};
+
+	constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+	constexpr double INF = std::numeric_limits<double>::infinity();
+
+	inline double max(double a, double b) {
+		return a < b ? b : a;
+	}
+	inline double min(double a, double b) {
+		return b < a ? b : a;
+	}
+	/// Product where zero times infinity is zero.
+	inline double mulz(double a, double b) {
+		return (a == 0 || b == 0) ? 0.0 : a * b;
+	}
+	/// Restores emptiness, as min and max drop NaN operands.
+	inline double keepEmpty(double res, double a, double b) {
+		return (a != a || b != b) ? NaN : res;
+	}
+
+	CARL_BATCH_KERNEL
+	void mulKernel(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru) {
+		for (std::size_t i = 0; i < n; ++i) {
+			double a = al[i], b = au[i], c = bl[i], d = bu[i];
+			double upper = max(max(mulz(a, c), mulz(a, d)), max(mulz(b, c), mulz(b, d)));
+			double lower = -max(max(mulz(-a, c), mulz(-a, d)), max(mulz(-b, c), mulz(-b, d)));
+			rl[i] = keepEmpty(lower, a, c);
+			ru[i] = keepEmpty(upper, a, c);
+		}
+	}
+
+	/// Computes bounds of x^exp for x >= 0, xl is a lower and xu an upper bound.
+	CARL_BATCH_KERNEL
+	void powKernel(std::size_t n, double* xl, double* xu, uint exp) {
+		std::vector<double> bl(xl, xl + n);
+		std::vector<double> bu(xu, xu + n);
+		for (uint e = 1; e < exp; ++e) {
+			for (std::size_t i = 0; i < n; ++i) {
+				xl[i] = -mulz(-xl[i], bl[i]);
+				xu[i] = mulz(xu[i], bu[i]);
+			}
+		}
+	}
+}
+
+CARL_BATCH_KERNEL
+void add(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru) {
+	RoundUpward r;
+	for (std::size_t i = 0; i < n; ++i) {
+		rl[i] = -((-al[i]) - bl[i]);
+		ru[i] = au[i] + bu[i];
+	}
+}
+
+CARL_BATCH_KERNEL
+void sub(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru) {
+	RoundUpward r;
+	for (std::size_t i = 0; i < n; ++i) {
+		double lower = -(bu[i] - al[i]);
+		double upper = au[i] - bl[i];
+		rl[i] = lower;
+		ru[i] = upper;
+	}
+}
+
+void mul(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru) {
+	RoundUpward r;
+	mulKernel(n, al, au, bl, bu, rl, ru);
+}
+
+void div(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru) {
+	RoundUpward r;
+	std::vector<double> il(n);
+	std::vector<double> iu(n);
+	std::vector<bool> containsZero(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		// [1/d, 1/c] where 1/d is rounded downward.
+		il[i] = -((-1.0) / bu[i]);
+		iu[i] = 1.0 / bl[i];
+		containsZero[i] = bl[i] <= 0 && bu[i] >= 0;
+	}
+	mulKernel(n, al, au, il.data(), iu.data(), rl, ru);
+	for (std::size_t i = 0; i < n; ++i) {
+		if (containsZero[i] && !std::isnan(rl[i])) {
+			rl[i] = -INF;
+			ru[i] = INF;
+		}
+	}
+}
+
+void sqr(std::size_t n, const double* al, const double* au, double* rl, double* ru) {
+	pow(n, al, au, 2, rl, ru);
+}
+
+void pow(std::size_t n, const double* al, const double* au, uint exp, double* rl, double* ru) {
+	if (exp == 0) {
+		for (std::size_t i = 0; i < n; ++i) {
+			bool isEmpty = std::isnan(al[i]);
+			rl[i] = isEmpty ? NaN : 1.0;
+			ru[i] = isEmpty ? NaN : 1.0;
+		}
+		return;
+	}
+	RoundUpward r;
+	if (exp % 2 == 0) {
+		// [min |x|^exp, max |x|^exp]
+		std::vector<double> lower(n);
+		std::vector<double> upper(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			double a = al[i], b = au[i];
+			lower[i] = keepEmpty(a > 0 ? a : (b < 0 ? -b : 0.0), a, b);
+			upper[i] = keepEmpty(max(-a, b), a, b);
+		}
+		powKernel(n, lower.data(), upper.data(), exp);
+		std::copy(lower.begin(), lower.end(), rl);
+		std::copy(upper.begin(), upper.end(), ru);
+	} else {
+		// x^exp is monotone, bound |a|^exp and |b|^exp from both sides and pick according to the signs.
+		std::vector<double> lowerA(n), upperA(n), lowerB(n), upperB(n);
+		std::vector<bool> negA(n), negB(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			negA[i] = al[i] < 0;
+			negB[i] = au[i] < 0;
+			lowerA[i] = upperA[i] = std::abs(al[i]);
+			lowerB[i] = upperB[i] = std::abs(au[i]);
+		}
+		powKernel(n, lowerA.data(), upperA.data(), exp);
+		powKernel(n, lowerB.data(), upperB.data(), exp);
+		for (std::size_t i = 0; i < n; ++i) {
+			rl[i] = negA[i] ? -upperA[i] : lowerA[i];
+			ru[i] = negB[i] ? -lowerB[i] : upperB[i];
+		}
+	}
+}
+
+CARL_BATCH_KERNEL
+void neg(std::size_t n, const double* al, const double* au, double* rl, double* ru) {
+	for (std::size_t i = 0; i < n; ++i) {
+		double lower = -au[i];
+		double upper = -al[i];
+		rl[i] = lower;
+		ru[i] = upper;
+	}
+}
+
+CARL_BATCH_KERNEL
+void intersect(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru) {
+	for (std::size_t i = 0; i < n; ++i) {
+		double lower = keepEmpty(max(al[i], bl[i]), al[i], bl[i]);
+		double upper = keepEmpty(min(au[i], bu[i]), al[i], bl[i]);
+		bool isEmpty = upper < lower;
+		rl[i] = isEmpty ? NaN : lower;
+		ru[i] = isEmpty ? NaN : upper;
+	}
+}
+
+}
+}
@@ -0,0 +1,188 @@
+/**
+ * @file IntervalBatch.h
+ *
+ * Batches of double intervals stored as structure of arrays.
+ */
+
+#pragma once
+
+#include "Interval.h"
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Kernels on intervals given by separate arrays of lower and upper bounds.
+ *
+ * All intervals are closed, infinite bounds are stored as infinities and an empty interval has NaN as both bounds.
+ * Every kernel switches the rounding mode to upward once, computes lower bounds by negation (-((-a) op b) instead of
+ * a op b rounded downward) and restores the rounding mode when it is done.
+ * The loops are free of branches and are compiled for AVX2 and for the baseline architecture, the version is selected
+ * when the library is loaded.
+ * The result arrays may alias the arguments.
+ */
+namespace interval_batch {
+	void add(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru);
+	void sub(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru);
+	void mul(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru);
+	/// Divides a by b, where b contains zero the result is unbounded.
+	void div(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru);
+	void sqr(std::size_t n, const double* al, const double* au, double* rl, double* ru);
+	void pow(std::size_t n, const double* al, const double* au, uint exp, double* rl, double* ru);
+	void neg(std::size_t n, const double* al, const double* au, double* rl, double* ru);
+	void intersect(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru);
+}
+
+/**
+ * A batch of intervals over double, stored as two arrays of lower and upper bounds.
+ *
+ * This is meant for evaluating the same expression on many boxes, as the interval Newton operator does for
+ * thousands of boxes in every propagation round. Compared to Interval<double>, the rounding mode is switched only
+ * once per operation on the whole batch and the operations are vectorized.
+ * All intervals in a batch are closed: converting from an Interval<double> drops strict bounds, which is a sound
+ * over-approximation.
+ */
+class IntervalBatch {
+private:
+	std::vector<double> mLower;
+	std::vector<double> mUpper;
+
+	static constexpr double empty() {
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+	static constexpr double inf() {
+		return std::numeric_limits<double>::infinity();
+	}
+public:
+	IntervalBatch() = default;
+
+	/**
+	 * Creates a batch holding the given interval n times.
+	 */
+	explicit IntervalBatch(std::size_t n, const Interval<double>& i = Interval<double>(0)):
+		mLower(n),
+		mUpper(n)
+	{
+		for (std::size_t k = 0; k < n; ++k) set(k, i);
+	}
+
+	explicit IntervalBatch(const std::vector<Interval<double>>& intervals):
+		mLower(intervals.size()),
+		mUpper(intervals.size())
+	{
+		for (std::size_t k = 0; k < intervals.size(); ++k) set(k, intervals[k]);
+	}
+
+	std::size_t size() const {
+		return mLower.size();
+	}
+	double* lower() {
+		return mLower.data();
+	}
+	const double* lower() const {
+		return mLower.data();
+	}
+	double* upper() {
+		return mUpper.data();
+	}
+	const double* upper() const {
+		return mUpper.data();
+	}
+
+	bool isEmpty(std::size_t k) const {
+		return std::isnan(mLower[k]);
+	}
+
+	void set(std::size_t k, const Interval<double>& i) {
+		assert(k < size());
+		if (i.isEmpty()) {
+			mLower[k] = empty();
+			mUpper[k] = empty();
+			return;
+		}
+		mLower[k] = (i.lowerBoundType() == BoundType::INFTY) ? -inf() : i.lower();
+		mUpper[k] = (i.upperBoundType() == BoundType::INFTY) ? inf() : i.upper();
+	}
+
+	Interval<double> operator[](std::size_t k) const {
+		assert(k < size());
+		if (isEmpty(k)) return Interval<double>::emptyInterval();
+		double l = mLower[k];
+		double u = mUpper[k];
+		return Interval<double>(
+			std::isinf(l) ? 0.0 : l, std::isinf(l) ? BoundType::INFTY : BoundType::WEAK,
+			std::isinf(u) ? 0.0 : u, std::isinf(u) ? BoundType::INFTY : BoundType::WEAK
+		);
+	}
+
+	std::vector<Interval<double>> toIntervals() const {
+		std::vector<Interval<double>> res;
+		res.reserve(size());
+		for (std::size_t k = 0; k < size(); ++k) res.emplace_back((*this)[k]);
+		return res;
+	}
+
+	IntervalBatch& operator+=(const IntervalBatch& rhs) {
+		assert(size() == rhs.size());
+		interval_batch::add(size(), lower(), upper(), rhs.lower(), rhs.upper(), lower(), upper());
+		return *this;
+	}
+	IntervalBatch& operator-=(const IntervalBatch& rhs) {
+		assert(size() == rhs.size());
+		interval_batch::sub(size(), lower(), upper(), rhs.lower(), rhs.upper(), lower(), upper());
+		return *this;
+	}
+	IntervalBatch& operator*=(const IntervalBatch& rhs) {
+		assert(size() == rhs.size());
+		interval_batch::mul(size(), lower(), upper(), rhs.lower(), rhs.upper(), lower(), upper());
+		return *this;
+	}
+	IntervalBatch& operator/=(const IntervalBatch& rhs) {
+		assert(size() == rhs.size());
+		interval_batch::div(size(), lower(), upper(), rhs.lower(), rhs.upper(), lower(), upper());
+		return *this;
+	}
+
+	friend IntervalBatch operator+(IntervalBatch lhs, const IntervalBatch& rhs) {
+		return lhs += rhs;
+	}
+	friend IntervalBatch operator-(IntervalBatch lhs, const IntervalBatch& rhs) {
+		return lhs -= rhs;
+	}
+	friend IntervalBatch operator*(IntervalBatch lhs, const IntervalBatch& rhs) {
+		return lhs *= rhs;
+	}
+	friend IntervalBatch operator/(IntervalBatch lhs, const IntervalBatch& rhs) {
+		return lhs /= rhs;
+	}
+	friend IntervalBatch operator-(IntervalBatch i) {
+		interval_batch::neg(i.size(), i.lower(), i.upper(), i.lower(), i.upper());
+		return i;
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const IntervalBatch& b) {
+		return os << b.toIntervals();
+	}
+};
+
+inline IntervalBatch sqr(IntervalBatch i) {
+	interval_batch::sqr(i.size(), i.lower(), i.upper(), i.lower(), i.upper());
+	return i;
+}
+
+inline IntervalBatch pow(IntervalBatch i, uint exp) {
+	interval_batch::pow(i.size(), i.lower(), i.upper(), exp, i.lower(), i.upper());
+	return i;
+}
+
+inline IntervalBatch set_intersection(IntervalBatch lhs, const IntervalBatch& rhs) {
+	assert(lhs.size() == rhs.size());
+	interval_batch::intersect(lhs.size(), lhs.lower(), lhs.upper(), rhs.lower(), rhs.upper(), lhs.lower(), lhs.upper());
+	return lhs;
+}
+
+}
@@ -0,0 +1,243 @@
+/**
+ * @file IntervalBox.h
+ *
+ * Assignments of intervals to variables stored densely by variable index.
+ */
+
+#pragma once
+
+#include "Interval.h"
+#include "../core/Variable.h"
+#include "../util/platform.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Maps a variable to a small nonnegative number, such that variables can be used as indices into a vector.
+ * Variables of different types may share an id, hence the type is part of the index.
+ */
+inline std::size_t denseIndex(Variable v) noexcept {
+	return v.id() * static_cast<std::size_t>(VariableType::TYPE_SIZE) + static_cast<std::size_t>(v.type());
+}
+
+namespace interval_box_detail {
+	/// Returns the index of the lowest set bit of a nonzero word.
+	inline std::size_t lowestBit(std::uint64_t bits) noexcept {
+		assert(bits != 0);
+#if defined __CLANG || defined __GCC
+		return std::size_t(__builtin_ctzll(bits));
+#else
+		std::size_t res = 0;
+		for (; (bits & 1) == 0; bits >>= 1) res++;
+		return res;
+#endif
+	}
+}
+
+template<typename Number>
+class IntervalBox;
+
+/**
+ * Provides the number type of an assignment of intervals to variables, that is of a
+ * `std::map<Variable, Interval<Number>>` or an IntervalBox<Number>.
+ * For all other types, there is no member type, such that templates can be restricted to assignments.
+ */
+template<typename T>
+struct IntervalAssignmentNumber {};
+template<typename Number>
+struct IntervalAssignmentNumber<std::map<Variable, Interval<Number>>> {
+	using type = Number;
+};
+template<typename Number>
+struct IntervalAssignmentNumber<IntervalBox<Number>> {
+	using type = Number;
+};
+
+/**
+ * An assignment of intervals to variables, i.e. a box, that is meant to replace `std::map<Variable, Interval<Number>>`
+ * in the inner loops of interval constraint propagation.
+ *
+ * - Lookups are a vector access using denseIndex().
+ * - The intervals are stored in fixed size chunks that are shared between copies until one of them modifies the chunk.
+ *   Hence taking a snapshot before branching only copies a few pointers.
+ * - The box records which variables were changed since the last call to clearChanged(), such that a propagation
+ *   engine only needs to revisit constraints on these variables.
+ *
+ * The interface is a subset of the one of std::map (at(), count(), operator[]), hence code that is templated on the
+ * assignment can use both.
+ * A box is not synchronized, but different copies can be used in different threads.
+ */
+template<typename Number>
+class IntervalBox {
+private:
+	static constexpr std::size_t CHUNK_SIZE = 64;
+	struct Entry {
+		/// The variable, NO_VARIABLE if this entry is not assigned.
+		Variable var;
+		Interval<Number> interval;
+	};
+	using Chunk = std::array<Entry, CHUNK_SIZE>;
+
+	std::vector<std::shared_ptr<Chunk>> mChunks;
+	/// Bitmask of variables changed since the last call to clearChanged(), indexed like the entries.
+	std::vector<std::uint64_t> mChanged;
+	/// Number of assigned variables.
+	std::size_t mSize = 0;
+
+	const Entry* find(Variable v) const {
+		std::size_t i = denseIndex(v);
+		if (i / CHUNK_SIZE >= mChunks.size()) return nullptr;
+		const auto& chunk = mChunks[i / CHUNK_SIZE];
+		if (!chunk) return nullptr;
+		const Entry& e = (*chunk)[i % CHUNK_SIZE];
+		return e.var == v ? &e : nullptr;
+	}
+
+	/// Returns the entry for v, copying its chunk if it is shared.
+	Entry& entry(Variable v) {
+		std::size_t i = denseIndex(v);
+		if (i / CHUNK_SIZE >= mChunks.size()) {
+			mChunks.resize(i / CHUNK_SIZE + 1);
+			mChanged.resize(mChunks.size(), 0);
+		}
+		auto& chunk = mChunks[i / CHUNK_SIZE];
+		if (!chunk) {
+			chunk = std::make_shared<Chunk>();
+		} else if (chunk.use_count() > 1) {
+			chunk = std::make_shared<Chunk>(*chunk);
+		}
+		Entry& e = (*chunk)[i % CHUNK_SIZE];
+		if (e.var != v) {
+			assert(e.var == Variable::NO_VARIABLE);
+			e.var = v;
+			mSize++;
+		}
+		mChanged[i / CHUNK_SIZE] |= std::uint64_t(1) << (i % CHUNK_SIZE);
+		return e;
+	}
+public:
+	IntervalBox() = default;
+
+	explicit IntervalBox(const std::map<Variable, Interval<Number>>& map) {
+		for (const auto& vi: map) {
+			set(vi.first, vi.second);
+		}
+		clearChanged();
+	}
+
+	/**
+	 * @return The number of assigned variables.
+	 */
+	std::size_t size() const {
+		return mSize;
+	}
+	bool empty() const {
+		return mSize == 0;
+	}
+
+	bool has(Variable v) const {
+		return find(v) != nullptr;
+	}
+	std::size_t count(Variable v) const {
+		return has(v) ? 1 : 0;
+	}
+
+	/**
+	 * @return The interval of v, which must be assigned.
+	 */
+	const Interval<Number>& at(Variable v) const {
+		const Entry* e = find(v);
+		assert(e != nullptr);
+		return e->interval;
+	}
+
+	/**
+	 * Assigns an interval to v and marks v as changed if the interval differs from the previous one.
+	 */
+	void set(Variable v, const Interval<Number>& i) {
+		const Entry* e = find(v);
+		if (e != nullptr && e->interval == i) return;
+		entry(v).interval = i;
+	}
+
+	/**
+	 * Access as for std::map, v is marked as changed.
+	 * Use at() or set() if possible, as this conservatively copies a shared chunk.
+	 */
+	Interval<Number>& operator[](Variable v) {
+		return entry(v).interval;
+	}
+
+	/**
+	 * @return If v was changed since the last call to clearChanged().
+	 */
+	bool changed(Variable v) const {
+		std::size_t i = denseIndex(v);
+		if (i / CHUNK_SIZE >= mChanged.size()) return false;
+		return (mChanged[i / CHUNK_SIZE] >> (i % CHUNK_SIZE)) & 1;
+	}
+	bool anyChanged() const {
+		for (auto bits: mChanged) {
+			if (bits != 0) return true;
+		}
+		return false;
+	}
+	std::vector<Variable> changedVariables() const {
+		std::vector<Variable> res;
+		for (std::size_t c = 0; c < mChanged.size(); ++c) {
+			for (std::uint64_t bits = mChanged[c]; bits != 0; bits &= bits - 1) {
+				res.push_back((*mChunks[c])[interval_box_detail::lowestBit(bits)].var);
+			}
+		}
+		return res;
+	}
+	void clearChanged() {
+		std::fill(mChanged.begin(), mChanged.end(), 0);
+	}
+
+	/**
+	 * Calls f(variable, interval) for all assigned variables, ordered by their dense index.
+	 */
+	template<typename F>
+	void forEach(F&& f) const {
+		for (const auto& chunk: mChunks) {
+			if (!chunk) continue;
+			for (const auto& e: *chunk) {
+				if (e.var != Variable::NO_VARIABLE) f(e.var, e.interval);
+			}
+		}
+	}
+
+	std::vector<Variable> variables() const {
+		std::vector<Variable> res;
+		forEach([&res](Variable v, const Interval<Number>&) { res.push_back(v); });
+		return res;
+	}
+
+	std::map<Variable, Interval<Number>> toMap() const {
+		std::map<Variable, Interval<Number>> res;
+		forEach([&res](Variable v, const Interval<Number>& i) { res.emplace(v, i); });
+		return res;
+	}
+
+	friend bool operator==(const IntervalBox& lhs, const IntervalBox& rhs) {
+		return lhs.toMap() == rhs.toMap();
+	}
+	friend bool operator!=(const IntervalBox& lhs, const IntervalBox& rhs) {
+		return !(lhs == rhs);
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const IntervalBox& box) {
+		return os << box.toMap();
+	}
+};
+
+}
@@ -7,6 +7,8 @@
 
 #pragma once
 #include "Interval.h"
+#include "IntervalBatch.h"
+#include "IntervalBox.h"
 #include "power.h"
 
 #include "../core/Monomial.h"
@@ -25,37 +27,122 @@ class MultivariateHorner;
 class IntervalEvaluation
 {
 public:
+	/**
+	 * @name Evaluation on a box
+	 * The box is given either as a `std::map<Variable, Interval<Numeric>>` or as an `IntervalBox<Numeric>`.
+	 * All variables must be assigned.
+	 * @{
+	 */
 	template<typename Numeric>
-	static Interval<Numeric> evaluate(const Monomial& m, const std::map<Variable, Interval<Numeric>>&);
+	static Interval<Numeric> evaluate(const Monomial& m, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluateOn<Numeric>(m, map);
+	}
+	template<typename Numeric>
+	static Interval<Numeric> evaluate(const Monomial& m, const IntervalBox<Numeric>& map) {
+		return evaluateOn<Numeric>(m, map);
+	}
 
-	template<typename Coeff, typename Numeric, EnableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>&);
-	
-	template<typename Coeff, typename Numeric, DisableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>&);
+	template<typename Coeff, typename Numeric>
+	static Interval<Numeric> evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluateOn<Numeric>(t, map);
+	}
+	template<typename Coeff, typename Numeric>
+	static Interval<Numeric> evaluate(const Term<Coeff>& t, const IntervalBox<Numeric>& map) {
+		return evaluateOn<Numeric>(t, map);
+	}
 
 	template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
-	static Interval<Numeric> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>&);
-    
+	static Interval<Numeric> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluateOn<Numeric>(p, map);
+	}
+	template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
+	static Interval<Numeric> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const IntervalBox<Numeric>& map) {
+		return evaluateOn<Numeric>(p, map);
+	}
+
 	template<typename P, typename Numeric>
-	static Interval<Numeric> evaluate(const FactorizedPolynomial<P>& p, const std::map<Variable, Interval<Numeric>>&);
-
-	template<typename Numeric, typename Coeff, EnableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map);
-	
-	template<typename Numeric, typename Coeff, DisableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map);
-	
+	static Interval<Numeric> evaluate(const FactorizedPolynomial<P>& p, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluateOn<Numeric>(p, map);
+	}
+	template<typename P, typename Numeric>
+	static Interval<Numeric> evaluate(const FactorizedPolynomial<P>& p, const IntervalBox<Numeric>& map) {
+		return evaluateOn<Numeric>(p, map);
+	}
+
+	template<typename Numeric, typename Coeff>
+	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluateOn<Numeric>(p, map);
+	}
+	template<typename Numeric, typename Coeff>
+	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const IntervalBox<Numeric>& map) {
+		return evaluateOn<Numeric>(p, map);
+	}
+
+	template<typename PolynomialType, typename Number, class strategy>
+	static Interval<Number> evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, Interval<Number>>& map) {
+		return evaluateOn<Number>(mvH, map);
+	}
 	template<typename PolynomialType, typename Number, class strategy>
-	static Interval<Number> evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, Interval<Number>>& map);
-    
+	static Interval<Number> evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const IntervalBox<Number>& map) {
+		return evaluateOn<Number>(mvH, map);
+	}
+	/// @}
+
+	/**
+	 * @name Batch evaluation
+	 * Evaluates on many boxes at once, the k'th box assigns the k'th interval of every batch in the map.
+	 * All batches in the map must have the same size.
+	 * @{
+	 */
+	static IntervalBatch evaluate(const Monomial& m, const std::map<Variable, IntervalBatch>& map);
+
+	template<typename Coeff>
+	static IntervalBatch evaluate(const Term<Coeff>& t, const std::map<Variable, IntervalBatch>& map);
+
+	template<typename Coeff, typename Policy, typename Ordering>
+	static IntervalBatch evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, IntervalBatch>& map);
+
+	template<typename PolynomialType, class strategy>
+	static IntervalBatch evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, IntervalBatch>& map);
+	/// @}
+
 private:
+	/**
+	 * @name Evaluation on either kind of box
+	 * The implementations of the evaluation on a box, Assignment is a map or an IntervalBox with the number type Numeric.
+	 * @{
+	 */
+	template<typename Numeric, typename Assignment>
+	static Interval<Numeric> evaluateOn(const Monomial& m, const Assignment& map);
+
+	template<typename Numeric, typename Coeff, typename Assignment>
+	static Interval<Numeric> evaluateOn(const Term<Coeff>& t, const Assignment& map);
+
+	template<typename Numeric, typename Coeff, typename Policy, typename Ordering, typename Assignment>
+	static Interval<Numeric> evaluateOn(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const Assignment& map);
+
+	template<typename Numeric, typename P, typename Assignment>
+	static Interval<Numeric> evaluateOn(const FactorizedPolynomial<P>& p, const Assignment& map);
+
+	template<typename Numeric, typename Coeff, typename Assignment, EnableIf<std::is_same<Numeric, Coeff>> = dummy>
+	static Interval<Numeric> evaluateOn(const UnivariatePolynomial<Coeff>& p, const Assignment& map);
+
+	template<typename Numeric, typename Coeff, typename Assignment, DisableIf<std::is_same<Numeric, Coeff>> = dummy>
+	static Interval<Numeric> evaluateOn(const UnivariatePolynomial<Coeff>& p, const Assignment& map);
+
+	template<typename Number, typename PolynomialType, class strategy, typename Assignment>
+	static Interval<Number> evaluateOn(const MultivariateHorner<PolynomialType, strategy>& mvH, const Assignment& map);
+	/// @}
+
+	static std::size_t batchSize(const std::map<Variable, IntervalBatch>& map) {
+		return map.empty() ? 1 : map.begin()->second.size();
+	}
 
 };
 
 
-template<typename Numeric>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const Monomial& m, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename Assignment>
+inline Interval<Numeric> IntervalEvaluation::evaluateOn(const Monomial& m, const Assignment& map)
 {
 	Interval<Numeric> result(1);
 	// TODO use iterator.
@@ -72,17 +159,8 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const Monomial& m, const s
 	return result;
 }
 
-template<typename Coeff, typename Numeric, EnableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>& map)
-{
-	Interval<Numeric> result(t.coeff());
-	if (t.monomial())
-		result *= IntervalEvaluation::evaluate( *t.monomial(), map );
-	return result;
-}
-
-template<typename Coeff, typename Numeric, DisableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename Coeff, typename Assignment>
+inline Interval<Numeric> IntervalEvaluation::evaluateOn(const Term<Coeff>& t, const Assignment& map)
 {
 	Interval<Numeric> result(t.coeff());
 	if (t.monomial())
@@ -90,8 +168,8 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const Term<Coeff>& t, cons
 	return result;
 }
 
-template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename Coeff, typename Policy, typename Ordering, typename Assignment>
+inline Interval<Numeric> IntervalEvaluation::evaluateOn(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const Assignment& map)
 {
 	CARL_LOG_FUNC("carl.core.monomial", p << ", " << map);
 	if(isZero(p)) {
@@ -107,8 +185,8 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const MultivariatePolynomi
 	}
 }
 
-template<typename P, typename Numeric>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const FactorizedPolynomial<P>& p, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename P, typename Assignment>
+inline Interval<Numeric> IntervalEvaluation::evaluateOn(const FactorizedPolynomial<P>& p, const Assignment& map)
 {
     if( !existsFactorization( p ) )
         return Interval<Numeric>( p.coefficient() );
@@ -130,24 +208,24 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const FactorizedPolynomial
     }
 }
 
-template<typename Numeric, typename Coeff, EnableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map) {
+template<typename Numeric, typename Coeff, typename Assignment, EnableIf<std::is_same<Numeric, Coeff>>>
+inline Interval<Numeric> IntervalEvaluation::evaluateOn(const UnivariatePolynomial<Coeff>& p, const Assignment& map) {
 	CARL_LOG_FUNC("carl.core.monomial", p << ", " << map);
 	assert(map.count(p.mainVar()) > 0);
-	Interval<Numeric> res = Interval<Numeric>::emptyInterval();
-	const Interval<Numeric> varValue = map.at(p.mainVar());
+	Interval<Numeric> res = Interval<Numeric>(carl::constant_zero<Numeric>().get());
+	const Interval<Numeric>& varValue = map.at(p.mainVar());
 	Interval<Numeric> exp(1);
-	for (unsigned i = 0; i < p.degree(); i++) {
-		res += p.coefficients()[i] * exp;
+	for (uint i = 0; i <= p.degree(); i++) {
+		res += exp * p.coefficients()[i];
         if( res.isInfinite() )
             return res;
-		exp = varValue.pow(i+1);
+		exp = carl::pow(varValue, i+1);
 	}
 	return res;
 }
 
-template<typename Numeric, typename Coeff, DisableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map) {
+template<typename Numeric, typename Coeff, typename Assignment, DisableIf<std::is_same<Numeric, Coeff>>>
+inline Interval<Numeric> IntervalEvaluation::evaluateOn(const UnivariatePolynomial<Coeff>& p, const Assignment& map) {
 	CARL_LOG_FUNC("carl.core.monomial", p << ", " << map);
 	assert(map.count(p.mainVar()) > 0);
 	Interval<Numeric> res = Interval<Numeric>(carl::constant_zero<Numeric>().get());
@@ -163,8 +241,8 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial
 }
 
 
-template<typename PolynomialType, typename Number, class strategy>
-inline Interval<Number> IntervalEvaluation::evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, Interval<Number>>& map)
+template<typename Number, typename PolynomialType, class strategy, typename Assignment>
+inline Interval<Number> IntervalEvaluation::evaluateOn(const MultivariateHorner<PolynomialType, strategy>& mvH, const Assignment& map)
 {
 	#ifdef DEBUG_HORNER
 		std::cout << __func__ << "   " << mvH << std::endl;
@@ -176,7 +254,7 @@ inline Interval<Number> IntervalEvaluation::evaluate(const MultivariateHorner<Po
 	if (mvH.getVariable() != Variable::NO_VARIABLE){
 		assert(map.count(mvH.getVariable()) > 0);
 		Interval<Number> res = Interval<Number>::emptyInterval();
-		const Interval<Number> varValue = map.find(mvH.getVariable())->second;
+		const Interval<Number> varValue = map.at(mvH.getVariable());
 
 		
 
@@ -212,4 +290,56 @@ inline Interval<Number> IntervalEvaluation::evaluate(const MultivariateHorner<Po
 	return result;
 }
 
+inline IntervalBatch IntervalEvaluation::evaluate(const Monomial& m, const std::map<Variable, IntervalBatch>& map)
+{
+	IntervalBatch result(batchSize(map), Interval<double>(1));
+	for (const auto& ve: m) {
+		CARL_LOG_ASSERT("carl.interval", map.count(ve.first) > (size_t)0, "Every variable is expected to be in the map.");
+		result *= carl::pow(map.at(ve.first), ve.second);
+	}
+	return result;
+}
+
+template<typename Coeff>
+inline IntervalBatch IntervalEvaluation::evaluate(const Term<Coeff>& t, const std::map<Variable, IntervalBatch>& map)
+{
+	IntervalBatch result(batchSize(map), Interval<double>(t.coeff()));
+	if (t.monomial())
+		result *= IntervalEvaluation::evaluate( *t.monomial(), map );
+	return result;
+}
+
+template<typename Coeff, typename Policy, typename Ordering>
+inline IntervalBatch IntervalEvaluation::evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, IntervalBatch>& map)
+{
+	CARL_LOG_FUNC("carl.core.monomial", p);
+	IntervalBatch result(batchSize(map), Interval<double>(0));
+	for (const auto& t: p) {
+		result += evaluate(t, map);
+	}
+	return result;
+}
+
+template<typename PolynomialType, class strategy>
+inline IntervalBatch IntervalEvaluation::evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, IntervalBatch>& map)
+{
+	std::size_t size = batchSize(map);
+	if (mvH.getVariable() == Variable::NO_VARIABLE) {
+		return IntervalBatch(size, Interval<double>(mvH.getIndepConstant()));
+	}
+	assert(map.count(mvH.getVariable()) > 0);
+	IntervalBatch result = carl::pow(map.at(mvH.getVariable()), mvH.getExponent());
+	if (mvH.getDependent()) {
+		result *= evaluate(*mvH.getDependent(), map);
+	} else {
+		result *= IntervalBatch(size, Interval<double>(mvH.getDepConstant()));
+	}
+	if (mvH.getIndependent()) {
+		result += evaluate(*mvH.getIndependent(), map);
+	} else {
+		result += IntervalBatch(size, Interval<double>(mvH.getIndepConstant()));
+	}
+	return result;
+}
+
 } //Namespace carl
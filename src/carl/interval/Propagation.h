@@ -0,0 +1,339 @@
+/**
+ * @file Propagation.h
+ *
+ * A propagation engine that applies contractors on a box until a fixpoint is reached.
+ */
+
+#pragma once
+
+#include "Contraction.h"
+#include "Contractor.h"
+#include "Interval.h"
+#include "IntervalBox.h"
+#include "../formula/Constraint.h"
+#include "../util/Common.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <queue>
+#include <vector>
+
+namespace carl {
+namespace contractor {
+
+struct PropagationSettings {
+	/// A variable is only propagated further if its interval was reduced by at least this fraction of its width.
+	double epsilon = 0.01;
+	/// Maximum number of contractor applications in one call to propagate().
+	std::size_t maxIterations = 1000;
+	/// Use the interval Newton operator on nonlinear equations in addition to the projections.
+	bool useNewton = true;
+};
+
+/**
+ * Propagates a set of constraints on boxes.
+ *
+ * For every constraint and every variable it contains, there is a projection contractor (contractor::Contractor),
+ * which solves the constraint for the variable, i.e. the HC4-revise step.
+ * Nonlinear equations additionally get an interval Newton contractor (Contraction<SimpleNewton>) for every variable.
+ *
+ * propagate() keeps a worklist of contractors, ordered by the relative width reduction of the variable whose change
+ * scheduled them. Whenever a contractor reduces the interval of its variable by more than the configured epsilon,
+ * all other contractors of constraints containing this variable are scheduled.
+ * This stops if the worklist is empty, the box becomes empty or the iteration budget is exhausted.
+ */
+template<typename Polynomial>
+class Propagation {
+public:
+	enum class Kind { PROJECTION, NEWTON };
+
+	/// Statistics of a single contractor, accumulated over all calls to propagate().
+	struct Statistics {
+		/// Number of applications.
+		std::size_t calls = 0;
+		/// Number of applications that narrowed the interval of the variable.
+		std::size_t narrowings = 0;
+		/// Number of applications that found the box to be empty.
+		std::size_t conflicts = 0;
+		/// Sum of the relative width reductions.
+		double reduction = 0;
+	};
+
+	struct ContractorInfo {
+		Kind kind;
+		/// Index of the constraint.
+		std::size_t constraint;
+		Variable variable;
+		Statistics statistics;
+	};
+private:
+	using Newton = Contraction<SimpleNewton, Polynomial>;
+
+	PropagationSettings mSettings;
+	std::vector<Constraint<Polynomial>> mConstraints;
+	std::vector<ContractorInfo> mContractors;
+	/// Projection contractors, nullptr for Newton contractors.
+	std::vector<std::unique_ptr<Contractor<std::size_t, Polynomial>>> mProjections;
+	/// Newton contractors by constraint, nullptr for constraints that have none.
+	std::vector<std::unique_ptr<Newton>> mNewton;
+	/// Contractors of constraints containing a variable, by denseIndex() of the variable.
+	std::vector<std::vector<std::size_t>> mWatches;
+	/// Contractors that must be applied on every box as they do not depend on any variable.
+	std::vector<std::size_t> mUnconditional;
+
+	/// Priority of every contractor in the worklist, zero if it is not scheduled.
+	std::vector<double> mPriority;
+	std::priority_queue<std::pair<double, std::size_t>> mQueue;
+	std::size_t mIterations = 0;
+	bool mBudgetExhausted = false;
+
+	void addContractor(Kind kind, std::size_t constraint, Variable v) {
+		mContractors.push_back(ContractorInfo{kind, constraint, v, Statistics()});
+		if (kind == Kind::PROJECTION) {
+			mProjections.emplace_back(std::make_unique<Contractor<std::size_t, Polynomial>>(constraint, mConstraints[constraint], v));
+		} else {
+			mProjections.emplace_back(nullptr);
+		}
+		mPriority.push_back(0);
+		for (const auto& w: mConstraints[constraint].variables()) {
+			std::size_t index = denseIndex(w);
+			if (index >= mWatches.size()) mWatches.resize(index + 1);
+			mWatches[index].push_back(mContractors.size() - 1);
+		}
+	}
+
+	void schedule(std::size_t contractor, double priority) {
+		if (priority <= mPriority[contractor]) return;
+		mPriority[contractor] = priority;
+		mQueue.emplace(priority, contractor);
+	}
+
+	void scheduleWatches(Variable v, std::size_t except, double priority) {
+		std::size_t index = denseIndex(v);
+		if (index >= mWatches.size()) return;
+		for (std::size_t c: mWatches[index]) {
+			if (c != except) schedule(c, priority);
+		}
+	}
+
+	/// The convex hull of two intervals.
+	static Interval<double> hull(const Interval<double>& a, const Interval<double>& b) {
+		if (a.isEmpty()) return b;
+		if (b.isEmpty()) return a;
+		double lower = a.lower();
+		BoundType lowerType = a.lowerBoundType();
+		if (b.lowerBoundType() == BoundType::INFTY || (lowerType != BoundType::INFTY && b.lower() < lower)) {
+			lower = b.lower();
+			lowerType = b.lowerBoundType();
+		} else if (lowerType != BoundType::INFTY && b.lower() == lower) {
+			lowerType = getWeakestBoundType(lowerType, b.lowerBoundType());
+		}
+		double upper = a.upper();
+		BoundType upperType = a.upperBoundType();
+		if (b.upperBoundType() == BoundType::INFTY || (upperType != BoundType::INFTY && b.upper() > upper)) {
+			upper = b.upper();
+			upperType = b.upperBoundType();
+		} else if (upperType != BoundType::INFTY && b.upper() == upper) {
+			upperType = getWeakestBoundType(upperType, b.upperBoundType());
+		}
+		return Interval<double>(lower, lowerType, upper, upperType);
+	}
+
+	/**
+	 * Measures how much cur, a subset of old, is smaller than old.
+	 * Where old is unbounded, making a bound finite counts as a reduction of one and moving a finite bound is
+	 * measured relative to its magnitude.
+	 */
+	static double relativeReduction(const Interval<double>& old, const Interval<double>& cur) {
+		if (cur.isEmpty()) return 1;
+		if (!old.isUnbounded()) {
+			double width = old.upper() - old.lower();
+			if (width <= 0) return 0;
+			return (width - (cur.upper() - cur.lower())) / width;
+		}
+		double res = 0;
+		if (old.lowerBoundType() == BoundType::INFTY) {
+			if (cur.lowerBoundType() != BoundType::INFTY) res = 1;
+		} else {
+			res = std::max(res, (cur.lower() - old.lower()) / (std::abs(old.lower()) + 1));
+		}
+		if (old.upperBoundType() == BoundType::INFTY) {
+			if (cur.upperBoundType() != BoundType::INFTY) res = 1;
+		} else {
+			res = std::max(res, (old.upper() - cur.upper()) / (std::abs(old.upper()) + 1));
+		}
+		return std::min(res, 1.0);
+	}
+
+	/// Applies a contractor, returns the new interval of its variable.
+	Interval<double> apply(std::size_t contractor, const IntervalBox<double>& box) {
+		const ContractorInfo& info = mContractors[contractor];
+		Interval<double> res = Interval<double>::emptyInterval();
+		if (info.kind == Kind::PROJECTION) {
+			for (const auto& i: mProjections[contractor]->contract(box)) {
+				res = hull(res, i);
+			}
+		} else {
+			Interval<double> resA;
+			Interval<double> resB;
+			(*mNewton[info.constraint])(box, info.variable, resA, resB);
+			res = hull(resA, resB);
+		}
+		return set_intersection(res, box.at(info.variable));
+	}
+
+	bool run(IntervalBox<double>& box) {
+		mIterations = 0;
+		mBudgetExhausted = false;
+		while (!mQueue.empty()) {
+			std::size_t contractor = mQueue.top().second;
+			double priority = mQueue.top().first;
+			mQueue.pop();
+			if (priority != mPriority[contractor]) continue;
+			if (mIterations >= mSettings.maxIterations) {
+				mBudgetExhausted = true;
+				break;
+			}
+			mPriority[contractor] = 0;
+			++mIterations;
+
+			ContractorInfo& info = mContractors[contractor];
+			Interval<double> old = box.at(info.variable);
+			Interval<double> res = apply(contractor, box);
+			info.statistics.calls++;
+			CARL_LOG_TRACE("carl.contractor", "Contracted " << info.variable << " from " << old << " to " << res);
+			if (res.isEmpty()) {
+				info.statistics.conflicts++;
+				box.set(info.variable, res);
+				clearQueue();
+				return false;
+			}
+			if (res == old) continue;
+			double reduction = relativeReduction(old, res);
+			info.statistics.narrowings++;
+			info.statistics.reduction += reduction;
+			box.set(info.variable, res);
+			if (reduction > mSettings.epsilon) {
+				scheduleWatches(info.variable, contractor, reduction);
+			}
+		}
+		clearQueue();
+		return true;
+	}
+
+	void clearQueue() {
+		mQueue = decltype(mQueue)();
+		std::fill(mPriority.begin(), mPriority.end(), 0);
+	}
+
+	/// Assigns the unbounded interval to all variables of the constraints that are not assigned.
+	void completeBox(IntervalBox<double>& box) const {
+		for (const auto& c: mConstraints) {
+			for (const auto& v: c.variables()) {
+				if (!box.has(v)) box.set(v, Interval<double>::unboundedInterval());
+			}
+		}
+	}
+public:
+	explicit Propagation(const PropagationSettings& settings = PropagationSettings()):
+		mSettings(settings)
+	{}
+
+	explicit Propagation(const std::vector<Constraint<Polynomial>>& constraints, const PropagationSettings& settings = PropagationSettings()):
+		mSettings(settings)
+	{
+		for (const auto& c: constraints) add(c);
+	}
+
+	/**
+	 * Adds a constraint and its contractors.
+	 * Constraints with relation NEQ are ignored, as they can not be used to contract a box.
+	 */
+	void add(const Constraint<Polynomial>& c) {
+		if (c.relation() == Relation::NEQ) {
+			CARL_LOG_DEBUG("carl.contractor", "Ignoring " << c);
+			return;
+		}
+		std::size_t id = mConstraints.size();
+		mConstraints.push_back(c);
+		bool newton = mSettings.useNewton && c.relation() == Relation::EQ && !c.lhs().isLinear();
+		mNewton.emplace_back(newton ? std::make_unique<Newton>(c.lhs()) : nullptr);
+		if (c.variables().empty()) {
+			mUnconditional.push_back(mContractors.size());
+			mContractors.push_back(ContractorInfo{Kind::PROJECTION, id, Variable::NO_VARIABLE, Statistics()});
+			mProjections.emplace_back(nullptr);
+			mPriority.push_back(0);
+			return;
+		}
+		for (const auto& v: c.variables()) {
+			addContractor(Kind::PROJECTION, id, v);
+			if (newton) addContractor(Kind::NEWTON, id, v);
+		}
+	}
+
+	const std::vector<Constraint<Polynomial>>& constraints() const {
+		return mConstraints;
+	}
+	const std::vector<ContractorInfo>& contractors() const {
+		return mContractors;
+	}
+	/**
+	 * @return Number of contractor applications in the last call to propagate().
+	 */
+	std::size_t iterations() const {
+		return mIterations;
+	}
+	/**
+	 * @return If the last call to propagate() stopped because of the iteration budget.
+	 */
+	bool budgetExhausted() const {
+		return mBudgetExhausted;
+	}
+	void resetStatistics() {
+		for (auto& c: mContractors) c.statistics = Statistics();
+	}
+
+	/**
+	 * Contracts the box with respect to all constraints.
+	 * Variables of the constraints that are not assigned are assigned the unbounded interval.
+	 * The changed bits of the box are set for all narrowed variables.
+	 * @return false, if the box contains no solution.
+	 */
+	bool propagate(IntervalBox<double>& box) {
+		completeBox(box);
+		for (std::size_t c: mUnconditional) {
+			if (mConstraints[mContractors[c].constraint].isConsistent() == 0) {
+				mContractors[c].statistics.conflicts++;
+				return false;
+			}
+		}
+		for (std::size_t c = 0; c < mContractors.size(); ++c) {
+			if (mContractors[c].variable != Variable::NO_VARIABLE) schedule(c, 1);
+		}
+		return run(box);
+	}
+
+	/**
+	 * Contracts the box, but only starts with the contractors that depend on variables that are marked as changed.
+	 * This is meant to be called after the box was split or some variables were tightened from the outside.
+	 * @return false, if the box contains no solution.
+	 */
+	bool propagateChanged(IntervalBox<double>& box) {
+		completeBox(box);
+		for (Variable v: box.changedVariables()) {
+			scheduleWatches(v, mContractors.size(), 1);
+		}
+		return run(box);
+	}
+
+	bool propagate(std::map<Variable, Interval<double>>& map) {
+		IntervalBox<double> box(map);
+		bool res = propagate(box);
+		map = box.toMap();
+		return res;
+	}
+};
+
+}
+}
@@ -0,0 +1,454 @@
+/**
+ * @file BinaryEncoding.h
+ *
+ * A compact binary encoding of numbers and polynomials.
+ *
+ * Unsigned integers and exponents are stored as LEB128 varints, signed integers are zigzag encoded. Small GMP integers
+ * are stored as varints as well, larger ones as their magnitude in 64 bit little endian words. Rationals are stored as
+ * numerator and denominator. Variables are stored as indices into a variable table that is managed by the user of the
+ * encoding, hence the encoding of a polynomial does not depend on the ids of the variables within the current process.
+ */
+
+#pragma once
+
+#include "../core/MonomialPool.h"
+#include "../core/MultivariatePolynomial.h"
+#include "../core/Term.h"
+#include "../core/UnivariatePolynomial.h"
+#include "../core/Variable.h"
+#include "../numbers/numbers.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace carl {
+namespace serialization {
+
+/// Version of the encoding, data with a different version can not be decoded.
+static constexpr std::uint32_t VERSION = 2;
+
+/// Thrown if the data to decode is malformed or truncated.
+struct DecodingError: std::runtime_error {
+	using std::runtime_error::runtime_error;
+};
+
+/**
+ * Appends encoded values to a byte buffer.
+ * Variables are encoded as their position in a table of variables given on construction. If the table is extensible,
+ * variables that are not contained in the table are appended to it.
+ */
+class Encoder {
+private:
+	std::string mData;
+	std::vector<Variable> mVariables;
+	std::unordered_map<Variable, std::size_t> mIndices;
+	bool mExtensible = false;
+public:
+	Encoder() = default;
+	/// Creates an encoder for the given variables.
+	explicit Encoder(std::vector<Variable> variables, bool extensible = false):
+		mVariables(std::move(variables)), mExtensible(extensible)
+	{
+		mIndices.reserve(mVariables.size());
+		for (std::size_t i = 0; i < mVariables.size(); ++i) {
+			mIndices.emplace(mVariables[i], i);
+		}
+	}
+
+	const std::string& data() const {
+		return mData;
+	}
+	std::string release() {
+		return std::move(mData);
+	}
+	/// Discards the encoded data but keeps the variable table.
+	void clear() {
+		mData.clear();
+	}
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+
+	void byte(std::uint8_t b) {
+		mData.push_back(char(b));
+	}
+	void raw(const void* data, std::size_t size) {
+		mData.append(static_cast<const char*>(data), size);
+	}
+	void varint(std::uint64_t n) {
+		while (n >= 0x80) {
+			byte(std::uint8_t(n | 0x80));
+			n >>= 7;
+		}
+		byte(std::uint8_t(n));
+	}
+	void svarint(std::int64_t n) {
+		varint((std::uint64_t(n) << 1) ^ std::uint64_t(n >> 63));
+	}
+	/// Writes a length-prefixed byte string.
+	void bytes(const std::string& s) {
+		varint(s.size());
+		raw(s.data(), s.size());
+	}
+	/// Writes the index of v in the variable table, v must be contained in the table unless it is extensible.
+	void variable(Variable v) {
+		auto it = mIndices.find(v);
+		if (it == mIndices.end()) {
+			if (!mExtensible) {
+				throw std::invalid_argument("Variable is not contained in the variable table of the encoder.");
+			}
+			it = mIndices.emplace(v, mVariables.size()).first;
+			mVariables.push_back(v);
+		}
+		varint(it->second);
+	}
+
+	template<typename T>
+	Encoder& operator<<(const T& t);
+};
+
+/**
+ * Decodes values from a byte range without copying it, e.g. from a memory mapped file.
+ * Variables are decoded by their position in the variable table given on construction.
+ * Throws DecodingError if the data is malformed.
+ */
+class Decoder {
+private:
+	const char* mCur;
+	const char* mEnd;
+	std::vector<Variable> mVariables;
+
+	void require(std::size_t n) const {
+		if (std::size_t(mEnd - mCur) < n) throw DecodingError("Unexpected end of binary data.");
+	}
+public:
+	Decoder(const char* begin, const char* end, std::vector<Variable> variables = {}):
+		mCur(begin), mEnd(end), mVariables(std::move(variables))
+	{}
+	explicit Decoder(const std::string& data, std::vector<Variable> variables = {}):
+		Decoder(data.data(), data.data() + data.size(), std::move(variables))
+	{}
+
+	bool atEnd() const {
+		return mCur == mEnd;
+	}
+	/// The remaining bytes.
+	std::size_t remaining() const {
+		return std::size_t(mEnd - mCur);
+	}
+	/// Continues decoding from another byte range with the same variable table.
+	void reset(const char* begin, const char* end) {
+		mCur = begin;
+		mEnd = end;
+	}
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	/// Appends a variable to the variable table.
+	void addVariable(Variable v) {
+		mVariables.push_back(v);
+	}
+
+	std::uint8_t byte() {
+		require(1);
+		return std::uint8_t(*mCur++);
+	}
+	/// Returns a pointer to the next size bytes and skips them.
+	const char* raw(std::size_t size) {
+		require(size);
+		const char* res = mCur;
+		mCur += size;
+		return res;
+	}
+	std::uint64_t varint() {
+		std::uint64_t res = 0;
+		for (unsigned shift = 0; shift < 64; shift += 7) {
+			std::uint8_t b = byte();
+			res |= std::uint64_t(b & 0x7f) << shift;
+			if ((b & 0x80) == 0) return res;
+		}
+		throw DecodingError("Varint is too long.");
+	}
+	std::int64_t svarint() {
+		std::uint64_t n = varint();
+		return std::int64_t(n >> 1) ^ -std::int64_t(n & 1);
+	}
+	/// Reads a length-prefixed byte string.
+	std::string bytes() {
+		std::uint64_t size = varint();
+		require(size);
+		return std::string(raw(size), size);
+	}
+	Variable variable() {
+		std::uint64_t index = varint();
+		if (index >= mVariables.size()) throw DecodingError("Variable index is out of range.");
+		return mVariables[index];
+	}
+
+	template<typename T>
+	T read();
+};
+
+/**
+ * Defines how values of type T are encoded.
+ * Specializations provide static write(Encoder&, const T&) and read(Decoder&) and set supported to true.
+ */
+template<typename T, typename = void>
+struct Encoding {
+	static constexpr bool supported = false;
+};
+
+template<typename T>
+constexpr bool is_encodable = Encoding<T>::supported;
+
+template<typename T>
+Encoder& Encoder::operator<<(const T& t) {
+	static_assert(is_encodable<T>, "This type can not be encoded.");
+	Encoding<T>::write(*this, t);
+	return *this;
+}
+
+template<typename T>
+T Decoder::read() {
+	static_assert(is_encodable<T>, "This type can not be decoded.");
+	return Encoding<T>::read(*this);
+}
+
+template<typename T>
+struct Encoding<T, std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value>> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, T t) {
+		e.varint(t);
+	}
+	static T read(Decoder& d) {
+		std::uint64_t n = d.varint();
+		if (n > std::uint64_t(std::numeric_limits<T>::max())) throw DecodingError("Integer is out of range.");
+		return T(n);
+	}
+};
+
+template<typename T>
+struct Encoding<T, std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value>> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, T t) {
+		e.svarint(t);
+	}
+	static T read(Decoder& d) {
+		std::int64_t n = d.svarint();
+		if (n < std::int64_t(std::numeric_limits<T>::min()) || n > std::int64_t(std::numeric_limits<T>::max())) {
+			throw DecodingError("Integer is out of range.");
+		}
+		return T(n);
+	}
+};
+
+/**
+ * Integers of at most 62 bits are stored as twice their value. Larger integers are stored as twice the sign times the
+ * number of 64 bit words plus one, followed by the words from the least significant one.
+ */
+template<>
+struct Encoding<mpz_class> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, const mpz_class& z) {
+		if (mpz_fits_slong_p(z.get_mpz_t()) && mpz_sizeinbase(z.get_mpz_t(), 2) <= 62) {
+			e.svarint(std::int64_t(mpz_get_si(z.get_mpz_t())) * 2);
+			return;
+		}
+		std::size_t words = (mpz_sizeinbase(z.get_mpz_t(), 2) + 63) / 64;
+		e.svarint((sgn(z) < 0 ? -std::int64_t(words) : std::int64_t(words)) * 2 + 1);
+		std::string buffer(words * 8, '\0');
+		mpz_export(&buffer[0], nullptr, -1, 8, -1, 0, z.get_mpz_t());
+		e.raw(buffer.data(), buffer.size());
+	}
+	static mpz_class read(Decoder& d) {
+		std::int64_t header = d.svarint();
+		if (header % 2 == 0) return mpz_class(static_cast<signed long>(header / 2));
+		std::int64_t size = (header - 1) / 2;
+		std::size_t words = std::size_t(size < 0 ? -size : size);
+		if (words > d.remaining() / 8) throw DecodingError("Unexpected end of binary data.");
+		mpz_class res;
+		mpz_import(res.get_mpz_t(), words, -1, 8, -1, 0, d.raw(words * 8));
+		if (size < 0) res = -res;
+		return res;
+	}
+};
+
+template<>
+struct Encoding<mpq_class> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, const mpq_class& q) {
+		e << q.get_num() << q.get_den();
+	}
+	static mpq_class read(Decoder& d) {
+		mpz_class num = d.read<mpz_class>();
+		mpz_class den = d.read<mpz_class>();
+		if (sgn(den) <= 0) throw DecodingError("Denominator is not positive.");
+		mpq_class res(num, den);
+		res.canonicalize();
+		return res;
+	}
+};
+
+template<>
+struct Encoding<Variable> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, Variable v) {
+		e.variable(v);
+	}
+	static Variable read(Decoder& d) {
+		return d.variable();
+	}
+};
+
+/// The number of variables followed by pairs of variables and exponents, nullptr is the empty monomial.
+template<>
+struct Encoding<Monomial::Arg> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, const Monomial::Arg& m) {
+		if (!m) {
+			e.varint(0);
+			return;
+		}
+		e.varint(m->exponents().size());
+		for (const auto& ve: m->exponents()) {
+			e << ve.first << ve.second;
+		}
+	}
+	static Monomial::Arg read(Decoder& d) {
+		std::uint64_t size = d.varint();
+		if (size == 0) return nullptr;
+		if (size > d.remaining() / 2) throw DecodingError("Unexpected end of binary data.");
+		Monomial::Content content;
+		content.reserve(size);
+		exponent totalDegree = 0;
+		for (std::uint64_t i = 0; i < size; ++i) {
+			Variable v = d.variable();
+			exponent e = d.read<exponent>();
+			if (e == 0) throw DecodingError("Monomial with zero exponent.");
+			content.emplace_back(v, e);
+			totalDegree += e;
+		}
+		// The variables of the reading context may be ordered differently than those of the writing one.
+		std::sort(content.begin(), content.end(), [](const auto& a, const auto& b){ return a.first < b.first; });
+		auto duplicate = std::adjacent_find(content.begin(), content.end(), [](const auto& a, const auto& b){ return a.first == b.first; });
+		if (duplicate != content.end()) throw DecodingError("Monomial with duplicate variable.");
+		return createMonomial(std::move(content), totalDegree);
+	}
+};
+
+template<typename C>
+struct Encoding<Term<C>, std::enable_if_t<is_encodable<C>>> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, const Term<C>& t) {
+		e << t.coeff() << t.monomial();
+	}
+	static Term<C> read(Decoder& d) {
+		C c = d.read<C>();
+		if (carl::isZero(c)) throw DecodingError("Term with zero coefficient.");
+		return Term<C>(c, d.read<Monomial::Arg>());
+	}
+};
+
+/// The number of terms followed by the terms in the order of the polynomial.
+template<typename C, typename O, typename P>
+struct Encoding<MultivariatePolynomial<C,O,P>, std::enable_if_t<is_encodable<C>>> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, const MultivariatePolynomial<C,O,P>& p) {
+		e.varint(p.nrTerms());
+		for (const auto& t: p) e << t;
+	}
+	static MultivariatePolynomial<C,O,P> read(Decoder& d) {
+		std::uint64_t size = d.varint();
+		if (size > d.remaining()) throw DecodingError("Unexpected end of binary data.");
+		typename MultivariatePolynomial<C,O,P>::TermsType terms;
+		terms.reserve(size);
+		for (std::uint64_t i = 0; i < size; ++i) {
+			terms.push_back(d.read<Term<C>>());
+		}
+		// The order of the variables in the table may differ from the order of the encoded ones.
+		return MultivariatePolynomial<C,O,P>(std::move(terms), false, false);
+	}
+};
+
+/// The main variable and the number of coefficients, followed by the coefficients.
+template<typename C>
+struct Encoding<UnivariatePolynomial<C>, std::enable_if_t<is_encodable<C>>> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, const UnivariatePolynomial<C>& p) {
+		e << p.mainVar();
+		e.varint(p.coefficients().size());
+		for (const auto& c: p.coefficients()) e << c;
+	}
+	static UnivariatePolynomial<C> read(Decoder& d) {
+		Variable v = d.variable();
+		std::uint64_t size = d.varint();
+		if (size > d.remaining()) throw DecodingError("Unexpected end of binary data.");
+		std::vector<C> coeffs;
+		coeffs.reserve(size);
+		for (std::uint64_t i = 0; i < size; ++i) {
+			coeffs.push_back(d.read<C>());
+		}
+		if (!coeffs.empty() && carl::isZero(coeffs.back())) throw DecodingError("Leading coefficient is zero.");
+		return UnivariatePolynomial<C>(v, std::move(coeffs));
+	}
+};
+
+template<typename T1, typename T2>
+struct Encoding<std::pair<T1,T2>, std::enable_if_t<is_encodable<T1> && is_encodable<T2>>> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, const std::pair<T1,T2>& p) {
+		e << p.first << p.second;
+	}
+	static std::pair<T1,T2> read(Decoder& d) {
+		T1 first = d.read<T1>();
+		return std::pair<T1,T2>(std::move(first), d.read<T2>());
+	}
+};
+
+template<typename T>
+struct Encoding<std::vector<T>, std::enable_if_t<is_encodable<T>>> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, const std::vector<T>& v) {
+		e.varint(v.size());
+		for (const auto& t: v) e << t;
+	}
+	static std::vector<T> read(Decoder& d) {
+		std::uint64_t size = d.varint();
+		if (size > d.remaining()) throw DecodingError("Unexpected end of binary data.");
+		std::vector<T> res;
+		res.reserve(size);
+		for (std::uint64_t i = 0; i < size; ++i) res.push_back(d.read<T>());
+		return res;
+	}
+};
+
+template<typename K, typename V, typename Compare>
+struct Encoding<std::map<K,V,Compare>, std::enable_if_t<is_encodable<K> && is_encodable<V>>> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, const std::map<K,V,Compare>& m) {
+		e.varint(m.size());
+		for (const auto& kv: m) e << kv.first << kv.second;
+	}
+	static std::map<K,V,Compare> read(Decoder& d) {
+		std::uint64_t size = d.varint();
+		if (size > d.remaining()) throw DecodingError("Unexpected end of binary data.");
+		std::map<K,V,Compare> res;
+		for (std::uint64_t i = 0; i < size; ++i) {
+			K key = d.read<K>();
+			res.emplace(std::move(key), d.read<V>());
+		}
+		return res;
+	}
+};
+
+}
+}
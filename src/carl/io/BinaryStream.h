@@ -0,0 +1,440 @@
+/**
+ * @file BinaryStream.h
+ *
+ * A compact binary interchange format for polynomials, constraints and formulas.
+ *
+ * A stream starts with the magic bytes "CARLBIN" and the version of the encoding, followed by a sequence of records.
+ * Every record consists of a tag, the size of its payload as a varint and the payload, which uses the encoding from
+ * BinaryEncoding.h. Variables, constraints and formulas are defined by records of their own before they are used and
+ * are referred to by the index of their definition afterwards:
+ * - A variable definition holds the type and the name of the variable. When reading, a variable with this name and
+ *   type is reused if it exists, otherwise it is created.
+ * - A constraint definition holds the left-hand side and the relation.
+ * - A formula definition holds the type and the indices of the constraint, the boolean variable or the subformulas.
+ *   Every subformula is defined only once, hence the size of a stream is linear in the size of the DAG of a formula.
+ * Polynomials are stored within their record, constraints and formulas that are written by the user are stored as a
+ * reference to their definition.
+ */
+
+#pragma once
+
+#include "../core/Relation.h"
+#include "../core/Variable.h"
+#include "../core/VariablePool.h"
+#include "../formula/Constraint.h"
+#include "../formula/Formula.h"
+#include "../util/MappedFile.h"
+#include "BinaryEncoding.h"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace carl {
+namespace serialization {
+
+/// The left-hand side followed by the relation.
+template<typename Pol>
+struct Encoding<Constraint<Pol>, std::enable_if_t<is_encodable<Pol>>> {
+	static constexpr bool supported = true;
+	static void write(Encoder& e, const Constraint<Pol>& c) {
+		e << c.lhs();
+		e.byte(std::uint8_t(c.relation()));
+	}
+	static Constraint<Pol> read(Decoder& d) {
+		Pol lhs = d.read<Pol>();
+		std::uint8_t rel = d.byte();
+		if (rel > std::uint8_t(Relation::GEQ)) throw DecodingError("Invalid relation.");
+		return Constraint<Pol>(lhs, Relation(rel));
+	}
+};
+
+namespace stream {
+	static constexpr char MAGIC[] = "CARLBIN";
+	static constexpr std::size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+
+	enum class Record: std::uint8_t {
+		/// Defines the next variable.
+		VARIABLE = 1,
+		/// Defines the next constraint.
+		CONSTRAINT_DEFINITION = 2,
+		/// Defines the next formula.
+		FORMULA_DEFINITION = 3,
+		/// A polynomial.
+		POLYNOMIAL = 4,
+		/// A reference to a constraint definition.
+		CONSTRAINT = 5,
+		/// A reference to a formula definition.
+		FORMULA = 6
+	};
+}
+
+/**
+ * Writes polynomials, constraints and formulas to a std::ostream in the binary format.
+ * Definitions are remembered for the lifetime of the writer, hence constraints and subformulas that are shared between
+ * several formulas written to the same stream are only stored once.
+ */
+template<typename Pol>
+class BinaryWriter {
+	static_assert(is_encodable<Pol>, "The polynomial type can not be encoded.");
+private:
+	std::ostream& mOut;
+	/// Encodes the payload of a record and assigns indices to all variables in the order they are defined.
+	Encoder mPayload = Encoder({}, true);
+	Encoder mScratch;
+	std::size_t mDefinedVariables = 0;
+	std::unordered_map<Constraint<Pol>, std::size_t> mConstraints;
+	std::unordered_map<Formula<Pol>, std::size_t> mFormulas;
+
+	void emit(stream::Record tag, const std::string& payload) {
+		mScratch.clear();
+		mScratch.byte(std::uint8_t(tag));
+		mScratch.varint(payload.size());
+		mOut.write(mScratch.data().data(), std::streamsize(mScratch.data().size()));
+		mOut.write(payload.data(), std::streamsize(payload.size()));
+	}
+	/// Writes the current payload, preceded by the definitions of the variables it introduced.
+	void emitPayload(stream::Record tag) {
+		const auto& vars = mPayload.variables();
+		for (; mDefinedVariables < vars.size(); ++mDefinedVariables) {
+			Variable v = vars[mDefinedVariables];
+			Encoder def;
+			def.byte(std::uint8_t(v.type()));
+			def.bytes(v.name());
+			emit(stream::Record::VARIABLE, def.data());
+		}
+		emit(tag, mPayload.data());
+	}
+
+	std::size_t define(const Constraint<Pol>& c) {
+		auto it = mConstraints.find(c);
+		if (it != mConstraints.end()) return it->second;
+		mPayload.clear();
+		mPayload << c;
+		emitPayload(stream::Record::CONSTRAINT_DEFINITION);
+		return mConstraints.emplace(c, mConstraints.size()).first->second;
+	}
+
+	template<typename F>
+	static void forEachSubformula(const Formula<Pol>& f, F&& f2) {
+		switch (f.getType()) {
+			case FormulaType::NOT: f2(f.subformula()); break;
+			case FormulaType::EXISTS:
+			case FormulaType::FORALL: f2(f.quantifiedFormula()); break;
+			case FormulaType::ITE:
+			case FormulaType::IMPLIES:
+			case FormulaType::AND:
+			case FormulaType::OR:
+			case FormulaType::XOR:
+			case FormulaType::IFF:
+				for (const auto& sub: f.subformulas()) f2(sub);
+				break;
+			default: break;
+		}
+	}
+
+	/// Defines a formula after all of its subformulas have been defined.
+	void defineNode(const Formula<Pol>& f) {
+		std::size_t constraint = 0;
+		if (f.getType() == FormulaType::CONSTRAINT) constraint = define(f.constraint());
+		mPayload.clear();
+		mPayload.byte(std::uint8_t(f.getType()));
+		switch (f.getType()) {
+			case FormulaType::TRUE:
+			case FormulaType::FALSE:
+				break;
+			case FormulaType::BOOL:
+				mPayload << f.boolean();
+				break;
+			case FormulaType::CONSTRAINT:
+				mPayload.varint(constraint);
+				break;
+			case FormulaType::EXISTS:
+			case FormulaType::FORALL:
+				mPayload << f.quantifiedVariables();
+				mPayload.varint(mFormulas.at(f.quantifiedFormula()));
+				break;
+			case FormulaType::NOT:
+				mPayload.varint(mFormulas.at(f.subformula()));
+				break;
+			case FormulaType::ITE:
+			case FormulaType::IMPLIES:
+			case FormulaType::AND:
+			case FormulaType::OR:
+			case FormulaType::XOR:
+			case FormulaType::IFF:
+				mPayload.varint(f.subformulas().size());
+				for (const auto& sub: f.subformulas()) mPayload.varint(mFormulas.at(sub));
+				break;
+			default:
+				throw std::invalid_argument("Formulas of type " + formulaTypeToString(f.getType()) + " can not be encoded.");
+		}
+		emitPayload(stream::Record::FORMULA_DEFINITION);
+		mFormulas.emplace(f, mFormulas.size());
+	}
+
+	/// Defines a formula and all its subformulas that are not yet defined, without recursion.
+	std::size_t define(const Formula<Pol>& formula) {
+		std::vector<Formula<Pol>> stack = { formula };
+		while (!stack.empty()) {
+			Formula<Pol> f = stack.back();
+			if (mFormulas.find(f) != mFormulas.end()) {
+				stack.pop_back();
+				continue;
+			}
+			bool ready = true;
+			forEachSubformula(f, [&](const Formula<Pol>& sub) {
+				if (mFormulas.find(sub) == mFormulas.end()) {
+					stack.push_back(sub);
+					ready = false;
+				}
+			});
+			if (!ready) continue;
+			stack.pop_back();
+			defineNode(f);
+		}
+		return mFormulas.at(formula);
+	}
+
+	void reference(stream::Record tag, std::size_t index) {
+		mScratch.clear();
+		mScratch.varint(index);
+		std::string payload = mScratch.release();
+		emit(tag, payload);
+	}
+public:
+	/// Creates a writer and writes the header to the stream.
+	explicit BinaryWriter(std::ostream& out): mOut(out) {
+		mOut.write(stream::MAGIC, stream::MAGIC_SIZE);
+		mScratch.varint(VERSION);
+		mOut.write(mScratch.data().data(), std::streamsize(mScratch.data().size()));
+	}
+
+	void write(const Pol& p) {
+		mPayload.clear();
+		mPayload << p;
+		emitPayload(stream::Record::POLYNOMIAL);
+	}
+	void write(const Constraint<Pol>& c) {
+		reference(stream::Record::CONSTRAINT, define(c));
+	}
+	/// Throws std::invalid_argument if the formula contains bitvector, uninterpreted or variable comparison atoms.
+	void write(const Formula<Pol>& f) {
+		reference(stream::Record::FORMULA, define(f));
+	}
+	template<typename T>
+	BinaryWriter& operator<<(const T& t) {
+		write(t);
+		return *this;
+	}
+	void flush() {
+		mOut.flush();
+	}
+};
+
+/**
+ * Reads polynomials, constraints and formulas in the binary format, either from a std::istream or directly from a
+ * contiguous buffer like a MappedFile. In the latter case, the records are decoded in place without being copied and
+ * the buffer must outlive the reader.
+ *
+ * Constraints and formulas are constructed through their pools, hence reading a stream within the process that wrote
+ * it yields the very same constraints and formulas. Throws DecodingError if the data is malformed.
+ */
+template<typename Pol>
+class BinaryReader {
+	static_assert(is_encodable<Pol>, "The polynomial type can not be decoded.");
+public:
+	using Item = std::variant<Pol, Constraint<Pol>, Formula<Pol>>;
+private:
+	std::istream* mIn = nullptr;
+	std::string mBuffer;
+	const char* mCur = nullptr;
+	const char* mEnd = nullptr;
+	Decoder mDecoder = Decoder(nullptr, nullptr);
+	std::vector<Constraint<Pol>> mConstraints;
+	std::vector<Formula<Pol>> mFormulas;
+
+	/// Reads a varint from the input stream, returns false at the end of the stream.
+	bool readStreamVarint(std::uint64_t& n, bool first) {
+		n = 0;
+		for (unsigned shift = 0; shift < 64; shift += 7) {
+			int c = mIn->get();
+			if (c == std::char_traits<char>::eof()) {
+				if (first && shift == 0) return false;
+				throw DecodingError("Unexpected end of binary data.");
+			}
+			n |= std::uint64_t(c & 0x7f) << shift;
+			if ((c & 0x80) == 0) return true;
+		}
+		throw DecodingError("Varint is too long.");
+	}
+	/// Moves the decoder to the payload of the next record.
+	bool nextRecord(stream::Record& tag) {
+		if (mIn != nullptr) {
+			int c = mIn->get();
+			if (c == std::char_traits<char>::eof()) return false;
+			tag = stream::Record(c);
+			std::uint64_t size;
+			readStreamVarint(size, false);
+			mBuffer.resize(size);
+			if (size > 0 && !mIn->read(&mBuffer[0], std::streamsize(size))) {
+				throw DecodingError("Unexpected end of binary data.");
+			}
+			mDecoder.reset(mBuffer.data(), mBuffer.data() + mBuffer.size());
+			return true;
+		}
+		if (mCur == mEnd) return false;
+		Decoder frame(mCur, mEnd);
+		tag = stream::Record(frame.byte());
+		std::uint64_t size = frame.varint();
+		const char* payload = frame.raw(size);
+		mCur = payload + size;
+		mDecoder.reset(payload, mCur);
+		return true;
+	}
+	void checkHeader(const char* magic, std::uint64_t version) const {
+		if (std::memcmp(magic, stream::MAGIC, stream::MAGIC_SIZE) != 0) throw DecodingError("Not a binary carl stream.");
+		if (version != VERSION) throw DecodingError("Unsupported version " + std::to_string(version) + " of binary carl stream.");
+	}
+
+	template<typename T>
+	const T& lookup(const std::vector<T>& definitions) {
+		std::uint64_t index = mDecoder.varint();
+		if (index >= definitions.size()) throw DecodingError("Reference to an undefined constraint or formula.");
+		return definitions[index];
+	}
+	void readVariable() {
+		std::uint8_t type = mDecoder.byte();
+		if (type > std::uint8_t(VariableType::MAX_TYPE)) throw DecodingError("Invalid variable type.");
+		std::string name = mDecoder.bytes();
+		Variable v = VariablePool::getInstance().findVariableWithName(name);
+		if (v == Variable::NO_VARIABLE || v.type() != VariableType(type)) {
+			v = freshVariable(name, VariableType(type));
+		}
+		mDecoder.addVariable(v);
+	}
+	Formula<Pol> readFormula() {
+		std::uint8_t type = mDecoder.byte();
+		switch (FormulaType(type)) {
+			case FormulaType::TRUE:
+			case FormulaType::FALSE:
+				return Formula<Pol>(FormulaType(type));
+			case FormulaType::BOOL:
+				return Formula<Pol>(mDecoder.variable());
+			case FormulaType::CONSTRAINT:
+				return Formula<Pol>(lookup(mConstraints));
+			case FormulaType::EXISTS:
+			case FormulaType::FORALL: {
+				auto vars = mDecoder.read<std::vector<Variable>>();
+				return Formula<Pol>(FormulaType(type), std::move(vars), lookup(mFormulas));
+			}
+			case FormulaType::NOT:
+				return Formula<Pol>(FormulaType::NOT, lookup(mFormulas));
+			case FormulaType::ITE:
+			case FormulaType::IMPLIES:
+			case FormulaType::AND:
+			case FormulaType::OR:
+			case FormulaType::XOR:
+			case FormulaType::IFF: {
+				std::uint64_t size = mDecoder.varint();
+				if (size > mDecoder.remaining()) throw DecodingError("Unexpected end of binary data.");
+				Formulas<Pol> subformulas;
+				subformulas.reserve(size);
+				for (std::uint64_t i = 0; i < size; ++i) subformulas.push_back(lookup(mFormulas));
+				if (FormulaType(type) == FormulaType::ITE) {
+					if (size != 3) throw DecodingError("Invalid number of subformulas.");
+					return Formula<Pol>(FormulaType::ITE, subformulas[0], subformulas[1], subformulas[2]);
+				}
+				if (FormulaType(type) == FormulaType::IMPLIES) {
+					if (size != 2) throw DecodingError("Invalid number of subformulas.");
+					return Formula<Pol>(FormulaType::IMPLIES, subformulas[0], subformulas[1]);
+				}
+				return Formula<Pol>(FormulaType(type), std::move(subformulas));
+			}
+			default:
+				throw DecodingError("Invalid formula type.");
+		}
+	}
+	void finishRecord() const {
+		if (!mDecoder.atEnd()) throw DecodingError("Unexpected data at the end of a record.");
+	}
+public:
+	/// Reads from a stream, the header is read immediately.
+	explicit BinaryReader(std::istream& in): mIn(&in) {
+		char magic[stream::MAGIC_SIZE];
+		if (!mIn->read(magic, stream::MAGIC_SIZE)) throw DecodingError("Unexpected end of binary data.");
+		std::uint64_t version;
+		if (!readStreamVarint(version, true)) throw DecodingError("Unexpected end of binary data.");
+		checkHeader(magic, version);
+	}
+	/// Reads from a buffer without copying it.
+	BinaryReader(const char* begin, const char* end) {
+		Decoder header(begin, end);
+		const char* magic = header.raw(stream::MAGIC_SIZE);
+		std::uint64_t version = header.varint();
+		checkHeader(magic, version);
+		mCur = end - header.remaining();
+		mEnd = end;
+	}
+	explicit BinaryReader(const MappedFile& file):
+		BinaryReader(file.begin(), file.end())
+	{}
+	BinaryReader(const BinaryReader&) = delete;
+	BinaryReader& operator=(const BinaryReader&) = delete;
+
+	/**
+	 * Reads the next polynomial, constraint or formula that was written to the stream.
+	 * @return The item or std::nullopt at the end of the stream.
+	 */
+	std::optional<Item> next() {
+		stream::Record tag;
+		while (nextRecord(tag)) {
+			switch (tag) {
+				case stream::Record::VARIABLE:
+					readVariable();
+					finishRecord();
+					break;
+				case stream::Record::CONSTRAINT_DEFINITION:
+					mConstraints.push_back(mDecoder.read<Constraint<Pol>>());
+					finishRecord();
+					break;
+				case stream::Record::FORMULA_DEFINITION:
+					mFormulas.push_back(readFormula());
+					finishRecord();
+					break;
+				case stream::Record::POLYNOMIAL: {
+					Item res(std::in_place_index<0>, mDecoder.read<Pol>());
+					finishRecord();
+					return res;
+				}
+				case stream::Record::CONSTRAINT: {
+					Item res(std::in_place_index<1>, lookup(mConstraints));
+					finishRecord();
+					return res;
+				}
+				case stream::Record::FORMULA: {
+					Item res(std::in_place_index<2>, lookup(mFormulas));
+					finishRecord();
+					return res;
+				}
+				default:
+					throw DecodingError("Invalid record type.");
+			}
+		}
+		return std::nullopt;
+	}
+
+	/// The variables defined so far, in the order of their definition.
+	const std::vector<Variable>& variables() const {
+		return mDecoder.variables();
+	}
+};
+
+}
+}
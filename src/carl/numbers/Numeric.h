@@ -6,251 +6,392 @@
  * Created on 2014-03-11
  */
 
-// WARNING: THIS CLASS IS NOT YET THREAD SAFE!!!
-
 #pragma once
 
 #include "numbers.h"
 
+#include <cassert>
+#include <functional>
 #include <iostream>
 #include <limits>
-#include <vector>
+#include <memory>
+#include <type_traits>
 
 namespace carl
 {
     using ContentType = sint;
-    const ContentType HIGHTEST_INTEGER_VALUE = (std::numeric_limits<ContentType>::max() >> ((std::numeric_limits<ContentType>::digits/2)+1))+1;
-    
+    /// Exclusive bound on the absolute values of natively stored numerators and denominators, i.e. they have at most 62 bits.
+    const ContentType HIGHTEST_INTEGER_VALUE = ContentType(1) << 62;
+
+    /**
+     * A rational number that stores small values natively and only falls back to the arbitrary precision rational type T if necessary.
+     *
+     * A native value is a normalized fraction of two machine integers whose absolute values are below HIGHTEST_INTEGER_VALUE.
+     * Arithmetic on native values is done with overflow checks and the result is promoted to T if it does not fit.
+     * Conversely, results of operations on T are demoted whenever they fit, hence the representation of every value is unique.
+     *
+     * Every Numeric owns its value, thus distinct objects can be used concurrently from different threads.
+     * Numeric can be used as coefficient type of polynomials, see the traits and operations below.
+     */
     template<typename T>
     class Numeric
-    {   
+    {
     private:
         // Members:
-        ContentType mContent = 0;
+        /// Numerator of the native value.
+        ContentType mNum = 0;
+        /// Denominator of the native value, always positive.
+        ContentType mDenom = 1;
+        /// The value, if it is not stored natively.
+        std::unique_ptr<T> mRational;
 
     public:
-        
-        static std::vector<T>           mRationalPool;
-        static std::vector<ContentType> mFreeRationalIds;
-        
+
         // Constructors/Destructor:
-        
+
         /**
          * Default constructor.
          */
         Numeric() = default;
         Numeric( const T& /*unused*/ ); // NOLINT
-        Numeric( ContentType /*unused*/, bool /*unused*/ = false ); // NOLINT
+        template<typename Integer, EnableIf<std::is_integral<Integer>> = dummy>
+        Numeric( Integer _value ) // NOLINT
+        {
+            if( std::is_signed<Integer>::value || uint(_value) < uint(HIGHTEST_INTEGER_VALUE) )
+                assignInteger( ContentType( _value ) );
+            else
+                assign( carl::fromInt<T>( uint( _value ) ) );
+        }
+        Numeric( const typename IntegralType<T>::type& /*unused*/ ); // NOLINT
+        Numeric( ContentType /*unused*/, ContentType /*unused*/ );
         Numeric( const Numeric<T>& /*unused*/ );
-        ~Numeric();
-        
-        ContentType content() const
+        Numeric( Numeric<T>&& /*unused*/ ) noexcept = default;
+        ~Numeric() = default;
+
+        /**
+         * @return true, if the value is stored natively, i.e. no instance of T is allocated.
+         */
+        bool isNative() const
         {
-            return mContent;
+            return !mRational;
         }
 
         // Methods:
 
         Numeric<T>& operator=( const T& /*unused*/ );
-        Numeric<T>& operator=( ContentType /*unused*/ );
         Numeric<T>& operator=( const Numeric<T>& /*unused*/ );
+        Numeric<T>& operator=( Numeric<T>&& /*unused*/ ) noexcept = default;
 
-        bool operator==( const Numeric<T>& /*unused*/ ) const;
-        bool operator!=( const Numeric<T>& /*unused*/ ) const;
-        bool operator<( const Numeric<T>& /*unused*/ ) const;
-        bool operator<=( const Numeric<T>& /*unused*/ ) const;
-        bool operator>( const Numeric<T>& /*unused*/ ) const;
-        bool operator>=( const Numeric<T>& /*unused*/ ) const;
-        
-        template<typename T1>
-        friend Numeric<T1>& div_assign( Numeric<T1>& /*unused*/, const Numeric<T1>& /*unused*/ );
-        template<typename T1>
-        friend Numeric<T1>& gcd_assign( Numeric<T1>& /*unused*/, const Numeric<T1>& /*unused*/ );
-        
-        template<typename T1>
-        friend Numeric<T1>& operator+=( Numeric<T1>& /*unused*/, const Numeric<T1>& /*unused*/ );
-        template<typename T1>
-        friend Numeric<T1>& operator-=( Numeric<T1>& /*unused*/, const Numeric<T1>& /*unused*/ );
-        template<typename T1>
-        friend Numeric<T1>& operator*=( Numeric<T1>& /*unused*/, const Numeric<T1>& /*unused*/ );
-        template<typename T1>
-        friend Numeric<T1>& operator/=( Numeric<T1>& /*unused*/, const Numeric<T1>& /*unused*/ );
-        
-        template<typename T1>
-        friend Numeric<T1>& operator++( Numeric<T1>& /*unused*/ );
-        template<typename T1>
-        friend Numeric<T1>& operator--( Numeric<T1>& /*unused*/ );
-        
-        template<typename T1>
-        friend Numeric<T1> operator-( const Numeric<T1>& /*unused*/ );
-        
-        template<typename T1>
-        friend Numeric<T1> div( const Numeric<T1>& /*unused*/, const Numeric<T1>& /*unused*/ );
-        template<typename T1>
-        friend Numeric<T1> abs( const Numeric<T1>& /*unused*/ );
-        template<typename T1>
-        friend Numeric<T1> lcm( const Numeric<T1>& /*unused*/, const Numeric<T1>& /*unused*/ );
-        template<typename T1>
-        friend Numeric<T1> gcd( const Numeric<T1>& /*unused*/, const Numeric<T1>& /*unused*/ );
-        
-        template<typename T1>
-        friend std::ostream& operator <<( std::ostream& /*unused*/, const Numeric<T1>& /*unused*/ );
-        
-        static ContentType allocate( const T& /*unused*/ );
-        static ContentType allocate( ContentType /*unused*/ );
-        static void gcd_( ContentType& /*unused*/, ContentType /*unused*/ );
-        
-        T toRational() const
+        friend bool operator==( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
         {
-            if( std::abs( this->mContent ) < HIGHTEST_INTEGER_VALUE )
-                return carl::fromInt<T>(this->mContent);
-            else
-                return mRationalPool[std::size_t(this->mContent)-std::size_t(HIGHTEST_INTEGER_VALUE)];
+            return compare( _valueA, _valueB ) == 0;
         }
-        
-        operator T() const
+        friend bool operator!=( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
         {
-            return this->toRational();
+            return compare( _valueA, _valueB ) != 0;
         }
-        
-        explicit operator typename IntegralType<T>::type () const
+        friend bool operator<( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
         {
-            if( std::abs( this->mContent ) < HIGHTEST_INTEGER_VALUE )
-                return typename IntegralType<T>::type( this->mContent );
-            else
-            {
-                T& rat = mRationalPool[std::size_t(this->mContent)-std::size_t(HIGHTEST_INTEGER_VALUE)];
-                assert( carl::isInteger( rat ) );
-                return carl::getNum( rat );
-            }
+            return compare( _valueA, _valueB ) < 0;
         }
-			
-		static bool withinNativeRange(const T& t) {
-			return t > -carl::fromInt<T>(HIGHTEST_INTEGER_VALUE) && t < carl::fromInt<T>(HIGHTEST_INTEGER_VALUE);
-		}
-        
-    private:
-        
-        inline const T& rational() const
+        friend bool operator<=( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
         {
-            assert( std::abs( this->mContent ) >= HIGHTEST_INTEGER_VALUE );
-            return mRationalPool[std::size_t(this->mContent)-std::size_t(HIGHTEST_INTEGER_VALUE)];
+            return compare( _valueA, _valueB ) <= 0;
         }
-        
-        inline T& rRational()
+        friend bool operator>( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
         {
-            assert( std::abs( this->mContent ) >= HIGHTEST_INTEGER_VALUE );
-            return mRationalPool[std::size_t(this->mContent)-std::size_t(HIGHTEST_INTEGER_VALUE)];
+            return compare( _valueA, _valueB ) > 0;
         }
-        
-        inline void maybeRationalize()
+        friend bool operator>=( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
         {
-            if( !(std::abs( this->mContent ) < HIGHTEST_INTEGER_VALUE) )
-                this->mContent = allocate( this->mContent );
+            return compare( _valueA, _valueB ) >= 0;
         }
-        
-        inline void maybeRationalize( const T& _rat )
+
+        Numeric<T>& operator+=( const Numeric<T>& /*unused*/ );
+        Numeric<T>& operator-=( const Numeric<T>& /*unused*/ );
+        Numeric<T>& operator*=( const Numeric<T>& /*unused*/ );
+        Numeric<T>& operator/=( const Numeric<T>& /*unused*/ );
+
+        friend Numeric<T> operator+( Numeric<T> _valueA, const Numeric<T>& _valueB )
         {
-            if( carl::isInteger( _rat ) && withinNativeRange(carl::getNum(_rat)) )
-            {
-                this->mContent = carl::toInt<ContentType>( carl::getNum( _rat ) );
-            }
-            else
-            {
-                this->mContent = allocate( _rat );
-            }
+            return _valueA += _valueB;
+        }
+        friend Numeric<T> operator-( Numeric<T> _valueA, const Numeric<T>& _valueB )
+        {
+            return _valueA -= _valueB;
+        }
+        friend Numeric<T> operator*( Numeric<T> _valueA, const Numeric<T>& _valueB )
+        {
+            return _valueA *= _valueB;
+        }
+        friend Numeric<T> operator/( Numeric<T> _valueA, const Numeric<T>& _valueB )
+        {
+            return _valueA /= _valueB;
         }
 
-        inline void maybeIntegralize()
+        Numeric<T>& operator++();
+        Numeric<T>& operator--();
+        Numeric<T> operator-() const;
+
+        /**
+         * Compares two Numerics.
+         * @return A negative number, zero or a positive number, if the first value is less than, equal to or greater than the second value.
+         */
+        static int compare( const Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+
+        /**
+         * @return The numerator, if the value is stored natively.
+         */
+        ContentType nativeNumerator() const
         {
-            const T& rat = this->rational();
-            if( carl::isInteger( rat ) && withinNativeRange(carl::getNum(rat)) )
-            {
-                mFreeRationalIds.push_back( this->mContent );
-                this->mContent = carl::toInt<ContentType>( carl::getNum( rat ) );
-            }
+            assert( isNative() );
+            return mNum;
         }
 
-        inline void maybeIntegralize( const T& _rat )
+        /**
+         * @return The denominator, if the value is stored natively.
+         */
+        ContentType nativeDenominator() const
         {
-            if( carl::isInteger( _rat ) && withinNativeRange(carl::getNum(_rat)) )
-            {
-                mFreeRationalIds.push_back( this->mContent );
-                this->mContent = carl::toInt<ContentType>( carl::getNum( _rat ) );
-            }
-            else
+            assert( isNative() );
+            return mDenom;
+        }
+
+        /**
+         * @return The value, if it is not stored natively.
+         */
+        const T& rational() const
+        {
+            assert( !isNative() );
+            return *mRational;
+        }
+
+        T toRational() const
+        {
+            if( isNative() )
             {
-                this->rRational() = _rat;
+                if( mDenom == 1 )
+                    return carl::fromInt<T>( mNum );
+                return carl::fromInt<T>( mNum ) / carl::fromInt<T>( mDenom );
             }
+            return *mRational;
+        }
+
+        explicit operator T() const
+        {
+            return this->toRational();
+        }
+
+        explicit operator typename IntegralType<T>::type () const
+        {
+            assert( carl::isInteger( *this ) );
+            if( isNative() )
+                return carl::fromInt<typename IntegralType<T>::type>( mNum );
+            return carl::getNum( *mRational );
+        }
+
+        /**
+         * @return true, if the given value can be stored natively.
+         */
+        static bool withinNativeRange( const T& _value )
+        {
+            const T bound = carl::fromInt<T>( HIGHTEST_INTEGER_VALUE );
+            return carl::abs( carl::getNum( _value ) ) < bound && carl::getDenom( _value ) < bound;
         }
+
+    private:
+
+        /**
+         * Assigns a native integer that may exceed the native range.
+         */
+        void assignInteger( ContentType /*unused*/ );
+
+        /**
+         * Assigns the fraction _num/_denom of two machine integers, which need not be normalized and may exceed the native range.
+         */
+        void assignFraction( ContentType /*unused*/, ContentType /*unused*/ );
+
+        /**
+         * Assigns the given value, i.e. stores it natively if possible.
+         */
+        void assign( const T& /*unused*/ );
+        void assign( T&& /*unused*/ );
     };
 
     template<typename T>
-    Numeric<T>& div_assign( Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    inline bool isZero( const Numeric<T>& _value )
+    {
+        return _value.isNative() && _value.nativeNumerator() == 0;
+    }
+
     template<typename T>
-    Numeric<T>& gcd_assign( Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    inline bool isOne( const Numeric<T>& _value )
+    {
+        return _value.isNative() && _value.nativeNumerator() == 1 && _value.nativeDenominator() == 1;
+    }
+
     template<typename T>
-    Numeric<T> div( const Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    inline bool isPositive( const Numeric<T>& _value )
+    {
+        return _value.isNative() ? _value.nativeNumerator() > 0 : carl::isPositive( _value.rational() );
+    }
+
     template<typename T>
-    Numeric<T> abs( const Numeric<T>& /*unused*/ );
+    inline bool isNegative( const Numeric<T>& _value )
+    {
+        return _value.isNative() ? _value.nativeNumerator() < 0 : carl::isNegative( _value.rational() );
+    }
+
     template<typename T>
-    Numeric<T> lcm( const Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    inline bool isInteger( const Numeric<T>& _value )
+    {
+        if( _value.isNative() )
+            return _value.nativeDenominator() == 1;
+        else
+            return carl::isInteger( _value.rational() );
+    }
+
     template<typename T>
-    Numeric<T> gcd( const Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    inline typename IntegralType<T>::type getNum( const Numeric<T>& _value )
+    {
+        if( _value.isNative() )
+            return carl::fromInt<typename IntegralType<T>::type>( _value.nativeNumerator() );
+        return carl::getNum( _value.rational() );
+    }
+
+    template<typename T>
+    inline typename IntegralType<T>::type getDenom( const Numeric<T>& _value )
+    {
+        if( _value.isNative() )
+            return carl::fromInt<typename IntegralType<T>::type>( _value.nativeDenominator() );
+        return carl::getDenom( _value.rational() );
+    }
+
+    template<typename T>
+    inline std::size_t bitsize( const Numeric<T>& _value )
+    {
+        return carl::bitsize( _value.toRational() );
+    }
+
+    template<typename T>
+    inline double toDouble( const Numeric<T>& _value )
+    {
+        if( _value.isNative() )
+            return double( _value.nativeNumerator() ) / double( _value.nativeDenominator() );
+        return carl::toDouble( _value.rational() );
+    }
+
     template<typename T>
-    Numeric<T> operator+( const Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    struct IntegralType<Numeric<T>> {
+        using type = typename carl::IntegralType<T>::type;
+    };
+
     template<typename T>
-    Numeric<T> operator-( const Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    struct is_rational<Numeric<T>>: is_rational<T> {};
+
+    template<typename Integer, typename T>
+    inline Integer toInt(const Numeric<T>& n)
+    {
+        if( std::is_integral<Integer>::value && n.isNative() )
+        {
+            assert( n.nativeDenominator() == 1 );
+            return Integer( n.nativeNumerator() );
+        }
+        return carl::toInt<Integer>(n.toRational());
+    }
+
     template<typename T>
-    Numeric<T> operator*( const Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    Numeric<T> abs( const Numeric<T>& /*unused*/ );
     template<typename T>
-    Numeric<T> operator/( const Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    typename IntegralType<T>::type floor( const Numeric<T>& /*unused*/ );
     template<typename T>
-    Numeric<T>& operator+=( Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    typename IntegralType<T>::type ceil( const Numeric<T>& /*unused*/ );
     template<typename T>
-    Numeric<T>& operator-=( Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    Numeric<T> gcd( const Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
     template<typename T>
-    Numeric<T>& operator*=( Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    Numeric<T>& gcd_assign( Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
     template<typename T>
-    Numeric<T>& operator/=( Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
+    Numeric<T> lcm( const Numeric<T>& /*unused*/, const Numeric<T>& /*unused*/ );
     template<typename T>
-    Numeric<T> operator-( const Numeric<T>& /*unused*/ );
+    Numeric<T> pow( const Numeric<T>& /*unused*/, std::size_t /*unused*/ );
     template<typename T>
-    Numeric<T>& operator++( Numeric<T>& /*unused*/ );
+    Numeric<T> reciprocal( const Numeric<T>& /*unused*/ );
+
     template<typename T>
-    Numeric<T>& operator--( Numeric<T>& /*unused*/ );
+    inline Numeric<T> quotient( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    {
+        return _valueA / _valueB;
+    }
+
     template<typename T>
-    std::ostream& operator <<( std::ostream& /*unused*/, const Numeric<T>& /*unused*/ );
-    
-    #define IS_INT( value ) std::abs( value ) < HIGHTEST_INTEGER_VALUE
-    
+    inline Numeric<T> div( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    {
+        return _valueA / _valueB;
+    }
+
     template<typename T>
-    inline bool isInteger( const Numeric<T>& _value )
+    inline Numeric<T>& div_assign( Numeric<T>& _valueA, const Numeric<T>& _valueB )
     {
-        if( std::abs( _value.content() ) < HIGHTEST_INTEGER_VALUE )
-            return true;
-        else
-            return carl::isInteger( Numeric<T>::mRationalPool[std::size_t(_value.content())-std::size_t(HIGHTEST_INTEGER_VALUE)] );
+        return _valueA /= _valueB;
     }
-    
-//    template<>
-//    inline void reserve<Numeric<cln::cl_RA>>( size_t _expectedNumOfElements )
-//    {
-//        Numeric<cln::cl_RA>::mRationalPool.reserve( Numeric<cln::cl_RA>::mRationalPool.capacity() + _expectedNumOfElements );
-//    }
-    
+
     template<typename T>
-    struct IntegralType<Numeric<T>> {
-        using type = typename carl::IntegralType<T>::type;
-    };
-    
-    template<typename Integer, typename T>
-    inline Integer toInt(const Numeric<T>& n)
+    std::ostream& operator <<( std::ostream& /*unused*/, const Numeric<T>& /*unused*/ );
+
+    template<typename T>
+    inline std::string toString( const Numeric<T>& _value, bool _infix = true )
     {
-        return carl::toInt<Integer>(T(n)); // TODO: this could be more efficient for native integer types
+        return carl::toString( _value.toRational(), _infix );
+    }
+
+#define NUMERIC_DECLARATIONS(T) \
+    template<> \
+    inline Numeric<T> fromInt( const sint& n ) { return Numeric<T>( n ); } \
+    template<> \
+    inline Numeric<T> fromInt( const uint& n ) { return Numeric<T>( n ); } \
+    template<> \
+    inline Numeric<T> rationalize<Numeric<T>>( float n ) { return Numeric<T>( carl::rationalize<T>( n ) ); } \
+    template<> \
+    inline Numeric<T> rationalize<Numeric<T>>( double n ) { return Numeric<T>( carl::rationalize<T>( n ) ); } \
+    template<> \
+    inline Numeric<T> rationalize<Numeric<T>>( int n ) { return Numeric<T>( n ); } \
+    template<> \
+    inline Numeric<T> rationalize<Numeric<T>>( sint n ) { return Numeric<T>( n ); } \
+    template<> \
+    inline Numeric<T> rationalize<Numeric<T>>( uint n ) { return Numeric<T>( n ); } \
+    template<> \
+    inline Numeric<T> parse<Numeric<T>>( const std::string& n ) { return Numeric<T>( carl::parse<T>( n ) ); } \
+    template<> \
+    inline bool try_parse<Numeric<T>>( const std::string& n, Numeric<T>& res ) \
+    { \
+        T tmp; \
+        if( !carl::try_parse<T>( n, tmp ) ) return false; \
+        res = tmp; \
+        return true; \
     }
-    
+
+    NUMERIC_DECLARATIONS(mpq_class)
+#ifdef USE_CLN_NUMBERS
+    NUMERIC_DECLARATIONS(cln::cl_RA)
+#endif
+
+#undef NUMERIC_DECLARATIONS
+
 } // namespace carl
 
+namespace std {
+
+    template<typename T>
+    struct hash<carl::Numeric<T>> {
+        std::size_t operator()( const carl::Numeric<T>& _value ) const
+        {
+            if( _value.isNative() )
+                return carl::hash_all( _value.nativeNumerator(), _value.nativeDenominator() );
+            return std::hash<T>()( _value.rational() );
+        }
+    };
+
+} // namespace std
+
 
 #include "Numeric.tpp"
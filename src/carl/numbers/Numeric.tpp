@@ -7,824 +7,514 @@
  */
 
 #include "typetraits.h"
+#include "../util/platform.h"
+
+#include <limits>
 
 namespace carl
 {
-    template<typename T>
-    std::vector<T> Numeric<T>::mRationalPool = std::vector<T>();
-    template<typename T>
-    std::vector<ContentType> Numeric<T>::mFreeRationalIds = std::vector<ContentType>();
-    
-    template<typename T>
-    ContentType Numeric<T>::allocate( const T& _value )
+namespace numeric_detail
+{
+    /**
+     * Overflow checked arithmetic on machine integers.
+     * @return true, if the result overflowed.
+     */
+#if defined __CLANG || defined __GCC
+    inline bool add_overflow( ContentType _a, ContentType _b, ContentType& _res )
     {
-        if( mFreeRationalIds.empty() )
-        {
-#ifdef __VS
-            mRationalPool.push_back(_value);
+        return __builtin_add_overflow( _a, _b, &_res );
+    }
+    inline bool sub_overflow( ContentType _a, ContentType _b, ContentType& _res )
+    {
+        return __builtin_sub_overflow( _a, _b, &_res );
+    }
+    inline bool mul_overflow( ContentType _a, ContentType _b, ContentType& _res )
+    {
+        return __builtin_mul_overflow( _a, _b, &_res );
+    }
 #else
-            mRationalPool.emplace_back( _value );
-#endif
-            assert( mRationalPool.size() + (size_t) HIGHTEST_INTEGER_VALUE - 1 <= std::numeric_limits<size_t>::max() );
-            return ContentType(mRationalPool.size() + HIGHTEST_INTEGER_VALUE - 1);
-        }
-        else
-        {
-            ContentType id = mFreeRationalIds.back();
-            mFreeRationalIds.pop_back();
-            assert( id >= HIGHTEST_INTEGER_VALUE );
-            mRationalPool[std::size_t(id-HIGHTEST_INTEGER_VALUE)] = _value;
-            return id;
-        }
+    inline bool add_overflow( ContentType _a, ContentType _b, ContentType& _res )
+    {
+        if( _b > 0 ? _a > std::numeric_limits<ContentType>::max() - _b : _a < std::numeric_limits<ContentType>::min() - _b )
+            return true;
+        _res = _a + _b;
+        return false;
     }
-    
-    template<typename T>
-    ContentType Numeric<T>::allocate( ContentType _value )
+    inline bool sub_overflow( ContentType _a, ContentType _b, ContentType& _res )
+    {
+        if( _b < 0 ? _a > std::numeric_limits<ContentType>::max() + _b : _a < std::numeric_limits<ContentType>::min() + _b )
+            return true;
+        _res = _a - _b;
+        return false;
+    }
+    inline bool mul_overflow( ContentType _a, ContentType _b, ContentType& _res )
     {
-        if( mFreeRationalIds.empty() )
+        const ContentType max = std::numeric_limits<ContentType>::max();
+        const ContentType min = std::numeric_limits<ContentType>::min();
+        if( _a > 0 )
         {
-            mRationalPool.emplace_back(carl::fromInt<T>(_value));
-            assert( mRationalPool.size() + (size_t) HIGHTEST_INTEGER_VALUE - 1 <= std::numeric_limits<size_t>::max() );
-            return ContentType(mRationalPool.size() + HIGHTEST_INTEGER_VALUE - 1);
+            if( _b > 0 ? _a > max / _b : _b < min / _a )
+                return true;
         }
-        else
+        else if( _a < 0 )
         {
-            ContentType id = mFreeRationalIds.back();
-            mFreeRationalIds.pop_back();
-            assert( id >= HIGHTEST_INTEGER_VALUE );
-            mRationalPool[std::size_t(id-HIGHTEST_INTEGER_VALUE)] = carl::fromInt<T>(_value);
-            return id;
+            if( _b > 0 ? _a < min / _b : ( _b != 0 && _b < max / _a ) )
+                return true;
         }
+        _res = _a * _b;
+        return false;
     }
+#endif
 
-    /**
-     * Constructing from a Rational.
-     * @param _value The Rational.
-     */
-    template<typename T>
-    Numeric<T>::Numeric( const T& _value ):
-        mContent( (carl::isInteger( _value ) && withinNativeRange(carl::getNum(_value))) ? carl::toInt<ContentType>( carl::getNum( _value ) ) : allocate( _value ) )
-    {}
-
-    /**
-     * Constructing from an integer.
-     * @param _value The integer.
-	 * @param is_definitely_int
-     */
-    template<typename T>
-    Numeric<T>::Numeric( ContentType _value, bool is_definitely_int ):
-        mContent( is_definitely_int || IS_INT( _value ) ? _value : allocate( _value ) )
-    {}
-    
-    /**
-     * Copy constructor.
-     * @param _value The Numeric to copy.
-     */
-    template<typename T>
-    Numeric<T>::Numeric( const Numeric<T>& _value ):
-        mContent( IS_INT( _value.mContent ) ? _value.mContent : allocate( _value.rational() ) )
-    {}
+    inline bool withinNativeRange( ContentType _value )
+    {
+        return _value < HIGHTEST_INTEGER_VALUE && _value > -HIGHTEST_INTEGER_VALUE;
+    }
 
-    template<typename T>
-    Numeric<T>::~Numeric()
+    inline uint gcd( uint _a, uint _b )
     {
-        if( !(IS_INT( mContent )) )
+        while( _b != 0 )
         {
-            mFreeRationalIds.push_back( mContent );
+            uint c = _a % _b;
+            _a = _b;
+            _b = c;
         }
+        return _a;
     }
 
-    /**
-     * Cast from a rational.
-     * @param _value The rational.
-     * @return The corresponding Numeric.
-     */
+    /// Non-negative gcd of two values within the native range.
+    inline ContentType gcd( ContentType _a, ContentType _b )
+    {
+        assert( withinNativeRange( _a ) && withinNativeRange( _b ) );
+        return ContentType( gcd( uint( _a < 0 ? -_a : _a ), uint( _b < 0 ? -_b : _b ) ) );
+    }
+}
+
     template<typename T>
-    Numeric<T>& Numeric<T>::operator=( const T& _value )
+    void Numeric<T>::assignInteger( ContentType _value )
     {
-        if( IS_INT( this->mContent ) )
+        if( numeric_detail::withinNativeRange( _value ) )
         {
-            if( carl::isInteger( _value ) && withinNativeRange(_value) )
-            {
-                this->mContent = carl::toInt<ContentType>( carl::getNum( _value ) );
-            }
-            else
-            {
-                this->mContent = allocate( _value );
-            }
+            mRational.reset();
+            mNum = _value;
+            mDenom = 1;
         }
         else
         {
-            if( carl::isInteger( _value ) && withinNativeRange(_value) )
-            {
-                mFreeRationalIds.push_back( this->mContent );
-                this->mContent = carl::toInt<ContentType>( carl::getNum( _value ) );
-            }
-            else
-            {
-                this->rRational() = _value;
-            }
+            assign( carl::fromInt<T>( _value ) );
         }
-        return *this; // NOLINT
     }
 
-    /**
-     * Cast from an integer.
-     * @param _value The integer.
-     * @return The corresponding Numeric.
-     */
     template<typename T>
-    Numeric<T>& Numeric<T>::operator=( ContentType _value )
+    void Numeric<T>::assignFraction( ContentType _num, ContentType _denom )
     {
-        if( IS_INT( this->mContent ) )
-        {
-            if( IS_INT( _value ) )
-                this->mContent = _value;
-            else
-                this->mContent = allocate( _value );
+        assert( _denom != 0 );
+        // Normalize on unsigned values, as the absolute value of the smallest machine integer is not a machine integer.
+        bool negative = (_num < 0) != (_denom < 0);
+        uint num = _num < 0 ? uint(0) - uint(_num) : uint(_num);
+        uint denom = _denom < 0 ? uint(0) - uint(_denom) : uint(_denom);
+        uint g = numeric_detail::gcd( num, denom );
+        num /= g;
+        denom /= g;
+        if( num < uint(HIGHTEST_INTEGER_VALUE) && denom < uint(HIGHTEST_INTEGER_VALUE) )
+        {
+            mRational.reset();
+            mNum = negative ? -ContentType(num) : ContentType(num);
+            mDenom = ContentType(denom);
         }
         else
         {
-            if( IS_INT( _value ) )
-            {
-                mFreeRationalIds.push_back( this->mContent );
-                this->mContent = _value;
-            }
-            else
-                this->rRational() = carl::fromInt<T>( _value );
+            T res = carl::fromInt<T>( num ) / carl::fromInt<T>( denom );
+            assign( negative ? T(-res) : res );
         }
-        return *this; // NOLINT
     }
 
-    /**
-     * Cast from a char array.
-     * @param _value The char array.
-     * @return The corresponding Numeric.
-     */
     template<typename T>
-    Numeric<T>& Numeric<T>::operator=( const Numeric<T>& _value )
+    void Numeric<T>::assign( const T& _value )
     {
-        if( IS_INT( this->mContent ) )
+        if( withinNativeRange( _value ) )
         {
-            if( IS_INT( _value.mContent ) )
-                this->mContent = _value.mContent;
-            else
-                this->mContent = allocate( _value.rational() );
+            mRational.reset();
+            mNum = carl::toInt<ContentType>( carl::getNum( _value ) );
+            mDenom = carl::toInt<ContentType>( carl::getDenom( _value ) );
+        }
+        else if( mRational )
+        {
+            *mRational = _value;
         }
         else
         {
-            if( IS_INT( _value.mContent ) )
-            {
-                mFreeRationalIds.push_back( this->mContent );
-                this->mContent = _value.mContent;
-            }
-            else
-                this->rRational() = _value.rational();
+            mRational = std::make_unique<T>( _value );
         }
-        return *this; // NOLINT
     }
 
-    /**
-     * Compares whether this Numeric and the given one are equal.
-     * @param _value The Numeric to compare with.
-     * @return true, if the two Numerics are equal;
-     *          false, otherwise.
-     */
     template<typename T>
-    bool Numeric<T>::operator==( const Numeric<T>& _value ) const
+    void Numeric<T>::assign( T&& _value )
     {
-        if( IS_INT( this->mContent ) )
+        if( withinNativeRange( _value ) )
         {
-            if( IS_INT( _value.mContent ) )
-                return this->mContent == _value.mContent;
-            else
-            {
-                assert( _value.rational() != carl::fromInt<T>(this->mContent) );
-                return false;
-            }
+            mRational.reset();
+            mNum = carl::toInt<ContentType>( carl::getNum( _value ) );
+            mDenom = carl::toInt<ContentType>( carl::getDenom( _value ) );
+        }
+        else if( mRational )
+        {
+            *mRational = std::move( _value );
         }
         else
         {
-            if( IS_INT( _value.mContent ) )
-            {
-                assert( this->rational() != carl::fromInt<T>(_value.mContent) );
-                return false;
-            }
-            else
-            {
-                return (this->rational() == _value.rational());
-            }
+            mRational = std::make_unique<T>( std::move( _value ) );
         }
     }
 
     /**
-     * Compares whether this Numeric and the given one are not equal.
-     * @param _value The Numeric to compare with.
-     * @return true, if the two Numerics are not equal;
-     *          false, otherwise.
+     * Constructing from a Rational.
+     * @param _value The Rational.
      */
     template<typename T>
-    bool Numeric<T>::operator!=( const Numeric<T>& _value ) const
+    Numeric<T>::Numeric( const T& _value )
     {
-        if( IS_INT( this->mContent ) )
-        {
-            if( IS_INT( _value.mContent ) )
-                return this->mContent != _value.mContent;
-            else
-            {
-                assert( _value.rational() != carl::fromInt<T>(this->mContent) );
-                return true;
-            }
-        }
-        else
-        {
-            if( IS_INT( _value.mContent ) )
-            {
-                assert( this->rational() != carl::fromInt<T>(_value.mContent) );
-                return true;
-            }
-            else
-            {
-                return (this->rational() != _value.rational());
-            }
-        }
+        assign( _value );
     }
 
     /**
-     * Compares whether this Numeric is less than the given one.
-     * @param _value The Numeric to compare with.
-     * @return true, if this Numeric is less than the given one;
-     *          false, otherwise.
+     * Constructing from an integer of the integral type belonging to T.
+     * @param _value The integer.
      */
     template<typename T>
-    bool Numeric<T>::operator<( const Numeric<T>& _value ) const
+    Numeric<T>::Numeric( const typename IntegralType<T>::type& _value )
     {
-        if( IS_INT( this->mContent ) )
-        {
-            if( IS_INT( _value.mContent ) )
-                return this->mContent < _value.mContent;
-            else
-            {
-                return _value.rational() > carl::fromInt<T>(this->mContent);
-            }
-        }
+        if( carl::abs( _value ) < carl::fromInt<typename IntegralType<T>::type>( HIGHTEST_INTEGER_VALUE ) )
+            mNum = carl::toInt<ContentType>( _value );
         else
-        {
-            if( IS_INT( _value.mContent ) )
-            {
-                return this->rational() < carl::fromInt<T>(_value.mContent);
-            }
-            else
-                return this->rational() < _value.rational();
-        }
+            mRational = std::make_unique<T>( _value );
     }
 
     /**
-     * Compares whether this Numeric is less or equal than the given one.
-     * @param _value The Numeric to compare with.
-     * @return true, if this Numeric is less or equal than the given one;
-     *          false, otherwise.
+     * Constructing from a fraction of two integers.
+     * @param _num The numerator.
+     * @param _denom The denominator, must not be zero.
      */
     template<typename T>
-    bool Numeric<T>::operator<=( const Numeric<T>& _value ) const
+    Numeric<T>::Numeric( ContentType _num, ContentType _denom )
     {
-        if( IS_INT( this->mContent ) )
-        {
-            if( IS_INT( _value.mContent ) )
-                return this->mContent <= _value.mContent;
-            else
-            {
-                return _value.rational() >= carl::fromInt<T>(this->mContent);
-            }
-        }
-        else
-        {
-            if( IS_INT( _value.mContent ) )
-            {
-                return this->rational() <= carl::fromInt<T>(_value.mContent);
-            }
-            else
-                return this->rational() <= _value.rational();
-        }
+        assignFraction( _num, _denom );
     }
 
     /**
-     * Compares whether this Numeric is greater than the given one.
-     * @param _value The Numeric to compare with.
-     * @return true, if this Numeric is greater than the given one;
-     *          false, otherwise.
+     * Copy constructor.
+     * @param _value The Numeric to copy.
      */
     template<typename T>
-    bool Numeric<T>::operator>( const Numeric<T>& _value ) const
-    {
-        if( IS_INT( this->mContent ) )
-        {
-            if( IS_INT( _value.mContent ) )
-                return this->mContent > _value.mContent;
-            else
-            {
-                return _value.rational() < carl::fromInt<T>(this->mContent);
-            }
-        }
-        else
-        {
-            if( IS_INT( _value.mContent ) )
-            {
-                return this->rational() > carl::fromInt<T>(_value.mContent);
-            }
-            else
-                return this->rational() > _value.rational();
-        }
-    }
+    Numeric<T>::Numeric( const Numeric<T>& _value ):
+        mNum( _value.mNum ),
+        mDenom( _value.mDenom ),
+        mRational( _value.mRational ? std::make_unique<T>( *_value.mRational ) : nullptr )
+    {}
 
     /**
-     * Compares whether this Numeric is greater or equal than the given one.
-     * @param _value The Numeric to compare with.
-     * @return true, if this Numeric is greater or equal than the given one;
-     *          false, otherwise.
+     * Cast from a rational.
+     * @param _value The rational.
+     * @return The corresponding Numeric.
      */
     template<typename T>
-    bool Numeric<T>::operator>=( const Numeric<T>& _value ) const
+    Numeric<T>& Numeric<T>::operator=( const T& _value )
     {
-        if( IS_INT( this->mContent ) )
-        {
-            if( IS_INT( _value.mContent ) )
-                return this->mContent >= _value.mContent;
-            else
-            {
-                return _value.rational() <= carl::fromInt<T>(this->mContent);
-            }
-        }
-        else
-        {
-            if( IS_INT( _value.mContent ) )
-            {
-                return this->rational() >= carl::fromInt<T>(_value.mContent);
-            }
-            else
-                return this->rational() >= _value.rational();
-        }
+        assign( _value );
+        return *this;
     }
-    
-    /**
-     * @param _valueA An integer.
-     * @param _valueB An integer.
-     * @result The quotient of this integer and the given integer.
-     */
+
     template<typename T>
-    Numeric<T>& div_assign( Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    Numeric<T>& Numeric<T>::operator=( const Numeric<T>& _value )
     {
-        assert( isInteger( _valueA ) );
-        assert( isInteger( _valueB ) );
-        assert( abs( _valueA ) >= abs( _valueB ) );
-        if( IS_INT( _valueA.mContent ) )
+        if( this == &_value )
+            return *this;
+        if( _value.isNative() )
         {
-            assert( IS_INT( _valueB.mContent ) );
-            _valueA.mContent /= _valueB.mContent;
+            mRational.reset();
+            mNum = _value.mNum;
+            mDenom = _value.mDenom;
         }
         else
         {
-            T& rat = _valueA.rRational();
-            if( IS_INT( _valueB.mContent ) )
-                rat = carl::div( carl::getNum( rat ), carl::fromInt<typename IntegralType<T>::type>( _valueB.mContent ) );
-            else
-                rat = carl::div( carl::getNum( rat ), carl::getNum( _valueB.rational() ) );
-            if( Numeric<T>::withinNativeRange(rat) )
-            {
-                Numeric<T>::mFreeRationalIds.push_back( _valueA.mContent );
-                _valueA.mContent = carl::toInt<ContentType>( carl::getNum( rat ) );
-            }
+            assign( *_value.mRational );
         }
-        return _valueA;
+        return *this;
     }
-    
+
     template<typename T>
-    void Numeric<T>::gcd_( ContentType& _a, ContentType _b )
+    int Numeric<T>::compare( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
     {
-        assert( _a > 0 && _b > 0 );
-        ContentType c;
-        while( _b != 0 )
-        {
-            c = _b;
-            _b = _a%_b;
-            _a = c;
-        }
+        if( _valueA.isNative() && _valueB.isNative() )
+        {
+            ContentType lhs = _valueA.mNum;
+            ContentType rhs = _valueB.mNum;
+            if( _valueA.mDenom != _valueB.mDenom
+                && (numeric_detail::mul_overflow( _valueA.mNum, _valueB.mDenom, lhs ) || numeric_detail::mul_overflow( _valueB.mNum, _valueA.mDenom, rhs )) )
+            {
+                T a = _valueA.toRational();
+                T b = _valueB.toRational();
+                return a < b ? -1 : (b < a ? 1 : 0);
+            }
+            return lhs < rhs ? -1 : (rhs < lhs ? 1 : 0);
+        }
+        // Values are represented uniquely, hence a native value never equals a non-native one.
+        if( _valueA.isNative() )
+            return carl::fromInt<T>( _valueA.mNum ) < _valueB.rational() * carl::fromInt<T>( _valueA.mDenom ) ? -1 : 1;
+        if( _valueB.isNative() )
+            return _valueA.rational() * carl::fromInt<T>( _valueB.mDenom ) < carl::fromInt<T>( _valueB.mNum ) ? -1 : 1;
+        const T& a = _valueA.rational();
+        const T& b = _valueB.rational();
+        return a < b ? -1 : (b < a ? 1 : 0);
     }
-  
+
     template<typename T>
-    Numeric<T>& gcd_assign( Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    Numeric<T>& Numeric<T>::operator+=( const Numeric<T>& _value )
     {
-        assert( isInteger( _valueA ) );
-        assert( isInteger( _valueB ) );
-        if( _valueA.mContent == 0 || _valueB.mContent == 0 )
-        {
-            if( !(IS_INT( _valueA.mContent )) )
-                Numeric<T>::mFreeRationalIds.push_back( _valueA.mContent );
-            _valueA.mContent = 0;
-        }
-        if( IS_INT( _valueA.mContent ) )
-        {
-            _valueA.mContent = std::abs( _valueA.mContent );
-            if( IS_INT( _valueB.mContent ) )
-            {
-                Numeric<T>::gcd_( _valueA.mContent, std::abs( _valueB.mContent ) );
-            }
-            else
-            {
-                typename IntegralType<T>::type a = carl::abs( carl::getNum( _valueB.rational() ) );
-                a = carl::mod( a, carl::fromInt<typename IntegralType<T>::type>(_valueA.mContent) );
-                if( a != 0 )
-                    Numeric<T>::gcd_( _valueA.mContent, carl::toInt<ContentType>( a ) );
-            }
-        }
-        else
+        if( isNative() && _value.isNative() )
         {
-            if( IS_INT( _valueB.mContent ) )
+            if( mDenom == _value.mDenom )
             {
-                typename IntegralType<T>::type a = carl::abs( carl::getNum( _valueA.rational() ) );
-                Numeric<T>::mFreeRationalIds.push_back( _valueA.mContent );
-                _valueA.mContent = std::abs( _valueB.mContent );
-                a = carl::mod( a, carl::fromInt<typename IntegralType<T>::type>(_valueA.mContent) );
-                if( a != 0 )
-                    Numeric<T>::gcd_( _valueA.mContent, carl::toInt<ContentType>( a ) );
+                // The sum of two native numerators does not overflow.
+                if( mDenom == 1 )
+                    assignInteger( mNum + _value.mNum );
+                else
+                    assignFraction( mNum + _value.mNum, mDenom );
+                return *this;
             }
-            else
+            ContentType lhs;
+            ContentType rhs;
+            ContentType num;
+            ContentType denom;
+            if( !numeric_detail::mul_overflow( mNum, _value.mDenom, lhs )
+                && !numeric_detail::mul_overflow( _value.mNum, mDenom, rhs )
+                && !numeric_detail::add_overflow( lhs, rhs, num )
+                && !numeric_detail::mul_overflow( mDenom, _value.mDenom, denom ) )
             {
-                _valueA.maybeIntegralize( carl::gcd( carl::getNum( _valueA.rational() ), carl::getNum( _valueB.rational() ) ) );
+                assignFraction( num, denom );
+                return *this;
             }
         }
-        return _valueA;
+        assign( toRational() + _value.toRational() );
+        return *this;
     }
-    
-    /**
-     * @param _valueA An integer.
-     * @param _valueB An integer.
-     * @result The quotient of the two given integer.
-     */
+
     template<typename T>
-    Numeric<T> div( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    Numeric<T>& Numeric<T>::operator-=( const Numeric<T>& _value )
     {
-        assert( isInteger( _valueA ) );
-        assert( isInteger( _valueB ) );
-        assert( abs( _valueA ) >= abs( _valueB ) );
-        if( IS_INT( _valueA.content() ) )
+        if( isNative() && _value.isNative() )
         {
-            assert( IS_INT( _valueB.content() ) );
-            return Numeric<T>(_valueA.content() / _valueB.content());
-        }
-        else
-        {
-            if( IS_INT( _valueB.content() ) )
+            if( mDenom == _value.mDenom )
             {
-                return Numeric<T>( carl::div( carl::getNum( _valueA.rational() ), carl::fromInt<typename IntegralType<T>::type>( _valueB.content() ) ) );
+                if( mDenom == 1 )
+                    assignInteger( mNum - _value.mNum );
+                else
+                    assignFraction( mNum - _value.mNum, mDenom );
+                return *this;
+            }
+            ContentType lhs;
+            ContentType rhs;
+            ContentType num;
+            ContentType denom;
+            if( !numeric_detail::mul_overflow( mNum, _value.mDenom, lhs )
+                && !numeric_detail::mul_overflow( _value.mNum, mDenom, rhs )
+                && !numeric_detail::sub_overflow( lhs, rhs, num )
+                && !numeric_detail::mul_overflow( mDenom, _value.mDenom, denom ) )
+            {
+                assignFraction( num, denom );
+                return *this;
             }
-            else
-                return Numeric<T>( carl::div( carl::getNum( _valueA.rational() ), carl::getNum( _valueB.rational() ) ) );
         }
+        assign( toRational() - _value.toRational() );
+        return *this;
     }
 
-    /**
-     * Calculates the absolute value of the given Numeric.
-     * @param _value The Numeric to calculate the Numeric for.
-     * @return The absolute value of the given Numeric.
-     */
     template<typename T>
-    Numeric<T> abs( const Numeric<T>& _value )
+    Numeric<T>& Numeric<T>::operator*=( const Numeric<T>& _value )
     {
-        if( IS_INT( _value.content() ) )
-        {
-            return Numeric<T>( std::abs( _value.content() ), true );
-        }
-        else
-        {
-            return Numeric<T>( carl::abs( _value.rational() ) ); 
-        }
+        if( isNative() && _value.isNative() )
+        {
+            if( mNum == 0 || _value.mNum == 0 )
+            {
+                assignInteger( 0 );
+                return *this;
+            }
+            // Cancel crosswise first, then the result is already normalized.
+            ContentType g1 = numeric_detail::gcd( mNum, _value.mDenom );
+            ContentType g2 = numeric_detail::gcd( _value.mNum, mDenom );
+            ContentType num;
+            ContentType denom;
+            if( !numeric_detail::mul_overflow( mNum / g1, _value.mNum / g2, num )
+                && !numeric_detail::mul_overflow( mDenom / g2, _value.mDenom / g1, denom ) )
+            {
+                if( numeric_detail::withinNativeRange( num ) && denom < HIGHTEST_INTEGER_VALUE )
+                {
+                    mNum = num;
+                    mDenom = denom;
+                }
+                else
+                {
+                    assign( carl::fromInt<T>( num ) / carl::fromInt<T>( denom ) );
+                }
+                return *this;
+            }
+        }
+        assign( toRational() * _value.toRational() );
+        return *this;
     }
 
-    /**
-     * Calculates the least common multiple of the two arguments.
-     * Note, that this method can only be applied to integers.
-     * @param _valueA An integer.
-     * @param _valueB An integer.
-     * @return The least common multiple of the two arguments.
-     */
     template<typename T>
-    Numeric<T> lcm( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    Numeric<T>& Numeric<T>::operator/=( const Numeric<T>& _value )
     {
-        assert( isInteger( _valueA ) );
-        assert( isInteger( _valueB ) );
-        if( IS_INT( _valueA.content() ) )
+        assert( !carl::isZero( _value ) );
+        if( _value.isNative() )
         {
-            if( IS_INT( _valueB.content() ) )
-            {
-                ContentType g = std::abs( _valueA.content() );
-                Numeric<T>::gcd_( g, std::abs( _valueB.content() ) );
-                return Numeric<T>( (std::abs(_valueA.content()*_valueB.content())/g) );
-            }
-            else
-                return Numeric<T>( carl::lcm( carl::fromInt<typename IntegralType<T>::type>( _valueA.content() ), carl::getNum( _valueB.rational() ) ) );
-        }
-        else
-        {
-            if( IS_INT( _valueB.content() ) )
-                return Numeric<T>( carl::lcm( carl::getNum( _valueA.rational() ), carl::fromInt<typename IntegralType<T>::type>( _valueB.content() ) ) );
-            else
-                return Numeric<T>( carl::lcm( carl::getNum( _valueA.rational() ), carl::getNum( _valueB.rational() ) ) );
+            // The reciprocal of a native value is native as well.
+            Numeric<T> inverse;
+            inverse.mNum = _value.mNum < 0 ? -_value.mDenom : _value.mDenom;
+            inverse.mDenom = _value.mNum < 0 ? -_value.mNum : _value.mNum;
+            return *this *= inverse;
         }
+        assign( toRational() / _value.rational() );
+        return *this;
     }
 
-    /**
-     * Calculates the greatest common divisor of the two arguments.
-     * Note, that this method can only be applied to integers.
-     * @param _valueA An integer.
-     * @param _valueB An integer.
-     * @return The least common divisor of the two arguments.
-     */
     template<typename T>
-    Numeric<T> gcd( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    Numeric<T>& Numeric<T>::operator++()
     {
-        Numeric<T> result( _valueA );
-        return gcd_assign( result, _valueB );
-    }
-    
-    /**
-     * Calculates the sum of the two given Numerics.
-     * @param _valueA The first summand.
-     * @param _valueB The second summand.
-     * @return The sum of the two given Numerics.
-     */
-    template<typename T>
-    Numeric<T> operator+( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
-    {
-        Numeric<T> result( _valueA );
-        result += _valueB;
-        return result;
+        return *this += Numeric<T>( 1 );
     }
 
-    /**
-     * Calculates the difference between the two given Numerics.
-     * @param _valueA The minuend.
-     * @param _valueB The subtrahend.
-     * @return The difference between the two given Numerics.
-     */
     template<typename T>
-    Numeric<T> operator-( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    Numeric<T>& Numeric<T>::operator--()
     {
-        Numeric<T> result( _valueA );
-        result -= _valueB;
-        return result;
+        return *this -= Numeric<T>( 1 );
     }
 
-    /**
-     * Calculates the product of the two given Numerics.
-     * @param _valueA The first factor.
-     * @param _valueB The second factor.
-     * @return The product of the two given Numerics.
-     */
     template<typename T>
-    Numeric<T> operator*( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    Numeric<T> Numeric<T>::operator-() const
     {
-        Numeric<T> result( _valueA );
-        result *= _valueB;
+        Numeric<T> result;
+        if( isNative() )
+        {
+            result.mNum = -mNum;
+            result.mDenom = mDenom;
+        }
+        else
+        {
+            result.assign( T( -*mRational ) );
+        }
         return result;
     }
 
-    /**
-     * Calculates the division of the two given Numerics.
-     * @param _valueA The dividend.
-     * @param _valueB The divisor.
-     * @return The difference of the two given Numerics.
-     */
     template<typename T>
-    Numeric<T> operator/( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    Numeric<T> abs( const Numeric<T>& _value )
     {
-        Numeric<T> result( _valueA );
-        result /= _valueB;
-        return result;
+        return carl::isNegative( _value ) ? -_value : _value;
     }
-    
-    /**
-     * Adds the value of the second given Numeric to the second given Numeric.
-     * @param _valueA The Numeric to add to.
-     * @param _valueB The Numeric to add.
-     * @return The first given Numeric increased by the second given Numeric.
-     */
+
     template<typename T>
-    Numeric<T>& operator+=( Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    typename IntegralType<T>::type floor( const Numeric<T>& _value )
     {
-        if( IS_INT( _valueA.mContent ) )
+        if( _value.isNative() )
         {
-            if( IS_INT( _valueB.mContent ) )
-            {
-                _valueA.mContent += _valueB.mContent;
-                _valueA.maybeRationalize();
-            }
-            else
-            {
-                T rat = _valueB.rational();
-                rat += fromInt<T>(_valueA.mContent);
-                _valueA.maybeRationalize( rat );
-            }
+            ContentType num = _value.nativeNumerator();
+            ContentType denom = _value.nativeDenominator();
+            ContentType res = num / denom;
+            if( num % denom != 0 && num < 0 )
+                --res;
+            return carl::fromInt<typename IntegralType<T>::type>( res );
         }
-        else
-        {
-            T& rat = _valueA.rRational();
-            if( IS_INT( _valueB.mContent ) )
-            {
-                rat += fromInt<T>(_valueB.mContent);
-            }
-            else
-            {
-                rat += _valueB.rational();
-            }
-            _valueA.maybeIntegralize( rat );
-        }
-        return _valueA;
+        return carl::floor( _value.rational() );
     }
 
-    /**
-     * Subtracts the second given Numeric to the first given Numeric.
-     * @param _valueA The Numeric to subtract from.
-     * @param _valueB The Numeric to subtract.
-     * @return The first given Numeric subtracted by the second given Numeric.
-     */
     template<typename T>
-    Numeric<T>& operator-=( Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    typename IntegralType<T>::type ceil( const Numeric<T>& _value )
     {
-        if( IS_INT( _valueA.mContent ) )
-        {
-            if( IS_INT( _valueB.mContent ) )
-            {
-                _valueA.mContent -= _valueB.mContent;
-                _valueA.maybeRationalize();
-            }
-            else
-            {
-                T rat = -_valueB.rational();
-                rat += carl::fromInt<T>(_valueA.mContent);
-                _valueA.maybeRationalize( rat );
-            }
-        }
-        else
+        if( _value.isNative() )
         {
-            T& rat = _valueA.rRational();
-            if( IS_INT( _valueB.mContent ) )
-            {
-                rat -= carl::fromInt<T>(_valueB.mContent);
-            }
-            else
-            {
-                rat -= _valueB.rational();
-            }
-            _valueA.maybeIntegralize( rat );
+            ContentType num = _value.nativeNumerator();
+            ContentType denom = _value.nativeDenominator();
+            ContentType res = num / denom;
+            if( num % denom != 0 && num > 0 )
+                ++res;
+            return carl::fromInt<typename IntegralType<T>::type>( res );
         }
-        return _valueA;
+        return carl::ceil( _value.rational() );
     }
 
     /**
-     * Multiplies the second given Numeric to the first given Numeric.
-     * @param _valueA The Numeric to multiply.
-     * @param _valueB The Numeric to multiply by.
-     * @return The first given Numeric multiplied by the second given Numeric.
+     * Calculates the greatest common divisor of two fractions, that is the gcd of the numerators divided by the lcm of the denominators.
      */
     template<typename T>
-    Numeric<T>& operator*=( Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    Numeric<T> gcd( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
     {
-        if( IS_INT( _valueA.mContent ) )
+        if( _valueA.isNative() && _valueB.isNative() )
         {
-            if( IS_INT( _valueB.mContent ) )
-            {
-                _valueA.mContent *= _valueB.mContent;
-                _valueA.maybeRationalize();
-            }
-            else
-            {
-                T rat = _valueB.rational();
-                rat *= carl::fromInt<T>(_valueA.mContent);
-                _valueA.maybeRationalize( rat );
-            }
-        }
-        else
-        {
-            T& rat = _valueA.rRational();
-            if( IS_INT( _valueB.mContent ) )
-            {
-                rat *= carl::fromInt<T>(_valueB.mContent);
-            }
-            else
-            {
-                rat *= _valueB.rational();
-            }
-            _valueA.maybeIntegralize( rat );
+            ContentType num = numeric_detail::gcd( _valueA.nativeNumerator(), _valueB.nativeNumerator() );
+            ContentType g = numeric_detail::gcd( _valueA.nativeDenominator(), _valueB.nativeDenominator() );
+            ContentType denom;
+            if( !numeric_detail::mul_overflow( _valueA.nativeDenominator() / g, _valueB.nativeDenominator(), denom ) )
+                return Numeric<T>( num, denom );
         }
-        return _valueA;
+        return Numeric<T>( carl::gcd( _valueA.toRational(), _valueB.toRational() ) );
     }
 
-    /**
-     * Divides the first given Numeric by the second given Numeric.
-     * @param _valueA The Numeric to divide.
-     * @param _valueB The Numeric to divide by.
-     * @return The first given Numeric divided by the second given Numeric.
-     */
     template<typename T>
-    Numeric<T>& operator/=( Numeric<T>& _valueA, const Numeric<T>& _valueB )
+    Numeric<T>& gcd_assign( Numeric<T>& _valueA, const Numeric<T>& _valueB )
     {
-        if( IS_INT( _valueA.mContent ) )
-        {
-            T rat = carl::fromInt<T>(_valueA.mContent);
-            if( IS_INT( _valueB.mContent ) )
-            {
-                rat /= carl::fromInt<T>(_valueB.mContent);
-            }
-            else
-            {
-                rat /= _valueB.rational();
-            }
-            _valueA.maybeRationalize( rat );
-        }
-        else
-        {
-            T& rat = _valueA.rRational();
-            if( IS_INT( _valueB.mContent ) )
-            {
-                rat /= carl::fromInt<T>(_valueB.mContent);
-            }
-            else
-            {
-                rat /= _valueB.rational();
-            }
-            _valueA.maybeIntegralize( rat );
-        }
+        _valueA = carl::gcd( _valueA, _valueB );
         return _valueA;
     }
 
     /**
-     * Calculates the additive inverse of the given Numeric.
-     * @param _value The Numeric to calculate the additive inverse for.
-     * @return The additive inverse of the given Numeric.
+     * Calculates the least common multiple of two fractions, that is the lcm of the numerators divided by the gcd of the denominators.
      */
     template<typename T>
-    Numeric<T> operator-( const Numeric<T>& _value )
+    Numeric<T> lcm( const Numeric<T>& _valueA, const Numeric<T>& _valueB )
     {
-        if( IS_INT( _value.content() ) )
-            return Numeric<T>( -_value.content(), true );
-        else
-            return Numeric<T>( -_value.rational() );
+        if( _valueA.isNative() && _valueB.isNative() )
+        {
+            ContentType g = numeric_detail::gcd( _valueA.nativeNumerator(), _valueB.nativeNumerator() );
+            if( g == 0 )
+                return Numeric<T>( 0 );
+            ContentType num;
+            if( !numeric_detail::mul_overflow( _valueA.nativeNumerator() / g, _valueB.nativeNumerator(), num ) )
+                return carl::abs( Numeric<T>( num, numeric_detail::gcd( _valueA.nativeDenominator(), _valueB.nativeDenominator() ) ) );
+        }
+        return Numeric<T>( carl::lcm( _valueA.toRational(), _valueB.toRational() ) );
     }
 
-    /**
-     * Increments the given Numeric by one.
-     * @param _value The Numeric to increment.
-     * @return The given Numeric incremented by one.
-     */
     template<typename T>
-    Numeric<T>& operator++( Numeric<T>& _value )
+    Numeric<T> pow( const Numeric<T>& _basis, std::size_t _exp )
     {
-        if( IS_INT( _value.mContent ) )
+        Numeric<T> res( 1 );
+        Numeric<T> mult( _basis );
+        for( std::size_t e = _exp; e > 0; e /= 2 )
         {
-            ++(_value.mContent);
-            _value.maybeRationalize();
+            if( e & std::size_t(1) )
+                res *= mult;
+            if( e > 1 )
+                mult *= mult;
         }
-        else
-        {
-            ++(_value.rRational());
-            _value.maybeIntegralize();
-        }
-        return _value;
+        return res;
     }
 
-    /**
-     * Decrements the given Numeric by one.
-     * @param _value The Numeric to decrement.
-     * @return The given Numeric decremented by one.
-     */
     template<typename T>
-    Numeric<T>& operator--( Numeric<T>& _value )
+    Numeric<T> reciprocal( const Numeric<T>& _value )
     {
-        if( IS_INT( _value.mContent ) )
-        {
-            --(_value.mContent);
-            _value.maybeRationalize();
-        }
-        else
-        {
-            --(_value.rRational());
-            _value.maybeIntegralize();
-        }
-        return _value;
+        return Numeric<T>( 1 ) / _value;
     }
 
-    /**
-     * Prints the given Numerics representation on the given output stream.
-     * @param _out The output stream to print on.
-     * @param _value The Numeric to print.
-     * @return The output stream after printing the given Numerics representation on it.
-     */
     template<typename T>
     std::ostream& operator <<( std::ostream& _out, const Numeric<T>& _value )
     {
-        if( IS_INT( _value.content() ) )
-            _out << _value.content();
+        if( _value.isNative() )
+        {
+            _out << _value.nativeNumerator();
+            if( _value.nativeDenominator() != 1 )
+                _out << "/" << _value.nativeDenominator();
+        }
         else
             _out << _value.rational();
         return _out;
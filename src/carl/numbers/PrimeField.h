@@ -0,0 +1,365 @@
+/**
+ * @file PrimeField.h
+ *
+ * Prime fields whose elements fit into a single machine word.
+ */
+
+#pragma once
+
+#include "../util/Singleton.h"
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * The prime field Z_p for an odd prime p < 2^63.
+ *
+ * Elements are machine words in Montgomery form, i.e. a is represented by a*R mod p with R = 2^64.
+ * Thereby, a multiplication only needs a Montgomery reduction instead of a division by p.
+ * Besides arithmetic on single elements, this class provides kernels for dense univariate polynomials,
+ * given as vectors of elements in Montgomery form with the constant coefficient first.
+ *
+ * The class is a literal type, hence a field for a modulus known at compile time is set up by the compiler.
+ * @see PrimeFieldNumber for a coefficient type based on this class.
+ */
+class PrimeField {
+public:
+	using Word = std::uint64_t;
+	using SignedWord = std::int64_t;
+	using Polynomial = std::vector<Word>;
+private:
+	/// The modulus.
+	Word mP;
+	/// -p^{-1} mod R.
+	Word mPInv;
+	/// R mod p, the Montgomery form of one.
+	Word mOne;
+	/// R^2 mod p, used to convert into Montgomery form.
+	Word mR2;
+
+	static constexpr Word negatedInverse(Word p) {
+		// Newton iteration, p is its own inverse modulo 2^3 and every step doubles the number of correct bits.
+		Word inv = p;
+		for (int i = 0; i < 5; ++i) {
+			inv *= Word(2) - p * inv;
+		}
+		return Word(0) - inv;
+	}
+
+	/// Computes a*b mod p by doubling, only used to set up the field.
+	static constexpr Word mulModSlow(Word a, Word b, Word p) noexcept {
+		Word res = 0;
+		for (; b > 0; b >>= 1) {
+			if (b & 1) {
+				res += a;
+				if (res >= p) res -= p;
+			}
+			a += a;
+			if (a >= p) a -= p;
+		}
+		return res;
+	}
+public:
+	/**
+	 * Creates the field Z_p.
+	 * @param p An odd prime below 2^63.
+	 */
+	explicit constexpr PrimeField(Word p):
+		mP(p),
+		mPInv(negatedInverse(p)),
+		mOne((Word(0) - p) % p),
+		mR2(mulModSlow((Word(0) - p) % p, (Word(0) - p) % p, p))
+	{
+		assert(p % 2 == 1 && p < (Word(1) << 63));
+	}
+
+	/**
+	 * @return The modulus p.
+	 */
+	constexpr Word p() const noexcept {
+		return mP;
+	}
+
+	/**
+	 * @return One in Montgomery form.
+	 */
+	constexpr Word one() const noexcept {
+		return mOne;
+	}
+
+	/**
+	 * Computes the full product of two words.
+	 * @return The low word of a*b, the high word is stored in hi.
+	 */
+	static constexpr Word mulWide(Word a, Word b, Word& hi) noexcept {
+#ifdef __SIZEOF_INT128__
+		__extension__ using DoubleWord = unsigned __int128;
+		DoubleWord t = DoubleWord(a) * b;
+		hi = Word(t >> 64);
+		return Word(t);
+#else
+		Word mask = 0xffffffff;
+		Word ll = (a & mask) * (b & mask);
+		Word lh = (a & mask) * (b >> 32);
+		Word hl = (a >> 32) * (b & mask);
+		Word mid = (ll >> 32) + (lh & mask) + (hl & mask);
+		hi = (a >> 32) * (b >> 32) + (lh >> 32) + (hl >> 32) + (mid >> 32);
+		return (mid << 32) | (ll & mask);
+#endif
+	}
+
+	/**
+	 * Montgomery reduction.
+	 * @param lo The low word of a number t less than p*R.
+	 * @param hi The high word of t.
+	 * @return t/R mod p.
+	 */
+	constexpr Word reduce(Word lo, Word hi = 0) const noexcept {
+		Word mpHi = 0;
+		Word mpLo = mulWide(lo * mPInv, mP, mpHi);
+		// lo + mpLo is a multiple of R, hence only its carry is needed.
+		Word res = hi + mpHi + Word(lo + mpLo < lo);
+		return res >= mP ? res - mP : res;
+	}
+
+	/**
+	 * Converts an arbitrary word into Montgomery form.
+	 */
+	constexpr Word toMontgomery(Word a) const noexcept {
+		Word hi = 0;
+		Word lo = mulWide(a % mP, mR2, hi);
+		return reduce(lo, hi);
+	}
+
+	/**
+	 * Converts an arbitrary signed word into Montgomery form.
+	 */
+	constexpr Word fromInt(SignedWord a) const noexcept {
+		if (a >= 0) return toMontgomery(Word(a));
+		return neg(toMontgomery(Word(0) - Word(a)));
+	}
+
+	/**
+	 * Converts from Montgomery form into the canonical representative in [0,p).
+	 */
+	constexpr Word fromMontgomery(Word a) const noexcept {
+		return reduce(a);
+	}
+
+	/**
+	 * Converts from Montgomery form into the symmetric representative in (-p/2,p/2], as used by GaloisField.
+	 */
+	constexpr SignedWord symmetric(Word a) const noexcept {
+		Word c = fromMontgomery(a);
+		return c > mP / 2 ? -SignedWord(mP - c) : SignedWord(c);
+	}
+
+	constexpr Word add(Word a, Word b) const noexcept {
+		Word s = a + b;
+		return s >= mP ? s - mP : s;
+	}
+
+	constexpr Word sub(Word a, Word b) const noexcept {
+		return a >= b ? a - b : a + (mP - b);
+	}
+
+	constexpr Word neg(Word a) const noexcept {
+		return a == 0 ? 0 : mP - a;
+	}
+
+	constexpr Word mul(Word a, Word b) const noexcept {
+		Word hi = 0;
+		Word lo = mulWide(a, b, hi);
+		return reduce(lo, hi);
+	}
+
+	constexpr Word pow(Word a, std::size_t exp) const noexcept {
+		Word res = mOne;
+		for (; exp > 0; exp /= 2) {
+			if (exp & 1) res = mul(res, a);
+			a = mul(a, a);
+		}
+		return res;
+	}
+
+	/**
+	 * Computes the multiplicative inverse with the extended euclidean algorithm.
+	 * @param a A nonzero element in Montgomery form.
+	 * @return The inverse in Montgomery form.
+	 */
+	constexpr Word inverse(Word a) const noexcept {
+		assert(a != 0);
+		SignedWord t = 0;
+		SignedWord newt = 1;
+		Word r = mP;
+		Word newr = fromMontgomery(a);
+		while (newr != 0) {
+			Word q = r / newr;
+			SignedWord tmp = t - SignedWord(q) * newt;
+			t = newt;
+			newt = tmp;
+			Word rtmp = r - q * newr;
+			r = newr;
+			newr = rtmp;
+		}
+		assert(r == 1);
+		return fromInt(t);
+	}
+
+	/// @name Kernels for dense polynomials
+	/// The loops are free of data dependent branches, such that the compiler can vectorize them.
+	/// @{
+
+	/**
+	 * Removes leading zero coefficients.
+	 */
+	static void trim(Polynomial& a) {
+		while (!a.empty() && a.back() == 0) a.pop_back();
+	}
+
+	/**
+	 * Computes a += b.
+	 */
+	void addAssign(Polynomial& a, const Polynomial& b) const {
+		if (a.size() < b.size()) a.resize(b.size(), 0);
+		for (std::size_t i = 0; i < b.size(); ++i) {
+			a[i] = add(a[i], b[i]);
+		}
+		trim(a);
+	}
+
+	/**
+	 * Computes a -= b.
+	 */
+	void subAssign(Polynomial& a, const Polynomial& b) const {
+		if (a.size() < b.size()) a.resize(b.size(), 0);
+		for (std::size_t i = 0; i < b.size(); ++i) {
+			a[i] = sub(a[i], b[i]);
+		}
+		trim(a);
+	}
+
+	/**
+	 * Computes a *= s for a scalar s.
+	 */
+	void scaleAssign(Polynomial& a, Word s) const {
+		for (auto& c: a) {
+			c = mul(c, s);
+		}
+		trim(a);
+	}
+
+	/**
+	 * Computes y[i + offset] += s * x[i], y must be large enough.
+	 */
+	void axpy(Polynomial& y, Word s, const Polynomial& x, std::size_t offset = 0) const {
+		assert(y.size() >= x.size() + offset);
+		Word* dest = y.data() + offset;
+		for (std::size_t i = 0; i < x.size(); ++i) {
+			dest[i] = add(dest[i], mul(s, x[i]));
+		}
+	}
+
+	/**
+	 * Computes the product of two polynomials.
+	 */
+	Polynomial multiply(const Polynomial& a, const Polynomial& b) const {
+		if (a.empty() || b.empty()) return Polynomial();
+		Polynomial res(a.size() + b.size() - 1, 0);
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			if (a[i] != 0) axpy(res, a[i], b, i);
+		}
+		trim(res);
+		return res;
+	}
+
+	/**
+	 * Divides a by b with remainder.
+	 * @param a Dividend, is replaced by the remainder.
+	 * @param b Divisor, must not be zero and must not have leading zeros.
+	 * @return The quotient.
+	 */
+	Polynomial divide(Polynomial& a, const Polynomial& b) const {
+		assert(!b.empty() && b.back() != 0);
+		trim(a);
+		if (a.size() < b.size()) return Polynomial();
+		Polynomial q(a.size() - b.size() + 1, 0);
+		Word lcInv = inverse(b.back());
+		for (std::size_t i = q.size(); i-- > 0;) {
+			Word c = mul(a[i + b.size() - 1], lcInv);
+			q[i] = c;
+			if (c != 0) axpy(a, neg(c), b, i);
+		}
+		a.resize(b.size() - 1);
+		trim(a);
+		return q;
+	}
+
+	/**
+	 * Computes the monic greatest common divisor of two polynomials.
+	 */
+	Polynomial gcd(Polynomial a, Polynomial b) const {
+		trim(a);
+		trim(b);
+		while (!b.empty()) {
+			divide(a, b);
+			std::swap(a, b);
+		}
+		if (!a.empty()) scaleAssign(a, inverse(a.back()));
+		return a;
+	}
+
+	/**
+	 * Evaluates a polynomial at the given point using the Horner scheme.
+	 */
+	Word evaluate(const Polynomial& a, Word x) const noexcept {
+		Word res = 0;
+		for (std::size_t i = a.size(); i-- > 0;) {
+			res = add(mul(res, x), a[i]);
+		}
+		return res;
+	}
+
+	/// @}
+
+	friend constexpr bool operator==(const PrimeField& lhs, const PrimeField& rhs) {
+		return lhs.mP == rhs.mP;
+	}
+	friend constexpr bool operator!=(const PrimeField& lhs, const PrimeField& rhs) {
+		return lhs.mP != rhs.mP;
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const PrimeField& rhs) {
+		return os << "GF(" << rhs.mP << ")";
+	}
+};
+
+/**
+ * Hands out prime fields for moduli only known at runtime, such that every field is only set up once.
+ * The returned pointers stay valid and can be shared between threads.
+ */
+class PrimeFieldManager: public Singleton<PrimeFieldManager> {
+private:
+	std::unordered_map<PrimeField::Word, std::unique_ptr<PrimeField>> mFields;
+	std::mutex mMutex;
+public:
+	const PrimeField* getField(PrimeField::Word p) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		auto& field = mFields[p];
+		if (!field) {
+			field = std::make_unique<PrimeField>(p);
+		}
+		return field.get();
+	}
+};
+
+}
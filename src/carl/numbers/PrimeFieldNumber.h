@@ -0,0 +1,378 @@
+/**
+ * @file PrimeFieldNumber.h
+ *
+ * Elements of prime fields with a word-size modulus.
+ */
+
+#pragma once
+
+#include "GFNumber.h"
+#include "PrimeField.h"
+#include "numbers.h"
+
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace carl
+{
+
+namespace prime_field_detail
+{
+	/// Provides the field of a PrimeFieldNumber whose modulus is known at compile time.
+	template<PrimeField::Word P>
+	class FieldStorage {
+	protected:
+		static constexpr PrimeField mStaticField = PrimeField(P);
+		FieldStorage() = default;
+		explicit FieldStorage(const PrimeField* field) {
+			assert(field == nullptr || field->p() == P);
+		}
+		void setField(const PrimeField* field) {
+			assert(field == nullptr || field->p() == P);
+		}
+	public:
+		const PrimeField* field() const noexcept {
+			return &mStaticField;
+		}
+	};
+
+	/// Provides the field of a PrimeFieldNumber whose modulus is only known at runtime.
+	template<>
+	class FieldStorage<0> {
+	protected:
+		const PrimeField* mField = nullptr;
+		FieldStorage() = default;
+		explicit FieldStorage(const PrimeField* field): mField(field) {}
+		void setField(const PrimeField* field) {
+			mField = field;
+		}
+	public:
+		const PrimeField* field() const noexcept {
+			return mField;
+		}
+	};
+}
+
+/**
+ * An element of a prime field Z_p with an odd prime p < 2^63 that is stored in a single machine word.
+ *
+ * This is a fast alternative to GFNumber for modular algorithms.
+ * The modulus is either given at compile time as template argument,
+ * or at runtime by a PrimeField obtained from the PrimeFieldManager, if the template argument is zero.
+ * The value is kept in Montgomery form, see PrimeField.
+ *
+ * Similar to GFNumber, a number with a runtime modulus may not know its field yet, for example constants like zero and one.
+ * Such a number represents an integer and adopts the field of the other operand in arithmetic operations.
+ * Arithmetic on such integers wraps around modulo 2^64.
+ */
+template<PrimeField::Word P = 0>
+class PrimeFieldNumber: public prime_field_detail::FieldStorage<P>
+{
+public:
+	using Word = PrimeField::Word;
+	using SignedWord = PrimeField::SignedWord;
+private:
+	using Storage = prime_field_detail::FieldStorage<P>;
+	/// The value in Montgomery form, or the integer itself if the field is unknown.
+	Word mValue = 0;
+
+	PrimeFieldNumber(Word value, const PrimeField* field, bool /*raw*/):
+		Storage(field),
+		mValue(value)
+	{}
+
+	/**
+	 * Lets both numbers agree on a field, i.e. a number without a field adopts the field of the other one.
+	 * @return The common field, or nullptr if both are integers.
+	 */
+	static const PrimeField* unify(PrimeFieldNumber& lhs, const PrimeFieldNumber& rhs) {
+		if (lhs.field() == nullptr && rhs.field() != nullptr) {
+			lhs.mValue = rhs.field()->fromInt(SignedWord(lhs.mValue));
+			lhs.setField(rhs.field());
+		}
+		assert(rhs.field() == nullptr || *lhs.field() == *rhs.field());
+		return lhs.field();
+	}
+
+	/// Returns the value of rhs in Montgomery form of the given field.
+	static Word valueIn(const PrimeField* field, const PrimeFieldNumber& rhs) {
+		return rhs.field() == nullptr ? field->fromInt(SignedWord(rhs.mValue)) : rhs.mValue;
+	}
+public:
+	PrimeFieldNumber() = default;
+
+	/**
+	 * Creates the given integer, if the modulus is given at compile time.
+	 * For a runtime modulus, the number has no field until it is combined with another number.
+	 */
+	template<typename Integer, EnableIf<std::is_integral<Integer>> = dummy>
+	PrimeFieldNumber(Integer n): // NOLINT
+		mValue(this->field() == nullptr ? Word(SignedWord(n)) : fromInteger(this->field(), n))
+	{}
+
+	/**
+	 * Creates the given integer modulo the given field.
+	 */
+	template<typename Integer, EnableIf<std::is_integral<Integer>> = dummy>
+	PrimeFieldNumber(Integer n, const PrimeField* field):
+		Storage(field),
+		mValue(fromInteger(this->field(), n))
+	{
+		assert(field != nullptr);
+	}
+
+	/**
+	 * Creates a number from a value that is already in Montgomery form.
+	 */
+	static PrimeFieldNumber fromMontgomery(Word value, const PrimeField* field = nullptr) {
+		PrimeFieldNumber res(value, field, true);
+		assert(res.field() != nullptr);
+		return res;
+	}
+
+	template<typename Integer>
+	static Word fromInteger(const PrimeField* field, Integer n) {
+		if (std::is_signed<Integer>::value) return field->fromInt(SignedWord(n));
+		return field->toMontgomery(Word(n));
+	}
+
+	/**
+	 * @return The value in Montgomery form.
+	 */
+	Word montgomery() const {
+		assert(this->field() != nullptr);
+		return mValue;
+	}
+
+	/**
+	 * @return The canonical representative in [0,p).
+	 */
+	Word value() const {
+		if (this->field() == nullptr) return mValue;
+		return this->field()->fromMontgomery(mValue);
+	}
+
+	/**
+	 * @return The symmetric representative in (-p/2,p/2], as used by GFNumber.
+	 */
+	SignedWord symmetricValue() const {
+		if (this->field() == nullptr) return SignedWord(mValue);
+		return this->field()->symmetric(mValue);
+	}
+
+	bool isZero() const {
+		return mValue == 0;
+	}
+
+	bool isOne() const {
+		if (this->field() == nullptr) return mValue == 1;
+		return mValue == this->field()->one();
+	}
+
+	PrimeFieldNumber inverse() const {
+		assert(!isZero());
+		if (this->field() == nullptr) {
+			assert(mValue == 1 || SignedWord(mValue) == -1);
+			return *this;
+		}
+		return PrimeFieldNumber(this->field()->inverse(mValue), this->field(), true);
+	}
+
+	PrimeFieldNumber operator-() const {
+		if (this->field() == nullptr) return PrimeFieldNumber(Word(0) - mValue, nullptr, true);
+		return PrimeFieldNumber(this->field()->neg(mValue), this->field(), true);
+	}
+
+	PrimeFieldNumber& operator+=(const PrimeFieldNumber& rhs) {
+		const PrimeField* f = unify(*this, rhs);
+		if (f == nullptr) mValue += rhs.mValue;
+		else mValue = f->add(mValue, valueIn(f, rhs));
+		return *this;
+	}
+	PrimeFieldNumber& operator-=(const PrimeFieldNumber& rhs) {
+		const PrimeField* f = unify(*this, rhs);
+		if (f == nullptr) mValue -= rhs.mValue;
+		else mValue = f->sub(mValue, valueIn(f, rhs));
+		return *this;
+	}
+	PrimeFieldNumber& operator*=(const PrimeFieldNumber& rhs) {
+		const PrimeField* f = unify(*this, rhs);
+		if (f == nullptr) mValue *= rhs.mValue;
+		else mValue = f->mul(mValue, valueIn(f, rhs));
+		return *this;
+	}
+	PrimeFieldNumber& operator/=(const PrimeFieldNumber& rhs) {
+		assert(!rhs.isZero());
+		const PrimeField* f = unify(*this, rhs);
+		if (f == nullptr) return *this *= rhs.inverse();
+		mValue = f->mul(mValue, f->inverse(valueIn(f, rhs)));
+		return *this;
+	}
+	PrimeFieldNumber& operator++() {
+		return *this += PrimeFieldNumber(1);
+	}
+	PrimeFieldNumber& operator--() {
+		return *this -= PrimeFieldNumber(1);
+	}
+
+	friend PrimeFieldNumber operator+(PrimeFieldNumber lhs, const PrimeFieldNumber& rhs) {
+		return lhs += rhs;
+	}
+	friend PrimeFieldNumber operator-(PrimeFieldNumber lhs, const PrimeFieldNumber& rhs) {
+		return lhs -= rhs;
+	}
+	friend PrimeFieldNumber operator*(PrimeFieldNumber lhs, const PrimeFieldNumber& rhs) {
+		return lhs *= rhs;
+	}
+	friend PrimeFieldNumber operator/(PrimeFieldNumber lhs, const PrimeFieldNumber& rhs) {
+		return lhs /= rhs;
+	}
+
+	/**
+	 * An integer without a field equals a field element only if it is its symmetric representative.
+	 * This keeps equality consistent with the hash, which does not know about fields.
+	 */
+	friend bool operator==(const PrimeFieldNumber& lhs, const PrimeFieldNumber& rhs) {
+		if (lhs.field() == rhs.field()) return lhs.mValue == rhs.mValue;
+		if (lhs.field() == nullptr || rhs.field() == nullptr) return lhs.symmetricValue() == rhs.symmetricValue();
+		return *lhs.field() == *rhs.field() && lhs.mValue == rhs.mValue;
+	}
+	friend bool operator!=(const PrimeFieldNumber& lhs, const PrimeFieldNumber& rhs) {
+		return !(lhs == rhs);
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const PrimeFieldNumber& rhs) {
+		os << "(" << rhs.symmetricValue() << ") mod ";
+		if (rhs.field() != nullptr) {
+			os << rhs.field()->p();
+		} else {
+			os << "?";
+		}
+		return os;
+	}
+
+	/**
+	 * Converts coefficients to the dense representation used by the polynomial kernels of PrimeField.
+	 */
+	static PrimeField::Polynomial toDense(const std::vector<PrimeFieldNumber>& coeffs, const PrimeField* field) {
+		PrimeField::Polynomial res;
+		res.reserve(coeffs.size());
+		for (const auto& c: coeffs) {
+			res.push_back(valueIn(field, c));
+		}
+		PrimeField::trim(res);
+		return res;
+	}
+
+	/**
+	 * Converts the dense representation used by the polynomial kernels of PrimeField back to coefficients.
+	 */
+	static std::vector<PrimeFieldNumber> fromDense(const PrimeField::Polynomial& dense, const PrimeField* field) {
+		std::vector<PrimeFieldNumber> res;
+		res.reserve(dense.size());
+		for (auto c: dense) {
+			res.push_back(fromMontgomery(c, field));
+		}
+		return res;
+	}
+};
+
+template<PrimeField::Word P>
+inline bool isZero(const PrimeFieldNumber<P>& n) {
+	return n.isZero();
+}
+
+template<PrimeField::Word P>
+inline bool isOne(const PrimeFieldNumber<P>& n) {
+	return n.isOne();
+}
+
+template<PrimeField::Word P>
+inline PrimeFieldNumber<P> quotient(const PrimeFieldNumber<P>& lhs, const PrimeFieldNumber<P>& rhs) {
+	return lhs / rhs;
+}
+
+template<PrimeField::Word P>
+inline PrimeFieldNumber<P> abs(const PrimeFieldNumber<P>& n) {
+	return n;
+}
+
+template<PrimeField::Word P>
+inline bool isInteger(const PrimeFieldNumber<P>& /*unused*/) {
+	return false;
+}
+
+template<PrimeField::Word P>
+inline std::string toString(const PrimeFieldNumber<P>& _number, bool /*unused*/) {
+	std::stringstream s;
+	s << _number;
+	return s.str();
+}
+
+/**
+ * Converts a prime field number to a GFNumber over the given field, which must be Z_p for the same p.
+ */
+template<typename IntegerType, PrimeField::Word P>
+GFNumber<IntegerType> toGFNumber(const PrimeFieldNumber<P>& n, const GaloisField<IntegerType>* gf) {
+	assert(gf != nullptr && gf->k() == 1);
+	assert(n.field() == nullptr || n.field()->p() == gf->p());
+	return GFNumber<IntegerType>(carl::fromInt<IntegerType>(sint(n.symmetricValue())), gf);
+}
+
+/**
+ * Converts a GFNumber over some Z_p to a prime field number.
+ * If the modulus is only known at runtime, the field is obtained from the PrimeFieldManager.
+ */
+template<PrimeField::Word P = 0, typename IntegerType>
+PrimeFieldNumber<P> toPrimeFieldNumber(const GFNumber<IntegerType>& n) {
+	if (n.gf() == nullptr) {
+		return PrimeFieldNumber<P>(carl::toInt<sint>(n.representingInteger()));
+	}
+	assert(n.gf()->k() == 1);
+	const PrimeField* field = PrimeFieldNumber<P>().field();
+	if (field == nullptr) {
+		field = PrimeFieldManager::getInstance().getField(n.gf()->p());
+	}
+	return PrimeFieldNumber<P>(carl::toInt<sint>(n.gf()->symmetricModulo(n.representingInteger())), field);
+}
+
+/**
+ * @ingroup typetraits_is_field
+ */
+template<PrimeField::Word P>
+struct is_field<PrimeFieldNumber<P>>: std::true_type {};
+
+/**
+ * @ingroup typetraits_is_number
+ */
+template<PrimeField::Word P>
+struct is_number<PrimeFieldNumber<P>>: std::true_type {};
+
+/**
+ * The characteristic is only known at compile time for a static modulus.
+ */
+template<PrimeField::Word P>
+struct characteristic<PrimeFieldNumber<P>> {
+	static_assert(P != 0, "The characteristic of a runtime prime field is only known at runtime.");
+	static constexpr uint value = uint(P);
+};
+
+template<PrimeField::Word P>
+struct IntegralType<PrimeFieldNumber<P>> {
+	using type = sint;
+};
+
+}
+
+namespace std {
+
+template<carl::PrimeField::Word P>
+struct hash<carl::PrimeFieldNumber<P>> {
+	std::size_t operator()(const carl::PrimeFieldNumber<P>& n) const {
+		return std::hash<carl::PrimeField::SignedWord>()(n.symmetricValue());
+	}
+};
+
+}
@@ -33,10 +33,10 @@ namespace boost { namespace spirit { namespace traits {
 			n /= carl::pow(mpq_class(10), unsigned(-exp));
 	}
 #endif
-	template<> inline bool is_equal_to_one(const mpz_class& value) {
+	inline bool is_equal_to_one(const mpz_class& value) {
 		return carl::isOne(value);
 	}
-	template<> inline bool is_equal_to_one(const mpq_class& value) {
+	inline bool is_equal_to_one(const mpq_class& value) {
 		return carl::isOne(value);
 	}
 }}}
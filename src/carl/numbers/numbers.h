@@ -62,6 +62,8 @@ namespace carl {
 
 #include "GaloisField.h"
 #include "GFNumber.h"
+#include "PrimeField.h"
+#include "PrimeFieldNumber.h"
 #include "Numeric.h"
 
 #include "conversion/conversion.h"
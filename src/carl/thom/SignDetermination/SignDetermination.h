@@ -16,6 +16,7 @@
 #include <cmath>
 #include <iterator>
 #include <list>
+#include <numeric>
 #include <queue>
 
 
@@ -39,6 +40,8 @@ private:
 	std::list<Alpha> mAda;
 	std::list<uint> mAdaHelper;
 	Eigen::MatrixXf mMatrix;
+	// for every sign condition in mSigns the column of mMatrix belonging to its trailing part
+	std::vector<Eigen::Index> mSignOrigins;
 	bool mNeedsUpdate = false;
 	
 	
@@ -61,6 +64,7 @@ public:
 		mAda(other.mAda),
 		mAdaHelper(other.mAdaHelper),
 		mMatrix(other.mMatrix),
+		mSignOrigins(other.mSignOrigins),
 		mNeedsUpdate(other.mNeedsUpdate)
 	{}
 	
@@ -76,6 +80,10 @@ public:
 	const auto& adaptedList() const { return mAda; }
 	const auto& matrix() const { return mMatrix; }
 	bool needsUpdate() const { return mNeedsUpdate; }
+	/// the adapted matrix of the current adapted list and sign conditions, computed from scratch
+	Eigen::MatrixXf recomputedMatrix() const { return adaptedMat(mAda, mSigns); }
+	std::size_t cacheHits() const { return mTaQ.cacheHits(); }
+	std::size_t cacheMisses() const { return mTaQ.cacheMisses(); }
 	
 	
 private:
@@ -97,6 +105,12 @@ private:
 		}
 		return res;
 	}       
+	// sigmaToTheAlpha for a single polynomial
+	static int signToTheAlpha(uint alpha, Sign sigma) {
+		if(sigma == Sign::ZERO) return alpha == 0 ? 1 : 0;
+		if(sigma == Sign::NEGATIVE && alpha == 1) return -1;
+		return 1;
+	}
 	static Eigen::MatrixXf adaptedMat(const std::list<Alpha>& ada, const std::list<SignCondition>& signs) {
 		Eigen::MatrixXf res(ada.size(), signs.size());
 		Eigen::Index i = 0;
@@ -166,6 +180,7 @@ private:
 			const Eigen::MatrixXf& mat,
 			const std::vector<Alpha>& ada,
 			std::vector<Polynomial>& products,
+			std::vector<Eigen::Index>& rows,
 			const uint q) const {
 		CARL_LOG_ASSERT("carl.thom.sign", n > 0, "");
 		std::vector<uint> lines(ada.size(), 0);
@@ -197,6 +212,7 @@ private:
 		for(uint i = 0; i < lines.size(); i++) {
 			if(lines[i] == 1) {
 				res.push_back(ada[i]);
+				rows.push_back(Eigen::Index(i));
 				newProducts.push_back(products[q*ada.size() + i]);
 			}
 		}
@@ -205,9 +221,17 @@ private:
 		return res;
 	}
        
+	/*
+	 * extends the adapted list by the polynomial added last.
+	 * every row of the new matrix belongs to a row of the old matrix, extended by alpha in {0,1,2} for the new polynomial,
+	 * and every column belongs to a column of the old matrix, extended by the sign of the new polynomial.
+	 * hence the new matrix is obtained from the old one without evaluating sigmaToTheAlpha on whole sign conditions.
+	 */
 	void update() {
 		std::list<Alpha> newAda = mAda;
 		for(auto& alpha : newAda) alpha.push_front(0);
+		std::vector<Eigen::Index> rowOrigins(mAda.size());
+		std::iota(rowOrigins.begin(), rowOrigins.end(), 0);
 		std::list<Polynomial> adaptedProducts = mProducts;
 		adaptedProducts.resize(mAda.size());
 		uint r1 = mAda.size();
@@ -231,6 +255,7 @@ private:
 				m2, 
 				std::vector<Alpha>(mAda.begin(), mAda.end()), 
 				products, 
+				rowOrigins,
 				1);
 			for(auto& alpha : A_2) {
 				alpha.push_front(1);
@@ -259,6 +284,7 @@ private:
 					m3,
 					std::vector<Alpha>(mAda.begin(), mAda.end()),
 					products,
+					rowOrigins,
 					2);
 				for(auto& alpha : A_3) {
 					alpha.push_front(2);
@@ -269,8 +295,21 @@ private:
 				}
 			}	 
 		}
+		Eigen::MatrixXf newMatrix(Eigen::Index(newAda.size()), Eigen::Index(mSigns.size()));
+		CARL_LOG_ASSERT("carl.thom.sign", mSignOrigins.size() == mSigns.size(), "");
+		Eigen::Index i = 0;
+		for(const auto& alpha : newAda) {
+			Eigen::Index j = 0;
+			for(const auto& sigma : mSigns) {
+				int factor = signToTheAlpha(alpha.front(), sigma.front());
+				newMatrix(i, j) = factor == 0 ? 0.0f : float(factor) * mMatrix(rowOrigins[std::size_t(i)], mSignOrigins[std::size_t(j)]);
+				j++;
+			}
+			i++;
+		}
+		CARL_LOG_ASSERT("carl.thom.sign", newMatrix == adaptedMat(newAda, mSigns), "incremental update of the matrix failed");
 		mAda = newAda;
-		mMatrix = adaptedMat(mAda, mSigns);
+		mMatrix = newMatrix;
 		CARL_LOG_ASSERT("carl.thom.sign", Eigen::FullPivLU<Eigen::MatrixXf>(mMatrix).rank() == mMatrix.cols(), "mMatrix must be invertible!");
 		mProducts = adaptedProducts;
 		mNeedsUpdate = false;
@@ -282,7 +321,8 @@ private:
 			std::list<Polynomial>& products,
 			std::list<Alpha>& ada,
 			std::list<uint>& adaHelper,
-			Eigen::MatrixXf& matrix
+			Eigen::MatrixXf& matrix,
+			std::vector<Eigen::Index>& signOrigins
 	) {
 		if(mNeedsUpdate) this->update();
 		
@@ -343,9 +383,11 @@ private:
 		
 		std::list<SignCondition> newSigns;
 		adaHelper = std::list<uint>(mSigns.size(), 0);
+		signOrigins.clear();
 		long k = 0;
 		for(long i = 0; i < long(currSigns.size()); i++) {
 			auto helper_it = adaHelper.begin();
+			Eigen::Index column = 0;
 			for(const auto& sigma : mSigns) {
 				if ((std::round(c(k))) != 0) {
 					uint tmp = *helper_it;
@@ -356,8 +398,10 @@ private:
 					std::advance(it, i);
 					newCond.push_front(it->front());
 					newSigns.push_back(newCond);
+					signOrigins.push_back(column);
 				}
 				helper_it++;
+				column++;
 				k++;
 			}
 			helper_it = adaHelper.begin();
@@ -377,7 +421,8 @@ public:
 		std::list<Alpha> dummyAda;
 		std::list<uint> dummyHelper;
 		Eigen::MatrixXf dummyMatrix;
-		std::list<SignCondition> newSigns = getSigns(p, dummyProducts, dummyAda, dummyHelper, dummyMatrix);
+		std::vector<Eigen::Index> dummyOrigins;
+		std::list<SignCondition> newSigns = getSigns(p, dummyProducts, dummyAda, dummyHelper, dummyMatrix, dummyOrigins);
 		return newSigns;
 	}
 	
@@ -386,7 +431,8 @@ public:
 		std::list<Alpha> newAda;
 		std::list<uint> newHelper;
 		Eigen::MatrixXf newMatrix;
-		std::list<SignCondition> newSigns = getSigns(p, newProducts, newAda, newHelper, newMatrix);
+		std::vector<Eigen::Index> newOrigins;
+		std::list<SignCondition> newSigns = getSigns(p, newProducts, newAda, newHelper, newMatrix, newOrigins);
 		mNeedsUpdate = true;
 		if(mP.empty()) {
 			mAda = newAda;
@@ -397,6 +443,7 @@ public:
 		mSigns = newSigns;
 		mProducts = newProducts;
 		mAdaHelper = newHelper;
+		mSignOrigins = newOrigins;
 		CARL_LOG_DEBUG("carl.thom.sign", *this);
 		return newSigns;
 	}
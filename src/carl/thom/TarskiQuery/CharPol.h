@@ -8,6 +8,7 @@
 #pragma once
 
 #include <eigen3/Eigen/Core>
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -91,4 +92,53 @@ std::vector<Coeff> charPol(const CoeffMatrix<Coeff>& m) {
 	return res;
 }
 
+// Berkowitz algorithm, see e.g. "On computing the determinant in small parallel time using a small number of processors" by S. J. Berkowitz.
+// computes the characteristic polynomial without any division, using O(n^4) ring operations.
+// as charPol, the coefficients are returned by increasing degree.
+template<typename Coeff>
+std::vector<Coeff> charPolBerkowitz(const CoeffMatrix<Coeff>& m) {
+	CARL_LOG_FUNC("carl.thom.tarski", "");
+	Eigen::Index n = m.cols();
+	CARL_LOG_ASSERT("carl.thom.tarski", n == m.rows(), "can only compute characteristic polynomial of square matrix");
+	CARL_LOG_INFO("carl.thom.tarski", "input has size " << n << "x" << n);
+
+	// coefficients of the characteristic polynomial of the leading principal submatrix, by decreasing degree
+	std::vector<Coeff> res = { Coeff(1) };
+	std::vector<Coeff> column;
+	std::vector<Coeff> tmp;
+	for(Eigen::Index r = 0; r < n; r++) {
+		// first column of the toeplitz matrix: 1, -a_rr, -R*C, -R*A*C, ..., -R*A^(r-1)*C
+		// where A is the leading principal r x r submatrix, R the row and C the column next to it
+		std::vector<Coeff> toeplitz(std::size_t(r) + 2, Coeff(0));
+		toeplitz[0] = Coeff(1);
+		toeplitz[1] = -m(r, r);
+		column.resize(std::size_t(r));
+		for(Eigen::Index i = 0; i < r; i++) column[std::size_t(i)] = m(i, r);
+		for(Eigen::Index k = 0; k < r; k++) {
+			Coeff sum(0);
+			for(Eigen::Index i = 0; i < r; i++) sum += m(r, i) * column[std::size_t(i)];
+			toeplitz[std::size_t(k) + 2] = -sum;
+			// column = A * column
+			tmp.assign(std::size_t(r), Coeff(0));
+			for(Eigen::Index i = 0; i < r; i++) {
+				for(Eigen::Index j = 0; j < r; j++) {
+					tmp[std::size_t(i)] += m(i, j) * column[std::size_t(j)];
+				}
+			}
+			std::swap(column, tmp);
+		}
+		// multiply the lower triangular toeplitz matrix with the previous coefficients
+		std::vector<Coeff> next(res.size() + 1, Coeff(0));
+		for(std::size_t i = 0; i < next.size(); i++) {
+			for(std::size_t j = 0; j < res.size() && j <= i; j++) {
+				next[i] += toeplitz[i - j] * res[j];
+			}
+		}
+		std::swap(res, next);
+	}
+	std::reverse(res.begin(), res.end());
+	CARL_LOG_INFO("carl.thom.tarski", "done computing the char pol ... ");
+	return res;
+}
+
 } // namespace carl
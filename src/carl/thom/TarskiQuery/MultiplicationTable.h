@@ -1,4 +1,4 @@
-/* 
+/*
  * File:   MultiplicationTable2.h
  * Author: tobias
  *
@@ -8,187 +8,206 @@
 #pragma once
 
 #include "GroebnerBase.h"
+#include "CharPol.h"
+
+#include <algorithm>
+#include <unordered_map>
 
 namespace carl {
-	
-	
+
+
 /*
  * these objects represent elements from a certain vector space as a linear combinations of its base.
- * rather than storing the elements in the base we only store indices.
+ * the coefficient of the i-th base element is stored at index i, i.e. the representation is dense.
  */
 template<typename Number>
-struct BaseRepresentation : public std::map<uint, Number> {
-	using Monomial = Term<Number>;
-	
+struct BaseRepresentation : public std::vector<Number> {
+
 	BaseRepresentation() = default;
-	
-	BaseRepresentation(const std::vector<Monomial>& base, const MultivariatePolynomial<Number>& p) {
-		CARL_LOG_ASSERT("carl.thom.tarski", base.size() >= p.size(), "p is not in <base>");
-		for(const auto& term : p) {
-			for(uint i = 0; i < base.size(); i++) {
-				if(term.monomial() == base[i].monomial()) {
-					this->insert(std::make_pair(i, term.coeff()));
-				}
-			}	  
-		}
+
+	explicit BaseRepresentation(std::size_t size) : std::vector<Number>(size, Number(0)) {}
+
+	bool isZero() const {
+		return std::all_of(this->begin(), this->end(), [](const Number& n){ return carl::isZero(n); });
 	}
-		
-	bool isZero() const { return this->empty(); }
-	bool contains(uint i) const { return this->find(i) != this->end(); }
+	bool contains(uint i) const { return i < this->size() && !carl::isZero((*this)[i]); }
 	Number get(uint index) const {
-		auto it = this->find(index);
-		if(it == this->end()) return Number(0);
-		else return it->second;
+		if(index >= this->size()) return Number(0);
+		return (*this)[index];
 	}
 };
 
 /*
  * Let Mon be the base of the structure Q[x_1,...x_n] / <gb> viewed as a Q vector space
- * this class stores for each monomial m in {ab | a,b in Mon } the following entry:
- * 
- * Monomial     |       BaseRepresentation      |       Index pairs
- * 
- * where the base representation is the monomial viewed as a linear combination of the basis
- * and index pairs stores a list of all pairs of basis elements whose product is equal to Monomial
+ * this class stores for each pair (i,j) of indices of basis elements the normal form of the product base_i * base_j,
+ * i.e. the product viewed as a linear combination of the basis.
+ *
+ * The normal forms are stored as sparse rows in a flat (compressed row) layout, row i * |Mon| + j belonging to the pair (i,j).
+ * Additionally, the traces of the multiplication maps of all basis elements and of all products of two basis elements are precomputed.
+ * Thereby, traces and Hermite matrices are obtained by plain matrix-vector products.
  */
 template<typename Number>
 class MultiplicationTable {
-	
+
 public:
-	
-	using IndexPairs = std::forward_list<std::pair<uint, uint>>;
+
 	using Monomial = Term<Number>;
-	
-	struct TableContent {
-		BaseRepresentation<Number> br;
-		IndexPairs pairs;
-	};
+
 private:
 
-	// main datastructure
-	std::unordered_map<Monomial, TableContent> mTable;
-	
 	// the base of the factor ring as a vector space
 	std::vector<Monomial> mBase;
-	
+
+	// maps the monomials of the base to their index
+	std::unordered_map<carl::Monomial::Arg, uint> mBaseIndex;
+
+	// normal forms of all products of two basis elements in compressed row layout
+	std::vector<std::size_t> mRowOffsets;
+	std::vector<uint> mColumns;
+	std::vector<Number> mValues;
+
+	// mTraces[k] is the trace of the multiplication by base_k
+	std::vector<Number> mTraces;
+
+	// mProductTraces[i * |Mon| + j] is the trace of the multiplication by base_i * base_j
+	std::vector<Number> mProductTraces;
+
 	// the groebner base object is used to compute reductions
 	GroebnerBase<Number> mGb;
-	
+
 public:
-	
-	MultiplicationTable() : mTable(), mBase(), mGb() {}
-	
+
+	MultiplicationTable() : mBase(), mGb() {}
+
 	explicit MultiplicationTable(const GroebnerBase<Number>& gb) : mGb(gb){
 		CARL_LOG_ASSERT("carl.thom.tarski.table", gb.hasFiniteMon(), "tried to set up a multiplication table on infinite basis");
 		init(gb);
 		CARL_LOG_TRACE("carl.thom.tarski.table", "done setting up multiplication table:\n" << *this);
 	}
-	
-	typename std::unordered_map<Monomial, TableContent>::const_iterator begin() const { return mTable.cbegin(); }
-	typename std::unordered_map<Monomial, TableContent>::const_iterator end() const { return mTable.cend(); }
-	typename std::unordered_map<Monomial, TableContent>::const_iterator cbegin() const { return mTable.cbegin(); }
-	typename std::unordered_map<Monomial, TableContent>::const_iterator cend() const { return mTable.cend(); }
-	
-	
-	inline bool contains(const Monomial& m) const {
-		return mTable.find(m) != mTable.end();
-	}
-	
+
 	const std::vector<Monomial>& getBase() const noexcept {
 		return mBase;
 	}
-	
-	BaseRepresentation<Number> reduce(const MultivariatePolynomial<Number>& p) const {
-		return BaseRepresentation<Number>(mBase, mGb.reduce(p));
+
+	std::size_t size() const noexcept {
+		return mBase.size();
 	}
-	
-	const TableContent& getEntry(const Monomial& mon) const {
-		auto it = mTable.find(mon);
-		assert(it != mTable.end());
-		return it->second;
+
+	BaseRepresentation<Number> reduce(const MultivariatePolynomial<Number>& p) const {
+		return toBaseRepresentation(mGb.reduce(p));
 	}
-	
+
 	MultivariatePolynomial<Number> baseReprToPolynomial(const BaseRepresentation<Number>& baseRepr) const {
 		MultivariatePolynomial<Number> res(Number(0));
-		for(const auto& entry : baseRepr) {
-			res += entry.second * this->mBase[entry.first];
+		for(uint i = 0; i < baseRepr.size(); i++) {
+			if(carl::isZero(baseRepr[i])) continue;
+			res += baseRepr[i] * this->mBase[i];
 		}
 		return res;
 	}
-	
+
 	BaseRepresentation<Number> multiply(const BaseRepresentation<Number>& f, const BaseRepresentation<Number>& g) const {
-		BaseRepresentation<Number> res;
-		for(const auto& entry : this->mTable) {
-			if(entry.second.br.isZero()) continue;
-			for(const auto& index_coeff : entry.second.br) {
-				Number newCoeff(0);
-				for(const auto& pair : entry.second.pairs) {
-					newCoeff += f.get(pair.first) * g.get(pair.second);
-				}
-				if(newCoeff != 0) {
-					res[index_coeff.first] += newCoeff * index_coeff.second;
+		BaseRepresentation<Number> res(size());
+		for(uint i = 0; i < f.size(); i++) {
+			if(carl::isZero(f[i])) continue;
+			for(uint j = 0; j < g.size(); j++) {
+				if(carl::isZero(g[j])) continue;
+				Number factor = f[i] * g[j];
+				std::size_t row = i * size() + j;
+				for(std::size_t k = mRowOffsets[row]; k < mRowOffsets[row + 1]; k++) {
+					res[mColumns[k]] += factor * mValues[k];
 				}
 			}
 		}
 		return res;
 	}
-	
-	
+
 	Number trace(const BaseRepresentation<Number>& f) const {
 		Number res(0);
-		for(const auto& index_coeff : f) {
-			for(uint i = 0; i < mBase.size(); i++) {
-				Monomial prod = mBase[index_coeff.first] * mBase[i];
-				BaseRepresentation<Number> prod_br = this->getEntry(prod).br;
-				res += index_coeff.second * prod_br.get(i);
-			}		   
+		for(uint k = 0; k < f.size(); k++) {
+			if(carl::isZero(f[k])) continue;
+			res += f[k] * mTraces[k];
+		}
+		return res;
+	}
+
+	/*
+	 * computes the matrix whose entry (i,j) is the trace of the multiplication by q * base_i * base_j.
+	 * first u_k = trace(q * base_k) is obtained from the precomputed product traces,
+	 * then every entry is the scalar product of u with the normal form of base_i * base_j.
+	 */
+	CoeffMatrix<Number> hermiteMatrix(const BaseRepresentation<Number>& q) const {
+		std::size_t n = size();
+		std::vector<Number> u(n, Number(0));
+		for(std::size_t l = 0; l < q.size(); l++) {
+			if(carl::isZero(q[l])) continue;
+			for(std::size_t k = 0; k < n; k++) {
+				u[k] += q[l] * mProductTraces[l * n + k];
+			}
+		}
+		CoeffMatrix<Number> res(n, n);
+		for(std::size_t i = 0; i < n; i++) {
+			for(std::size_t j = i; j < n; j++) {
+				Number t(0);
+				std::size_t row = i * n + j;
+				for(std::size_t k = mRowOffsets[row]; k < mRowOffsets[row + 1]; k++) {
+					t += mValues[k] * u[mColumns[k]];
+				}
+				res(long(i), long(j)) = t;
+				res(long(j), long(i)) = t;
+			}
 		}
 		return res;
 	}
-	
+
 	template<typename C>
 	friend std::ostream& operator<<(std::ostream& o, const MultiplicationTable<C>& table);
-	
+
 private:
-	
-	// returns a list of all pairs of indicdes (i,j) such that base_i * base_j == c
-	IndexPairs indexPairs(const Monomial& c) const {
-		IndexPairs res;
-		for(uint i = 0; i < mBase.size(); i++) {
-			for(uint j = i; j < mBase.size(); j++) {
-				if(mBase[i] * mBase[j] == c) {
-					res.push_front(std::make_pair(i, j));
-					if(i != j) res.push_front(std::make_pair(j, i));
-				}
+
+	BaseRepresentation<Number> toBaseRepresentation(const MultivariatePolynomial<Number>& p) const {
+		CARL_LOG_ASSERT("carl.thom.tarski", mBase.size() >= p.size(), "p is not in <base>");
+		BaseRepresentation<Number> res(size());
+		for(const auto& term : p) {
+			auto it = mBaseIndex.find(term.monomial());
+			CARL_LOG_ASSERT("carl.thom.tarski", it != mBaseIndex.end(), "p is not in <base>");
+			if(it != mBaseIndex.end()) {
+				res[it->second] = term.coeff();
 			}
 		}
 		return res;
 	}
-	
+
 	void init(const GroebnerBase<Number>& gb) {
 		CARL_LOG_FUNC("carl.thom.tarski", "gb = " << gb.get());
-		
+
 		// some needed values
 		std::vector<Monomial> Cor = gb.cor();
 		std::vector<Monomial> Bor = gb.bor();
 		std::vector<Monomial> Mon = gb.mon();
 		std::set<Variable> vars = gb.gatherVariables();
-		
+
 		// sort the base
 		std::sort(Mon.begin(), Mon.end());
 		mBase = Mon;
-		
+		for(uint i = 0; i < mBase.size(); i++) {
+			mBaseIndex.emplace(mBase[i].monomial(), i);
+		}
+
+		// normal forms of all monomials computed so far
+		std::unordered_map<Monomial, BaseRepresentation<Number>> table;
+
 		// monomials in bor in increasing order
 		std::sort(Bor.begin(), Bor.end());
-		
+
 		// ---- step 0 ---- (not explicitly mentioned)
 		// put BaseReprensentation of the monomials from Mon itself in table
 		for(uint i = 0; i < Mon.size(); i++) {
-			BaseRepresentation<Number> baseRepr;
-			baseRepr[i] = Number(1); 
-			mTable[Mon[i]] = {baseRepr, indexPairs(Mon[i])};
+			BaseRepresentation<Number> baseRepr(size());
+			baseRepr[i] = Number(1);
+			table[Mon[i]] = baseRepr;
 		}
-		
+
 		// ---- step 1 ----
 		// compute the normal forms of the elements in Bor
 		for(const auto& m : Bor) {
@@ -206,13 +225,7 @@ private:
 				}
 				MultivariatePolynomial<Number> diff = G.stripLT();
 				diff *= Number(-1);
-				BaseRepresentation<Number> baseRepr(mBase, diff);
-				IndexPairs pairs;
-				if(!baseRepr.isZero()) {
-					pairs = indexPairs(m);
-				}
-				mTable[m] = {baseRepr, pairs};
-				//CARL_LOG_TRACE("carl.thom.tarski", "mTable = " << mTable);			     
+				table[m] = toBaseRepresentation(diff);
 			}
 			else {
 				// try to find a variable X_j, such that m / X_j is in Bor
@@ -220,7 +233,7 @@ private:
 				auto it = vars.begin();
 				Variable var = *it;
 				Monomial x_beta;
-				while(!m.divide(var, x_beta) || (std::find(Bor.begin(), Bor.end(), x_beta) == Bor.end())) {				    
+				while(!m.divide(var, x_beta) || (std::find(Bor.begin(), Bor.end(), x_beta) == Bor.end())) {
 					it++;
 					CARL_LOG_ASSERT("carl.thom.tarski.table", it != vars.end(), "");
 					var = *it;
@@ -228,66 +241,72 @@ private:
 				CARL_LOG_ASSERT("carl.thom.tarski.table", std::find(Bor.begin(), Bor.end(), x_beta) != Bor.end(), "");
 				CARL_LOG_TRACE("carl.thom.tarski.table", "x_beta = " << x_beta);
 				CARL_LOG_TRACE("carl.thom.tarski.table", "var = " << var);
-				CARL_LOG_ASSERT("carl.thom.tarski.table", this->contains(x_beta), "");
+				CARL_LOG_ASSERT("carl.thom.tarski.table", table.find(x_beta) != table.end(), "");
 				CARL_LOG_ASSERT("carl.thom.tarski.table", x_beta < m, "");
-				
-				BaseRepresentation<Number> nf_x_beta = mTable[x_beta].br;
-				MultivariatePolynomial<Number> sum(Number(0));
-				
+
+				const BaseRepresentation<Number> nf_x_beta = table[x_beta];
+				BaseRepresentation<Number> sum(size());
+
 				// sum over all pairs in Mon^2...
 				CARL_LOG_TRACE("carl.thom.tarski.table", "nf_x_beta" << nf_x_beta);
-				for(const auto& entry_beta : nf_x_beta) {
-					Monomial x_gamma_prime = var * Mon[entry_beta.first];
+				for(uint beta = 0; beta < nf_x_beta.size(); beta++) {
+					if(carl::isZero(nf_x_beta[beta])) continue;
+					Monomial x_gamma_prime = var * Mon[beta];
 					CARL_LOG_ASSERT("carl.thom.tarski.table", x_gamma_prime < m, "");
-					CARL_LOG_ASSERT("carl.thom.tarski.table", this->contains(x_gamma_prime), "");
-					BaseRepresentation<Number> nf_x_gamma_prime = mTable[x_gamma_prime].br;
+					CARL_LOG_ASSERT("carl.thom.tarski.table", table.find(x_gamma_prime) != table.end(), "");
+					const BaseRepresentation<Number>& nf_x_gamma_prime = table[x_gamma_prime];
 					CARL_LOG_TRACE("carl.thom.tarski.table", "nf_x_gamma_prime" << nf_x_gamma_prime);
-					for(const auto& entry_gamma : nf_x_gamma_prime) {
-						Term<Number> prod(nf_x_beta[entry_beta.first]);
-						prod = prod * nf_x_gamma_prime[entry_gamma.first];
-						prod = prod * Mon[entry_gamma.first];
-						sum += prod;
+					for(uint gamma = 0; gamma < nf_x_gamma_prime.size(); gamma++) {
+						if(carl::isZero(nf_x_gamma_prime[gamma])) continue;
+						sum[gamma] += nf_x_beta[beta] * nf_x_gamma_prime[gamma];
 					}
 				}
-				IndexPairs pairs;
-				BaseRepresentation<Number> baseRepr(mBase, sum);
-				if(!baseRepr.isZero()) {
-					pairs = indexPairs(m);
-				}
-				mTable[m] = {baseRepr, pairs};
+				table[m] = sum;
 			}
 		}
-		
+
 		// ---- step 2 ----
-		// construct the matrices expressing multiplication by a variable (see step 2)
-		
-		// ---- step 3 ----
 		// find the normal forms of all other elements in Tab(Mon)
 		// Tab(Mon) = set of products of elements from Mon
-		std::list<Monomial> tabmon;
-		for(const auto& m1 : Mon) {
-			for(const auto& m2 : Mon) {
-				Monomial prod = m1 * m2;
-				if(std::find(tabmon.begin(), tabmon.end(), prod) == tabmon.end()) {
-					tabmon.push_back(prod);
-				}				
+		// and store them for every pair of indices
+		std::size_t n = size();
+		mRowOffsets.assign(1, 0);
+		for(std::size_t i = 0; i < n; i++) {
+			for(std::size_t j = 0; j < n; j++) {
+				Monomial prod = Mon[i] * Mon[j];
+				auto it = table.find(prod);
+				if(it == table.end()) {
+					// we do not have the normal form of prod yet
+					CARL_LOG_TRACE("carl.thom.tarski.table", "still to compute: normal form for " << prod);
+					// make it easy here and use groebner reduce
+					MultivariatePolynomial<Number> nf = mGb.reduce(MultivariatePolynomial<Number>(prod));
+					it = table.emplace(prod, toBaseRepresentation(nf)).first;
+				}
+				for(uint k = 0; k < it->second.size(); k++) {
+					if(carl::isZero(it->second[k])) continue;
+					mColumns.push_back(k);
+					mValues.push_back(it->second[k]);
+				}
+				mRowOffsets.push_back(mColumns.size());
 			}
 		}
-		CARL_LOG_TRACE("carl.thom.tarski", "tabmon = " << tabmon);
-		for(const auto& m : tabmon) {
-			if(!this->contains(m)) {
-				// we do not have the normal form of m yet
-				CARL_LOG_TRACE("carl.thom.tarski.table", "still to compute: normal form for " << m);
-				
-				// make it easy here and use groebner reduce
-				MultivariatePolynomial<Number> nf_m = mGb.reduce(MultivariatePolynomial<Number>(m));
-				
-				IndexPairs pairs;
-				BaseRepresentation<Number> baseRepr(mBase, nf_m);
-				if(!baseRepr.isZero()) {
-					pairs = indexPairs(m);
+
+		// ---- step 3 ----
+		// precompute the traces of the multiplication maps
+		// trace(base_k) is the sum of the coefficients of base_i in the normal form of base_k * base_i
+		mTraces.assign(n, Number(0));
+		for(std::size_t k = 0; k < n; k++) {
+			for(std::size_t i = 0; i < n; i++) {
+				std::size_t row = k * n + i;
+				for(std::size_t e = mRowOffsets[row]; e < mRowOffsets[row + 1]; e++) {
+					if(mColumns[e] == i) mTraces[k] += mValues[e];
 				}
-				mTable[m] = {baseRepr, pairs};
+			}
+		}
+		mProductTraces.assign(n * n, Number(0));
+		for(std::size_t row = 0; row < n * n; row++) {
+			for(std::size_t e = mRowOffsets[row]; e < mRowOffsets[row + 1]; e++) {
+				mProductTraces[row] += mValues[e] * mTraces[mColumns[e]];
 			}
 		}
 	}
@@ -296,9 +315,16 @@ private:
 template<typename C>
 std::ostream& operator<<(std::ostream& o, const MultiplicationTable<C>& table) {
 	o << "Base = " << table.mBase << std::endl;
-	o << "Length = " << table.mTable.size() << std::endl;
-	for (const auto& entry: table.mTable) {
-		o << entry.first << "\t" << entry.second.br << "\t" << entry.second.pairs << std::endl;
+	std::size_t n = table.size();
+	for(std::size_t i = 0; i < n; i++) {
+		for(std::size_t j = 0; j < n; j++) {
+			std::size_t row = i * n + j;
+			o << table.mBase[i] << " * " << table.mBase[j] << "\t";
+			for(std::size_t e = table.mRowOffsets[row]; e < table.mRowOffsets[row + 1]; e++) {
+				o << " + " << table.mValues[e] << "*" << table.mBase[table.mColumns[e]];
+			}
+			o << std::endl;
+		}
 	}
 	return o;
 }
@@ -18,43 +18,12 @@ template<typename Number>
 int multivariateTarskiQuery(const MultivariatePolynomial<Number>& Q, const MultiplicationTable<Number>& table) {
         CARL_LOG_FUNC("carl.thom.tarski", "Q = " << Q);
         BaseRepresentation<Number> q = table.reduce(Q);
-        std::vector<typename MultiplicationTable<Number>::Monomial> base = table.getBase();
         // compute the traces...
-        CoeffMatrix<Number> m(base.size(), base.size());
-        CARL_LOG_INFO("carl.thom.tarski", "base size is " << base.size());
+        CARL_LOG_INFO("carl.thom.tarski", "base size is " << table.size());
         CARL_LOG_INFO("carl.thom.tarski", "setting up the matrix now ...");
-        for(const auto& entry : table) {
-                BaseRepresentation<Number> Qc = table.multiply(q, entry.second.br);
-                Number t = table.trace(Qc);
-                for (const auto& pair : entry.second.pairs) {
-                        m(long(pair.first), long(pair.second)) = t;
-                }
-        }
-        
-        /*
-        for(uint i = 0; i < base.size(); i++) {
-                for(uint j = i; j < base.size(); j++) {    
-                        BaseRepresentation<Number> prod = table.getEntry(base[i] * base[j]).br;
-                        BaseRepresentation<Number> Qc = table.multiply(q, prod);
-                        //BaseRepresentation<Number> Qc = table.reduce(base[i] * base[j] * Q);
-                        Number t = table.trace(Qc);
-                        m(i, j) = t;
-                        m(j, i) = t;
-                }
-        }
-        */
-        /*
-        for(uint i = 0; i < base.size(); i++) {
-                for(uint j = i; j < base.size(); j++) {
-                        std::cout << m(i, j) << "\t\t";
-                }
-                std::cout << std::endl;
-        }
-        std::cout << std::endl;
-        */
-        
+        CoeffMatrix<Number> m = table.hermiteMatrix(q);
         CARL_LOG_INFO("carl.thom.tarski", "... done setting up matrix.");
-        std::vector<Number> cp = charPol(m);
+        std::vector<Number> cp = charPolBerkowitz(m);
         CARL_LOG_TRACE("carl.thom.tarski", "char pol: " << cp);
         int v1 = int(sign_variations(cp.begin(), cp.end(), sgn<Number>));
         for(uint i = 1; i < cp.size(); i += 2) {
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <iterator>
+#include <map>
+#include <memory>
 
 #include "MultiplicationTable.h"
 #include "MultivariateTarskiQuery.h"
@@ -37,7 +39,17 @@ private:
         MultiplicationTable<Number> mTab;
         bool mTrivialGb = false;
         
-        mutable std::map<Polynomial, QueryResultType> mCache;
+        /*
+         * memo table of query results on the zero set of this manager, keyed by the normalized polynomial.
+         * it is shared among all copies of the manager, hence also among all sign determinations
+         * and thom encodings derived from the same one.
+         */
+        struct QueryCache {
+                std::map<Polynomial, QueryResultType> results;
+                std::size_t hits = 0;
+                std::size_t misses = 0;
+        };
+        std::shared_ptr<QueryCache> mCache = std::make_shared<QueryCache>();
         
 public:
         TarskiQueryManager() = default;
@@ -111,6 +123,10 @@ public:
                 return (*this)(Polynomial(c));
         }
         
+        std::size_t cacheHits() const { return mCache->hits; }
+        std::size_t cacheMisses() const { return mCache->misses; }
+        std::size_t cacheSize() const { return mCache->results.size(); }
+        
         Polynomial reduceProduct(const Polynomial& a, const Polynomial& b) const {
                 if(this->isUnivariateManager()) {
                         // todo: implement
@@ -134,11 +150,13 @@ private:
          * looks for the normalization of p in the cache
          */
         bool getCached(const Polynomial& p, QueryResultType& res) const {
-                auto it = mCache.find(p.normalize());
-                if(it != mCache.end()) {
+                auto it = mCache->results.find(p.normalize());
+                if(it != mCache->results.end()) {
 						res = int(sgn(p.lcoeff())) * (it->second);
+                        mCache->hits++;
                         return true;
                 }
+                mCache->misses++;
                 return false;
         }
         
@@ -146,7 +164,7 @@ private:
          * writes normalized p with correspoding result in cache
          */
         void cache(const Polynomial& p, const QueryResultType res) const {
-                mCache.insert(std::make_pair(p.normalize(), int(sgn(p.lcoeff())) * res));
+                mCache->results.insert(std::make_pair(p.normalize(), int(sgn(p.lcoeff())) * res));
         }
         
 }; // class TarskiQueryManager
@@ -1,4 +1,4 @@
-/* 
+/*
  * File:   Cache.h
  * Author: Florian Corzilius
  *
@@ -9,17 +9,25 @@
 
 #include "Common.h"
 
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <stack>
+#include <stdexcept>
+#include <string>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
-namespace carl {   
+namespace carl {
     template<typename T, class I>
     using TypeInfoPair = std::pair<T*,I>;
-    
+
     template<typename T, class I>
     bool operator==(const TypeInfoPair<T,I>& _tipA, const TypeInfoPair<T,I>& _tipB) {
         return *_tipA.first == *_tipB.first;
@@ -36,278 +44,304 @@ namespace std {
 }
 
 namespace carl
-{   
+{
     template<typename T>
     bool returnFalse( const T& /*unused*/, const T& /*unused*/) { return false; }
-    
+
     template<typename T>
     void doNothing( const T& /*unused*/, const T& /*unused*/) {}
-   
+
+    /**
+     * Returns how many registrations of a cached object are held by others than the object itself, given a function
+     * summing the usage counters of its entry. Registrations held by the object itself do not keep the entry alive.
+     * Objects that can refer to themselves overload this and sum the usage counters in the same critical section in
+     * which they change the references on themselves.
+     */
+    template<typename T>
+    std::size_t cacheExternalUsage( const T& /*unused*/, const std::function<std::size_t()>& _usage ) { return _usage(); }
+
+    /**
+     * A cache for objects that are shared by reference, e.g. the factorizations of FactorizedPolynomial.
+     *
+     * The entries are distributed over independently locked stripes by their hash. Registering and deregistering a
+     * reference, accessing an entry and strengthening its activity do not lock at all: the usage counters are atomic
+     * and stored per reference, and references are resolved through a table that never moves its slots.
+     *
+     * The number of entries is limited by the maximum cache size. If a stripe exceeds its share, unused entries are
+     * evicted by a CLOCK sweep whose activity counters are halved whenever the hand passes an entry. Entries that are
+     * still in use are never evicted, hence the cache may only exceed its size if all its entries are in use.
+     */
     template<typename T>
     class Cache {
-        
+
     public:
         // The type of the reference of an entry in the cache.
         using Ref = std::size_t;
-        
+
         struct Info {
             /**
-             * Store the number of usages of the entry in the cache for which this information hold by external objects.
-             */
-            std::size_t usageCount;
-            
-            /**
-             * Stores the reference of the entry in the cache for which this information hold.
+             * Stores the references of the entry in the cache for which this information hold. There may be several
+             * if equal entries were merged after rehashing.
              */
             std::vector<Ref> refStoragePositions;
-            
+
             /**
              * Stores the activity of the entry in the cache for which this information hold. The activity states how often the entry
              * is involved in computations in the recent past.
              */
-            double activity;
+            std::atomic<std::size_t> activity;
+
+            /**
+             * The stripe the entry is stored in.
+             */
+            std::atomic<std::size_t> stripe;
+
+            /**
+             * The position of the entry in the clock of its stripe.
+             */
+            std::size_t clockPosition;
 
-            explicit Info( double _activity ):
-                usageCount(0),
+            explicit Info( std::size_t _stripe ):
                 refStoragePositions(),
-                activity(_activity)
+                activity(0),
+                stripe(_stripe),
+                clockPosition(0)
             {}
         };
-        
+
         using Container = std::unordered_set<TypeInfoPair<T,Info>*, pointerHash<TypeInfoPair<T,Info>>, pointerEqual<TypeInfoPair<T,Info>>>;
-        
-    private:
-        // Members
-        
-        /**
-         * The threshold for the cache's size which should not be exceeded, except more of the cache entries are still in use.
-         */
-        std::size_t mMaxCacheSize;
-        
-        /**
-         * The current number of entries in the cache, which are not used.
-         */
-        std::size_t mNumOfUnusedEntries = 0;
-        
-        /**
-         * The percentage of the cache, which shall be removed at best, if the cache size exceeds the threshold. (NOT YET USED)
-         */
-        double mCacheReductionAmount;
-        
-        /**
-         * The threshold for the maximum activity. In case it is exceeded, all activities are rescaled.
-         */
-        double mMaxActivity = 0.0;
-        
+
         /**
-         * The reciprocal of the factor to multiply an activity with in order to increase it. 
-         * This member can increased by a user interface.
+         * Statistics of the cache, see statistics().
          */
-        double mActivityIncrement = 1.0;
-        
+        struct Statistics {
+            /// Number of objects that were already cached when calling cache().
+            std::size_t hits = 0;
+            /// Number of objects that were newly cached.
+            std::size_t misses = 0;
+            /// Number of evicted entries.
+            std::size_t evictions = 0;
+            /// Number of entries in the cache.
+            std::size_t size = 0;
+        };
+
+    private:
         /**
-         * The decay (between 0.9 and 1.0) of the given increments on activities. 
-         * It is applied by increasing the increment by multiplying this members reciprocal to it.
+         * The number of stripes, a power of two.
          */
-        double mDecay;
-        
+        static constexpr std::size_t Stripes = 16;
+
         /**
-         * The threshold limiting the maximum activity. If this threshold is exceeded, all activities are rescaled.
+         * The references are resolved by a two-level table of slots, the first level is allocated upfront.
          */
-        double mActivityThreshold = 1e100;
-        
+        static constexpr std::size_t SlotBlockBits = 10;
+        static constexpr std::size_t SlotBlockSize = std::size_t(1) << SlotBlockBits;
+        static constexpr std::size_t SlotBlocks = std::size_t(1) << 14;
+
+        struct Slot {
+            std::atomic<TypeInfoPair<T,Info>*> entry{nullptr};
+            /// The number of registrations of this reference.
+            std::atomic<std::size_t> usageCount{0};
+        };
+
+        struct alignas(64) Stripe {
+            std::recursive_mutex mutex;
+            Container entries;
+            /// All entries of the stripe in the order visited by the clock hand.
+            std::vector<TypeInfoPair<T,Info>*> clock;
+            std::size_t hand = 0;
+            std::atomic<std::size_t> size{0};
+            std::size_t hits = 0;
+            std::size_t misses = 0;
+            std::size_t evictions = 0;
+        };
+
+        // Members
+
         /**
-         * The factor multiplied to all activities in order to rescale (decrease) them.
+         * The threshold for the cache's size which should not be exceeded, except more of the cache entries are still in use.
          */
-        double mActivityDecrementFactor = 1e-100;
-        
+        std::size_t mMaxCacheSize;
+
         /**
-         * A mutex for situation where any member is changed. TODO: Refine the locking-situations. 
+         * The share of the maximum cache size of every stripe.
          */
-        std::recursive_mutex mMutex;
-        
+        std::size_t mMaxStripeSize;
+
         /**
-         *  The container storing all cached entries. It maps the objects to store to cache information, which cover a usage counter, 
-         *  the position in mCacheRefs, being the entries reference, and the activity of this entry.
+         * The percentage of a stripe, which is removed if the stripe size exceeds its share.
          */
-        Container mCache;
-        
+        double mCacheReductionAmount;
+
+        std::array<Stripe, Stripes> mStripes;
+
+        std::unique_ptr<std::atomic<Slot*>[]> mSlotBlocks;
+
         /**
-         * Stores at the reference of an entry in the cache an iterator to this entry. 
-         * This reference can be used to access the entry outside this class.
+         * A mutex for allocating and freeing references.
          */
-        std::vector<TypeInfoPair<T,Info>*> mCacheRefs;
+        std::mutex mRefMutex;
+
+        /// The number of references that were ever allocated, including the reserved reference NO_REF.
+        std::size_t mNumOfRefs = 1;
+
         /// A stack containing free references, which have been used before but freed now.
         std::stack<Ref> mUnusedPositionsInCacheRefs;
-        
+
+        /**
+         * Entries that were merged into an equal entry by rehash(). Other threads may still access them through a
+         * reference they resolved before the merge, hence they are only destroyed by reclaim() once the usage counters
+         * of their former references have drained.
+         */
+        std::vector<TypeInfoPair<T,Info>*> mRetired;
+
+        std::size_t stripe( std::size_t _hash ) const
+        {
+            // As for StripedPointerSet, the stripes use the upper bits of the hash.
+            std::uint64_t h = std::uint64_t(_hash) * 0x9E3779B97F4A7C15ull;
+            return std::size_t(h >> 40) & (Stripes - 1);
+        }
+
+        Slot& slot( Ref _ref ) const
+        {
+            assert( _ref != NO_REF );
+            assert( (_ref >> SlotBlockBits) < SlotBlocks );
+            Slot* block = mSlotBlocks[_ref >> SlotBlockBits].load( std::memory_order_acquire );
+            assert( block != nullptr );
+            return block[_ref & (SlotBlockSize - 1)];
+        }
+
+        TypeInfoPair<T,Info>* entry( Ref _ref ) const
+        {
+            TypeInfoPair<T,Info>* res = slot( _ref ).entry.load( std::memory_order_acquire );
+            assert( res != nullptr );
+            return res;
+        }
+
     public:
 
         static const Ref NO_REF;
 
-        // The constructor.
-        explicit Cache( size_t _maxCacheSize = 10000, double _cacheReductionAmount = 0.2, double _decay = 0.98 );
+        /**
+         * The constructor.
+         * @param _maxCacheSize The maximum number of entries, which is only exceeded if all entries are in use.
+         * @param _cacheReductionAmount The share of a stripe that is evicted at once if it exceeds its size.
+         */
+        explicit Cache( std::size_t _maxCacheSize = 10000, double _cacheReductionAmount = 0.2 );
         Cache( const Cache& ) = delete; // no implementation
         Cache& operator=( const Cache& ) = delete; // no implementation
 
         ~Cache();
-        
+
         /**
-         * Caches the given object.
+         * Caches the given object and registers the returned reference once.
          * @param _toCache The object to cache.
          * @param _canBeUpdated A function, which determines whether, in the case an equal object has already been cached, the given object
          *                      can update the information in this already cached object.
          * @param _update A function which updates an object in the cache, which is equal to the given object, by the information in the given object.
          *                After this function has been applied, the corresponding entry in the cache will be reinserted in it after been rehashed.
-         * @return The reference of the entry, which can be used outside this class to access the entry.
+         * @return The reference of the entry, which can be used outside this class to access the entry, and whether the object was inserted.
+         *         If not, the caller still owns the given object.
          */
         std::pair<Ref,bool> cache( T* _toCache, bool (*_canBeUpdated)( const T&, const T& ) = &returnFalse<T>, void (*_update)( const T&, const T& ) = &doNothing<T> );
-        
+
         /**
          * Registers the entry to the given reference. It mainly increases the usage counter of this entry in the cache.
          * @param _refStoragePos The reference of the entry to register.
          */
-        void reg( Ref _refStoragePos );
-        
+        void reg( Ref _refStoragePos )
+        {
+            slot( _refStoragePos ).usageCount.fetch_add( 1, std::memory_order_relaxed );
+        }
+
         /**
          * Deregisters the entry to the given reference. It mainly decreases the usage counter of this entry in the cache.
          * @param _refStoragePos The reference of the entry to deregister.
          */
         void dereg( Ref _refStoragePos );
-        
+
         /**
          * Removes and reinserts the entry with the given reference, after its hash value is recalculated.
          * @param _refStoragePos The reference of the entry to apply the given function to.
-         * @return The new reference.
          */
         void rehash( Ref _refStoragePos );
-        
-        /**
-         * Decays all activities by increasing the activity increment.
-         */
-        void decayActivity();
-        
+
         /**
          * Strenghtens the activity of the entry in the cache with the given reference, by increasing its activity.
          * @param _refStoragePos The reference of the entry in the cache to strengthen its activity.
          */
-        void strengthenActivity( Ref _refStoragePos );
-        
+        void strengthenActivity( Ref _refStoragePos )
+        {
+            std::atomic<std::size_t>& activity = entry( _refStoragePos )->second.activity;
+            // Saturates instead of overflowing, as plain load and store it may lose concurrent increments.
+            std::size_t value = activity.load( std::memory_order_relaxed );
+            if( value < std::numeric_limits<std::size_t>::max() )
+                activity.store( value + 1, std::memory_order_relaxed );
+        }
+
+        /**
+         * @return The statistics of this cache, which are collected one stripe after another.
+         */
+        Statistics statistics();
+
         /**
          * Prints all information stored in this cache to std::cout.
          * @param _out The stream to print on.
          */
-        void print( std::ostream& _out = std::cout ) const;
-        
+        void print( std::ostream& _out = std::cout );
+
         /**
-         * @param _refStoragePos The reference of the entry to obtain the object from. 
+         * @param _refStoragePos The reference of the entry to obtain the object from.
          * @return The object in the entry with the given reference.
          */
         const T& get( Ref _refStoragePos ) const
         {
-            assert( _refStoragePos < mCacheRefs.size() );
-            assert( mCacheRefs[_refStoragePos] != nullptr );
-            assert( mCacheRefs[_refStoragePos]->second.usageCount > 0 );
-            return *mCacheRefs[_refStoragePos]->first;
+            assert( slot( _refStoragePos ).usageCount.load( std::memory_order_relaxed ) > 0 );
+            return *entry( _refStoragePos )->first;
         }
-        
+
     private:
-        
+
         /**
-         * Removes a certain amount of unused entries in the cache.
+         * @return Whether the given entry is used by some object other than itself.
          */
-        void clean();
-        
+        bool inUse( const TypeInfoPair<T,Info>* _entry ) const;
+
         /**
-         * Removes the entry at the given position in the cache.
-         * @param _toRemove The position to the entry to remove from the cache.
-         * @return 
+         * Removes the entry from its stripe, whose lock must be held.
          */
-        std::size_t erase( TypeInfoPair<T,Info>* _toRemove )
-        {
-            assert( checkNumOfUnusedEntries() );
-            std::lock_guard<std::recursive_mutex> lock( mMutex );
-            assert( _toRemove->second.usageCount == 0 );
-            for( const Ref& ref : _toRemove->second.refStoragePositions )
-            {
-                mCacheRefs[ref] = nullptr;
-                assert (ref > 0);
-                mUnusedPositionsInCacheRefs.push( ref );
-            }
-            assert( mNumOfUnusedEntries > 0 );
-            --mNumOfUnusedEntries;
-            assert(_toRemove->second.usageCount == 0);
-            auto result = mCache.erase( _toRemove );
-            T* toDel = _toRemove->first;
-            delete _toRemove;
-            delete toDel;
-            assert( checkNumOfUnusedEntries() );
-            return result;
-        }
-        
+        void unlink( Stripe& _stripe, TypeInfoPair<T,Info>* _entry );
+
         /**
-         * Removes the entry at the given position in the cache.
-         * @param _toRemove The position to the entry to remove from the cache.
-         * @return An iterator to the entry in the cache right after the entry which has to be removed.
+         * Inserts the entry in its stripe, whose lock must be held.
          */
-        typename Container::iterator erase( typename Container::iterator _toRemove )
-        {
-            assert( checkNumOfUnusedEntries() );
-            std::lock_guard<std::recursive_mutex> lock( mMutex );
-            assert( (*_toRemove)->second.usageCount == 0 );
-            for( const Ref& ref : (*_toRemove)->second.refStoragePositions )
-            {
-                mCacheRefs[ref] = nullptr;
-                assert (ref > 0);
-                mUnusedPositionsInCacheRefs.push( ref );
-            }
-            assert( mNumOfUnusedEntries > 0 );
-            --mNumOfUnusedEntries;
-            assert((*_toRemove)->second.usageCount == 0);
-            T* toDel = (*_toRemove)->first;
-            TypeInfoPair<T,Info>* toDelB = *_toRemove;
-            auto result = mCache.erase( _toRemove );
-            delete toDelB;
-            delete toDel;
-            assert( checkNumOfUnusedEntries() );
-            return result;
-        }
-        
-        bool hasDuplicates(const std::vector<Ref>& _vec) const
-        {
-            std::set<Ref> vecEntries;
-            for (const Ref& r: _vec) {
-                if (!vecEntries.insert(r).second) {
-                    return true;
-                }
-            }
-            return false;
-        }
-        
-        bool checkNumOfUnusedEntries() const
-        {
-            std::size_t actualNumOfUnusedEntries = 0;
-            for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
-            {
-                if( (*iter)->second.usageCount == 0 )
-                {
-                    ++actualNumOfUnusedEntries;
-                }
-            }
-            return mNumOfUnusedEntries == actualNumOfUnusedEntries;
-        }
-        
-        size_t sumOfAllUsageCounts() const
-        {
-            std::size_t result = 0;
-            for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
-            {
-                result += (*iter)->second.usageCount;
-            }
-            return result;
-        }
-        
+        void link( Stripe& _stripe, TypeInfoPair<T,Info>* _entry );
+
+        /**
+         * Evicts unused entries from the given stripe, whose lock must be held, until it is small enough again.
+         * @param _victims The evicted entries, which must be destroyed by destroy() after releasing the lock.
+         */
+        void evict( Stripe& _stripe, std::vector<TypeInfoPair<T,Info>*>& _victims );
+
+        /**
+         * Destroys evicted entries and frees their references.
+         * No lock must be held, as destroying an object may deregister other entries.
+         */
+        void destroy( const std::vector<TypeInfoPair<T,Info>*>& _victims );
+
+        /**
+         * Destroys the retired entries which are not used anymore. Their references belong to the entry they were
+         * merged into and are kept. No lock must be held, as destroying an object may deregister other entries.
+         */
+        void reclaim();
+
+        /**
+         * @return A fresh reference.
+         * @throws std::length_error If the table of references is full.
+         */
+        Ref allocateRef();
     };
-    
+
 } // namespace carl
 
 
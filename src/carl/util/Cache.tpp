@@ -1,4 +1,4 @@
-/* 
+/*
  * File:   Cache.tpp
  * Author: Florian Corzilius
  *
@@ -11,278 +11,331 @@
 
 
 namespace carl
-{   
+{
     template<typename T>
     const typename Cache<T>::Ref Cache<T>::NO_REF = 0;
 
     template<typename T>
-    Cache<T>::Cache( size_t _maxCacheSize, double _cacheReductionAmount, double _decay ):
+    Cache<T>::Cache( std::size_t _maxCacheSize, double _cacheReductionAmount ):
         mMaxCacheSize( _maxCacheSize ),
-        mCacheReductionAmount( _cacheReductionAmount ), // TODO: use it, but without the effort of quick select
-        mDecay( _decay ),
-        mCache(),
-        mCacheRefs(),
+        mMaxStripeSize( std::max( _maxCacheSize / Stripes, std::size_t(1) ) ),
+        mCacheReductionAmount( _cacheReductionAmount ),
+        mStripes(),
+        mSlotBlocks( new std::atomic<Slot*>[SlotBlocks] ),
         mUnusedPositionsInCacheRefs()
     {
-        assert( _decay >= 0.9 && _decay <= 1.0 );
-        mCache.reserve( _maxCacheSize ); // TODO: maybe no reservation of memory and let it grow dynamically
-        mCacheRefs.reserve( _maxCacheSize ); // TODO: maybe no reservation of memory and let it grow dynamically
-        // reserve the first entry with index 0 as default
-        mCacheRefs.push_back( nullptr ); 
+        assert( _cacheReductionAmount >= 0.0 && _cacheReductionAmount < 1.0 );
+        for( std::size_t i = 0; i < SlotBlocks; ++i )
+            mSlotBlocks[i].store( nullptr, std::memory_order_relaxed );
+        // The first reference is reserved as NO_REF.
+        mSlotBlocks[0].store( new Slot[SlotBlockSize], std::memory_order_release );
     }
-    
+
     template<typename T>
     Cache<T>::~Cache()
     {
-        mCacheRefs.clear();
-        while( !mCache.empty() )
+        for( TypeInfoPair<T,Info>* tip : mRetired )
         {
-            TypeInfoPair<T,Info>* tip = *mCache.begin();
-            mCache.erase( mCache.begin() );
-            T* t = tip->first;
+            delete tip->first;
             delete tip;
-            delete t;
         }
+        for( auto& s : mStripes )
+        {
+            for( TypeInfoPair<T,Info>* tip : s.clock )
+            {
+                delete tip->first;
+                delete tip;
+            }
+        }
+        for( std::size_t i = 0; i < SlotBlocks; ++i )
+            delete[] mSlotBlocks[i].load( std::memory_order_relaxed );
     }
-    
+
     template<typename T>
-    std::pair<typename Cache<T>::Ref,bool> Cache<T>::cache( T* _toCache, bool (*_canBeUpdated)( const T&, const T& ), void (*_update)( const T&, const T& ) )
+    typename Cache<T>::Ref Cache<T>::allocateRef()
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        if( mCache.size() >= mMaxCacheSize ) // Clean, if the number of elements in the cache exceeds the threshold.
+        std::lock_guard<std::mutex> lock( mRefMutex );
+        if( !mUnusedPositionsInCacheRefs.empty() ) // Try to take the reference from the stack of old ones.
         {
-            clean();
+            Ref res = mUnusedPositionsInCacheRefs.top();
+            mUnusedPositionsInCacheRefs.pop();
+            return res;
         }
-        auto newElement = new TypeInfoPair<T,Info>(_toCache, Info(mMaxActivity));
-        auto ret = mCache.insert( newElement );
-        
+        std::size_t block = mNumOfRefs >> SlotBlockBits;
+        if( block >= SlotBlocks )
+            throw std::length_error( "Cache: all " + std::to_string( SlotBlocks * SlotBlockSize ) + " references are in use" );
+        Ref res = mNumOfRefs++;
+        if( mSlotBlocks[block].load( std::memory_order_relaxed ) == nullptr )
+            mSlotBlocks[block].store( new Slot[SlotBlockSize], std::memory_order_release );
+        return res;
+    }
+
+    template<typename T>
+    bool Cache<T>::inUse( const TypeInfoPair<T,Info>* _entry ) const
+    {
+        return cacheExternalUsage( *_entry->first, [this, _entry]()
+        {
+            std::size_t usage = 0;
+            for( Ref ref : _entry->second.refStoragePositions )
+                usage += slot( ref ).usageCount.load( std::memory_order_acquire );
+            return usage;
+        } ) > 0;
+    }
+
+    template<typename T>
+    void Cache<T>::link( Stripe& _stripe, TypeInfoPair<T,Info>* _entry )
+    {
+        _entry->second.clockPosition = _stripe.clock.size();
+        _stripe.clock.push_back( _entry );
+        _stripe.size.store( _stripe.clock.size(), std::memory_order_relaxed );
+    }
+
+    template<typename T>
+    void Cache<T>::unlink( Stripe& _stripe, TypeInfoPair<T,Info>* _entry )
+    {
+        std::size_t pos = _entry->second.clockPosition;
+        assert( _stripe.clock[pos] == _entry );
+        _stripe.clock[pos] = _stripe.clock.back();
+        _stripe.clock[pos]->second.clockPosition = pos;
+        _stripe.clock.pop_back();
+        _stripe.size.store( _stripe.clock.size(), std::memory_order_relaxed );
+    }
+
+    template<typename T>
+    std::pair<typename Cache<T>::Ref,bool> Cache<T>::cache( T* _toCache, bool (*_canBeUpdated)( const T&, const T& ), void (*_update)( const T&, const T& ) )
+    {
+        std::size_t stripeId = stripe( _toCache->getHash() );
+        Stripe& s = mStripes[stripeId];
+        std::vector<TypeInfoPair<T,Info>*> victims;
+        auto newElement = new TypeInfoPair<T,Info>( std::piecewise_construct, std::forward_as_tuple( _toCache ), std::forward_as_tuple( stripeId ) );
+        std::unique_lock<std::recursive_mutex> lock( s.mutex );
+        auto ret = s.entries.insert( newElement );
+
         if( !ret.second ) // There is already an equal object in the cache.
         {
+            delete newElement;
+            TypeInfoPair<T,Info>* element = *ret.first;
+            Ref ref = element->second.refStoragePositions.front();
+            assert( ref != NO_REF );
+            reg( ref );
+            ++s.hits;
             // Try to update the entry in the cache by the information in the given object.
-            if( (*_canBeUpdated)( *((*ret.first)->first), *_toCache ) )
+            bool update = (*_canBeUpdated)( *element->first, *_toCache );
+            lock.unlock();
+            if( update )
             {
-                TypeInfoPair<T,Info>* element = *ret.first;
                 (*_update)( *element->first, *_toCache );
-                mCache.erase( ret.first );
-                element->first->rehash();
-                auto retB = mCache.insert( element );
-                assert( retB.second );
-                for( const Ref& ref : element->second.refStoragePositions )
-                    mCacheRefs[ref] = *retB.first;
-                delete newElement;
-                Info& info = (*retB.first)->second;
-                assert( info.refStoragePositions.size() > 0);
-                assert( info.refStoragePositions.front() > 0 );
-                info.refStoragePositions.insert( info.refStoragePositions.end(), element->second.refStoragePositions.begin(), element->second.refStoragePositions.end() );
-                return std::make_pair( info.refStoragePositions.front(), false );
+                rehash( ref );
             }
-            else
-                delete newElement;
+            return std::make_pair( ref, false );
         }
-        else // Create a new entry in the cache.
+        // Create a new entry in the cache.
+        Ref ref;
+        try
         {
-            if( mUnusedPositionsInCacheRefs.empty() ) // Get a brand new reference.
-            {
-                assert( mCacheRefs.size() > 0);
-                (*ret.first)->second.refStoragePositions.push_back( mCacheRefs.size() );
-                assert( !hasDuplicates( (*ret.first)->second.refStoragePositions ) );
-                mCacheRefs.push_back( newElement );
-            }
-            else // Try to take the reference from the stack of old ones.
-            {
-                mCacheRefs[mUnusedPositionsInCacheRefs.top()] = newElement;
-                assert( mUnusedPositionsInCacheRefs.top() > 0);
-                newElement->second.refStoragePositions.push_back( mUnusedPositionsInCacheRefs.top() );
-                assert( !hasDuplicates( newElement->second.refStoragePositions ) );
-                mUnusedPositionsInCacheRefs.pop();
-            }
-            assert( mNumOfUnusedEntries < std::numeric_limits<ContentType>::max() );
-            ++mNumOfUnusedEntries;
+            ref = allocateRef();
         }
-        assert( (*ret.first)->second.refStoragePositions.size() > 0);
-        assert( (*ret.first)->second.refStoragePositions.front() > 0 );
-        return std::make_pair( (*ret.first)->second.refStoragePositions.front(), ret.second );
-    }
-    
-    template<typename T>
-    void Cache<T>::reg( Ref _refStoragePos )
-    {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        assert( _refStoragePos < mCacheRefs.size() );
-        TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
-        assert( cacheRef != nullptr );
-        if( cacheRef->second.usageCount == 0 )
+        catch( ... )
         {
-            assert( mNumOfUnusedEntries > 0 );
-            --mNumOfUnusedEntries;
+            s.entries.erase( newElement );
+            delete newElement;
+            throw;
         }
-        assert( cacheRef->second.usageCount < std::numeric_limits<ContentType>::max() );
-        ++cacheRef->second.usageCount;
+        newElement->second.refStoragePositions.push_back( ref );
+        Slot& sl = slot( ref );
+        sl.usageCount.store( 1, std::memory_order_relaxed );
+        sl.entry.store( newElement, std::memory_order_release );
+        link( s, newElement );
+        ++s.misses;
+        bool full = s.clock.size() > mMaxStripeSize;
+        if( full )
+            evict( s, victims );
+        lock.unlock();
+        destroy( victims );
+        if( full )
+            reclaim();
+        return std::make_pair( ref, true );
     }
-    
+
     template<typename T>
     void Cache<T>::dereg( Ref _refStoragePos )
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        assert( _refStoragePos < mCacheRefs.size() );
-        TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
-        assert( cacheRef != nullptr );
-        assert( cacheRef->second.usageCount > 0 );
-        --cacheRef->second.usageCount;
-        if( cacheRef->second.usageCount == 0 ) // no more usage
+        std::size_t stripeId = entry( _refStoragePos )->second.stripe.load( std::memory_order_relaxed );
+        std::size_t previous = slot( _refStoragePos ).usageCount.fetch_sub( 1, std::memory_order_acq_rel );
+        assert( previous > 0 );
+        // The entry must not be accessed anymore, it may be evicted concurrently.
+        // It may have become unused, except for a reference from itself.
+        if( previous <= 2 && mStripes[stripeId].size.load( std::memory_order_relaxed ) > mMaxStripeSize )
         {
-            assert( mNumOfUnusedEntries < std::numeric_limits<ContentType>::max() );
-            ++mNumOfUnusedEntries;
-            // If the cache contains more used elements than the maximum desired cache size, remove this entry directly.
-            if( mCache.size() - mNumOfUnusedEntries >= mMaxCacheSize )
+            std::vector<TypeInfoPair<T,Info>*> victims;
             {
-                erase( cacheRef );
+                std::lock_guard<std::recursive_mutex> lock( mStripes[stripeId].mutex );
+                evict( mStripes[stripeId], victims );
             }
+            destroy( victims );
+            reclaim();
         }
     }
-    
+
     template<typename T>
     void Cache<T>::rehash( Ref _refStoragePos )
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        assert( _refStoragePos < mCacheRefs.size() );
-        TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
-        assert( cacheRef != nullptr );
-        mCache.erase( cacheRef );
+        TypeInfoPair<T,Info>* cacheRef = entry( _refStoragePos );
+        {
+            // The entry is found by its old hash, hence it is removed before being rehashed.
+            Stripe& s = mStripes[cacheRef->second.stripe.load( std::memory_order_relaxed )];
+            std::lock_guard<std::recursive_mutex> lock( s.mutex );
+            auto erased = s.entries.erase( cacheRef );
+            assert( erased == 1 );
+            (void)erased;
+            unlink( s, cacheRef );
+        }
         cacheRef->first->rehash();
+        std::size_t stripeId = stripe( cacheRef->first->getHash() );
+        Stripe& s = mStripes[stripeId];
+        std::unique_lock<std::recursive_mutex> lock( s.mutex );
+        auto ret = s.entries.insert( cacheRef );
+        if( ret.second )
+        {
+            cacheRef->second.stripe.store( stripeId, std::memory_order_relaxed );
+            link( s, cacheRef );
+            return;
+        }
+        // Merge with the equal entry, the usage counters stay with the references.
+        Info& info = (*ret.first)->second;
         const Info& infoB = cacheRef->second;
-        auto ret = mCache.insert( cacheRef );
-        if( !ret.second )
+        info.refStoragePositions.insert( info.refStoragePositions.end(), infoB.refStoragePositions.begin(), infoB.refStoragePositions.end() );
+        for( const Ref& ref : infoB.refStoragePositions )
+        {
+            slot( ref ).entry.store( *(ret.first), std::memory_order_release );
+        }
+        lock.unlock();
+        std::lock_guard<std::mutex> refLock( mRefMutex );
+        mRetired.push_back( cacheRef );
+    }
+
+    template<typename T>
+    void Cache<T>::evict( Stripe& _stripe, std::vector<TypeInfoPair<T,Info>*>& _victims )
+    {
+        CARL_LOG_TRACE( "carl.util.cache", "Cleaning cache..." );
+        std::size_t target = std::size_t( double(mMaxStripeSize) * (1.0 - mCacheReductionAmount) );
+        // Activities are halved whenever the hand passes, after some rounds unused entries are evicted regardless.
+        std::size_t steps = 4 * _stripe.clock.size();
+        while( _stripe.clock.size() > target && steps > 0 )
         {
-            Info& info = (*ret.first)->second;
-            if( infoB.usageCount == 0 )
+            --steps;
+            if( _stripe.hand >= _stripe.clock.size() ) _stripe.hand = 0;
+            TypeInfoPair<T,Info>* cur = _stripe.clock[_stripe.hand];
+            std::size_t activity = cur->second.activity.load( std::memory_order_relaxed );
+            if( inUse( cur ) )
             {
-                assert( mNumOfUnusedEntries > 0 );
-                --mNumOfUnusedEntries;
+                ++_stripe.hand;
             }
-            else if( info.usageCount == 0 )
+            else if( activity > 0 && steps >= _stripe.clock.size() )
             {
-                assert( mNumOfUnusedEntries > 0 );
-                --mNumOfUnusedEntries;
+                cur->second.activity.store( activity / 2, std::memory_order_relaxed );
+                ++_stripe.hand;
             }
-            assert( info.usageCount + infoB.usageCount >= info.usageCount );
-            info.usageCount += infoB.usageCount;
-            info.refStoragePositions.insert( info.refStoragePositions.end(), infoB.refStoragePositions.begin(), infoB.refStoragePositions.end() );
-            assert( !hasDuplicates( info.refStoragePositions ) );
-            assert( std::find( infoB.refStoragePositions.begin(), infoB.refStoragePositions.end(), _refStoragePos ) != infoB.refStoragePositions.end() );
-            for( const Ref& ref : infoB.refStoragePositions )
+            else
             {
-                assert( mCacheRefs[ref] != *(ret.first) );
-                mCacheRefs[ref] = *(ret.first);
+                // The hand now points to the entry that replaces the evicted one.
+                _stripe.entries.erase( cur );
+                unlink( _stripe, cur );
+                ++_stripe.evictions;
+                _victims.push_back( cur );
             }
-            delete cacheRef->first;
-            delete cacheRef;
         }
     }
-    
+
     template<typename T>
-    void Cache<T>::clean()
+    void Cache<T>::destroy( const std::vector<TypeInfoPair<T,Info>*>& _victims )
     {
-        CARL_LOG_TRACE( "carl.util.cache", "Cleaning cache..." );
-        if( double(mNumOfUnusedEntries) < (double(mCache.size()) * mCacheReductionAmount) )
+        for( TypeInfoPair<T,Info>* victim : _victims )
         {
-            if( mNumOfUnusedEntries > 0 )
+            // May deregister the entry itself, hence its references are freed afterwards.
+            delete victim->first;
+            std::lock_guard<std::mutex> lock( mRefMutex );
+            for( const Ref& ref : victim->second.refStoragePositions )
             {
-                // There are less entries we can delete than we want to delete: just delete them all
-                for( auto iter = mCache.begin(); iter != mCache.end(); )
-                {
-                    if( (*iter)->second.usageCount == 0 )
-                    {
-                        iter = erase( iter );
-                    }
-                    else
-                    {
-                        ++iter;
-                    }
-                }
+                assert( slot( ref ).usageCount.load() == 0 );
+                slot( ref ).entry.store( nullptr, std::memory_order_relaxed );
+                mUnusedPositionsInCacheRefs.push( ref );
             }
-            assert( mNumOfUnusedEntries == 0 );
+            delete victim;
         }
-        else
+    }
+
+    template<typename T>
+    void Cache<T>::reclaim()
+    {
+        std::vector<TypeInfoPair<T,Info>*> drained;
         {
-            std::vector<typename Container::iterator> noUsageEntries;
-            // Calculate the expected median of the activities of all entries in the cache with no usage.
-            double limit = 0.0;
-            for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
+            std::lock_guard<std::mutex> lock( mRefMutex );
+            for( std::size_t i = 0; i < mRetired.size(); )
             {
-                if( (*iter)->second.usageCount == 0 )
+                if( inUse( mRetired[i] ) )
                 {
-                    noUsageEntries.push_back( iter );
-                    limit += (*iter)->second.activity;
+                    ++i;
                 }
-            }
-            limit = limit / double(noUsageEntries.size());
-            // Remove all entries in the cache with no usage, which have an activity below the calculated median.
-            for( auto iter = noUsageEntries.begin(); iter != noUsageEntries.end(); ++iter )
-            {
-                if( (**iter)->second.activity <= limit )
+                else
                 {
-                    erase( *iter );
+                    drained.push_back( mRetired[i] );
+                    mRetired[i] = mRetired.back();
+                    mRetired.pop_back();
                 }
             }
         }
+        for( TypeInfoPair<T,Info>* tip : drained )
+        {
+            delete tip->first;
+            delete tip;
+        }
     }
-    
-    template<typename T>
-    void Cache<T>::decayActivity()
-    {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        mActivityIncrement *= (1 / mDecay);
-    }
-    
+
     template<typename T>
-    void Cache<T>::strengthenActivity( Ref _refStoragePos )
+    typename Cache<T>::Statistics Cache<T>::statistics()
     {
-        assert( _refStoragePos < mCacheRefs.size() );
-        TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
-        assert( cacheRef != nullptr );
-        // update the activity of the cache entry at the given position
-        if( (cacheRef->second.activity += mActivityIncrement) > mActivityThreshold )
+        Statistics res;
+        for( auto& s : mStripes )
         {
-            std::lock_guard<std::recursive_mutex> lock( mMutex );
-            // rescale if the threshold for the maximum activity has been exceeded
-            for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
-                (*iter)->second.activity *= mActivityDecrementFactor;
-            mActivityIncrement *= mActivityDecrementFactor;
-            mMaxActivity *= mActivityDecrementFactor;
+            std::lock_guard<std::recursive_mutex> lock( s.mutex );
+            res.hits += s.hits;
+            res.misses += s.misses;
+            res.evictions += s.evictions;
+            res.size += s.clock.size();
         }
-        // update the maximum activity
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        if( mMaxActivity < cacheRef->second.activity )
-            mMaxActivity = cacheRef->second.activity;
+        return res;
     }
-    
+
     template<typename T>
-    void Cache<T>::print( std::ostream& _out ) const
+    void Cache<T>::print( std::ostream& _out )
     {
+        Statistics stats = statistics();
         _out << "General cache information:" << std::endl;
         _out << "   desired maximum cache size                                 : "  << mMaxCacheSize << std::endl;
-        _out << "   number of unused entries                                   : "  << mNumOfUnusedEntries << std::endl;
-        _out << "   desired reduction amount when cleaning the cache (not used): "  << mCacheReductionAmount << std::endl;
-        _out << "   maximum of all activities                                  : "  << mMaxActivity << std::endl;
-        _out << "   the current value of the activity increment                : "  << mActivityIncrement << std::endl;
-        _out << "   decay factor for the given activities                      : "  << mDecay << std::endl;
-        _out << "   upper bound of the activities                              : "  << mActivityThreshold << std::endl;
-        _out << "   scaling factor of the activities                           : "  << mActivityDecrementFactor << std::endl;
-        _out << "   current size of the cache                                  : "  << mCache.size() << std::endl;
-        _out << "   number of yet involved references                          : "  << mCacheRefs.size() << std::endl;
-        _out << "   number of currently freed references                       : "  << mUnusedPositionsInCacheRefs.size() << std::endl;
+        _out << "   desired reduction amount when cleaning a stripe            : "  << mCacheReductionAmount << std::endl;
+        _out << "   current size of the cache                                  : "  << stats.size << std::endl;
+        _out << "   hits / misses / evictions                                  : "  << stats.hits << " / " << stats.misses << " / " << stats.evictions << std::endl;
+        {
+            std::lock_guard<std::mutex> lock( mRefMutex );
+            _out << "   number of yet involved references                          : "  << mNumOfRefs << std::endl;
+            _out << "   number of currently freed references                       : "  << mUnusedPositionsInCacheRefs.size() << std::endl;
+        }
         _out << "Cache contains:" << std::endl;
-        for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
+        for( auto& s : mStripes )
         {
-            assert( (*iter)->first != nullptr );
-            _out << "   " << *(*iter)->first << std::endl;
-            _out << "                       usage count: " << (*iter)->second.usageCount << std::endl;
-            _out << "        reference storage positions:";
-            for( Ref ref : (*iter)->second.refStoragePositions )
-                _out << "  " << ref;
-            _out << "                          activity: " << (*iter)->second.activity << std::endl;
+            std::lock_guard<std::recursive_mutex> lock( s.mutex );
+            for( const TypeInfoPair<T,Info>* tip : s.clock )
+            {
+                assert( tip->first != nullptr );
+                _out << "   " << *tip->first << std::endl;
+                _out << "        reference storage positions (usage count):";
+                for( Ref ref : tip->second.refStoragePositions )
+                    _out << "  " << ref << " (" << slot( ref ).usageCount.load() << ")";
+                _out << std::endl;
+                _out << "                          activity: " << tip->second.activity.load() << std::endl;
+            }
         }
     }
-    
+
 } // namespace carl
@@ -0,0 +1,2108 @@
+#include "CompileInfo.h"
+
+namespace carl {
+
+const std::string CompileInfo::SystemName = "Linux";
+const std::string CompileInfo::SystemVersion = "6.18.44-fc-v139";
+const std::string CompileInfo::BuildType = "RELEASE";
+const std::string CompileInfo::CXXCompiler = "/usr/bin/c++";
+const std::string CompileInfo::CXXCompilerVersion = "12.2.0";
+const std::string CompileInfo::GitRevisionSHA1 = "";
+
+std::ostream& operator<<(std::ostream& os, CMakeOptionPrinter cmop) {
+	auto print = [&os,&cmop](bool advanced, const std::string& type, const std::string& key, const std::string& value) {
+		if (advanced && !cmop.advanced) return;
+		if (type.empty()) return;
+		if (key.empty()) return;
+		if (key[0] == '_') return;
+		if (value.find('\n') == std::string::npos) {
+			os << key << " = " << value << std::endl;
+		} else {
+			os << key << " has multiple lines." << std::endl;
+		}
+	};
+
+	
+	print(false, "BOOL", "ALLWARNINGS", R"VAR(OFF)VAR");
+	print(false, "STRING", "BENCHMARK_REPETITIONS", R"VAR(5)VAR");
+	print(false, "PATH", "BIN_INSTALL_DIR", R"VAR(/usr/local/lib)VAR");
+	print(false, "PATH", "BIN_INSTALL_DIR", R"VAR(/usr/local/lib)VAR");
+	print(false, "", "BOOST_COMPONENTS", R"VAR(system;program_options;regex;unit_test_framework;timer;chrono)VAR");
+	print(false, "", "BOOST_FOUND", R"VAR(TRUE)VAR");
+	print(false, "", "BOOST_HAS_STACKTRACE", R"VAR(1)VAR");
+	print(false, "BOOL", "BUCHBERGER_STATISTICS", R"VAR(OFF)VAR");
+	print(false, "BOOL", "BUILD_ADDONS", R"VAR(OFF)VAR");
+	print(false, "BOOL", "BUILD_DOXYGEN", R"VAR(OFF)VAR");
+	print(false, "", "Boost_CHRONO_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_CHRONO_HEADER", R"VAR(ON)VAR");
+	print(false, "", "Boost_CHRONO_HEADER_NAME", R"VAR(boost/chrono.hpp)VAR");
+	print(false, "", "Boost_CHRONO_LIBRARIES", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_chrono.a)VAR");
+	print(false, "", "Boost_CHRONO_LIBRARY", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_chrono.a)VAR");
+	print(true, "FILEPATH", "Boost_CHRONO_LIBRARY_DEBUG", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_chrono.a)VAR");
+	print(true, "FILEPATH", "Boost_CHRONO_LIBRARY_RELEASE", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_chrono.a)VAR");
+	print(true, "PATH", "Boost_DIR", R"VAR(/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0)VAR");
+	print(false, "", "Boost_FOUND", R"VAR(TRUE)VAR");
+	print(true, "PATH", "Boost_INCLUDE_DIR", R"VAR(/usr/include)VAR");
+	print(false, "", "Boost_INCLUDE_DIRS", R"VAR(/usr/include)VAR");
+	print(false, "", "Boost_LIBRARIES", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_system.a;/usr/lib/x86_64-linux-gnu/libboost_program_options.a;/usr/lib/x86_64-linux-gnu/libboost_regex.a;/usr/lib/x86_64-linux-gnu/libboost_unit_test_framework.a;/usr/lib/x86_64-linux-gnu/libboost_timer.a;/usr/lib/x86_64-linux-gnu/libboost_chrono.a)VAR");
+	print(false, "", "Boost_LIBRARY_DIRS", R"VAR(/usr/lib/x86_64-linux-gnu)VAR");
+	print(true, "PATH", "Boost_LIBRARY_DIR_DEBUG", R"VAR(/usr/lib/x86_64-linux-gnu)VAR");
+	print(true, "PATH", "Boost_LIBRARY_DIR_RELEASE", R"VAR(/usr/lib/x86_64-linux-gnu)VAR");
+	print(false, "", "Boost_LIB_PREFIX", R"VAR()VAR");
+	print(false, "", "Boost_LIB_VERSION", R"VAR(1_74)VAR");
+	print(false, "", "Boost_MAJOR_VERSION", R"VAR(1)VAR");
+	print(false, "", "Boost_MINOR_VERSION", R"VAR(74)VAR");
+	print(false, "", "Boost_NAMESPACE", R"VAR(boost)VAR");
+	print(false, "UNINITIALIZED", "Boost_NO_BOOST_CMAKE", R"VAR(ON)VAR");
+	print(false, "", "Boost_PROGRAM_OPTIONS_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_PROGRAM_OPTIONS_HEADER", R"VAR(ON)VAR");
+	print(false, "", "Boost_PROGRAM_OPTIONS_HEADER_NAME", R"VAR(boost/program_options.hpp)VAR");
+	print(false, "", "Boost_PROGRAM_OPTIONS_LIBRARIES", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_program_options.a)VAR");
+	print(false, "", "Boost_PROGRAM_OPTIONS_LIBRARY", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_program_options.a)VAR");
+	print(true, "FILEPATH", "Boost_PROGRAM_OPTIONS_LIBRARY_DEBUG", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_program_options.a)VAR");
+	print(true, "FILEPATH", "Boost_PROGRAM_OPTIONS_LIBRARY_RELEASE", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_program_options.a)VAR");
+	print(false, "", "Boost_REGEX_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_REGEX_HEADER", R"VAR(ON)VAR");
+	print(false, "", "Boost_REGEX_HEADER_NAME", R"VAR(boost/regex.hpp)VAR");
+	print(false, "", "Boost_REGEX_LIBRARIES", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_regex.a)VAR");
+	print(false, "", "Boost_REGEX_LIBRARY", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_regex.a)VAR");
+	print(true, "FILEPATH", "Boost_REGEX_LIBRARY_DEBUG", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_regex.a)VAR");
+	print(true, "FILEPATH", "Boost_REGEX_LIBRARY_RELEASE", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_regex.a)VAR");
+	print(false, "", "Boost_SUBMINOR_VERSION", R"VAR(0)VAR");
+	print(false, "", "Boost_SYSTEM_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_SYSTEM_HEADER", R"VAR(ON)VAR");
+	print(false, "", "Boost_SYSTEM_HEADER_NAME", R"VAR(boost/system/config.hpp)VAR");
+	print(false, "", "Boost_SYSTEM_LIBRARIES", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_system.a)VAR");
+	print(false, "", "Boost_SYSTEM_LIBRARY", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_system.a)VAR");
+	print(true, "FILEPATH", "Boost_SYSTEM_LIBRARY_DEBUG", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_system.a)VAR");
+	print(true, "FILEPATH", "Boost_SYSTEM_LIBRARY_RELEASE", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_system.a)VAR");
+	print(false, "", "Boost_TIMER_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_TIMER_HEADER", R"VAR(ON)VAR");
+	print(false, "", "Boost_TIMER_HEADER_NAME", R"VAR(boost/timer.hpp)VAR");
+	print(false, "", "Boost_TIMER_LIBRARIES", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_timer.a)VAR");
+	print(false, "", "Boost_TIMER_LIBRARY", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_timer.a)VAR");
+	print(true, "FILEPATH", "Boost_TIMER_LIBRARY_DEBUG", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_timer.a)VAR");
+	print(true, "FILEPATH", "Boost_TIMER_LIBRARY_RELEASE", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_timer.a)VAR");
+	print(false, "", "Boost_UNIT_TEST_FRAMEWORK_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_UNIT_TEST_FRAMEWORK_HEADER", R"VAR(ON)VAR");
+	print(false, "", "Boost_UNIT_TEST_FRAMEWORK_HEADER_NAME", R"VAR(boost/test/framework.hpp)VAR");
+	print(false, "", "Boost_UNIT_TEST_FRAMEWORK_LIBRARIES", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_unit_test_framework.a)VAR");
+	print(false, "", "Boost_UNIT_TEST_FRAMEWORK_LIBRARY", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_unit_test_framework.a)VAR");
+	print(true, "FILEPATH", "Boost_UNIT_TEST_FRAMEWORK_LIBRARY_DEBUG", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_unit_test_framework.a)VAR");
+	print(true, "FILEPATH", "Boost_UNIT_TEST_FRAMEWORK_LIBRARY_RELEASE", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_unit_test_framework.a)VAR");
+	print(false, "", "Boost_USE_DEBUG_LIBS", R"VAR(TRUE)VAR");
+	print(false, "", "Boost_USE_DEBUG_RUNTIME", R"VAR(OFF)VAR");
+	print(false, "", "Boost_USE_MULTITHREADED", R"VAR(TRUE)VAR");
+	print(false, "", "Boost_USE_RELEASE_LIBS", R"VAR(TRUE)VAR");
+	print(false, "", "Boost_USE_STATIC_LIBS", R"VAR(ON)VAR");
+	print(false, "", "Boost_VERSION", R"VAR(107400)VAR");
+	print(false, "", "Boost_VERSION_COUNT", R"VAR(3)VAR");
+	print(false, "", "Boost_VERSION_MACRO", R"VAR(107400)VAR");
+	print(false, "", "Boost_VERSION_MAJOR", R"VAR(1)VAR");
+	print(false, "", "Boost_VERSION_MINOR", R"VAR(74)VAR");
+	print(false, "", "Boost_VERSION_PATCH", R"VAR(0)VAR");
+	print(false, "", "Boost_VERSION_STRING", R"VAR(1.74.0)VAR");
+	print(false, "", "Boost_chrono_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_program_options_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_regex_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_system_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_timer_FOUND", R"VAR(ON)VAR");
+	print(false, "", "Boost_unit_test_framework_FOUND", R"VAR(ON)VAR");
+	print(false, "", "CARL_LIBRARIES_DIR", R"VAR(/root/repo/_gate_build/lib)VAR");
+	print(false, "FILEPATH", "CLANG_FORMAT", R"VAR(CLANG_FORMAT-NOTFOUND)VAR");
+	print(false, "STRING", "CLANG_SANITIZER", R"VAR(none)VAR");
+	print(false, "FILEPATH", "CLANG_TIDY", R"VAR(CLANG_TIDY-NOTFOUND)VAR");
+	print(true, "FILEPATH", "CMAKE_ADDR2LINE", R"VAR(/usr/bin/addr2line)VAR");
+	print(true, "FILEPATH", "CMAKE_AR", R"VAR(/usr/bin/ar)VAR");
+	print(true, "FILEPATH", "CMAKE_AR", R"VAR(/usr/bin/ar)VAR");
+	print(false, "", "CMAKE_AUTOGEN_ORIGIN_DEPENDS", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_AUTOMOC_COMPILER_PREDEFINES", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_AUTOMOC_MACRO_NAMES", R"VAR(Q_OBJECT;Q_GADGET;Q_NAMESPACE;Q_NAMESPACE_EXPORT)VAR");
+	print(false, "", "CMAKE_AUTOMOC_PATH_PREFIX", R"VAR(OFF)VAR");
+	print(false, "", "CMAKE_BASE_NAME", R"VAR(g++)VAR");
+	print(false, "", "CMAKE_BINARY_DIR", R"VAR(/root/repo/_gate_build)VAR");
+	print(false, "", "CMAKE_BUILD_TOOL", R"VAR(/usr/bin/gmake)VAR");
+	print(false, "STRING", "CMAKE_BUILD_TYPE", R"VAR(RELEASE)VAR");
+	print(false, "", "CMAKE_BUILD_WITH_INSTALL_RPATH", R"VAR(FALSE)VAR");
+	print(false, "INTERNAL", "CMAKE_CACHEFILE_DIR", R"VAR(/root/repo/_gate_build)VAR");
+	print(false, "INTERNAL", "CMAKE_CACHE_MAJOR_VERSION", R"VAR(3)VAR");
+	print(false, "INTERNAL", "CMAKE_CACHE_MINOR_VERSION", R"VAR(25)VAR");
+	print(false, "INTERNAL", "CMAKE_CACHE_PATCH_VERSION", R"VAR(1)VAR");
+	print(false, "", "CMAKE_CFG_INTDIR", R"VAR(.)VAR");
+	print(true, "BOOL", "CMAKE_COLOR_MAKEFILE", R"VAR(ON)VAR");
+	print(false, "INTERNAL", "CMAKE_COMMAND", R"VAR(/usr/bin/cmake)VAR");
+	print(false, "", "CMAKE_COMPILER_IS_GNUCXX", R"VAR(1)VAR");
+	print(false, "INTERNAL", "CMAKE_CPACK_COMMAND", R"VAR(/usr/bin/cpack)VAR");
+	print(false, "", "CMAKE_CROSSCOMPILING", R"VAR(FALSE)VAR");
+	print(false, "INTERNAL", "CMAKE_CTEST_COMMAND", R"VAR(/usr/bin/ctest)VAR");
+	print(false, "", "CMAKE_CURRENT_BINARY_DIR", R"VAR(/root/repo/_gate_build/src/carl/util)VAR");
+	print(false, "", "CMAKE_CURRENT_LIST_DIR", R"VAR(/root/repo/src/carl/util)VAR");
+	print(false, "", "CMAKE_CURRENT_LIST_FILE", R"VAR(/root/repo/src/carl/util/CMakeLists.txt)VAR");
+	print(false, "", "CMAKE_CURRENT_SOURCE_DIR", R"VAR(/root/repo/src/carl/util)VAR");
+	print(false, "", "CMAKE_CXX11_COMPILE_FEATURES", R"VAR(cxx_std_11;cxx_alias_templates;cxx_alignas;cxx_alignof;cxx_attributes;cxx_auto_type;cxx_constexpr;cxx_decltype;cxx_decltype_incomplete_return_types;cxx_default_function_template_args;cxx_defaulted_functions;cxx_defaulted_move_initializers;cxx_delegating_constructors;cxx_deleted_functions;cxx_enum_forward_declarations;cxx_explicit_conversions;cxx_extended_friend_declarations;cxx_extern_templates;cxx_final;cxx_func_identifier;cxx_generalized_initializers;cxx_inheriting_constructors;cxx_inline_namespaces;cxx_lambdas;cxx_local_type_template_args;cxx_long_long_type;cxx_noexcept;cxx_nonstatic_member_init;cxx_nullptr;cxx_override;cxx_range_for;cxx_raw_string_literals;cxx_reference_qualified_functions;cxx_right_angle_brackets;cxx_rvalue_references;cxx_sizeof_member;cxx_static_assert;cxx_strong_enums;cxx_thread_local;cxx_trailing_return_types;cxx_unicode_literals;cxx_uniform_initialization;cxx_unrestricted_unions;cxx_user_literals;cxx_variadic_macros;cxx_variadic_templates)VAR");
+	print(false, "", "CMAKE_CXX11_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++11)VAR");
+	print(false, "", "CMAKE_CXX11_STANDARD_COMPILE_OPTION", R"VAR(-std=c++11)VAR");
+	print(false, "", "CMAKE_CXX11_STANDARD__HAS_FULL_SUPPORT", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_CXX14_COMPILE_FEATURES", R"VAR(cxx_std_14;cxx_aggregate_default_initializers;cxx_attribute_deprecated;cxx_binary_literals;cxx_contextual_conversions;cxx_decltype_auto;cxx_digit_separators;cxx_generic_lambdas;cxx_lambda_init_captures;cxx_relaxed_constexpr;cxx_return_type_deduction;cxx_variable_templates)VAR");
+	print(false, "", "CMAKE_CXX14_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++14)VAR");
+	print(false, "", "CMAKE_CXX14_STANDARD_COMPILE_OPTION", R"VAR(-std=c++14)VAR");
+	print(false, "", "CMAKE_CXX14_STANDARD__HAS_FULL_SUPPORT", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_CXX17_COMPILE_FEATURES", R"VAR(cxx_std_17)VAR");
+	print(false, "", "CMAKE_CXX17_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++17)VAR");
+	print(false, "", "CMAKE_CXX17_STANDARD_COMPILE_OPTION", R"VAR(-std=c++17)VAR");
+	print(false, "", "CMAKE_CXX20_COMPILE_FEATURES", R"VAR(cxx_std_20)VAR");
+	print(false, "", "CMAKE_CXX20_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++20)VAR");
+	print(false, "", "CMAKE_CXX20_STANDARD_COMPILE_OPTION", R"VAR(-std=c++20)VAR");
+	print(false, "", "CMAKE_CXX23_COMPILE_FEATURES", R"VAR(cxx_std_23)VAR");
+	print(false, "", "CMAKE_CXX23_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++23)VAR");
+	print(false, "", "CMAKE_CXX23_STANDARD_COMPILE_OPTION", R"VAR(-std=c++23)VAR");
+	print(false, "", "CMAKE_CXX98_COMPILE_FEATURES", R"VAR(cxx_std_98;cxx_template_template_parameters)VAR");
+	print(false, "", "CMAKE_CXX98_EXTENSION_COMPILE_OPTION", R"VAR(-std=gnu++98)VAR");
+	print(false, "", "CMAKE_CXX98_STANDARD_COMPILE_OPTION", R"VAR(-std=c++98)VAR");
+	print(false, "", "CMAKE_CXX98_STANDARD__HAS_FULL_SUPPORT", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_CXX_ABI_COMPILED", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_APPEND", R"VAR(<CMAKE_AR> q <TARGET> <LINK_FLAGS> <OBJECTS>)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_APPEND_IPO", R"VAR("/usr/bin/gcc-ar-12" r <TARGET> <LINK_FLAGS> <OBJECTS>)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_CREATE", R"VAR(<CMAKE_AR> qc <TARGET> <LINK_FLAGS> <OBJECTS>)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_CREATE_IPO", R"VAR("/usr/bin/gcc-ar-12" cr <TARGET> <LINK_FLAGS> <OBJECTS>)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_FINISH", R"VAR(<CMAKE_RANLIB> <TARGET>)VAR");
+	print(false, "", "CMAKE_CXX_ARCHIVE_FINISH_IPO", R"VAR("/usr/bin/gcc-ranlib-12" <TARGET>)VAR");
+	print(false, "", "CMAKE_CXX_BYTE_ORDER", R"VAR(LITTLE_ENDIAN)VAR");
+	print(false, "", "CMAKE_CXX_CL_SHOWINCLUDES_PREFIX", R"VAR()VAR");
+	print(true, "FILEPATH", "CMAKE_CXX_COMPILER", R"VAR(/usr/bin/c++)VAR");
+	print(true, "FILEPATH", "CMAKE_CXX_COMPILER", R"VAR(/usr/bin/c++)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_ABI", R"VAR(ELF)VAR");
+	print(true, "FILEPATH", "CMAKE_CXX_COMPILER_AR", R"VAR(/usr/bin/gcc-ar-12)VAR");
+	print(true, "FILEPATH", "CMAKE_CXX_COMPILER_AR", R"VAR(/usr/bin/gcc-ar-12)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_ARG1", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_ENV_VAR", R"VAR(CXX)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_FRONTEND_VARIANT", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_ID", R"VAR(GNU)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_ID_RUN", R"VAR(1)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_LOADED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_PREDEFINES_COMMAND", R"VAR(/usr/bin/c++;-dM;-E;-c;/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp)VAR");
+	print(true, "FILEPATH", "CMAKE_CXX_COMPILER_RANLIB", R"VAR(/usr/bin/gcc-ranlib-12)VAR");
+	print(true, "FILEPATH", "CMAKE_CXX_COMPILER_RANLIB", R"VAR(/usr/bin/gcc-ranlib-12)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_VERSION", R"VAR(12.2.0)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_VERSION_INTERNAL", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_WORKS", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_CXX_COMPILER_WRAPPER", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_FEATURES", R"VAR(cxx_std_98;cxx_template_template_parameters;cxx_std_11;cxx_alias_templates;cxx_alignas;cxx_alignof;cxx_attributes;cxx_auto_type;cxx_constexpr;cxx_decltype;cxx_decltype_incomplete_return_types;cxx_default_function_template_args;cxx_defaulted_functions;cxx_defaulted_move_initializers;cxx_delegating_constructors;cxx_deleted_functions;cxx_enum_forward_declarations;cxx_explicit_conversions;cxx_extended_friend_declarations;cxx_extern_templates;cxx_final;cxx_func_identifier;cxx_generalized_initializers;cxx_inheriting_constructors;cxx_inline_namespaces;cxx_lambdas;cxx_local_type_template_args;cxx_long_long_type;cxx_noexcept;cxx_nonstatic_member_init;cxx_nullptr;cxx_override;cxx_range_for;cxx_raw_string_literals;cxx_reference_qualified_functions;cxx_right_angle_brackets;cxx_rvalue_references;cxx_sizeof_member;cxx_static_assert;cxx_strong_enums;cxx_thread_local;cxx_trailing_return_types;cxx_unicode_literals;cxx_uniform_initialization;cxx_unrestricted_unions;cxx_user_literals;cxx_variadic_macros;cxx_variadic_templates;cxx_std_14;cxx_aggregate_default_initializers;cxx_attribute_deprecated;cxx_binary_literals;cxx_contextual_conversions;cxx_decltype_auto;cxx_digit_separators;cxx_generic_lambdas;cxx_lambda_init_captures;cxx_relaxed_constexpr;cxx_return_type_deduction;cxx_variable_templates;cxx_std_17;cxx_std_20;cxx_std_23)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OBJECT", R"VAR(<CMAKE_CXX_COMPILER> <DEFINES> <INCLUDES> <FLAGS> -o <OBJECT> -c <SOURCE>)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_COLOR_DIAGNOSTICS", R"VAR(-fdiagnostics-color=always)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_COLOR_DIAGNOSTICS_OFF", R"VAR(-fno-diagnostics-color)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_CREATE_PCH", R"VAR(-x;c++-header;-include;<PCH_HEADER>)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_EXPLICIT_LANGUAGE", R"VAR(-x;c++)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_INVALID_PCH", R"VAR(-Winvalid-pch)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_IPO", R"VAR(-flto=auto;-fno-fat-lto-objects)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_PIC", R"VAR(-fPIC)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_PIE", R"VAR(-fPIE)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_SYSROOT", R"VAR(--sysroot=)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_USE_PCH", R"VAR(-include;<PCH_HEADER>)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_VISIBILITY", R"VAR(-fvisibility=)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_VISIBILITY_INLINES_HIDDEN", R"VAR(-fvisibility-inlines-hidden)VAR");
+	print(false, "", "CMAKE_CXX_COMPILE_OPTIONS_WARNING_AS_ERROR", R"VAR(-Werror)VAR");
+	print(false, "", "CMAKE_CXX_CREATE_ASSEMBLY_SOURCE", R"VAR(<CMAKE_CXX_COMPILER> <DEFINES> <INCLUDES> <FLAGS> -S <SOURCE> -o <ASSEMBLY_SOURCE>)VAR");
+	print(false, "", "CMAKE_CXX_CREATE_PREPROCESSED_SOURCE", R"VAR(<CMAKE_CXX_COMPILER> <DEFINES> <INCLUDES> <FLAGS> -E <SOURCE> > <PREPROCESSED_SOURCE>)VAR");
+	print(false, "", "CMAKE_CXX_CREATE_SHARED_LIBRARY", R"VAR(<CMAKE_CXX_COMPILER> <CMAKE_SHARED_LIBRARY_CXX_FLAGS> <LANGUAGE_COMPILE_FLAGS> <LINK_FLAGS> <CMAKE_SHARED_LIBRARY_CREATE_CXX_FLAGS> <SONAME_FLAG><TARGET_SONAME> -o <TARGET> <OBJECTS> <LINK_LIBRARIES>)VAR");
+	print(false, "", "CMAKE_CXX_CREATE_SHARED_MODULE", R"VAR(<CMAKE_CXX_COMPILER> <CMAKE_SHARED_LIBRARY_CXX_FLAGS> <LANGUAGE_COMPILE_FLAGS> <LINK_FLAGS> <CMAKE_SHARED_LIBRARY_CREATE_CXX_FLAGS> <SONAME_FLAG><TARGET_SONAME> -o <TARGET> <OBJECTS> <LINK_LIBRARIES>)VAR");
+	print(false, "", "CMAKE_CXX_DEPENDS_USE_COMPILER", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_CXX_DEPFILE_FORMAT", R"VAR(gcc)VAR");
+	print(false, "", "CMAKE_CXX_EXTENSIONS_COMPUTED_DEFAULT", R"VAR(ON)VAR");
+	print(false, "", "CMAKE_CXX_EXTENSIONS_DEFAULT", R"VAR(ON)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS", R"VAR( -Wunknown-pragmas -std=c++17 -pthread -fmax-errors=5 -fdiagnostics-color=auto)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS", R"VAR( -Wunknown-pragmas -std=c++17 -pthread -fmax-errors=5 -fdiagnostics-color=auto)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS_DEBUG", R"VAR(-g -O1)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS_DEBUG", R"VAR(-g -O1)VAR");
+	print(false, "", "CMAKE_CXX_FLAGS_DEBUG_INIT", R"VAR( -g)VAR");
+	print(false, "", "CMAKE_CXX_FLAGS_INIT", R"VAR(  )VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS_MINSIZEREL", R"VAR(-Os -DNDEBUG)VAR");
+	print(false, "", "CMAKE_CXX_FLAGS_MINSIZEREL_INIT", R"VAR( -Os -DNDEBUG)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS_RELEASE", R"VAR(-O3 -DNDEBUG -O3)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS_RELEASE", R"VAR(-O3 -DNDEBUG -O3)VAR");
+	print(false, "", "CMAKE_CXX_FLAGS_RELEASE_INIT", R"VAR( -O3 -DNDEBUG)VAR");
+	print(true, "STRING", "CMAKE_CXX_FLAGS_RELWITHDEBINFO", R"VAR(-O2 -g -DNDEBUG)VAR");
+	print(false, "", "CMAKE_CXX_FLAGS_RELWITHDEBINFO_INIT", R"VAR( -O2 -g -DNDEBUG)VAR");
+	print(false, "", "CMAKE_CXX_IGNORE_EXTENSIONS", R"VAR(inl;h;hpp;HPP;H;o;O;obj;OBJ;def;DEF;rc;RC)VAR");
+	print(false, "", "CMAKE_CXX_IMPLICIT_INCLUDE_DIRECTORIES", R"VAR(/usr/include/c++/12;/usr/include/x86_64-linux-gnu/c++/12;/usr/include/c++/12/backward;/usr/lib/gcc/x86_64-linux-gnu/12/include;/usr/local/include;/usr/include/x86_64-linux-gnu;/usr/include)VAR");
+	print(false, "", "CMAKE_CXX_IMPLICIT_LINK_DIRECTORIES", R"VAR(/usr/lib/gcc/x86_64-linux-gnu/12;/usr/lib/x86_64-linux-gnu;/usr/lib;/lib/x86_64-linux-gnu;/lib)VAR");
+	print(false, "", "CMAKE_CXX_IMPLICIT_LINK_FRAMEWORK_DIRECTORIES", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_IMPLICIT_LINK_LIBRARIES", R"VAR(stdc++;m;gcc_s;gcc;c;gcc_s;gcc)VAR");
+	print(false, "", "CMAKE_CXX_INFORMATION_LOADED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_CXX_LIBRARY_ARCHITECTURE", R"VAR(x86_64-linux-gnu)VAR");
+	print(false, "", "CMAKE_CXX_LINKER_PREFERENCE", R"VAR(30)VAR");
+	print(false, "", "CMAKE_CXX_LINKER_PREFERENCE_PROPAGATES", R"VAR(1)VAR");
+	print(false, "", "CMAKE_CXX_LINKER_WRAPPER_FLAG", R"VAR(-Wl,)VAR");
+	print(false, "", "CMAKE_CXX_LINKER_WRAPPER_FLAG_SEP", R"VAR(,)VAR");
+	print(false, "", "CMAKE_CXX_LINK_EXECUTABLE", R"VAR(<CMAKE_CXX_COMPILER> <FLAGS> <CMAKE_CXX_LINK_FLAGS> <LINK_FLAGS> <OBJECTS> -o <TARGET> <LINK_LIBRARIES>)VAR");
+	print(false, "", "CMAKE_CXX_LINK_OPTIONS_NO_PIE", R"VAR(-no-pie)VAR");
+	print(false, "", "CMAKE_CXX_LINK_OPTIONS_PIE", R"VAR(-fPIE;-pie)VAR");
+	print(false, "", "CMAKE_CXX_LINK_WHAT_YOU_USE_FLAG", R"VAR(LINKER:--no-as-needed)VAR");
+	print(false, "", "CMAKE_CXX_OUTPUT_EXTENSION", R"VAR(.o)VAR");
+	print(false, "", "CMAKE_CXX_PLATFORM_ID", R"VAR(Linux)VAR");
+	print(false, "", "CMAKE_CXX_SIMULATE_ID", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_SIMULATE_VERSION", R"VAR()VAR");
+	print(false, "", "CMAKE_CXX_SIZEOF_DATA_PTR", R"VAR(8)VAR");
+	print(false, "", "CMAKE_CXX_SOURCE_FILE_EXTENSIONS", R"VAR(C;M;c++;cc;cpp;cxx;m;mm;mpp;CPP;ixx;cppm)VAR");
+	print(false, "", "CMAKE_CXX_STANDARD_COMPUTED_DEFAULT", R"VAR(17)VAR");
+	print(false, "", "CMAKE_CXX_STANDARD_DEFAULT", R"VAR(17)VAR");
+	print(false, "", "CMAKE_CXX_VERBOSE_FLAG", R"VAR(-v)VAR");
+	print(false, "", "CMAKE_DEPFILE_FLAGS_CXX", R"VAR(-MD -MT <DEP_TARGET> -MF <DEP_FILE>)VAR");
+	print(true, "FILEPATH", "CMAKE_DLLTOOL", R"VAR(CMAKE_DLLTOOL-NOTFOUND)VAR");
+	print(false, "", "CMAKE_DL_LIBS", R"VAR(dl)VAR");
+	print(false, "", "CMAKE_EFFECTIVE_SYSTEM_NAME", R"VAR(Linux)VAR");
+	print(false, "INTERNAL", "CMAKE_EXECUTABLE_FORMAT", R"VAR(ELF)VAR");
+	print(false, "", "CMAKE_EXECUTABLE_RPATH_LINK_CXX_FLAG", R"VAR(-Wl,-rpath-link,)VAR");
+	print(false, "", "CMAKE_EXECUTABLE_RUNTIME_CXX_FLAG", R"VAR(-Wl,-rpath,)VAR");
+	print(false, "", "CMAKE_EXECUTABLE_RUNTIME_CXX_FLAG_SEP", R"VAR(:)VAR");
+	print(false, "", "CMAKE_EXECUTABLE_SUFFIX", R"VAR()VAR");
+	print(false, "", "CMAKE_EXE_EXPORTS_CXX_FLAG", R"VAR(-Wl,--export-dynamic)VAR");
+	print(false, "", "CMAKE_EXE_EXPORTS_C_FLAG", R"VAR(-Wl,--export-dynamic)VAR");
+	print(true, "STRING", "CMAKE_EXE_LINKER_FLAGS", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_EXE_LINKER_FLAGS_DEBUG", R"VAR()VAR");
+	print(false, "", "CMAKE_EXE_LINKER_FLAGS_INIT", R"VAR( )VAR");
+	print(true, "STRING", "CMAKE_EXE_LINKER_FLAGS_MINSIZEREL", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_EXE_LINKER_FLAGS_RELEASE", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_EXE_LINKER_FLAGS_RELWITHDEBINFO", R"VAR()VAR");
+	print(false, "", "CMAKE_EXE_LINK_DYNAMIC_CXX_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_EXE_LINK_DYNAMIC_C_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_EXE_LINK_STATIC_CXX_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(false, "", "CMAKE_EXE_LINK_STATIC_C_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(true, "BOOL", "CMAKE_EXPORT_COMPILE_COMMANDS", R"VAR(ON)VAR");
+	print(true, "BOOL", "CMAKE_EXPORT_COMPILE_COMMANDS", R"VAR(ON)VAR");
+	print(false, "INTERNAL", "CMAKE_EXTRA_GENERATOR", R"VAR()VAR");
+	print(false, "", "CMAKE_FILES_DIRECTORY", R"VAR(/CMakeFiles)VAR");
+	print(false, "", "CMAKE_FIND_FRAMEWORK", R"VAR(LAST)VAR");
+	print(false, "", "CMAKE_FIND_LIBRARY_PREFIXES", R"VAR(lib)VAR");
+	print(false, "", "CMAKE_FIND_LIBRARY_SUFFIXES", R"VAR(.a;.so)VAR");
+	print(false, "STATIC", "CMAKE_FIND_PACKAGE_REDIRECTS_DIR", R"VAR(/root/repo/_gate_build/CMakeFiles/pkgRedirects)VAR");
+	print(false, "INTERNAL", "CMAKE_GENERATOR", R"VAR(Unix Makefiles)VAR");
+	print(false, "INTERNAL", "CMAKE_GENERATOR_INSTANCE", R"VAR()VAR");
+	print(false, "INTERNAL", "CMAKE_GENERATOR_PLATFORM", R"VAR()VAR");
+	print(false, "INTERNAL", "CMAKE_GENERATOR_TOOLSET", R"VAR()VAR");
+	print(false, "INTERNAL", "CMAKE_HOME_DIRECTORY", R"VAR(/root/repo)VAR");
+	print(false, "", "CMAKE_HOST_LINUX", R"VAR(1)VAR");
+	print(false, "", "CMAKE_HOST_SYSTEM", R"VAR(Linux-6.18.44-fc-v139)VAR");
+	print(false, "", "CMAKE_HOST_SYSTEM_NAME", R"VAR(Linux)VAR");
+	print(false, "", "CMAKE_HOST_SYSTEM_PROCESSOR", R"VAR(x86_64)VAR");
+	print(false, "", "CMAKE_HOST_SYSTEM_VERSION", R"VAR(6.18.44-fc-v139)VAR");
+	print(false, "", "CMAKE_HOST_UNIX", R"VAR(1)VAR");
+	print(false, "", "CMAKE_INCLUDE_FLAG_C", R"VAR(-I)VAR");
+	print(false, "", "CMAKE_INCLUDE_FLAG_CXX", R"VAR(-I)VAR");
+	print(false, "", "CMAKE_INCLUDE_SYSTEM_FLAG_CXX", R"VAR(-isystem )VAR");
+	print(true, "PATH", "CMAKE_INSTALL_BINDIR", R"VAR(bin)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_DATADIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_DATAROOTDIR", R"VAR(share)VAR");
+	print(false, "", "CMAKE_INSTALL_DEFAULT_COMPONENT_NAME", R"VAR(Unspecified)VAR");
+	print(false, "PATH", "CMAKE_INSTALL_DIR", R"VAR(/usr/local/lib/cmake/carl)VAR");
+	print(false, "PATH", "CMAKE_INSTALL_DIR", R"VAR(/usr/local/lib/cmake/carl)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_DOCDIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_INCLUDEDIR", R"VAR(include)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_INFODIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_LIBDIR", R"VAR(lib)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_LIBEXECDIR", R"VAR(libexec)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_LOCALEDIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_LOCALSTATEDIR", R"VAR(var)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_MANDIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_OLDINCLUDEDIR", R"VAR(/usr/include)VAR");
+	print(false, "PATH", "CMAKE_INSTALL_PREFIX", R"VAR(/usr/local)VAR");
+	print(false, "", "CMAKE_INSTALL_RPATH", R"VAR(/usr/local/lib)VAR");
+	print(false, "", "CMAKE_INSTALL_RPATH_USE_LINK_PATH", R"VAR(TRUE)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_RUNSTATEDIR", R"VAR()VAR");
+	print(true, "PATH", "CMAKE_INSTALL_SBINDIR", R"VAR(sbin)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_SHAREDSTATEDIR", R"VAR(com)VAR");
+	print(false, "INTERNAL", "CMAKE_INSTALL_SO_NO_EXE", R"VAR(1)VAR");
+	print(true, "PATH", "CMAKE_INSTALL_SYSCONFDIR", R"VAR(etc)VAR");
+	print(false, "", "CMAKE_INTERNAL_PLATFORM_ABI", R"VAR(ELF)VAR");
+	print(false, "", "CMAKE_LIBRARY_ARCHITECTURE", R"VAR(x86_64-linux-gnu)VAR");
+	print(false, "", "CMAKE_LIBRARY_ARCHITECTURE_REGEX", R"VAR([a-z0-9_]+(-[a-z0-9_]+)?-linux-gnu[a-z0-9_]*)VAR");
+	print(false, "", "CMAKE_LIBRARY_PATH_FLAG", R"VAR(-L)VAR");
+	print(false, "", "CMAKE_LIBRARY_PATH_TERMINATOR", R"VAR()VAR");
+	print(true, "FILEPATH", "CMAKE_LINKER", R"VAR(/usr/bin/ld)VAR");
+	print(true, "FILEPATH", "CMAKE_LINKER", R"VAR(/usr/bin/ld)VAR");
+	print(false, "", "CMAKE_LINK_GROUP_USING_RESCAN", R"VAR(LINKER:--start-group;LINKER:--end-group)VAR");
+	print(false, "", "CMAKE_LINK_GROUP_USING_RESCAN_SUPPORTED", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_LINK_LIBRARY_FLAG", R"VAR(-l)VAR");
+	print(false, "", "CMAKE_LINK_LIBRARY_SUFFIX", R"VAR()VAR");
+	print(false, "", "CMAKE_LINK_LIBRARY_USING_DEFAULT_SUPPORTED", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_LINK_LIBRARY_USING_WHOLE_ARCHIVE", R"VAR(LINKER:--push-state,--whole-archive;<LINK_ITEM>;LINKER:--pop-state)VAR");
+	print(false, "", "CMAKE_LINK_LIBRARY_USING_WHOLE_ARCHIVE_SUPPORTED", R"VAR(TRUE)VAR");
+	print(false, "", "CMAKE_LINK_WHAT_YOU_USE_CHECK", R"VAR(ldd;-u;-r)VAR");
+	print(false, "", "CMAKE_MAJOR_VERSION", R"VAR(3)VAR");
+	print(true, "FILEPATH", "CMAKE_MAKE_PROGRAM", R"VAR($(MAKE))VAR");
+	print(true, "FILEPATH", "CMAKE_MAKE_PROGRAM", R"VAR($(MAKE))VAR");
+	print(false, "", "CMAKE_MATCH_0", R"VAR()VAR");
+	print(false, "", "CMAKE_MATCH_1", R"VAR()VAR");
+	print(false, "", "CMAKE_MATCH_2", R"VAR()VAR");
+	print(false, "", "CMAKE_MATCH_3", R"VAR()VAR");
+	print(false, "", "CMAKE_MATCH_COUNT", R"VAR(0)VAR");
+	print(false, "", "CMAKE_MINIMUM_REQUIRED_VERSION", R"VAR(3.7)VAR");
+	print(false, "", "CMAKE_MINOR_VERSION", R"VAR(25)VAR");
+	print(true, "STRING", "CMAKE_MODULE_LINKER_FLAGS", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_MODULE_LINKER_FLAGS_DEBUG", R"VAR()VAR");
+	print(false, "", "CMAKE_MODULE_LINKER_FLAGS_INIT", R"VAR( )VAR");
+	print(true, "STRING", "CMAKE_MODULE_LINKER_FLAGS_MINSIZEREL", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_MODULE_LINKER_FLAGS_RELEASE", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_MODULE_LINKER_FLAGS_RELWITHDEBINFO", R"VAR()VAR");
+	print(false, "", "CMAKE_MODULE_PATH", R"VAR(/root/repo/cmake)VAR");
+	print(false, "", "CMAKE_MT", R"VAR()VAR");
+	print(true, "FILEPATH", "CMAKE_NM", R"VAR(/usr/bin/nm)VAR");
+	print(false, "INTERNAL", "CMAKE_NUMBER_OF_MAKEFILES", R"VAR(16)VAR");
+	print(true, "FILEPATH", "CMAKE_OBJCOPY", R"VAR(/usr/bin/objcopy)VAR");
+	print(true, "FILEPATH", "CMAKE_OBJDUMP", R"VAR(/usr/bin/objdump)VAR");
+	print(false, "", "CMAKE_PARENT_LIST_FILE", R"VAR(/root/repo/src/carl/util/CMakeLists.txt)VAR");
+	print(false, "", "CMAKE_PATCH_VERSION", R"VAR(1)VAR");
+	print(false, "", "CMAKE_PCH_EXTENSION", R"VAR(.gch)VAR");
+	print(false, "", "CMAKE_PCH_PROLOGUE", R"VAR(#pragma GCC system_header)VAR");
+	print(false, "", "CMAKE_PLATFORM_IMPLICIT_LINK_DIRECTORIES", R"VAR(/lib;/lib32;/lib64;/usr/lib;/usr/lib32;/usr/lib64)VAR");
+	print(false, "", "CMAKE_PLATFORM_INFO_DIR", R"VAR(/root/repo/_gate_build/CMakeFiles/3.25.1)VAR");
+	print(false, "INTERNAL", "CMAKE_PLATFORM_INFO_INITIALIZED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_PLATFORM_USES_PATH_WHEN_NO_SONAME", R"VAR(1)VAR");
+	print(false, "", "CMAKE_POSITION_INDEPENDENT_CODE", R"VAR(ON)VAR");
+	print(false, "STATIC", "CMAKE_PROJECT_DESCRIPTION", R"VAR()VAR");
+	print(false, "STATIC", "CMAKE_PROJECT_HOMEPAGE_URL", R"VAR()VAR");
+	print(false, "STATIC", "CMAKE_PROJECT_NAME", R"VAR(carl)VAR");
+	print(true, "FILEPATH", "CMAKE_RANLIB", R"VAR(/usr/bin/ranlib)VAR");
+	print(true, "FILEPATH", "CMAKE_RANLIB", R"VAR(/usr/bin/ranlib)VAR");
+	print(true, "FILEPATH", "CMAKE_READELF", R"VAR(/usr/bin/readelf)VAR");
+	print(false, "INTERNAL", "CMAKE_ROOT", R"VAR(/usr/share/cmake-3.25)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_CREATE_CXX_FLAGS", R"VAR(-shared)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_CREATE_C_FLAGS", R"VAR(-shared)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_CXX_FLAGS", R"VAR(-fPIC)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_C_FLAGS", R"VAR()VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_CXX_FLAGS", R"VAR(-rdynamic)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_C_FLAGS", R"VAR()VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_DYNAMIC_CXX_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_DYNAMIC_C_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_STATIC_CXX_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_LINK_STATIC_C_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_PREFIX", R"VAR(lib)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RPATH_LINK_CXX_FLAG", R"VAR(-Wl,-rpath-link,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RPATH_LINK_C_FLAG", R"VAR(-Wl,-rpath-link,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RPATH_ORIGIN_TOKEN", R"VAR($ORIGIN)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RUNTIME_CXX_FLAG", R"VAR(-Wl,-rpath,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RUNTIME_CXX_FLAG_SEP", R"VAR(:)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RUNTIME_C_FLAG", R"VAR(-Wl,-rpath,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_RUNTIME_C_FLAG_SEP", R"VAR(:)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_SONAME_CXX_FLAG", R"VAR(-Wl,-soname,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_SONAME_C_FLAG", R"VAR(-Wl,-soname,)VAR");
+	print(false, "", "CMAKE_SHARED_LIBRARY_SUFFIX", R"VAR(.so)VAR");
+	print(true, "STRING", "CMAKE_SHARED_LINKER_FLAGS", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_SHARED_LINKER_FLAGS_DEBUG", R"VAR()VAR");
+	print(false, "", "CMAKE_SHARED_LINKER_FLAGS_INIT", R"VAR( )VAR");
+	print(true, "STRING", "CMAKE_SHARED_LINKER_FLAGS_MINSIZEREL", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_SHARED_LINKER_FLAGS_RELEASE", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_SHARED_LINKER_FLAGS_RELWITHDEBINFO", R"VAR()VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_CREATE_CXX_FLAGS", R"VAR(-shared)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_CXX_FLAGS", R"VAR(-fPIC)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_LINK_DYNAMIC_CXX_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_LINK_DYNAMIC_C_FLAGS", R"VAR(-Wl,-Bdynamic)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_LINK_STATIC_CXX_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_LINK_STATIC_C_FLAGS", R"VAR(-Wl,-Bstatic)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_PREFIX", R"VAR(lib)VAR");
+	print(false, "", "CMAKE_SHARED_MODULE_SUFFIX", R"VAR(.so)VAR");
+	print(false, "", "CMAKE_SIZEOF_VOID_P", R"VAR(8)VAR");
+	print(false, "", "CMAKE_SKIP_BUILD_RPATH", R"VAR(FALSE)VAR");
+	print(true, "BOOL", "CMAKE_SKIP_INSTALL_RPATH", R"VAR(NO)VAR");
+	print(true, "BOOL", "CMAKE_SKIP_RPATH", R"VAR(NO)VAR");
+	print(false, "", "CMAKE_SOURCE_DIR", R"VAR(/root/repo)VAR");
+	print(false, "", "CMAKE_STATIC_LIBRARY_PREFIX", R"VAR(lib)VAR");
+	print(false, "", "CMAKE_STATIC_LIBRARY_SUFFIX", R"VAR(.a)VAR");
+	print(true, "STRING", "CMAKE_STATIC_LINKER_FLAGS", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_STATIC_LINKER_FLAGS_DEBUG", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_STATIC_LINKER_FLAGS_MINSIZEREL", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_STATIC_LINKER_FLAGS_RELEASE", R"VAR()VAR");
+	print(true, "STRING", "CMAKE_STATIC_LINKER_FLAGS_RELWITHDEBINFO", R"VAR()VAR");
+	print(true, "FILEPATH", "CMAKE_STRIP", R"VAR(/usr/bin/strip)VAR");
+	print(false, "", "CMAKE_SYSTEM", R"VAR(Linux-6.18.44-fc-v139)VAR");
+	print(false, "", "CMAKE_SYSTEM_INCLUDE_PATH", R"VAR(/usr/include/X11)VAR");
+	print(false, "", "CMAKE_SYSTEM_INFO_FILE", R"VAR(Platform/Linux)VAR");
+	print(false, "", "CMAKE_SYSTEM_LIBRARY_PATH", R"VAR(/usr/lib/X11)VAR");
+	print(false, "", "CMAKE_SYSTEM_LOADED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_SYSTEM_NAME", R"VAR(Linux)VAR");
+	print(false, "", "CMAKE_SYSTEM_PREFIX_PATH", R"VAR(/usr/local;/usr;/;/usr;/usr/local;/usr/X11R6;/usr/pkg;/opt)VAR");
+	print(false, "", "CMAKE_SYSTEM_PROCESSOR", R"VAR(x86_64)VAR");
+	print(false, "", "CMAKE_SYSTEM_SPECIFIC_INFORMATION_LOADED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_SYSTEM_SPECIFIC_INITIALIZE_LOADED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_SYSTEM_VERSION", R"VAR(6.18.44-fc-v139)VAR");
+	print(false, "", "CMAKE_TESTING_ENABLED", R"VAR(1)VAR");
+	print(false, "", "CMAKE_TWEAK_VERSION", R"VAR(0)VAR");
+	print(false, "INTERNAL", "CMAKE_UNAME", R"VAR(/usr/bin/uname)VAR");
+	print(true, "BOOL", "CMAKE_VERBOSE_MAKEFILE", R"VAR(FALSE)VAR");
+	print(false, "", "CMAKE_VERSION", R"VAR(3.25.1)VAR");
+	print(false, "BOOL", "COMPARE_WITH_Z3", R"VAR(OFF)VAR");
+	print(false, "", "COMPONENT", R"VAR()VAR");
+	print(false, "BOOL", "COVERAGE", R"VAR(OFF)VAR");
+	print(false, "", "CPATH", R"VAR()VAR");
+	print(false, "", "DEF_INSTALL_CMAKE_DIR", R"VAR(lib/cmake/carl)VAR");
+	print(false, "BOOL", "DEVELOPER", R"VAR(OFF)VAR");
+	print(false, "", "DOT", R"VAR(DOXYGEN_DOT_EXECUTABLE-NOTFOUND)VAR");
+	print(false, "", "DOXYGEN", R"VAR(DOXYGEN_EXECUTABLE-NOTFOUND)VAR");
+	print(true, "FILEPATH", "DOXYGEN_DOT_EXECUTABLE", R"VAR(DOXYGEN_DOT_EXECUTABLE-NOTFOUND)VAR");
+	print(false, "", "DOXYGEN_DOT_FOUND", R"VAR(NO)VAR");
+	print(true, "FILEPATH", "DOXYGEN_EXECUTABLE", R"VAR(DOXYGEN_EXECUTABLE-NOTFOUND)VAR");
+	print(false, "", "DOXYGEN_FIND_QUIETLY", R"VAR(TRUE)VAR");
+	print(false, "", "DOXYGEN_FOUND", R"VAR(NO)VAR");
+	print(false, "", "DYNAMIC_EXT", R"VAR(.so)VAR");
+	print(false, "", "Doxygen_FOUND", R"VAR(FALSE)VAR");
+	print(false, "", "Doxygen_dot_FOUND", R"VAR(FALSE)VAR");
+	print(false, "", "Doxygen_doxygen_FOUND", R"VAR(FALSE)VAR");
+	print(false, "", "EIGEN3_FOUND", R"VAR(TRUE)VAR");
+	print(true, "PATH", "EIGEN3_INCLUDE_DIR", R"VAR(/usr/include/eigen3)VAR");
+	print(false, "", "EIGEN3_MAJOR_VERSION", R"VAR(4)VAR");
+	print(false, "", "EIGEN3_MINOR_VERSION", R"VAR(0)VAR");
+	print(false, "", "EIGEN3_VERSION", R"VAR(3.4.0)VAR");
+	print(false, "", "EIGEN3_VERSION_OK", R"VAR(TRUE)VAR");
+	print(false, "", "EIGEN3_WORLD_VERSION", R"VAR(3)VAR");
+	print(false, "BOOL", "ENABLE_PACKAGING", R"VAR(OFF)VAR");
+	print(false, "PATH", "EXECUTABLE_OUTPUT_PATH", R"VAR(/root/repo/_gate_build/bin)VAR");
+	print(false, "", "EXPORTED_OPTIONS", R"VAR(LOGGING;TIMING;FORCE_SHIPPED_RESOURCES;FORCE_SHIPPED_GMP;USE_GINAC;USE_CLN_NUMBERS;USE_COCOA;USE_BLISS;USE_MPFR_FLOAT;BUILD_DOXYGEN;THREAD_SAFE;BUCHBERGER_STATISTICS)VAR");
+	print(false, "BOOL", "EXPORT_TO_CMAKE", R"VAR(ON)VAR");
+	print(false, "INTERNAL", "FIND_PACKAGE_MESSAGE_DETAILS_PythonInterp", R"VAR([/root/.pyenv/shims/python3][v3.11.7()])VAR");
+	print(false, "BOOL", "FORCE_SHIPPED_GMP", R"VAR(OFF)VAR");
+	print(false, "BOOL", "FORCE_SHIPPED_RESOURCES", R"VAR(OFF)VAR");
+	print(true, "FILEPATH", "GIT_EXECUTABLE", R"VAR(/usr/bin/git)VAR");
+	print(true, "UNINITIALIZED", "GMPXX_FOUND", R"VAR(TRUE)VAR");
+	print(true, "UNINITIALIZED", "GMPXX_FOUND", R"VAR(TRUE)VAR");
+	print(true, "PATH", "GMPXX_INCLUDE_DIR", R"VAR(/usr/include)VAR");
+	print(true, "UNINITIALIZED", "GMP_FOUND", R"VAR(TRUE)VAR");
+	print(true, "UNINITIALIZED", "GMP_FOUND", R"VAR(TRUE)VAR");
+	print(true, "PATH", "GMP_INCLUDE_DIR", R"VAR(/usr/include/x86_64-linux-gnu)VAR");
+	print(true, "FILEPATH", "GMP_LIBRARY", R"VAR(/usr/lib/x86_64-linux-gnu/libgmp.so)VAR");
+	print(false, "", "GMP_LIB_PATH", R"VAR(/usr/lib/x86_64-linux-gnu)VAR");
+	print(true, "UNINITIALIZED", "GMP_VERSION", R"VAR(6.2.1)VAR");
+	print(true, "UNINITIALIZED", "GMP_VERSION", R"VAR(6.2.1)VAR");
+	print(false, "", "GTEST_FOUND", R"VAR(ON)VAR");
+	print(false, "", "GTEST_LIBRARIES", R"VAR(GTESTCORE_STATIC;GTESTMAIN_STATIC;pthread;dl)VAR");
+	print(false, "", "GTEST_VERSION", R"VAR(system)VAR");
+	print(false, "PATH", "INCLUDE_INSTALL_DIR", R"VAR(/usr/local/include)VAR");
+	print(false, "PATH", "INCLUDE_INSTALL_DIR", R"VAR(/usr/local/include)VAR");
+	print(false, "", "LIBNAME", R"VAR(EIGEN3)VAR");
+	print(false, "", "LIBRARY_PATH", R"VAR()VAR");
+	print(false, "", "LIB_FILESYSTEM", R"VAR(stdc++fs)VAR");
+	print(false, "PATH", "LIB_INSTALL_DIR", R"VAR(/usr/local/lib)VAR");
+	print(false, "PATH", "LIB_INSTALL_DIR", R"VAR(/usr/local/lib)VAR");
+	print(false, "", "LIB_VERSION", R"VAR(19.01)VAR");
+	print(false, "", "LINUX", R"VAR(1)VAR");
+	print(false, "BOOL", "LOGGING", R"VAR(OFF)VAR");
+	print(false, "BOOL", "LOGGING_DISABLE_INEFFICIENT", R"VAR(OFF)VAR");
+	print(false, "", "PROJECT_BINARY_DIR", R"VAR(/root/repo/_gate_build)VAR");
+	print(false, "", "PROJECT_DESCRIPTION", R"VAR(Computer ARithmetic Library)VAR");
+	print(false, "", "PROJECT_FULLNAME", R"VAR(carl)VAR");
+	print(false, "", "PROJECT_HOMEPAGE_URL", R"VAR()VAR");
+	print(false, "", "PROJECT_IS_TOP_LEVEL", R"VAR(ON)VAR");
+	print(false, "", "PROJECT_NAME", R"VAR(carl)VAR");
+	print(false, "", "PROJECT_SOURCE_DIR", R"VAR(/root/repo)VAR");
+	print(false, "", "PROJECT_VERSION", R"VAR(19.01)VAR");
+	print(false, "", "PROJECT_VERSION_FULL", R"VAR(19.01)VAR");
+	print(false, "", "PROJECT_VERSION_MAJOR", R"VAR(19)VAR");
+	print(false, "", "PROJECT_VERSION_MINOR", R"VAR(01)VAR");
+	print(false, "BOOL", "PRUNE_MONOMIAL_POOL", R"VAR(ON)VAR");
+	print(true, "FILEPATH", "PYTHON_EXECUTABLE", R"VAR(/root/.pyenv/shims/python3)VAR");
+	print(false, "BOOL", "RAN_USE_THOM", R"VAR(OFF)VAR");
+	print(false, "BOOL", "RAN_USE_Z3", R"VAR(OFF)VAR");
+	print(false, "", "RUN_CONFIGURE", R"VAR(ON)VAR");
+	print(false, "", "STATIC_EXT", R"VAR(.a)VAR");
+	print(false, "BOOL", "THREAD_SAFE", R"VAR(OFF)VAR");
+	print(false, "BOOL", "TIMING", R"VAR(OFF)VAR");
+	print(false, "STATIC", "TestCommon_LIB_DEPENDS", R"VAR(general;carl-shared;general;GTESTCORE_STATIC;general;GTESTMAIN_STATIC;general;pthread;general;dl;)VAR");
+	print(false, "", "UNIX", R"VAR(1)VAR");
+	print(false, "", "UPPERCOMPONENT", R"VAR(CHRONO)VAR");
+	print(false, "BOOL", "USE_BLISS", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_CLN_NUMBERS", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_COCOA", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_COTIRE", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_GINAC", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_MPFR_FLOAT", R"VAR(OFF)VAR");
+	print(false, "BOOL", "USE_Z3_NUMBERS", R"VAR(OFF)VAR");
+	print(false, "", "_Boost_CHANGE_INCDIR", R"VAR(1)VAR");
+	print(false, "", "_Boost_CHANGE_LIBDIR_DEBUG", R"VAR(0)VAR");
+	print(false, "", "_Boost_CHANGE_LIBDIR_RELEASE", R"VAR(0)VAR");
+	print(false, "", "_Boost_CHANGE_LIBNAME", R"VAR(1)VAR");
+	print(false, "INTERNAL", "_Boost_COMPONENTS_SEARCHED", R"VAR(chrono;program_options;regex;system;timer;unit_test_framework)VAR");
+	print(false, "", "_Boost_FIND_LIBRARY_HINTS_FOR_COMPONENT", R"VAR()VAR");
+	print(false, "", "_Boost_FIND_VERSION_SHORT", R"VAR(1.65)VAR");
+	print(false, "", "_Boost_IMPORTED_TARGETS", R"VAR(TRUE)VAR");
+	print(false, "", "_Boost_INCLUDE_DIR_CHANGED", R"VAR(0)VAR");
+	print(false, "INTERNAL", "_Boost_INCLUDE_DIR_LAST", R"VAR(/usr/include)VAR");
+	print(false, "", "_Boost_KNOWN_VERSIONS", R"VAR(1.80.0;1.80;1.79.0;1.79;1.78.0;1.78;1.77.0;1.77;1.76.0;1.76;1.75.0;1.75;1.74.0;1.74;1.73.0;1.73;1.72.0;1.72;1.71.0;1.71;1.70.0;1.70;1.69.0;1.69;1.68.0;1.68;1.67.0;1.67;1.66.0;1.66;1.65.1;1.65.0;1.65;1.64.0;1.64;1.63.0;1.63;1.62.0;1.62;1.61.0;1.61;1.60.0;1.60;1.59.0;1.59;1.58.0;1.58;1.57.0;1.57;1.56.0;1.56;1.55.0;1.55;1.54.0;1.54;1.53.0;1.53;1.52.0;1.52;1.51.0;1.51;1.50.0;1.50;1.49.0;1.49;1.48.0;1.48;1.47.0;1.47;1.46.1;1.46.0;1.46;1.45.0;1.45;1.44.0;1.44;1.43.0;1.43;1.42.0;1.42;1.41.0;1.41;1.40.0;1.40;1.39.0;1.39;1.38.0;1.38;1.37.0;1.37;1.36.1;1.36.0;1.36;1.35.1;1.35.0;1.35;1.34.1;1.34.0;1.34;1.33.1;1.33.0;1.33)VAR");
+	print(false, "", "_Boost_LIBRARY_DIR_DEBUG_CHANGED", R"VAR(0)VAR");
+	print(false, "INTERNAL", "_Boost_LIBRARY_DIR_DEBUG_LAST", R"VAR(/usr/lib/x86_64-linux-gnu)VAR");
+	print(false, "", "_Boost_LIBRARY_DIR_RELEASE_CHANGED", R"VAR(0)VAR");
+	print(false, "INTERNAL", "_Boost_LIBRARY_DIR_RELEASE_LAST", R"VAR(/usr/lib/x86_64-linux-gnu)VAR");
+	print(false, "", "_Boost_NAMESPACE_CHANGED", R"VAR(0)VAR");
+	print(false, "INTERNAL", "_Boost_NAMESPACE_LAST", R"VAR(boost)VAR");
+	print(false, "", "_Boost_TIMER_DEPENDENCIES", R"VAR(chrono)VAR");
+	print(false, "", "_Boost_TIMER_TARGET_DEPENDENCIES", R"VAR(Boost::chrono)VAR");
+	print(false, "", "_Boost_USE_MULTITHREADED_CHANGED", R"VAR(0)VAR");
+	print(false, "INTERNAL", "_Boost_USE_MULTITHREADED_LAST", R"VAR(TRUE)VAR");
+	print(false, "", "_Boost_USE_STATIC_LIBS_CHANGED", R"VAR(1)VAR");
+	print(false, "INTERNAL", "_Boost_USE_STATIC_LIBS_LAST", R"VAR(ON)VAR");
+	print(false, "", "_Boost_VARS_DIR", R"VAR(BOOST_ROOT;Boost_NO_SYSTEM_PATHS)VAR");
+	print(false, "", "_Boost_VARS_INC", R"VAR(BOOST_INCLUDEDIR;Boost_INCLUDE_DIR;Boost_ADDITIONAL_VERSIONS)VAR");
+	print(false, "", "_Boost_VARS_LIB", R"VAR(BOOST_LIBRARYDIR;Boost_LIBRARY_DIR_DEBUG;BOOST_LIBRARYDIR;Boost_LIBRARY_DIR_RELEASE)VAR");
+	print(false, "", "_Boost_VARS_LIB_DEBUG", R"VAR(BOOST_LIBRARYDIR;Boost_LIBRARY_DIR_DEBUG)VAR");
+	print(false, "", "_Boost_VARS_LIB_RELEASE", R"VAR(BOOST_LIBRARYDIR;Boost_LIBRARY_DIR_RELEASE)VAR");
+	print(false, "", "_Boost_VARS_NAME", R"VAR(Boost_NAMESPACE;Boost_COMPILER;Boost_THREADAPI;Boost_USE_DEBUG_PYTHON;Boost_USE_MULTITHREADED;Boost_USE_STATIC_LIBS;Boost_USE_STATIC_RUNTIME;Boost_USE_STLPORT;Boost_USE_STLPORT_DEPRECATED_NATIVE_IOSTREAMS)VAR");
+	print(false, "", "_CMAKE_CUDA_IMPLICIT_INCLUDE_DIRECTORIES_INIT", R"VAR(/usr/include)VAR");
+	print(false, "", "_CMAKE_CXX_IMPLICIT_INCLUDE_DIRECTORIES_INIT", R"VAR(/usr/include/c++/12;/usr/include/x86_64-linux-gnu/c++/12;/usr/include/c++/12/backward;/usr/lib/gcc/x86_64-linux-gnu/12/include;/usr/local/include;/usr/include/x86_64-linux-gnu;/usr/include;/usr/include)VAR");
+	print(false, "", "_CMAKE_CXX_IPO_MAY_BE_SUPPORTED_BY_COMPILER", R"VAR(YES)VAR");
+	print(false, "", "_CMAKE_CXX_IPO_SUPPORTED_BY_CMAKE", R"VAR(YES)VAR");
+	print(false, "", "_CMAKE_CXX_PIE_MAY_BE_SUPPORTED_BY_LINKER", R"VAR(YES)VAR");
+	print(false, "", "_CMAKE_C_IMPLICIT_INCLUDE_DIRECTORIES_INIT", R"VAR(/usr/include)VAR");
+	print(false, "", "_CMAKE_INSTALL_DIR", R"VAR(/usr)VAR");
+	print(false, "INTERNAL", "_CMAKE_LINKER_PUSHPOP_STATE_SUPPORTED", R"VAR(TRUE)VAR");
+	print(false, "", "_CMAKE_SYSTEM_PREFIX_PATH_INSTALL_PREFIX_COUNT", R"VAR(2)VAR");
+	print(false, "", "_CMAKE_SYSTEM_PREFIX_PATH_INSTALL_PREFIX_VALUE", R"VAR(/usr/local)VAR");
+	print(false, "", "_CMAKE_SYSTEM_PREFIX_PATH_STAGING_PREFIX_COUNT", R"VAR(0)VAR");
+	print(false, "", "_CMAKE_SYSTEM_PREFIX_PATH_STAGING_PREFIX_VALUE", R"VAR()VAR");
+	print(false, "", "_ENV_BOOSTROOT", R"VAR()VAR");
+	print(false, "", "_ENV_BOOST_INCLUDEDIR", R"VAR()VAR");
+	print(false, "", "_ENV_BOOST_LIBRARYDIR", R"VAR()VAR");
+	print(false, "", "_ENV_BOOST_ROOT", R"VAR()VAR");
+	print(false, "INTERNAL", "_GNUInstallDirs_LAST_CMAKE_INSTALL_PREFIX", R"VAR(/usr/local)VAR");
+	print(false, "", "_INCLUDED_FILE", R"VAR(/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake)VAR");
+	print(false, "", "_INCLUDED_SYSTEM_INFO_FILE", R"VAR(/usr/share/cmake-3.25/Modules/Platform/Linux.cmake)VAR");
+	print(false, "", "_IN_TC", R"VAR(0)VAR");
+	print(false, "", "__COMPILER_CMAKE_COMMON_COMPILER_MACROS", R"VAR(1)VAR");
+	print(false, "", "__COMPILER_GNU", R"VAR(1)VAR");
+	print(false, "", "__LINUX_COMPILER_GNU", R"VAR(1)VAR");
+	print(false, "", "__UNIX_PATHS_INCLUDED", R"VAR(1)VAR");
+	print(false, "", "__lto_flags", R"VAR(-flto=auto;-fno-fat-lto-objects)VAR");
+	print(false, "", "__pch_header_C", R"VAR(c-header)VAR");
+	print(false, "", "__pch_header_CXX", R"VAR(c++-header)VAR");
+	print(false, "", "__pch_header_OBJC", R"VAR(objective-c-header)VAR");
+	print(false, "", "__pch_header_OBJCXX", R"VAR(objective-c++-header)VAR");
+	print(false, "", "_boost_ARCHITECTURE_TAG", R"VAR()VAR");
+	print(false, "", "_boost_BOOSTIFIED_VERSION", R"VAR(1_65)VAR");
+	print(false, "", "_boost_COMPILER", R"VAR(-gcc12)VAR");
+	print(false, "", "_boost_DEBUG_ABI_TAG", R"VAR(-d)VAR");
+	print(false, "", "_boost_DEBUG_NAMES", R"VAR(boost_chrono-gcc12-mt-d-1_74;boost_chrono-gcc12-mt-d;boost_chrono-gcc12-mt-d;boost_chrono-mt-d-1_74;boost_chrono-mt-d;boost_chrono-mt-d;boost_chrono-mt;boost_chrono)VAR");
+	print(false, "", "_boost_INCLUDE_SEARCH_DIRS", R"VAR(PATHS;C:/boost/include;C:/boost;/sw/local/include)VAR");
+	print(false, "", "_boost_LIBRARY_SEARCH_DIRS_DEBUG", R"VAR(/usr/lib/x86_64-linux-gnu;NO_DEFAULT_PATH;NO_CMAKE_FIND_ROOT_PATH)VAR");
+	print(false, "", "_boost_LIBRARY_SEARCH_DIRS_RELEASE", R"VAR(/usr/lib/x86_64-linux-gnu;NO_DEFAULT_PATH;NO_CMAKE_FIND_ROOT_PATH)VAR");
+	print(false, "", "_boost_LIBRARY_SEARCH_DIRS_tmp", R"VAR(/usr/lib/x86_64-linux-gnu;NO_DEFAULT_PATH;NO_CMAKE_FIND_ROOT_PATH)VAR");
+	print(false, "", "_boost_MULTITHREADED", R"VAR(-mt)VAR");
+	print(false, "", "_boost_ORIG_CMAKE_FIND_LIBRARY_SUFFIXES", R"VAR(.a;.so)VAR");
+	print(false, "", "_boost_PATH_SUFFIXES", R"VAR(boost-1_80_0;boost_1_80_0;boost/boost-1_80_0;boost/boost_1_80_0;boost-1_80;boost_1_80;boost/boost-1_80;boost/boost_1_80;boost-1_79_0;boost_1_79_0;boost/boost-1_79_0;boost/boost_1_79_0;boost-1_79;boost_1_79;boost/boost-1_79;boost/boost_1_79;boost-1_78_0;boost_1_78_0;boost/boost-1_78_0;boost/boost_1_78_0;boost-1_78;boost_1_78;boost/boost-1_78;boost/boost_1_78;boost-1_77_0;boost_1_77_0;boost/boost-1_77_0;boost/boost_1_77_0;boost-1_77;boost_1_77;boost/boost-1_77;boost/boost_1_77;boost-1_76_0;boost_1_76_0;boost/boost-1_76_0;boost/boost_1_76_0;boost-1_76;boost_1_76;boost/boost-1_76;boost/boost_1_76;boost-1_75_0;boost_1_75_0;boost/boost-1_75_0;boost/boost_1_75_0;boost-1_75;boost_1_75;boost/boost-1_75;boost/boost_1_75;boost-1_74_0;boost_1_74_0;boost/boost-1_74_0;boost/boost_1_74_0;boost-1_74;boost_1_74;boost/boost-1_74;boost/boost_1_74;boost-1_73_0;boost_1_73_0;boost/boost-1_73_0;boost/boost_1_73_0;boost-1_73;boost_1_73;boost/boost-1_73;boost/boost_1_73;boost-1_72_0;boost_1_72_0;boost/boost-1_72_0;boost/boost_1_72_0;boost-1_72;boost_1_72;boost/boost-1_72;boost/boost_1_72;boost-1_71_0;boost_1_71_0;boost/boost-1_71_0;boost/boost_1_71_0;boost-1_71;boost_1_71;boost/boost-1_71;boost/boost_1_71;boost-1_70_0;boost_1_70_0;boost/boost-1_70_0;boost/boost_1_70_0;boost-1_70;boost_1_70;boost/boost-1_70;boost/boost_1_70;boost-1_69_0;boost_1_69_0;boost/boost-1_69_0;boost/boost_1_69_0;boost-1_69;boost_1_69;boost/boost-1_69;boost/boost_1_69;boost-1_68_0;boost_1_68_0;boost/boost-1_68_0;boost/boost_1_68_0;boost-1_68;boost_1_68;boost/boost-1_68;boost/boost_1_68;boost-1_67_0;boost_1_67_0;boost/boost-1_67_0;boost/boost_1_67_0;boost-1_67;boost_1_67;boost/boost-1_67;boost/boost_1_67;boost-1_66_0;boost_1_66_0;boost/boost-1_66_0;boost/boost_1_66_0;boost-1_66;boost_1_66;boost/boost-1_66;boost/boost_1_66;boost-1_65_1;boost_1_65_1;boost/boost-1_65_1;boost/boost_1_65_1;boost-1_65;boost_1_65;boost/boost-1_65;boost/boost_1_65)VAR");
+	print(false, "", "_boost_RELEASE_ABI_TAG", R"VAR()VAR");
+	print(false, "", "_boost_RELEASE_NAMES", R"VAR(boost_chrono-gcc12-mt-1_74;boost_chrono-gcc12-mt;boost_chrono-gcc12-mt;boost_chrono-mt-1_74;boost_chrono-mt;boost_chrono-mt;boost_chrono-mt;boost_chrono)VAR");
+	print(false, "", "_boost_STATIC_RUNTIME_WORKAROUND", R"VAR(false)VAR");
+	print(false, "", "_boost_TEST_VERSIONS", R"VAR(1.80.0;1.80;1.79.0;1.79;1.78.0;1.78;1.77.0;1.77;1.76.0;1.76;1.75.0;1.75;1.74.0;1.74;1.73.0;1.73;1.72.0;1.72;1.71.0;1.71;1.70.0;1.70;1.69.0;1.69;1.68.0;1.68;1.67.0;1.67;1.66.0;1.66;1.65.1;1.65)VAR");
+	print(false, "", "_boost_VER", R"VAR()VAR");
+	print(false, "", "_boost_docstring_debug", R"VAR(Boost chrono library (debug))VAR");
+	print(false, "", "_boost_docstring_release", R"VAR(Boost chrono library (release))VAR");
+	print(false, "", "_eigen3_major_version_match", R"VAR(define EIGEN_MAJOR_VERSION 4)VAR");
+	print(false, "", "_eigen3_minor_version_match", R"VAR(define EIGEN_MINOR_VERSION 0)VAR");
+	print(false, "", "_eigen3_version_header", R"VAR(// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// Copyright (C) 2008-2015 Gael Guennebaud <gael.guennebaud@inria.fr>
+// Copyright (C) 2006-2008 Benoit Jacob <jacob.benoit.1@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef EIGEN_MACROS_H
+#define EIGEN_MACROS_H
+
+//------------------------------------------------------------------------------------------
+// Eigen version and basic defaults
+//------------------------------------------------------------------------------------------
+
+#define EIGEN_WORLD_VERSION 3
+#define EIGEN_MAJOR_VERSION 4
+#define EIGEN_MINOR_VERSION 0
+
+#define EIGEN_VERSION_AT_LEAST(x,y,z) (EIGEN_WORLD_VERSION>x || (EIGEN_WORLD_VERSION>=x && \
+                                      (EIGEN_MAJOR_VERSION>y || (EIGEN_MAJOR_VERSION>=y && \
+                                                                 EIGEN_MINOR_VERSION>=z))))
+
+#ifdef EIGEN_DEFAULT_TO_ROW_MAJOR
+#define EIGEN_DEFAULT_MATRIX_STORAGE_ORDER_OPTION Eigen::RowMajor
+#else
+#define EIGEN_DEFAULT_MATRIX_STORAGE_ORDER_OPTION Eigen::ColMajor
+#endif
+
+#ifndef EIGEN_DEFAULT_DENSE_INDEX_TYPE
+#define EIGEN_DEFAULT_DENSE_INDEX_TYPE std::ptrdiff_t
+#endif
+
+// Upperbound on the C++ version to use.
+// Expected values are 03, 11, 14, 17, etc.
+// By default, let's use an arbitrarily large C++ version.
+#ifndef EIGEN_MAX_CPP_VER
+#define EIGEN_MAX_CPP_VER 99
+#endif
+
+/** Allows to disable some optimizations which might affect the accuracy of the result.
+  * Such optimization are enabled by default, and set EIGEN_FAST_MATH to 0 to disable them.
+  * They currently include:
+  *   - single precision ArrayBase::sin() and ArrayBase::cos() for SSE and AVX vectorization.
+  */
+#ifndef EIGEN_FAST_MATH
+#define EIGEN_FAST_MATH 1
+#endif
+
+#ifndef EIGEN_STACK_ALLOCATION_LIMIT
+// 131072 == 128 KB
+#define EIGEN_STACK_ALLOCATION_LIMIT 131072
+#endif
+
+//------------------------------------------------------------------------------------------
+// Compiler identification, EIGEN_COMP_*
+//------------------------------------------------------------------------------------------
+
+/// \internal EIGEN_COMP_GNUC set to 1 for all compilers compatible with GCC
+#ifdef __GNUC__
+  #define EIGEN_COMP_GNUC (__GNUC__*10+__GNUC_MINOR__)
+#else
+  #define EIGEN_COMP_GNUC 0
+#endif
+
+/// \internal EIGEN_COMP_CLANG set to major+minor version (e.g., 307 for clang 3.7) if the compiler is clang
+#if defined(__clang__)
+  #define EIGEN_COMP_CLANG (__clang_major__*100+__clang_minor__)
+#else
+  #define EIGEN_COMP_CLANG 0
+#endif
+
+/// \internal EIGEN_COMP_CASTXML set to 1 if being preprocessed by CastXML
+#if defined(__castxml__)
+  #define EIGEN_COMP_CASTXML 1
+#else
+  #define EIGEN_COMP_CASTXML 0
+#endif
+
+/// \internal EIGEN_COMP_LLVM set to 1 if the compiler backend is llvm
+#if defined(__llvm__)
+  #define EIGEN_COMP_LLVM 1
+#else
+  #define EIGEN_COMP_LLVM 0
+#endif
+
+/// \internal EIGEN_COMP_ICC set to __INTEL_COMPILER if the compiler is Intel compiler, 0 otherwise
+#if defined(__INTEL_COMPILER)
+  #define EIGEN_COMP_ICC __INTEL_COMPILER
+#else
+  #define EIGEN_COMP_ICC 0
+#endif
+
+/// \internal EIGEN_COMP_MINGW set to 1 if the compiler is mingw
+#if defined(__MINGW32__)
+  #define EIGEN_COMP_MINGW 1
+#else
+  #define EIGEN_COMP_MINGW 0
+#endif
+
+/// \internal EIGEN_COMP_SUNCC set to 1 if the compiler is Solaris Studio
+#if defined(__SUNPRO_CC)
+  #define EIGEN_COMP_SUNCC 1
+#else
+  #define EIGEN_COMP_SUNCC 0
+#endif
+
+/// \internal EIGEN_COMP_MSVC set to _MSC_VER if the compiler is Microsoft Visual C++, 0 otherwise.
+#if defined(_MSC_VER)
+  #define EIGEN_COMP_MSVC _MSC_VER
+#else
+  #define EIGEN_COMP_MSVC 0
+#endif
+
+#if defined(__NVCC__)
+#if defined(__CUDACC_VER_MAJOR__) && (__CUDACC_VER_MAJOR__ >= 9)
+  #define EIGEN_COMP_NVCC  ((__CUDACC_VER_MAJOR__ * 10000) + (__CUDACC_VER_MINOR__ * 100))
+#elif defined(__CUDACC_VER__)
+  #define EIGEN_COMP_NVCC __CUDACC_VER__
+#else
+  #error "NVCC did not define compiler version."
+#endif
+#else
+  #define EIGEN_COMP_NVCC 0
+#endif
+
+// For the record, here is a table summarizing the possible values for EIGEN_COMP_MSVC:
+//  name        ver   MSC_VER
+//  2008         9      1500
+//  2010        10      1600
+//  2012        11      1700
+//  2013        12      1800
+//  2015        14      1900
+//  "15"        15      1900
+//  2017-14.1   15.0    1910
+//  2017-14.11  15.3    1911
+//  2017-14.12  15.5    1912
+//  2017-14.13  15.6    1913
+//  2017-14.14  15.7    1914
+
+/// \internal EIGEN_COMP_MSVC_LANG set to _MSVC_LANG if the compiler is Microsoft Visual C++, 0 otherwise.
+#if defined(_MSVC_LANG)
+  #define EIGEN_COMP_MSVC_LANG _MSVC_LANG
+#else
+  #define EIGEN_COMP_MSVC_LANG 0
+#endif
+
+// For the record, here is a table summarizing the possible values for EIGEN_COMP_MSVC_LANG:
+// MSVC option                          Standard  MSVC_LANG
+// /std:c++14 (default as of VS 2019)   C++14     201402L
+// /std:c++17                           C++17     201703L
+// /std:c++latest                       >C++17    >201703L
+
+/// \internal EIGEN_COMP_MSVC_STRICT set to 1 if the compiler is really Microsoft Visual C++ and not ,e.g., ICC or clang-cl
+#if EIGEN_COMP_MSVC && !(EIGEN_COMP_ICC || EIGEN_COMP_LLVM || EIGEN_COMP_CLANG)
+  #define EIGEN_COMP_MSVC_STRICT _MSC_VER
+#else
+  #define EIGEN_COMP_MSVC_STRICT 0
+#endif
+
+/// \internal EIGEN_COMP_IBM set to xlc version if the compiler is IBM XL C++
+// XLC   version
+// 3.1   0x0301
+// 4.5   0x0405
+// 5.0   0x0500
+// 12.1  0x0C01
+#if defined(__IBMCPP__) || defined(__xlc__) || defined(__ibmxl__)
+  #define EIGEN_COMP_IBM __xlC__
+#else
+  #define EIGEN_COMP_IBM 0
+#endif
+
+/// \internal EIGEN_COMP_PGI set to PGI version if the compiler is Portland Group Compiler
+#if defined(__PGI)
+  #define EIGEN_COMP_PGI (__PGIC__*100+__PGIC_MINOR__)
+#else
+  #define EIGEN_COMP_PGI 0
+#endif
+
+/// \internal EIGEN_COMP_ARM set to 1 if the compiler is ARM Compiler
+#if defined(__CC_ARM) || defined(__ARMCC_VERSION)
+  #define EIGEN_COMP_ARM 1
+#else
+  #define EIGEN_COMP_ARM 0
+#endif
+
+/// \internal EIGEN_COMP_EMSCRIPTEN set to 1 if the compiler is Emscripten Compiler
+#if defined(__EMSCRIPTEN__)
+  #define EIGEN_COMP_EMSCRIPTEN 1
+#else
+  #define EIGEN_COMP_EMSCRIPTEN 0
+#endif
+
+
+/// \internal EIGEN_GNUC_STRICT set to 1 if the compiler is really GCC and not a compatible compiler (e.g., ICC, clang, mingw, etc.)
+#if EIGEN_COMP_GNUC && !(EIGEN_COMP_CLANG || EIGEN_COMP_ICC || EIGEN_COMP_MINGW || EIGEN_COMP_PGI || EIGEN_COMP_IBM || EIGEN_COMP_ARM || EIGEN_COMP_EMSCRIPTEN)
+  #define EIGEN_COMP_GNUC_STRICT 1
+#else
+  #define EIGEN_COMP_GNUC_STRICT 0
+#endif
+
+
+#if EIGEN_COMP_GNUC
+  #define EIGEN_GNUC_AT_LEAST(x,y) ((__GNUC__==x && __GNUC_MINOR__>=y) || __GNUC__>x)
+  #define EIGEN_GNUC_AT_MOST(x,y)  ((__GNUC__==x && __GNUC_MINOR__<=y) || __GNUC__<x)
+  #define EIGEN_GNUC_AT(x,y)       ( __GNUC__==x && __GNUC_MINOR__==y )
+#else
+  #define EIGEN_GNUC_AT_LEAST(x,y) 0
+  #define EIGEN_GNUC_AT_MOST(x,y)  0
+  #define EIGEN_GNUC_AT(x,y)       0
+#endif
+
+// FIXME: could probably be removed as we do not support gcc 3.x anymore
+#if EIGEN_COMP_GNUC && (__GNUC__ <= 3)
+#define EIGEN_GCC3_OR_OLDER 1
+#else
+#define EIGEN_GCC3_OR_OLDER 0
+#endif
+
+
+
+//------------------------------------------------------------------------------------------
+// Architecture identification, EIGEN_ARCH_*
+//------------------------------------------------------------------------------------------
+
+
+#if defined(__x86_64__) || (defined(_M_X64) && !defined(_M_ARM64EC)) || defined(__amd64)
+  #define EIGEN_ARCH_x86_64 1
+#else
+  #define EIGEN_ARCH_x86_64 0
+#endif
+
+#if defined(__i386__) || defined(_M_IX86) || defined(_X86_) || defined(__i386)
+  #define EIGEN_ARCH_i386 1
+#else
+  #define EIGEN_ARCH_i386 0
+#endif
+
+#if EIGEN_ARCH_x86_64 || EIGEN_ARCH_i386
+  #define EIGEN_ARCH_i386_OR_x86_64 1
+#else
+  #define EIGEN_ARCH_i386_OR_x86_64 0
+#endif
+
+/// \internal EIGEN_ARCH_ARM set to 1 if the architecture is ARM
+#if defined(__arm__)
+  #define EIGEN_ARCH_ARM 1
+#else
+  #define EIGEN_ARCH_ARM 0
+#endif
+
+/// \internal EIGEN_ARCH_ARM64 set to 1 if the architecture is ARM64
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(_M_ARM64EC)
+  #define EIGEN_ARCH_ARM64 1
+#else
+  #define EIGEN_ARCH_ARM64 0
+#endif
+
+/// \internal EIGEN_ARCH_ARM_OR_ARM64 set to 1 if the architecture is ARM or ARM64
+#if EIGEN_ARCH_ARM || EIGEN_ARCH_ARM64
+  #define EIGEN_ARCH_ARM_OR_ARM64 1
+#else
+  #define EIGEN_ARCH_ARM_OR_ARM64 0
+#endif
+
+/// \internal EIGEN_ARCH_ARMV8 set to 1 if the architecture is armv8 or greater.
+#if EIGEN_ARCH_ARM_OR_ARM64 && defined(__ARM_ARCH) && __ARM_ARCH >= 8
+#define EIGEN_ARCH_ARMV8 1
+#else
+#define EIGEN_ARCH_ARMV8 0
+#endif
+
+
+/// \internal EIGEN_HAS_ARM64_FP16 set to 1 if the architecture provides an IEEE
+/// compliant Arm fp16 type
+#if EIGEN_ARCH_ARM64
+  #ifndef EIGEN_HAS_ARM64_FP16
+    #if defined(__ARM_FP16_FORMAT_IEEE)
+      #define EIGEN_HAS_ARM64_FP16 1
+    #else
+      #define EIGEN_HAS_ARM64_FP16 0
+    #endif
+  #endif
+#endif
+
+/// \internal EIGEN_HAS_ARM64_FP16_VECTOR_ARITHMETIC set to 1 if the architecture
+/// supports Neon vector intrinsics for fp16.
+#if EIGEN_ARCH_ARM64
+  #ifndef EIGEN_HAS_ARM64_FP16_VECTOR_ARITHMETIC
+    #if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+      #define EIGEN_HAS_ARM64_FP16_VECTOR_ARITHMETIC 1
+    #else
+      #define EIGEN_HAS_ARM64_FP16_VECTOR_ARITHMETIC 0
+    #endif
+  #endif
+#endif
+
+/// \internal EIGEN_HAS_ARM64_FP16_SCALAR_ARITHMETIC set to 1 if the architecture
+/// supports Neon scalar intrinsics for fp16.
+#if EIGEN_ARCH_ARM64
+  #ifndef EIGEN_HAS_ARM64_FP16_SCALAR_ARITHMETIC
+    #if defined(__ARM_FEATURE_FP16_SCALAR_ARITHMETIC)
+      #define EIGEN_HAS_ARM64_FP16_SCALAR_ARITHMETIC 1
+    #endif
+  #endif
+#endif
+
+/// \internal EIGEN_ARCH_MIPS set to 1 if the architecture is MIPS
+#if defined(__mips__) || defined(__mips)
+  #define EIGEN_ARCH_MIPS 1
+#else
+  #define EIGEN_ARCH_MIPS 0
+#endif
+
+/// \internal EIGEN_ARCH_SPARC set to 1 if the architecture is SPARC
+#if defined(__sparc__) || defined(__sparc)
+  #define EIGEN_ARCH_SPARC 1
+#else
+  #define EIGEN_ARCH_SPARC 0
+#endif
+
+/// \internal EIGEN_ARCH_IA64 set to 1 if the architecture is Intel Itanium
+#if defined(__ia64__)
+  #define EIGEN_ARCH_IA64 1
+#else
+  #define EIGEN_ARCH_IA64 0
+#endif
+
+/// \internal EIGEN_ARCH_PPC set to 1 if the architecture is PowerPC
+#if defined(__powerpc__) || defined(__ppc__) || defined(_M_PPC)
+  #define EIGEN_ARCH_PPC 1
+#else
+  #define EIGEN_ARCH_PPC 0
+#endif
+
+
+
+//------------------------------------------------------------------------------------------
+// Operating system identification, EIGEN_OS_*
+//------------------------------------------------------------------------------------------
+
+/// \internal EIGEN_OS_UNIX set to 1 if the OS is a unix variant
+#if defined(__unix__) || defined(__unix)
+  #define EIGEN_OS_UNIX 1
+#else
+  #define EIGEN_OS_UNIX 0
+#endif
+
+/// \internal EIGEN_OS_LINUX set to 1 if the OS is based on Linux kernel
+#if defined(__linux__)
+  #define EIGEN_OS_LINUX 1
+#else
+  #define EIGEN_OS_LINUX 0
+#endif
+
+/// \internal EIGEN_OS_ANDROID set to 1 if the OS is Android
+// note: ANDROID is defined when using ndk_build, __ANDROID__ is defined when using a standalone toolchain.
+#if defined(__ANDROID__) || defined(ANDROID)
+  #define EIGEN_OS_ANDROID 1
+#else
+  #define EIGEN_OS_ANDROID 0
+#endif
+
+/// \internal EIGEN_OS_GNULINUX set to 1 if the OS is GNU Linux and not Linux-based OS (e.g., not android)
+#if defined(__gnu_linux__) && !(EIGEN_OS_ANDROID)
+  #define EIGEN_OS_GNULINUX 1
+#else
+  #define EIGEN_OS_GNULINUX 0
+#endif
+
+/// \internal EIGEN_OS_BSD set to 1 if the OS is a BSD variant
+#if defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__bsdi__) || defined(__DragonFly__)
+  #define EIGEN_OS_BSD 1
+#else
+  #define EIGEN_OS_BSD 0
+#endif
+
+/// \internal EIGEN_OS_MAC set to 1 if the OS is MacOS
+#if defined(__APPLE__)
+  #define EIGEN_OS_MAC 1
+#else
+  #define EIGEN_OS_MAC 0
+#endif
+
+/// \internal EIGEN_OS_QNX set to 1 if the OS is QNX
+#if defined(__QNX__)
+  #define EIGEN_OS_QNX 1
+#else
+  #define EIGEN_OS_QNX 0
+#endif
+
+/// \internal EIGEN_OS_WIN set to 1 if the OS is Windows based
+#if defined(_WIN32)
+  #define EIGEN_OS_WIN 1
+#else
+  #define EIGEN_OS_WIN 0
+#endif
+
+/// \internal EIGEN_OS_WIN64 set to 1 if the OS is Windows 64bits
+#if defined(_WIN64)
+  #define EIGEN_OS_WIN64 1
+#else
+  #define EIGEN_OS_WIN64 0
+#endif
+
+/// \internal EIGEN_OS_WINCE set to 1 if the OS is Windows CE
+#if defined(_WIN32_WCE)
+  #define EIGEN_OS_WINCE 1
+#else
+  #define EIGEN_OS_WINCE 0
+#endif
+
+/// \internal EIGEN_OS_CYGWIN set to 1 if the OS is Windows/Cygwin
+#if defined(__CYGWIN__)
+  #define EIGEN_OS_CYGWIN 1
+#else
+  #define EIGEN_OS_CYGWIN 0
+#endif
+
+/// \internal EIGEN_OS_WIN_STRICT set to 1 if the OS is really Windows and not some variants
+#if EIGEN_OS_WIN && !( EIGEN_OS_WINCE || EIGEN_OS_CYGWIN )
+  #define EIGEN_OS_WIN_STRICT 1
+#else
+  #define EIGEN_OS_WIN_STRICT 0
+#endif
+
+/// \internal EIGEN_OS_SUN set to __SUNPRO_C if the OS is SUN
+// compiler  solaris   __SUNPRO_C
+// version   studio
+// 5.7       10        0x570
+// 5.8       11        0x580
+// 5.9       12        0x590
+// 5.10	     12.1      0x5100
+// 5.11	     12.2      0x5110
+// 5.12	     12.3      0x5120
+#if (defined(sun) || defined(__sun)) && !(defined(__SVR4) || defined(__svr4__))
+  #define EIGEN_OS_SUN __SUNPRO_C
+#else
+  #define EIGEN_OS_SUN 0
+#endif
+
+/// \internal EIGEN_OS_SOLARIS set to 1 if the OS is Solaris
+#if (defined(sun) || defined(__sun)) && (defined(__SVR4) || defined(__svr4__))
+  #define EIGEN_OS_SOLARIS 1
+#else
+  #define EIGEN_OS_SOLARIS 0
+#endif
+
+
+//------------------------------------------------------------------------------------------
+// Detect GPU compilers and architectures
+//------------------------------------------------------------------------------------------
+
+// NVCC is not supported as the target platform for HIPCC
+// Note that this also makes EIGEN_CUDACC and EIGEN_HIPCC mutually exclusive
+#if defined(__NVCC__) && defined(__HIPCC__)
+  #error "NVCC as the target platform for HIPCC is currently not supported."
+#endif
+
+#if defined(__CUDACC__) && !defined(EIGEN_NO_CUDA)
+  // Means the compiler is either nvcc or clang with CUDA enabled
+  #define EIGEN_CUDACC __CUDACC__
+#endif
+
+#if defined(__CUDA_ARCH__) && !defined(EIGEN_NO_CUDA)
+  // Means we are generating code for the device
+  #define EIGEN_CUDA_ARCH __CUDA_ARCH__
+#endif
+
+#if defined(EIGEN_CUDACC)
+#include <cuda.h>
+  #define EIGEN_CUDA_SDK_VER (CUDA_VERSION * 10)
+#else
+  #define EIGEN_CUDA_SDK_VER 0
+#endif
+
+#if defined(__HIPCC__) && !defined(EIGEN_NO_HIP)
+  // Means the compiler is HIPCC (analogous to EIGEN_CUDACC, but for HIP)
+  #define EIGEN_HIPCC __HIPCC__
+
+  // We need to include hip_runtime.h here because it pulls in
+  // ++ hip_common.h which contains the define for  __HIP_DEVICE_COMPILE__
+  // ++ host_defines.h which contains the defines for the __host__ and __device__ macros
+  #include <hip/hip_runtime.h>
+
+  #if defined(__HIP_DEVICE_COMPILE__)
+    // analogous to EIGEN_CUDA_ARCH, but for HIP
+    #define EIGEN_HIP_DEVICE_COMPILE __HIP_DEVICE_COMPILE__
+  #endif
+
+  // For HIP (ROCm 3.5 and higher), we need to explicitly set the launch_bounds attribute
+  // value to 1024. The compiler assigns a default value of 256 when the attribute is not
+  // specified. This results in failures on the HIP platform, for cases when a GPU kernel
+  // without an explicit launch_bounds attribute is called with a threads_per_block value
+  // greater than 256.
+  //
+  // This is a regression in functioanlity and is expected to be fixed within the next
+  // couple of ROCm releases (compiler will go back to using 1024 value as the default)
+  //
+  // In the meantime, we will use a "only enabled for HIP" macro to set the launch_bounds
+  // attribute.
+
+  #define EIGEN_HIP_LAUNCH_BOUNDS_1024 __launch_bounds__(1024)
+
+#endif
+
+#if !defined(EIGEN_HIP_LAUNCH_BOUNDS_1024)
+#define EIGEN_HIP_LAUNCH_BOUNDS_1024
+#endif // !defined(EIGEN_HIP_LAUNCH_BOUNDS_1024)
+
+// Unify CUDA/HIPCC
+
+#if defined(EIGEN_CUDACC) || defined(EIGEN_HIPCC)
+//
+// If either EIGEN_CUDACC or EIGEN_HIPCC is defined, then define EIGEN_GPUCC
+//
+#define EIGEN_GPUCC
+//
+// EIGEN_HIPCC implies the HIP compiler and is used to tweak Eigen code for use in HIP kernels
+// EIGEN_CUDACC implies the CUDA compiler and is used to tweak Eigen code for use in CUDA kernels
+//
+// In most cases the same tweaks are required to the Eigen code to enable in both the HIP and CUDA kernels.
+// For those cases, the corresponding code should be guarded with
+//      #if defined(EIGEN_GPUCC)
+// instead of
+//      #if defined(EIGEN_CUDACC) || defined(EIGEN_HIPCC)
+//
+// For cases where the tweak is specific to HIP, the code should be guarded with
+//      #if defined(EIGEN_HIPCC)
+//
+// For cases where the tweak is specific to CUDA, the code should be guarded with
+//      #if defined(EIGEN_CUDACC)
+//
+#endif
+
+#if defined(EIGEN_CUDA_ARCH) || defined(EIGEN_HIP_DEVICE_COMPILE)
+//
+// If either EIGEN_CUDA_ARCH or EIGEN_HIP_DEVICE_COMPILE is defined, then define EIGEN_GPU_COMPILE_PHASE
+//
+#define EIGEN_GPU_COMPILE_PHASE
+//
+// GPU compilers (HIPCC, NVCC) typically do two passes over the source code,
+//   + one to compile the source for the "host" (ie CPU)
+//   + another to compile the source for the "device" (ie. GPU)
+//
+// Code that needs to enabled only during the either the "host" or "device" compilation phase
+// needs to be guarded with a macro that indicates the current compilation phase
+//
+// EIGEN_HIP_DEVICE_COMPILE implies the device compilation phase in HIP
+// EIGEN_CUDA_ARCH implies the device compilation phase in CUDA
+//
+// In most cases, the "host" / "device" specific code is the same for both HIP and CUDA
+// For those cases, the code should be guarded with
+//       #if defined(EIGEN_GPU_COMPILE_PHASE)
+// instead of
+//       #if defined(EIGEN_CUDA_ARCH) || defined(EIGEN_HIP_DEVICE_COMPILE)
+//
+// For cases where the tweak is specific to HIP, the code should be guarded with
+//      #if defined(EIGEN_HIP_DEVICE_COMPILE)
+//
+// For cases where the tweak is specific to CUDA, the code should be guarded with
+//      #if defined(EIGEN_CUDA_ARCH)
+//
+#endif
+
+#if defined(EIGEN_USE_SYCL) && defined(__SYCL_DEVICE_ONLY__)
+// EIGEN_USE_SYCL is a user-defined macro while __SYCL_DEVICE_ONLY__ is a compiler-defined macro.
+// In most cases we want to check if both macros are defined which can be done using the define below.
+#define SYCL_DEVICE_ONLY
+#endif
+
+//------------------------------------------------------------------------------------------
+// Detect Compiler/Architecture/OS specific features
+//------------------------------------------------------------------------------------------
+
+#if EIGEN_GNUC_AT_MOST(4,3) && !EIGEN_COMP_CLANG
+  // see bug 89
+  #define EIGEN_SAFE_TO_USE_STANDARD_ASSERT_MACRO 0
+#else
+  #define EIGEN_SAFE_TO_USE_STANDARD_ASSERT_MACRO 1
+#endif
+
+// Cross compiler wrapper around LLVM's __has_builtin
+#ifdef __has_builtin
+#  define EIGEN_HAS_BUILTIN(x) __has_builtin(x)
+#else
+#  define EIGEN_HAS_BUILTIN(x) 0
+#endif
+
+// A Clang feature extension to determine compiler features.
+// We use it to determine 'cxx_rvalue_references'
+#ifndef __has_feature
+# define __has_feature(x) 0
+#endif
+
+// Some old compilers do not support template specializations like:
+// template<typename T,int N> void foo(const T x[N]);
+#if !(   EIGEN_COMP_CLANG && (   (EIGEN_COMP_CLANG<309)                                                       \
+                              || (defined(__apple_build_version__) && (__apple_build_version__ < 9000000)))  \
+      || EIGEN_COMP_GNUC_STRICT && EIGEN_COMP_GNUC<49)
+#define EIGEN_HAS_STATIC_ARRAY_TEMPLATE 1
+#else
+#define EIGEN_HAS_STATIC_ARRAY_TEMPLATE 0
+#endif
+
+// The macro EIGEN_CPLUSPLUS is a replacement for __cplusplus/_MSVC_LANG that
+// works for both platforms, indicating the C++ standard version number.
+//
+// With MSVC, without defining /Zc:__cplusplus, the __cplusplus macro will
+// report 199711L regardless of the language standard specified via /std.
+// We need to rely on _MSVC_LANG instead, which is only available after
+// VS2015.3.
+#if EIGEN_COMP_MSVC_LANG > 0
+#define EIGEN_CPLUSPLUS EIGEN_COMP_MSVC_LANG
+#elif EIGEN_COMP_MSVC >= 1900
+#define EIGEN_CPLUSPLUS 201103L
+#elif defined(__cplusplus)
+#define EIGEN_CPLUSPLUS __cplusplus
+#else
+#define EIGEN_CPLUSPLUS 0
+#endif
+
+// The macro EIGEN_COMP_CXXVER defines the c++ verson expected by the compiler.
+// For instance, if compiling with gcc and -std=c++17, then EIGEN_COMP_CXXVER
+// is defined to 17.
+#if EIGEN_CPLUSPLUS > 201703L
+  #define EIGEN_COMP_CXXVER 20
+#elif EIGEN_CPLUSPLUS > 201402L
+  #define EIGEN_COMP_CXXVER 17
+#elif EIGEN_CPLUSPLUS > 201103L
+  #define EIGEN_COMP_CXXVER 14
+#elif EIGEN_CPLUSPLUS >= 201103L
+  #define EIGEN_COMP_CXXVER 11
+#else
+  #define EIGEN_COMP_CXXVER 03
+#endif
+
+#ifndef EIGEN_HAS_CXX14_VARIABLE_TEMPLATES
+  #if defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304 && EIGEN_MAX_CPP_VER>=14
+    #define EIGEN_HAS_CXX14_VARIABLE_TEMPLATES 1
+  #else
+    #define EIGEN_HAS_CXX14_VARIABLE_TEMPLATES 0
+  #endif
+#endif
+
+
+// The macros EIGEN_HAS_CXX?? defines a rough estimate of available c++ features
+// but in practice we should not rely on them but rather on the availabilty of
+// individual features as defined later.
+// This is why there is no EIGEN_HAS_CXX17.
+// FIXME: get rid of EIGEN_HAS_CXX14 and maybe even EIGEN_HAS_CXX11.
+#if EIGEN_MAX_CPP_VER>=11 && EIGEN_COMP_CXXVER>=11
+#define EIGEN_HAS_CXX11 1
+#else
+#define EIGEN_HAS_CXX11 0
+#endif
+
+#if EIGEN_MAX_CPP_VER>=14 && EIGEN_COMP_CXXVER>=14
+#define EIGEN_HAS_CXX14 1
+#else
+#define EIGEN_HAS_CXX14 0
+#endif
+
+// Do we support r-value references?
+#ifndef EIGEN_HAS_RVALUE_REFERENCES
+#if EIGEN_MAX_CPP_VER>=11 && \
+    (__has_feature(cxx_rvalue_references) || \
+     (EIGEN_COMP_CXXVER >= 11) || (EIGEN_COMP_MSVC >= 1600))
+  #define EIGEN_HAS_RVALUE_REFERENCES 1
+#else
+  #define EIGEN_HAS_RVALUE_REFERENCES 0
+#endif
+#endif
+
+// Does the compiler support C99?
+// Need to include <cmath> to make sure _GLIBCXX_USE_C99 gets defined
+#include <cmath>
+#ifndef EIGEN_HAS_C99_MATH
+#if EIGEN_MAX_CPP_VER>=11 && \
+    ((defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901))       \
+  || (defined(__GNUC__) && defined(_GLIBCXX_USE_C99)) \
+  || (defined(_LIBCPP_VERSION) && !defined(_MSC_VER)) \
+  || (EIGEN_COMP_MSVC >= 1900) || defined(SYCL_DEVICE_ONLY))
+  #define EIGEN_HAS_C99_MATH 1
+#else
+  #define EIGEN_HAS_C99_MATH 0
+#endif
+#endif
+
+// Does the compiler support result_of?
+// result_of was deprecated in c++17 and removed in c++ 20
+#ifndef EIGEN_HAS_STD_RESULT_OF
+#if EIGEN_HAS_CXX11 && EIGEN_COMP_CXXVER < 17
+#define EIGEN_HAS_STD_RESULT_OF 1
+#else
+#define EIGEN_HAS_STD_RESULT_OF 0
+#endif
+#endif
+
+// Does the compiler support std::hash?
+#ifndef EIGEN_HAS_STD_HASH
+// The std::hash struct is defined in C++11 but is not labelled as a __device__
+// function and is not constexpr, so cannot be used on device.
+#if EIGEN_HAS_CXX11 && !defined(EIGEN_GPU_COMPILE_PHASE)
+#define EIGEN_HAS_STD_HASH 1
+#else
+#define EIGEN_HAS_STD_HASH 0
+#endif
+#endif  // EIGEN_HAS_STD_HASH
+
+#ifndef EIGEN_HAS_STD_INVOKE_RESULT
+#if EIGEN_MAX_CPP_VER >= 17 && EIGEN_COMP_CXXVER >= 17
+#define EIGEN_HAS_STD_INVOKE_RESULT 1
+#else
+#define EIGEN_HAS_STD_INVOKE_RESULT 0
+#endif
+#endif
+
+#ifndef EIGEN_HAS_ALIGNAS
+#if EIGEN_MAX_CPP_VER>=11 && EIGEN_HAS_CXX11 &&   \
+      (     __has_feature(cxx_alignas)            \
+        ||  EIGEN_HAS_CXX14                       \
+        || (EIGEN_COMP_MSVC >= 1800)              \
+        || (EIGEN_GNUC_AT_LEAST(4,8))             \
+        || (EIGEN_COMP_CLANG>=305)                \
+        || (EIGEN_COMP_ICC>=1500)                 \
+        || (EIGEN_COMP_PGI>=1500)                 \
+        || (EIGEN_COMP_SUNCC>=0x5130))
+#define EIGEN_HAS_ALIGNAS 1
+#else
+#define EIGEN_HAS_ALIGNAS 0
+#endif
+#endif
+
+// Does the compiler support type_traits?
+// - full support of type traits was added only to GCC 5.1.0.
+// - 20150626 corresponds to the last release of 4.x libstdc++
+#ifndef EIGEN_HAS_TYPE_TRAITS
+#if EIGEN_MAX_CPP_VER>=11 && (EIGEN_HAS_CXX11 || EIGEN_COMP_MSVC >= 1700) \
+  && ((!EIGEN_COMP_GNUC_STRICT) || EIGEN_GNUC_AT_LEAST(5, 1)) \
+  && ((!defined(__GLIBCXX__))   || __GLIBCXX__ > 20150626)
+#define EIGEN_HAS_TYPE_TRAITS 1
+#define EIGEN_INCLUDE_TYPE_TRAITS
+#else
+#define EIGEN_HAS_TYPE_TRAITS 0
+#endif
+#endif
+
+// Does the compiler support variadic templates?
+#ifndef EIGEN_HAS_VARIADIC_TEMPLATES
+#if EIGEN_MAX_CPP_VER>=11 && (EIGEN_COMP_CXXVER >= 11) \
+  && (!defined(__NVCC__) || !EIGEN_ARCH_ARM_OR_ARM64 || (EIGEN_COMP_NVCC >= 80000) )
+    // ^^ Disable the use of variadic templates when compiling with versions of nvcc older than 8.0 on ARM devices:
+    //    this prevents nvcc from crashing when compiling Eigen on Tegra X1
+#define EIGEN_HAS_VARIADIC_TEMPLATES 1
+#elif  EIGEN_MAX_CPP_VER>=11 && (EIGEN_COMP_CXXVER >= 11) && defined(SYCL_DEVICE_ONLY)
+#define EIGEN_HAS_VARIADIC_TEMPLATES 1
+#else
+#define EIGEN_HAS_VARIADIC_TEMPLATES 0
+#endif
+#endif
+
+// Does the compiler fully support const expressions? (as in c++14)
+#ifndef EIGEN_HAS_CONSTEXPR
+  #if defined(EIGEN_CUDACC)
+  // Const expressions are supported provided that c++11 is enabled and we're using either clang or nvcc 7.5 or above
+    #if EIGEN_MAX_CPP_VER>=14 && (EIGEN_COMP_CXXVER >= 11 && (EIGEN_COMP_CLANG || EIGEN_COMP_NVCC >= 70500))
+      #define EIGEN_HAS_CONSTEXPR 1
+    #endif
+  #elif EIGEN_MAX_CPP_VER>=14 && (__has_feature(cxx_relaxed_constexpr) || (EIGEN_COMP_CXXVER >= 14) || \
+    (EIGEN_GNUC_AT_LEAST(4,8) && (EIGEN_COMP_CXXVER >= 11)) || \
+    (EIGEN_COMP_CLANG >= 306 && (EIGEN_COMP_CXXVER >= 11)))
+    #define EIGEN_HAS_CONSTEXPR 1
+  #endif
+
+  #ifndef EIGEN_HAS_CONSTEXPR
+    #define EIGEN_HAS_CONSTEXPR 0
+  #endif
+
+#endif // EIGEN_HAS_CONSTEXPR
+
+#if EIGEN_HAS_CONSTEXPR
+#define EIGEN_CONSTEXPR constexpr
+#else
+#define EIGEN_CONSTEXPR
+#endif
+
+// Does the compiler support C++11 math?
+// Let's be conservative and enable the default C++11 implementation only if we are sure it exists
+#ifndef EIGEN_HAS_CXX11_MATH
+  #if EIGEN_MAX_CPP_VER>=11 && ((EIGEN_COMP_CXXVER > 11) || (EIGEN_COMP_CXXVER == 11) && (EIGEN_COMP_GNUC_STRICT || EIGEN_COMP_CLANG || EIGEN_COMP_MSVC || EIGEN_COMP_ICC)  \
+      && (EIGEN_ARCH_i386_OR_x86_64) && (EIGEN_OS_GNULINUX || EIGEN_OS_WIN_STRICT || EIGEN_OS_MAC))
+    #define EIGEN_HAS_CXX11_MATH 1
+  #else
+    #define EIGEN_HAS_CXX11_MATH 0
+  #endif
+#endif
+
+// Does the compiler support proper C++11 containers?
+#ifndef EIGEN_HAS_CXX11_CONTAINERS
+  #if    EIGEN_MAX_CPP_VER>=11 && \
+         ((EIGEN_COMP_CXXVER > 11) \
+      || ((EIGEN_COMP_CXXVER == 11) && (EIGEN_COMP_GNUC_STRICT || EIGEN_COMP_CLANG || EIGEN_COMP_MSVC || EIGEN_COMP_ICC>=1400)))
+    #define EIGEN_HAS_CXX11_CONTAINERS 1
+  #else
+    #define EIGEN_HAS_CXX11_CONTAINERS 0
+  #endif
+#endif
+
+// Does the compiler support C++11 noexcept?
+#ifndef EIGEN_HAS_CXX11_NOEXCEPT
+  #if    EIGEN_MAX_CPP_VER>=11 && \
+         (__has_feature(cxx_noexcept) \
+      || (EIGEN_COMP_CXXVER > 11) \
+      || ((EIGEN_COMP_CXXVER == 11) && (EIGEN_COMP_GNUC_STRICT || EIGEN_COMP_CLANG || EIGEN_COMP_MSVC || EIGEN_COMP_ICC>=1400)))
+    #define EIGEN_HAS_CXX11_NOEXCEPT 1
+  #else
+    #define EIGEN_HAS_CXX11_NOEXCEPT 0
+  #endif
+#endif
+
+#ifndef EIGEN_HAS_CXX11_ATOMIC
+  #if    EIGEN_MAX_CPP_VER>=11 && \
+         (__has_feature(cxx_atomic) \
+      || (EIGEN_COMP_CXXVER > 11) \
+      || ((EIGEN_COMP_CXXVER == 11) && (EIGEN_COMP_MSVC==0 || EIGEN_COMP_MSVC >= 1700)))
+    #define EIGEN_HAS_CXX11_ATOMIC 1
+  #else
+    #define EIGEN_HAS_CXX11_ATOMIC 0
+  #endif
+#endif
+
+#ifndef EIGEN_HAS_CXX11_OVERRIDE_FINAL
+  #if    EIGEN_MAX_CPP_VER>=11 && \
+       (EIGEN_COMP_CXXVER >= 11 || EIGEN_COMP_MSVC >= 1700)
+    #define EIGEN_HAS_CXX11_OVERRIDE_FINAL 1
+  #else
+    #define EIGEN_HAS_CXX11_OVERRIDE_FINAL 0
+  #endif
+#endif
+
+// NOTE: the required Apple's clang version is very conservative
+//       and it could be that XCode 9 works just fine.
+// NOTE: the MSVC version is based on https://en.cppreference.com/w/cpp/compiler_support
+//       and not tested.
+#ifndef EIGEN_HAS_CXX17_OVERALIGN
+#if EIGEN_MAX_CPP_VER>=17 && EIGEN_COMP_CXXVER>=17 && (                                 \
+           (EIGEN_COMP_MSVC >= 1912)                                                    \
+        || (EIGEN_GNUC_AT_LEAST(7,0))                                                   \
+        || ((!defined(__apple_build_version__)) && (EIGEN_COMP_CLANG>=500))             \
+        || (( defined(__apple_build_version__)) && (__apple_build_version__>=10000000)) \
+      )
+#define EIGEN_HAS_CXX17_OVERALIGN 1
+#else
+#define EIGEN_HAS_CXX17_OVERALIGN 0
+#endif
+#endif
+
+#if defined(EIGEN_CUDACC) && EIGEN_HAS_CONSTEXPR
+  // While available already with c++11, this is useful mostly starting with c++14 and relaxed constexpr rules
+  #if defined(__NVCC__)
+    // nvcc considers constexpr functions as __host__ __device__ with the option --expt-relaxed-constexpr
+    #ifdef __CUDACC_RELAXED_CONSTEXPR__
+      #define EIGEN_CONSTEXPR_ARE_DEVICE_FUNC
+    #endif
+  #elif defined(__clang__) && defined(__CUDA__) && __has_feature(cxx_relaxed_constexpr)
+    // clang++ always considers constexpr functions as implicitly __host__ __device__
+    #define EIGEN_CONSTEXPR_ARE_DEVICE_FUNC
+  #endif
+#endif
+
+// Does the compiler support the __int128 and __uint128_t extensions for 128-bit
+// integer arithmetic?
+//
+// Clang and GCC define __SIZEOF_INT128__ when these extensions are supported,
+// but we avoid using them in certain cases:
+//
+// * Building using Clang for Windows, where the Clang runtime library has
+//   128-bit support only on LP64 architectures, but Windows is LLP64.
+#ifndef EIGEN_HAS_BUILTIN_INT128
+#if defined(__SIZEOF_INT128__) && !(EIGEN_OS_WIN && EIGEN_COMP_CLANG)
+#define EIGEN_HAS_BUILTIN_INT128 1
+#else
+#define EIGEN_HAS_BUILTIN_INT128 0
+#endif
+#endif
+
+//------------------------------------------------------------------------------------------
+// Preprocessor programming helpers
+//------------------------------------------------------------------------------------------
+
+// This macro can be used to prevent from macro expansion, e.g.:
+//   std::max EIGEN_NOT_A_MACRO(a,b)
+#define EIGEN_NOT_A_MACRO
+
+#define EIGEN_DEBUG_VAR(x) std::cerr << #x << " = " << x << std::endl;
+
+// concatenate two tokens
+#define EIGEN_CAT2(a,b) a ## b
+#define EIGEN_CAT(a,b) EIGEN_CAT2(a,b)
+
+#define EIGEN_COMMA ,
+
+// convert a token to a string
+#define EIGEN_MAKESTRING2(a) #a
+#define EIGEN_MAKESTRING(a) EIGEN_MAKESTRING2(a)
+
+// EIGEN_STRONG_INLINE is a stronger version of the inline, using __forceinline on MSVC,
+// but it still doesn't use GCC's always_inline. This is useful in (common) situations where MSVC needs forceinline
+// but GCC is still doing fine with just inline.
+#ifndef EIGEN_STRONG_INLINE
+#if (EIGEN_COMP_MSVC || EIGEN_COMP_ICC) && !defined(EIGEN_GPUCC)
+#define EIGEN_STRONG_INLINE __forceinline
+#else
+#define EIGEN_STRONG_INLINE inline
+#endif
+#endif
+
+// EIGEN_ALWAYS_INLINE is the stronget, it has the effect of making the function inline and adding every possible
+// attribute to maximize inlining. This should only be used when really necessary: in particular,
+// it uses __attribute__((always_inline)) on GCC, which most of the time is useless and can severely harm compile times.
+// FIXME with the always_inline attribute,
+// gcc 3.4.x and 4.1 reports the following compilation error:
+//   Eval.h:91: sorry, unimplemented: inlining failed in call to 'const Eigen::Eval<Derived> Eigen::MatrixBase<Scalar, Derived>::eval() const'
+//    : function body not available
+//   See also bug 1367
+#if EIGEN_GNUC_AT_LEAST(4,2) && !defined(SYCL_DEVICE_ONLY)
+#define EIGEN_ALWAYS_INLINE __attribute__((always_inline)) inline
+#else
+#define EIGEN_ALWAYS_INLINE EIGEN_STRONG_INLINE
+#endif
+
+#if EIGEN_COMP_GNUC
+#define EIGEN_DONT_INLINE __attribute__((noinline))
+#elif EIGEN_COMP_MSVC
+#define EIGEN_DONT_INLINE __declspec(noinline)
+#else
+#define EIGEN_DONT_INLINE
+#endif
+
+#if EIGEN_COMP_GNUC
+#define EIGEN_PERMISSIVE_EXPR __extension__
+#else
+#define EIGEN_PERMISSIVE_EXPR
+#endif
+
+// GPU stuff
+
+// Disable some features when compiling with GPU compilers (NVCC/clang-cuda/SYCL/HIPCC)
+#if defined(EIGEN_CUDACC) || defined(SYCL_DEVICE_ONLY) || defined(EIGEN_HIPCC)
+  // Do not try asserts on device code
+  #ifndef EIGEN_NO_DEBUG
+  #define EIGEN_NO_DEBUG
+  #endif
+
+  #ifdef EIGEN_INTERNAL_DEBUGGING
+  #undef EIGEN_INTERNAL_DEBUGGING
+  #endif
+
+  #ifdef EIGEN_EXCEPTIONS
+  #undef EIGEN_EXCEPTIONS
+  #endif
+#endif
+
+#if defined(SYCL_DEVICE_ONLY)
+  #ifndef EIGEN_DONT_VECTORIZE
+    #define EIGEN_DONT_VECTORIZE
+  #endif
+  #define EIGEN_DEVICE_FUNC __attribute__((flatten)) __attribute__((always_inline))
+// All functions callable from CUDA/HIP code must be qualified with __device__
+#elif defined(EIGEN_GPUCC)
+    #define EIGEN_DEVICE_FUNC __host__ __device__
+#else
+  #define EIGEN_DEVICE_FUNC
+#endif
+
+
+// this macro allows to get rid of linking errors about multiply defined functions.
+//  - static is not very good because it prevents definitions from different object files to be merged.
+//           So static causes the resulting linked executable to be bloated with multiple copies of the same function.
+//  - inline is not perfect either as it unwantedly hints the compiler toward inlining the function.
+#define EIGEN_DECLARE_FUNCTION_ALLOWING_MULTIPLE_DEFINITIONS EIGEN_DEVICE_FUNC
+#define EIGEN_DEFINE_FUNCTION_ALLOWING_MULTIPLE_DEFINITIONS EIGEN_DEVICE_FUNC inline
+
+#ifdef NDEBUG
+# ifndef EIGEN_NO_DEBUG
+#  define EIGEN_NO_DEBUG
+# endif
+#endif
+
+// eigen_plain_assert is where we implement the workaround for the assert() bug in GCC <= 4.3, see bug 89
+#ifdef EIGEN_NO_DEBUG
+  #ifdef SYCL_DEVICE_ONLY // used to silence the warning on SYCL device
+    #define eigen_plain_assert(x) EIGEN_UNUSED_VARIABLE(x)
+  #else
+    #define eigen_plain_assert(x)
+  #endif
+#else
+  #if EIGEN_SAFE_TO_USE_STANDARD_ASSERT_MACRO
+    namespace Eigen {
+    namespace internal {
+    inline bool copy_bool(bool b) { return b; }
+    }
+    }
+    #define eigen_plain_assert(x) assert(x)
+  #else
+    // work around bug 89
+    #include <cstdlib>   // for abort
+    #include <iostream>  // for std::cerr
+
+    namespace Eigen {
+    namespace internal {
+    // trivial function copying a bool. Must be EIGEN_DONT_INLINE, so we implement it after including Eigen headers.
+    // see bug 89.
+    namespace {
+    EIGEN_DONT_INLINE bool copy_bool(bool b) { return b; }
+    }
+    inline void assert_fail(const char *condition, const char *function, const char *file, int line)
+    {
+      std::cerr << "assertion failed: " << condition << " in function " << function << " at " << file << ":" << line << std::endl;
+      abort();
+    }
+    }
+    }
+    #define eigen_plain_assert(x) \
+      do { \
+        if(!Eigen::internal::copy_bool(x)) \
+          Eigen::internal::assert_fail(EIGEN_MAKESTRING(x), __PRETTY_FUNCTION__, __FILE__, __LINE__); \
+      } while(false)
+  #endif
+#endif
+
+// eigen_assert can be overridden
+#ifndef eigen_assert
+#define eigen_assert(x) eigen_plain_assert(x)
+#endif
+
+#ifdef EIGEN_INTERNAL_DEBUGGING
+#define eigen_internal_assert(x) eigen_assert(x)
+#else
+#define eigen_internal_assert(x)
+#endif
+
+#ifdef EIGEN_NO_DEBUG
+#define EIGEN_ONLY_USED_FOR_DEBUG(x) EIGEN_UNUSED_VARIABLE(x)
+#else
+#define EIGEN_ONLY_USED_FOR_DEBUG(x)
+#endif
+
+#ifndef EIGEN_NO_DEPRECATED_WARNING
+  #if EIGEN_COMP_GNUC
+    #define EIGEN_DEPRECATED __attribute__((deprecated))
+  #elif EIGEN_COMP_MSVC
+    #define EIGEN_DEPRECATED __declspec(deprecated)
+  #else
+    #define EIGEN_DEPRECATED
+  #endif
+#else
+  #define EIGEN_DEPRECATED
+#endif
+
+#if EIGEN_COMP_GNUC
+#define EIGEN_UNUSED __attribute__((unused))
+#else
+#define EIGEN_UNUSED
+#endif
+
+// Suppresses 'unused variable' warnings.
+namespace Eigen {
+  namespace internal {
+    template<typename T> EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE void ignore_unused_variable(const T&) {}
+  }
+}
+#define EIGEN_UNUSED_VARIABLE(var) Eigen::internal::ignore_unused_variable(var);
+
+#if !defined(EIGEN_ASM_COMMENT)
+  #if EIGEN_COMP_GNUC && (EIGEN_ARCH_i386_OR_x86_64 || EIGEN_ARCH_ARM_OR_ARM64)
+    #define EIGEN_ASM_COMMENT(X)  __asm__("#" X)
+  #else
+    #define EIGEN_ASM_COMMENT(X)
+  #endif
+#endif
+
+
+// Acts as a barrier preventing operations involving `X` from crossing. This
+// occurs, for example, in the fast rounding trick where a magic constant is
+// added then subtracted, which is otherwise compiled away with -ffast-math.
+//
+// See bug 1674
+#if !defined(EIGEN_OPTIMIZATION_BARRIER)
+  #if EIGEN_COMP_GNUC
+    // According to https://gcc.gnu.org/onlinedocs/gcc/Constraints.html:
+    //   X: Any operand whatsoever.
+    //   r: A register operand is allowed provided that it is in a general
+    //      register.
+    //   g: Any register, memory or immediate integer operand is allowed, except
+    //      for registers that are not general registers.
+    //   w: (AArch32/AArch64) Floating point register, Advanced SIMD vector
+    //      register or SVE vector register.
+    //   x: (SSE) Any SSE register.
+    //      (AArch64) Like w, but restricted to registers 0 to 15 inclusive.
+    //   v: (PowerPC) An Altivec vector register.
+    //   wa:(PowerPC) A VSX register.
+    //
+    // "X" (uppercase) should work for all cases, though this seems to fail for
+    // some versions of GCC for arm/aarch64 with
+    //   "error: inconsistent operand constraints in an 'asm'"
+    // Clang x86_64/arm/aarch64 seems to require "g" to support both scalars and
+    // vectors, otherwise
+    //   "error: non-trivial scalar-to-vector conversion, possible invalid
+    //    constraint for vector type"
+    //
+    // GCC for ppc64le generates an internal compiler error with x/X/g.
+    // GCC for AVX generates an internal compiler error with X.
+    //
+    // Tested on icc/gcc/clang for sse, avx, avx2, avx512dq
+    //           gcc for arm, aarch64,
+    //           gcc for ppc64le,
+    // both vectors and scalars.
+    //
+    // Note that this is restricted to plain types - this will not work
+    // directly for std::complex<T>, Eigen::half, Eigen::bfloat16. For these,
+    // you will need to apply to the underlying POD type.
+    #if EIGEN_ARCH_PPC && EIGEN_COMP_GNUC_STRICT
+      // This seems to be broken on clang.  Packet4f is loaded into a single
+      //   register rather than a vector, zeroing out some entries.  Integer
+      //   types also generate a compile error.
+      // General, Altivec, VSX.
+      #define EIGEN_OPTIMIZATION_BARRIER(X)  __asm__  ("" : "+r,v,wa" (X));
+    #elif EIGEN_ARCH_ARM_OR_ARM64
+      #ifdef __ARM_FP
+        // General, VFP or NEON.
+        // Clang doesn't like "r",
+        //    error: non-trivial scalar-to-vector conversion, possible invalid
+        //           constraint for vector typ
+        #define EIGEN_OPTIMIZATION_BARRIER(X)  __asm__  ("" : "+g,w" (X));
+      #else
+        // Arm without VFP or NEON.
+        // "w" constraint will not compile.
+        #define EIGEN_OPTIMIZATION_BARRIER(X)  __asm__  ("" : "+g" (X));
+      #endif
+    #elif EIGEN_ARCH_i386_OR_x86_64
+      // General, SSE.
+      #define EIGEN_OPTIMIZATION_BARRIER(X)  __asm__  ("" : "+g,x" (X));
+    #else
+      // Not implemented for other architectures.
+      #define EIGEN_OPTIMIZATION_BARRIER(X)
+    #endif
+  #else
+    // Not implemented for other compilers.
+    #define EIGEN_OPTIMIZATION_BARRIER(X)
+  #endif
+#endif
+
+#if EIGEN_COMP_MSVC
+  // NOTE MSVC often gives C4127 warnings with compiletime if statements. See bug 1362.
+  // This workaround is ugly, but it does the job.
+#  define EIGEN_CONST_CONDITIONAL(cond)  (void)0, cond
+#else
+#  define EIGEN_CONST_CONDITIONAL(cond)  cond
+#endif
+
+#ifdef EIGEN_DONT_USE_RESTRICT_KEYWORD
+  #define EIGEN_RESTRICT
+#endif
+#ifndef EIGEN_RESTRICT
+  #define EIGEN_RESTRICT __restrict
+#endif
+
+
+#ifndef EIGEN_DEFAULT_IO_FORMAT
+#ifdef EIGEN_MAKING_DOCS
+// format used in Eigen's documentation
+// needed to define it here as escaping characters in CMake add_definition's argument seems very problematic.
+#define EIGEN_DEFAULT_IO_FORMAT Eigen::IOFormat(3, 0, " ", "\n", "", "")
+#else
+#define EIGEN_DEFAULT_IO_FORMAT Eigen::IOFormat()
+#endif
+#endif
+
+// just an empty macro !
+#define EIGEN_EMPTY
+
+
+// When compiling CUDA/HIP device code with NVCC or HIPCC
+// pull in math functions from the global namespace.
+// In host mode, and when device code is compiled with clang,
+// use the std versions.
+#if (defined(EIGEN_CUDA_ARCH) && defined(__NVCC__)) || defined(EIGEN_HIP_DEVICE_COMPILE)
+  #define EIGEN_USING_STD(FUNC) using ::FUNC;
+#else
+  #define EIGEN_USING_STD(FUNC) using std::FUNC;
+#endif
+
+#if EIGEN_COMP_MSVC_STRICT && (EIGEN_COMP_MSVC < 1900 || (EIGEN_COMP_MSVC == 1900 && EIGEN_COMP_NVCC))
+  // For older MSVC versions, as well as 1900 && CUDA 8, using the base operator is necessary,
+  //   otherwise we get duplicate definition errors
+  // For later MSVC versions, we require explicit operator= definition, otherwise we get
+  //   use of implicitly deleted operator errors.
+  // (cf Bugs 920, 1000, 1324, 2291)
+  #define EIGEN_INHERIT_ASSIGNMENT_EQUAL_OPERATOR(Derived) \
+    using Base::operator =;
+#elif EIGEN_COMP_CLANG // workaround clang bug (see http://forum.kde.org/viewtopic.php?f=74&t=102653)
+  #define EIGEN_INHERIT_ASSIGNMENT_EQUAL_OPERATOR(Derived) \
+    using Base::operator =; \
+    EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE Derived& operator=(const Derived& other) { Base::operator=(other); return *this; } \
+    template <typename OtherDerived> \
+    EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE Derived& operator=(const DenseBase<OtherDerived>& other) { Base::operator=(other.derived()); return *this; }
+#else
+  #define EIGEN_INHERIT_ASSIGNMENT_EQUAL_OPERATOR(Derived) \
+    using Base::operator =; \
+    EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE Derived& operator=(const Derived& other) \
+    { \
+      Base::operator=(other); \
+      return *this; \
+    }
+#endif
+
+
+/**
+ * \internal
+ * \brief Macro to explicitly define the default copy constructor.
+ * This is necessary, because the implicit definition is deprecated if the copy-assignment is overridden.
+ */
+#if EIGEN_HAS_CXX11
+#define EIGEN_DEFAULT_COPY_CONSTRUCTOR(CLASS) CLASS(const CLASS&) = default;
+#else
+#define EIGEN_DEFAULT_COPY_CONSTRUCTOR(CLASS)
+#endif
+
+
+
+/** \internal
+ * \brief Macro to manually inherit assignment operators.
+ * This is necessary, because the implicitly defined assignment operator gets deleted when a custom operator= is defined.
+ * With C++11 or later this also default-implements the copy-constructor
+ */
+#define EIGEN_INHERIT_ASSIGNMENT_OPERATORS(Derived)  \
+    EIGEN_INHERIT_ASSIGNMENT_EQUAL_OPERATOR(Derived) \
+    EIGEN_DEFAULT_COPY_CONSTRUCTOR(Derived)
+
+/** \internal
+ * \brief Macro to manually define default constructors and destructors.
+ * This is necessary when the copy constructor is re-defined.
+ * For empty helper classes this should usually be protected, to avoid accidentally creating empty objects.
+ *
+ * Hiding the default destructor lead to problems in C++03 mode together with boost::multiprecision
+ */
+#if EIGEN_HAS_CXX11
+#define EIGEN_DEFAULT_EMPTY_CONSTRUCTOR_AND_DESTRUCTOR(Derived)  \
+    Derived() = default; \
+    ~Derived() = default;
+#else
+#define EIGEN_DEFAULT_EMPTY_CONSTRUCTOR_AND_DESTRUCTOR(Derived)  \
+    Derived() {}; \
+    /* ~Derived() {}; */
+#endif
+
+
+
+
+
+/**
+* Just a side note. Commenting within defines works only by documenting
+* behind the object (via '!<'). Comments cannot be multi-line and thus
+* we have these extra long lines. What is confusing doxygen over here is
+* that we use '\' and basically have a bunch of typedefs with their
+* documentation in a single line.
+**/
+
+#define EIGEN_GENERIC_PUBLIC_INTERFACE(Derived) \
+  typedef typename Eigen::internal::traits<Derived>::Scalar Scalar; /*!< \brief Numeric type, e.g. float, double, int or std::complex<float>. */ \
+  typedef typename Eigen::NumTraits<Scalar>::Real RealScalar; /*!< \brief The underlying numeric type for composed scalar types. \details In cases where Scalar is e.g. std::complex<T>, T were corresponding to RealScalar. */ \
+  typedef typename Base::CoeffReturnType CoeffReturnType; /*!< \brief The return type for coefficient access. \details Depending on whether the object allows direct coefficient access (e.g. for a MatrixXd), this type is either 'const Scalar&' or simply 'Scalar' for objects that do not allow direct coefficient access. */ \
+  typedef typename Eigen::internal::ref_selector<Derived>::type Nested; \
+  typedef typename Eigen::internal::traits<Derived>::StorageKind StorageKind; \
+  typedef typename Eigen::internal::traits<Derived>::StorageIndex StorageIndex; \
+  enum CompileTimeTraits \
+      { RowsAtCompileTime = Eigen::internal::traits<Derived>::RowsAtCompileTime, \
+        ColsAtCompileTime = Eigen::internal::traits<Derived>::ColsAtCompileTime, \
+        Flags = Eigen::internal::traits<Derived>::Flags, \
+        SizeAtCompileTime = Base::SizeAtCompileTime, \
+        MaxSizeAtCompileTime = Base::MaxSizeAtCompileTime, \
+        IsVectorAtCompileTime = Base::IsVectorAtCompileTime }; \
+  using Base::derived; \
+  using Base::const_cast_derived;
+
+
+// FIXME Maybe the EIGEN_DENSE_PUBLIC_INTERFACE could be removed as importing PacketScalar is rarely needed
+#define EIGEN_DENSE_PUBLIC_INTERFACE(Derived) \
+  EIGEN_GENERIC_PUBLIC_INTERFACE(Derived) \
+  typedef typename Base::PacketScalar PacketScalar;
+
+
+#define EIGEN_PLAIN_ENUM_MIN(a,b) (((int)a <= (int)b) ? (int)a : (int)b)
+#define EIGEN_PLAIN_ENUM_MAX(a,b) (((int)a >= (int)b) ? (int)a : (int)b)
+
+// EIGEN_SIZE_MIN_PREFER_DYNAMIC gives the min between compile-time sizes. 0 has absolute priority, followed by 1,
+// followed by Dynamic, followed by other finite values. The reason for giving Dynamic the priority over
+// finite values is that min(3, Dynamic) should be Dynamic, since that could be anything between 0 and 3.
+#define EIGEN_SIZE_MIN_PREFER_DYNAMIC(a,b) (((int)a == 0 || (int)b == 0) ? 0 \
+                           : ((int)a == 1 || (int)b == 1) ? 1 \
+                           : ((int)a == Dynamic || (int)b == Dynamic) ? Dynamic \
+                           : ((int)a <= (int)b) ? (int)a : (int)b)
+
+// EIGEN_SIZE_MIN_PREFER_FIXED is a variant of EIGEN_SIZE_MIN_PREFER_DYNAMIC comparing MaxSizes. The difference is that finite values
+// now have priority over Dynamic, so that min(3, Dynamic) gives 3. Indeed, whatever the actual value is
+// (between 0 and 3), it is not more than 3.
+#define EIGEN_SIZE_MIN_PREFER_FIXED(a,b)  (((int)a == 0 || (int)b == 0) ? 0 \
+                           : ((int)a == 1 || (int)b == 1) ? 1 \
+                           : ((int)a == Dynamic && (int)b == Dynamic) ? Dynamic \
+                           : ((int)a == Dynamic) ? (int)b \
+                           : ((int)b == Dynamic) ? (int)a \
+                           : ((int)a <= (int)b) ? (int)a : (int)b)
+
+// see EIGEN_SIZE_MIN_PREFER_DYNAMIC. No need for a separate variant for MaxSizes here.
+#define EIGEN_SIZE_MAX(a,b) (((int)a == Dynamic || (int)b == Dynamic) ? Dynamic \
+                           : ((int)a >= (int)b) ? (int)a : (int)b)
+
+#define EIGEN_LOGICAL_XOR(a,b) (((a) || (b)) && !((a) && (b)))
+
+#define EIGEN_IMPLIES(a,b) (!(a) || (b))
+
+#if EIGEN_HAS_BUILTIN(__builtin_expect) || EIGEN_COMP_GNUC
+#define EIGEN_PREDICT_FALSE(x) (__builtin_expect(x, false))
+#define EIGEN_PREDICT_TRUE(x) (__builtin_expect(false || (x), true))
+#else
+#define EIGEN_PREDICT_FALSE(x) (x)
+#define EIGEN_PREDICT_TRUE(x) (x)
+#endif
+
+// the expression type of a standard coefficient wise binary operation
+#define EIGEN_CWISE_BINARY_RETURN_TYPE(LHS,RHS,OPNAME) \
+    CwiseBinaryOp< \
+      EIGEN_CAT(EIGEN_CAT(internal::scalar_,OPNAME),_op)< \
+          typename internal::traits<LHS>::Scalar, \
+          typename internal::traits<RHS>::Scalar \
+      >, \
+      const LHS, \
+      const RHS \
+    >
+
+#define EIGEN_MAKE_CWISE_BINARY_OP(METHOD,OPNAME) \
+  template<typename OtherDerived> \
+  EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE const EIGEN_CWISE_BINARY_RETURN_TYPE(Derived,OtherDerived,OPNAME) \
+  (METHOD)(const EIGEN_CURRENT_STORAGE_BASE_CLASS<OtherDerived> &other) const \
+  { \
+    return EIGEN_CWISE_BINARY_RETURN_TYPE(Derived,OtherDerived,OPNAME)(derived(), other.derived()); \
+  }
+
+#define EIGEN_SCALAR_BINARY_SUPPORTED(OPNAME,TYPEA,TYPEB) \
+  (Eigen::internal::has_ReturnType<Eigen::ScalarBinaryOpTraits<TYPEA,TYPEB,EIGEN_CAT(EIGEN_CAT(Eigen::internal::scalar_,OPNAME),_op)<TYPEA,TYPEB>  > >::value)
+
+#define EIGEN_EXPR_BINARYOP_SCALAR_RETURN_TYPE(EXPR,SCALAR,OPNAME) \
+  CwiseBinaryOp<EIGEN_CAT(EIGEN_CAT(internal::scalar_,OPNAME),_op)<typename internal::traits<EXPR>::Scalar,SCALAR>, const EXPR, \
+                const typename internal::plain_constant_type<EXPR,SCALAR>::type>
+
+#define EIGEN_SCALAR_BINARYOP_EXPR_RETURN_TYPE(SCALAR,EXPR,OPNAME) \
+  CwiseBinaryOp<EIGEN_CAT(EIGEN_CAT(internal::scalar_,OPNAME),_op)<SCALAR,typename internal::traits<EXPR>::Scalar>, \
+                const typename internal::plain_constant_type<EXPR,SCALAR>::type, const EXPR>
+
+// Workaround for MSVC 2010 (see ML thread "patch with compile for for MSVC 2010")
+#if EIGEN_COMP_MSVC_STRICT && (EIGEN_COMP_MSVC_STRICT<=1600)
+#define EIGEN_MSVC10_WORKAROUND_BINARYOP_RETURN_TYPE(X) typename internal::enable_if<true,X>::type
+#else
+#define EIGEN_MSVC10_WORKAROUND_BINARYOP_RETURN_TYPE(X) X
+#endif
+
+#define EIGEN_MAKE_SCALAR_BINARY_OP_ONTHERIGHT(METHOD,OPNAME) \
+  template <typename T> EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE \
+  EIGEN_MSVC10_WORKAROUND_BINARYOP_RETURN_TYPE(const EIGEN_EXPR_BINARYOP_SCALAR_RETURN_TYPE(Derived,typename internal::promote_scalar_arg<Scalar EIGEN_COMMA T EIGEN_COMMA EIGEN_SCALAR_BINARY_SUPPORTED(OPNAME,Scalar,T)>::type,OPNAME))\
+  (METHOD)(const T& scalar) const { \
+    typedef typename internal::promote_scalar_arg<Scalar,T,EIGEN_SCALAR_BINARY_SUPPORTED(OPNAME,Scalar,T)>::type PromotedT; \
+    return EIGEN_EXPR_BINARYOP_SCALAR_RETURN_TYPE(Derived,PromotedT,OPNAME)(derived(), \
+           typename internal::plain_constant_type<Derived,PromotedT>::type(derived().rows(), derived().cols(), internal::scalar_constant_op<PromotedT>(scalar))); \
+  }
+
+#define EIGEN_MAKE_SCALAR_BINARY_OP_ONTHELEFT(METHOD,OPNAME) \
+  template <typename T> EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE friend \
+  EIGEN_MSVC10_WORKAROUND_BINARYOP_RETURN_TYPE(const EIGEN_SCALAR_BINARYOP_EXPR_RETURN_TYPE(typename internal::promote_scalar_arg<Scalar EIGEN_COMMA T EIGEN_COMMA EIGEN_SCALAR_BINARY_SUPPORTED(OPNAME,T,Scalar)>::type,Derived,OPNAME)) \
+  (METHOD)(const T& scalar, const StorageBaseType& matrix) { \
+    typedef typename internal::promote_scalar_arg<Scalar,T,EIGEN_SCALAR_BINARY_SUPPORTED(OPNAME,T,Scalar)>::type PromotedT; \
+    return EIGEN_SCALAR_BINARYOP_EXPR_RETURN_TYPE(PromotedT,Derived,OPNAME)( \
+           typename internal::plain_constant_type<Derived,PromotedT>::type(matrix.derived().rows(), matrix.derived().cols(), internal::scalar_constant_op<PromotedT>(scalar)), matrix.derived()); \
+  }
+
+#define EIGEN_MAKE_SCALAR_BINARY_OP(METHOD,OPNAME) \
+  EIGEN_MAKE_SCALAR_BINARY_OP_ONTHELEFT(METHOD,OPNAME) \
+  EIGEN_MAKE_SCALAR_BINARY_OP_ONTHERIGHT(METHOD,OPNAME)
+
+
+#if (defined(_CPPUNWIND) || defined(__EXCEPTIONS)) && !defined(EIGEN_CUDA_ARCH) && !defined(EIGEN_EXCEPTIONS) && !defined(EIGEN_USE_SYCL) && !defined(EIGEN_HIP_DEVICE_COMPILE)
+  #define EIGEN_EXCEPTIONS
+#endif
+
+
+#ifdef EIGEN_EXCEPTIONS
+#  define EIGEN_THROW_X(X) throw X
+#  define EIGEN_THROW throw
+#  define EIGEN_TRY try
+#  define EIGEN_CATCH(X) catch (X)
+#else
+#  if defined(EIGEN_CUDA_ARCH)
+#    define EIGEN_THROW_X(X) asm("trap;")
+#    define EIGEN_THROW asm("trap;")
+#  elif defined(EIGEN_HIP_DEVICE_COMPILE)
+#    define EIGEN_THROW_X(X) asm("s_trap 0")
+#    define EIGEN_THROW asm("s_trap 0")
+#  else
+#    define EIGEN_THROW_X(X) std::abort()
+#    define EIGEN_THROW std::abort()
+#  endif
+#  define EIGEN_TRY if (true)
+#  define EIGEN_CATCH(X) else
+#endif
+
+
+#if EIGEN_HAS_CXX11_NOEXCEPT
+#   define EIGEN_INCLUDE_TYPE_TRAITS
+#   define EIGEN_NOEXCEPT noexcept
+#   define EIGEN_NOEXCEPT_IF(x) noexcept(x)
+#   define EIGEN_NO_THROW noexcept(true)
+#   define EIGEN_EXCEPTION_SPEC(X) noexcept(false)
+#else
+#   define EIGEN_NOEXCEPT
+#   define EIGEN_NOEXCEPT_IF(x)
+#   define EIGEN_NO_THROW throw()
+#   if EIGEN_COMP_MSVC || EIGEN_COMP_CXXVER>=17
+      // MSVC does not support exception specifications (warning C4290),
+      // and they are deprecated in c++11 anyway. This is even an error in c++17.
+#     define EIGEN_EXCEPTION_SPEC(X) throw()
+#   else
+#     define EIGEN_EXCEPTION_SPEC(X) throw(X)
+#   endif
+#endif
+
+#if EIGEN_HAS_VARIADIC_TEMPLATES
+// The all function is used to enable a variadic version of eigen_assert which can take a parameter pack as its input.
+namespace Eigen {
+namespace internal {
+
+inline bool all(){ return true; }
+
+template<typename T, typename ...Ts>
+bool all(T t, Ts ... ts){ return t && all(ts...); }
+
+}
+}
+#endif
+
+#if EIGEN_HAS_CXX11_OVERRIDE_FINAL
+// provide override and final specifiers if they are available:
+#   define EIGEN_OVERRIDE override
+#   define EIGEN_FINAL final
+#else
+#   define EIGEN_OVERRIDE
+#   define EIGEN_FINAL
+#endif
+
+// Wrapping #pragma unroll in a macro since it is required for SYCL
+#if defined(SYCL_DEVICE_ONLY)
+  #if defined(_MSC_VER)
+    #define EIGEN_UNROLL_LOOP __pragma(unroll)
+  #else
+    #define EIGEN_UNROLL_LOOP _Pragma("unroll")
+  #endif
+#else
+  #define EIGEN_UNROLL_LOOP
+#endif
+
+#endif // EIGEN_MACROS_H
+)VAR");
+	print(false, "", "_eigen3_world_version_match", R"VAR(define EIGEN_WORLD_VERSION 3)VAR");
+	print(false, "", "_fixed", R"VAR(/usr/lib/x86_64-linux-gnu/libboost_system.so;/usr/lib/x86_64-linux-gnu/libboost_program_options.so;/usr/lib/x86_64-linux-gnu/libboost_regex.so;/usr/lib/x86_64-linux-gnu/libboost_unit_test_framework.so;/usr/lib/x86_64-linux-gnu/libboost_timer.so;/usr/lib/x86_64-linux-gnu/libboost_chrono.so)VAR");
+	print(false, "", "_isMultiConfig", R"VAR(0)VAR");
+	print(false, "", "_l", R"VAR()VAR");
+	print(false, "", "_type", R"VAR(PATH)VAR");
+	print(false, "", "_uppercomp", R"VAR(CHRONO)VAR");
+	print(false, "", "_var", R"VAR(Boost_UNIT_TEST_FRAMEWORK_LIBRARY_RELEASE)VAR");
+	print(true, "PATH", "boost_chrono_DIR", R"VAR(/usr/lib/x86_64-linux-gnu/cmake/boost_chrono-1.74.0)VAR");
+	print(true, "PATH", "boost_headers_DIR", R"VAR(/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0)VAR");
+	print(true, "PATH", "boost_program_options_DIR", R"VAR(/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0)VAR");
+	print(true, "PATH", "boost_regex_DIR", R"VAR(/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0)VAR");
+	print(true, "PATH", "boost_system_DIR", R"VAR(/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0)VAR");
+	print(true, "PATH", "boost_timer_DIR", R"VAR(/usr/lib/x86_64-linux-gnu/cmake/boost_timer-1.74.0)VAR");
+	print(true, "PATH", "boost_unit_test_framework_DIR", R"VAR(/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0)VAR");
+	print(false, "", "c", R"VAR()VAR");
+	print(false, "STATIC", "carl-shared_LIB_DEPENDS", R"VAR(general;GMPXX_SHARED;general;GMP_SHARED;general;dl;general;stdc++fs;general;pthread;)VAR");
+	print(false, "STATIC", "carl-static_LIB_DEPENDS", R"VAR(general;GMPXX_STATIC;general;GMP_STATIC;general;dl;general;stdc++fs;general;pthread;)VAR");
+	print(false, "STATIC", "carl_BINARY_DIR", R"VAR(/root/repo/_gate_build)VAR");
+	print(false, "", "carl_DESCRIPTION", R"VAR(Computer ARithmetic Library)VAR");
+	print(false, "", "carl_HOMEPAGE_URL", R"VAR()VAR");
+	print(false, "STATIC", "carl_IS_TOP_LEVEL", R"VAR(ON)VAR");
+	print(false, "", "carl_LIBRARIES_DYNAMIC", R"VAR(pthread;dl)VAR");
+	print(false, "", "carl_NAME", R"VAR(CArL)VAR");
+	print(false, "STATIC", "carl_SOURCE_DIR", R"VAR(/root/repo)VAR");
+	print(false, "", "compiler", R"VAR()VAR");
+	print(false, "", "component", R"VAR()VAR");
+	print(false, "", "dep", R"VAR()VAR");
+	print(false, "", "lang", R"VAR()VAR");
+	print(false, "", "p", R"VAR()VAR");
+	print(false, "", "type", R"VAR()VAR");
+	print(false, "", "v", R"VAR()VAR");
+	print(false, "", "var", R"VAR(CMAKE_INSTALL_DIR)VAR");
+	print(false, "", "version", R"VAR()VAR");
+
+	return os;
+}
+
+}
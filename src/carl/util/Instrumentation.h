@@ -0,0 +1,383 @@
+/**
+ * @file Instrumentation.h
+ *
+ * Low-overhead performance counters and scoped timers.
+ *
+ * Probes are identified by hierarchical names like "carl.core.gcd" and are interned once per call site. Every thread
+ * accumulates into its own counters, hence recording a value never synchronizes with other threads. The values of
+ * all threads are only summed up when the Registry is asked for them, for example to export them as JSON or, if
+ * tracing is enabled, as a Chrome trace (chrome://tracing or https://ui.perfetto.dev).
+ * When a thread exits, its values are moved to the Registry and its counters are reused by the next new thread.
+ *
+ * The macros CARL_COUNT, CARL_COUNT_ADD and CARL_TIME_SCOPE expand to nothing unless TIMING is defined.
+ */
+
+#pragma once
+
+#include "Singleton.h"
+#include "../config.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace carl {
+namespace instrumentation {
+
+/// The clock used for all timers.
+using clock = std::chrono::steady_clock;
+
+/// Maximal number of distinct probe names.
+constexpr std::size_t maxProbes = 1024;
+/// The probe that all names share once maxProbes is reached.
+constexpr const char* overflowProbe = "carl.instrumentation.overflow";
+
+/// A single timed region as recorded for the Chrome trace, times are in nanoseconds since the registry was created.
+struct TraceEvent {
+	std::size_t probe;
+	std::int64_t begin;
+	std::int64_t duration;
+};
+
+/**
+ * The values recorded by a single thread.
+ * Only the owning thread writes, but the registry may read concurrently. The values are therefore relaxed atomics that
+ * are updated by a plain load and store instead of a locked read-modify-write.
+ */
+struct ThreadData {
+	std::size_t thread;
+	std::array<std::atomic<std::uint64_t>, maxProbes> counts{};
+	std::array<std::atomic<std::uint64_t>, maxProbes> nanoseconds{};
+	std::mutex traceMutex;
+	std::vector<TraceEvent> trace;
+
+	explicit ThreadData(std::size_t id): thread(id) {}
+
+	static void add(std::atomic<std::uint64_t>& value, std::uint64_t n) {
+		value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+	}
+};
+
+/// The aggregated values of a single probe.
+struct Entry {
+	std::string name;
+	/// Number of events or number of times a timed region was left.
+	std::uint64_t count = 0;
+	/// Overall time spent in a timed region, zero for counters.
+	std::uint64_t nanoseconds = 0;
+};
+
+class Registry: public Singleton<Registry> {
+	friend Singleton<Registry>;
+private:
+	/// Registers the calling thread on first use and retires it when the thread exits.
+	struct ThreadHandle {
+		ThreadData* data;
+		ThreadHandle(): data(Registry::getInstance().registerThread()) {}
+		ThreadHandle(const ThreadHandle&) = delete;
+		ThreadHandle& operator=(const ThreadHandle&) = delete;
+		~ThreadHandle() {
+			Registry::getInstance().retireThread(data);
+		}
+	};
+	/// A recorded trace event together with the thread it was recorded by.
+	using ThreadTraceEvent = std::pair<std::size_t, TraceEvent>;
+
+	mutable std::mutex mMutex;
+	std::vector<std::string> mNames;
+	/// Data of all running threads that recorded a value.
+	std::vector<std::unique_ptr<ThreadData>> mThreads;
+	/// Data of exited threads, all values are zero and the trace is empty.
+	std::vector<std::unique_ptr<ThreadData>> mFree;
+	/// Number of threads registered so far, used as id for the trace.
+	std::size_t mNextThread = 0;
+	/// Values of exited threads.
+	std::array<std::uint64_t, maxProbes> mRetiredCounts{};
+	std::array<std::uint64_t, maxProbes> mRetiredNanoseconds{};
+	std::vector<ThreadTraceEvent> mRetiredTrace;
+	std::atomic<bool> mTracing = ATOMIC_VAR_INIT(false);
+	const clock::time_point mEpoch = clock::now();
+
+	Registry() = default;
+
+	ThreadData* registerThread() {
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mFree.empty()) {
+			mThreads.emplace_back(std::make_unique<ThreadData>(mNextThread));
+		} else {
+			mThreads.emplace_back(std::move(mFree.back()));
+			mFree.pop_back();
+			mThreads.back()->thread = mNextThread;
+		}
+		++mNextThread;
+		return mThreads.back().get();
+	}
+
+	/// Moves the values of an exiting thread to the retired values and keeps its data for the next thread.
+	void retireThread(ThreadData* data) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (std::size_t p = 0; p < maxProbes; ++p) {
+			mRetiredCounts[p] += data->counts[p].exchange(0, std::memory_order_relaxed);
+			mRetiredNanoseconds[p] += data->nanoseconds[p].exchange(0, std::memory_order_relaxed);
+		}
+		{
+			std::lock_guard<std::mutex> traceLock(data->traceMutex);
+			for (const auto& e: data->trace) mRetiredTrace.emplace_back(data->thread, e);
+			data->trace.clear();
+			data->trace.shrink_to_fit();
+		}
+		auto it = std::find_if(mThreads.begin(), mThreads.end(), [data](const auto& t){ return t.get() == data; });
+		assert(it != mThreads.end());
+		mFree.push_back(std::move(*it));
+		mThreads.erase(it);
+	}
+
+	ThreadData& local() {
+		thread_local ThreadHandle handle;
+		return *handle.data;
+	}
+
+	std::int64_t sinceEpoch(clock::time_point t) const {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(t - mEpoch).count();
+	}
+
+	static void writeString(std::ostream& os, const std::string& s) {
+		os << '"';
+		for (char c: s) {
+			if (c == '"' || c == '\\') os << '\\';
+			os << c;
+		}
+		os << '"';
+	}
+
+public:
+	/**
+	 * Returns the id of the probe with the given name, creating it if necessary.
+	 * Names are hierarchical, separated by dots.
+	 * The last id is reserved for overflowProbe, which is returned for all new names once the other ids are used up.
+	 */
+	std::size_t probe(const std::string& name) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		auto it = std::find(mNames.begin(), mNames.end(), name);
+		if (it != mNames.end()) return std::size_t(std::distance(mNames.begin(), it));
+		if (mNames.size() + 1 >= maxProbes) {
+			if (mNames.size() < maxProbes) mNames.emplace_back(overflowProbe);
+			return maxProbes - 1;
+		}
+		mNames.push_back(name);
+		return mNames.size() - 1;
+	}
+
+	/// Adds n to the counter of the given probe.
+	void count(std::size_t probe, std::uint64_t n = 1) {
+		ThreadData::add(local().counts[probe], n);
+	}
+
+	/// Records that a region of the given probe was executed from begin to end.
+	void time(std::size_t probe, clock::time_point begin, clock::time_point end) {
+		ThreadData& data = local();
+		auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+		ThreadData::add(data.counts[probe], 1);
+		ThreadData::add(data.nanoseconds[probe], std::uint64_t(nanos));
+		if (mTracing.load(std::memory_order_relaxed)) {
+			std::lock_guard<std::mutex> lock(data.traceMutex);
+			data.trace.push_back(TraceEvent{probe, sinceEpoch(begin), nanos});
+		}
+	}
+
+	/// Returns the number of thread data blocks, for running threads and for reuse by new threads.
+	std::size_t allocatedThreads() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mThreads.size() + mFree.size();
+	}
+
+	/// Enables or disables recording of individual timed regions for writeChromeTrace().
+	void tracing(bool enable) {
+		mTracing.store(enable);
+	}
+	bool tracing() const {
+		return mTracing.load();
+	}
+
+	/**
+	 * Sums up the values of all threads.
+	 * @return All probes that were hit at least once, sorted by name.
+	 */
+	std::vector<Entry> aggregate() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		std::vector<Entry> res;
+		for (std::size_t p = 0; p < mNames.size(); ++p) {
+			Entry e{mNames[p], mRetiredCounts[p], mRetiredNanoseconds[p]};
+			for (const auto& t: mThreads) {
+				e.count += t->counts[p].load(std::memory_order_relaxed);
+				e.nanoseconds += t->nanoseconds[p].load(std::memory_order_relaxed);
+			}
+			if (e.count > 0) res.push_back(std::move(e));
+		}
+		std::sort(res.begin(), res.end(), [](const Entry& a, const Entry& b){ return a.name < b.name; });
+		return res;
+	}
+
+	/// Returns the aggregated values of the given probe.
+	Entry get(const std::string& name) const {
+		for (auto& e: aggregate()) {
+			if (e.name == name) return e;
+		}
+		return Entry{name};
+	}
+
+	/**
+	 * Resets all values and drops the recorded trace.
+	 * Values recorded concurrently by other threads may survive the reset.
+	 */
+	void reset() {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mRetiredCounts.fill(0);
+		mRetiredNanoseconds.fill(0);
+		mRetiredTrace.clear();
+		for (const auto& t: mThreads) {
+			for (std::size_t p = 0; p < maxProbes; ++p) {
+				t->counts[p].store(0, std::memory_order_relaxed);
+				t->nanoseconds[p].store(0, std::memory_order_relaxed);
+			}
+			std::lock_guard<std::mutex> traceLock(t->traceMutex);
+			t->trace.clear();
+		}
+	}
+
+	/**
+	 * Writes the aggregated values as a JSON object that is nested along the dots in the probe names.
+	 * Every probe becomes an object with "count" and, for timers, "nanoseconds".
+	 */
+	void writeJSON(std::ostream& os) const {
+		struct Node {
+			const Entry* entry = nullptr;
+			std::map<std::string, Node> children;
+		};
+		auto entries = aggregate();
+		Node root;
+		for (const auto& e: entries) {
+			Node* cur = &root;
+			std::size_t begin = 0;
+			while (true) {
+				std::size_t end = e.name.find('.', begin);
+				cur = &cur->children[e.name.substr(begin, end - begin)];
+				if (end == std::string::npos) break;
+				begin = end + 1;
+			}
+			cur->entry = &e;
+		}
+		auto write = [&os](const Node& n, std::size_t indent, const auto& self) -> void {
+			os << "{";
+			bool first = true;
+			auto next = [&]() {
+				os << (first ? "\n" : ",\n") << std::string(indent + 1, '\t');
+				first = false;
+			};
+			if (n.entry != nullptr) {
+				next();
+				os << "\"count\": " << n.entry->count;
+				if (n.entry->nanoseconds > 0) {
+					next();
+					os << "\"nanoseconds\": " << n.entry->nanoseconds;
+				}
+			}
+			for (const auto& c: n.children) {
+				next();
+				writeString(os, c.first);
+				os << ": ";
+				self(c.second, indent + 1, self);
+			}
+			if (!first) os << "\n" << std::string(indent, '\t');
+			os << "}";
+		};
+		write(root, 0, write);
+		os << std::endl;
+	}
+
+	/**
+	 * Writes all timed regions recorded while tracing was enabled in the Chrome trace event format.
+	 */
+	void writeChromeTrace(std::ostream& os) const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		os << "{\"traceEvents\": [";
+		bool first = true;
+		auto flags = os.flags();
+		os << std::fixed << std::setprecision(3);
+		auto write = [&](std::size_t thread, const TraceEvent& e) {
+			os << (first ? "\n" : ",\n") << "{\"name\": ";
+			writeString(os, mNames[e.probe]);
+			os << ", \"cat\": \"carl\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << thread;
+			os << ", \"ts\": " << double(e.begin) / 1000 << ", \"dur\": " << double(e.duration) / 1000 << "}";
+			first = false;
+		};
+		for (const auto& e: mRetiredTrace) write(e.first, e.second);
+		for (const auto& t: mThreads) {
+			std::lock_guard<std::mutex> traceLock(t->traceMutex);
+			for (const auto& e: t->trace) write(t->thread, e);
+		}
+		os.flags(flags);
+		os << "\n]}" << std::endl;
+	}
+};
+
+/// Interns a probe name, meant to be a function-local static at the call site.
+class Probe {
+private:
+	std::size_t mId;
+public:
+	explicit Probe(const char* name): mId(Registry::getInstance().probe(name)) {}
+	std::size_t id() const {
+		return mId;
+	}
+};
+
+/// Records the time from construction to destruction.
+class ScopedTimer {
+private:
+	std::size_t mProbe;
+	clock::time_point mStart;
+public:
+	explicit ScopedTimer(const Probe& probe): mProbe(probe.id()), mStart(clock::now()) {}
+	ScopedTimer(const ScopedTimer&) = delete;
+	ScopedTimer& operator=(const ScopedTimer&) = delete;
+	~ScopedTimer() {
+		Registry::getInstance().time(mProbe, mStart, clock::now());
+	}
+};
+
+inline std::ostream& operator<<(std::ostream& os, const Registry& r) {
+	r.writeJSON(os);
+	return os;
+}
+
+}
+}
+
+#define __CARL_INSTRUMENTATION_CAT2(a, b) a ## b
+#define __CARL_INSTRUMENTATION_CAT(a, b) __CARL_INSTRUMENTATION_CAT2(a, b)
+
+#ifdef TIMING
+#define CARL_COUNT_ADD(name, n) do { \
+		static const ::carl::instrumentation::Probe __carl_probe(name); \
+		::carl::instrumentation::Registry::getInstance().count(__carl_probe.id(), n); \
+	} while (false)
+#define CARL_TIME_SCOPE(name) \
+	static const ::carl::instrumentation::Probe __CARL_INSTRUMENTATION_CAT(__carl_probe_, __LINE__)(name); \
+	::carl::instrumentation::ScopedTimer __CARL_INSTRUMENTATION_CAT(__carl_timer_, __LINE__)(__CARL_INSTRUMENTATION_CAT(__carl_probe_, __LINE__))
+#else
+#define CARL_COUNT_ADD(name, n)
+#define CARL_TIME_SCOPE(name)
+#endif
+#define CARL_COUNT(name) CARL_COUNT_ADD(name, 1)
@@ -0,0 +1,54 @@
+/**
+ * @file LineChunks.h
+ *
+ * Splits a text buffer into chunks of whole lines that are processed in parallel.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+using LineChunk = std::pair<const char*, const char*>;
+
+/**
+ * Splits [begin, end) into at most n chunks of roughly equal size. Every chunk but the last ends right after a newline,
+ * hence no line is split. Chunks are not smaller than minSize, except for the last one.
+ */
+inline std::vector<LineChunk> splitAtLines(const char* begin, const char* end, std::size_t n, std::size_t minSize) {
+	std::vector<LineChunk> res;
+	std::size_t size = std::size_t(end - begin);
+	n = std::max(std::size_t(1), std::min(n, size / std::max(minSize, std::size_t(1))));
+	const char* cur = begin;
+	for (std::size_t i = 1; i < n && cur != end; ++i) {
+		const char* target = begin + size * i / n;
+		if (target < cur) continue;
+		const char* newline = static_cast<const char*>(std::memchr(target, '\n', std::size_t(end - target)));
+		if (newline == nullptr) break;
+		res.emplace_back(cur, newline + 1);
+		cur = newline + 1;
+	}
+	res.emplace_back(cur, end);
+	return res;
+}
+
+/**
+ * Calls f(i, chunks[i]) for every chunk, every call in its own thread but the first, which is run by the caller.
+ */
+template<typename F>
+void forEachChunk(const std::vector<LineChunk>& chunks, F&& f) {
+	std::vector<std::thread> threads;
+	for (std::size_t i = 1; i < chunks.size(); ++i) {
+		threads.emplace_back([&f, &chunks, i]() { f(i, chunks[i]); });
+	}
+	if (!chunks.empty()) f(std::size_t(0), chunks[0]);
+	for (auto& t: threads) t.join();
+}
+
+}
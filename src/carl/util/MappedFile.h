@@ -0,0 +1,102 @@
+/**
+ * @file MappedFile.h
+ *
+ * Read-only access to the contents of a file as a contiguous buffer.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CARL_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace carl {
+
+/**
+ * The contents of a file, mapped into memory if the platform supports it and read into a string otherwise.
+ * Mapping lets the operating system read the file lazily and sequentially, hence parsers can process files that are
+ * larger than what is reasonable to copy, and the file is never copied into a user space buffer.
+ *
+ * The contents are not null-terminated. Throws std::runtime_error if the file can not be read.
+ */
+class MappedFile {
+private:
+	const char* mData = nullptr;
+	std::size_t mSize = 0;
+	/// Holds the contents if the file is not mapped.
+	std::string mBuffer;
+	bool mMapped = false;
+
+	void readFile(const std::string& filename) {
+		std::ifstream in(filename, std::ios::binary);
+		if (!in) throw std::runtime_error("Could not open " + filename);
+		mBuffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+		mData = mBuffer.data();
+		mSize = mBuffer.size();
+	}
+	void unmap() {
+#ifdef CARL_HAS_MMAP
+		if (mMapped) munmap(const_cast<char*>(mData), mSize);
+#endif
+		mMapped = false;
+		mData = nullptr;
+		mSize = 0;
+	}
+public:
+	explicit MappedFile(const std::string& filename) {
+#ifdef CARL_HAS_MMAP
+		int fd = open(filename.c_str(), O_RDONLY);
+		if (fd < 0) throw std::runtime_error("Could not open " + filename);
+		struct stat st;
+		if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			void* data = mmap(nullptr, std::size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data != MAP_FAILED) {
+				madvise(data, std::size_t(st.st_size), MADV_SEQUENTIAL);
+				mData = static_cast<const char*>(data);
+				mSize = std::size_t(st.st_size);
+				mMapped = true;
+			}
+		}
+		close(fd);
+		if (mMapped) return;
+#endif
+		// Empty files, pipes and platforms without mmap.
+		readFile(filename);
+	}
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	~MappedFile() {
+		unmap();
+	}
+
+	const char* data() const {
+		return mData;
+	}
+	std::size_t size() const {
+		return mSize;
+	}
+	const char* begin() const {
+		return mData;
+	}
+	const char* end() const {
+		return mData + mSize;
+	}
+	/**
+	 * @return If the file is mapped instead of being copied into memory.
+	 */
+	bool isMapped() const {
+		return mMapped;
+	}
+};
+
+}
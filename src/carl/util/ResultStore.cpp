@@ -0,0 +1,319 @@
+#include "ResultStore.h"
+
+#include "../core/logging.h"
+#include "../io/BinaryEncoding.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CARL_HAS_MMAP
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace carl {
+
+namespace {
+	/**
+	 * The file starts with the magic string, the version of the file format, the version of the binary encoding,
+	 * the generation and eight reserved bytes.
+	 */
+	constexpr char MAGIC[8] = {'C', 'A', 'R', 'L', 'S', 'T', 'O', 'R'};
+	constexpr std::size_t HEADER_SIZE = 32;
+	/**
+	 * Every entry starts with the size of its payload and a checksum of the payload.
+	 * The payload consists of the hash of the key, the size of the key, the key and the value.
+	 */
+	constexpr std::size_t ENTRY_HEADER_SIZE = 8;
+	constexpr std::size_t PAYLOAD_HEADER_SIZE = 12;
+
+	template<typename T>
+	T load(const char* data) {
+		T res;
+		std::memcpy(&res, data, sizeof(T));
+		return res;
+	}
+	template<typename T>
+	void append(std::string& s, T t) {
+		s.append(reinterpret_cast<const char*>(&t), sizeof(T));
+	}
+
+	std::uint64_t fnv1a(const char* data, std::size_t size) {
+		std::uint64_t res = 14695981039346656037ull;
+		for (std::size_t i = 0; i < size; ++i) {
+			res ^= std::uint8_t(data[i]);
+			res *= 1099511628211ull;
+		}
+		return res;
+	}
+	std::uint32_t checksum(const char* data, std::size_t size) {
+		return std::uint32_t(fnv1a(data, size));
+	}
+
+#ifdef CARL_HAS_MMAP
+	/// Holds a lock on a file for the lifetime of the object.
+	class FileLock {
+	private:
+		int mFile;
+		bool mLocked = false;
+	public:
+		FileLock(int file, bool exclusive): mFile(file) {
+			int res;
+			do {
+				res = flock(mFile, exclusive ? LOCK_EX : LOCK_SH);
+			} while (res != 0 && errno == EINTR);
+			mLocked = (res == 0);
+			if (!mLocked) CARL_LOG_WARN("carl.util.resultstore", "Could not lock the store: " << std::strerror(errno));
+		}
+		FileLock(const FileLock&) = delete;
+		FileLock& operator=(const FileLock&) = delete;
+		~FileLock() {
+			if (mLocked) flock(mFile, LOCK_UN);
+		}
+		bool locked() const {
+			return mLocked;
+		}
+	};
+
+	bool writeAll(int file, const std::string& data, std::size_t offset) {
+		std::size_t written = 0;
+		while (written < data.size()) {
+			ssize_t res = pwrite(file, data.data() + written, data.size() - written, off_t(offset + written));
+			if (res < 0 && errno == EINTR) continue;
+			if (res <= 0) return false;
+			written += std::size_t(res);
+		}
+		return true;
+	}
+#endif
+
+	std::atomic<ResultStore*> activeStore(nullptr);
+	std::unique_ptr<ResultStore> activeStoreOwner;
+}
+
+std::uint64_t ResultStore::hash(const std::string& data) {
+	return fnv1a(data.data(), data.size());
+}
+
+#ifdef CARL_HAS_MMAP
+
+ResultStore::ResultStore(const std::string& filename, std::size_t maxSize):
+	mFilename(filename), mMaxSize(std::max(maxSize, HEADER_SIZE))
+{
+	mFile = open(filename.c_str(), O_RDWR | O_CREAT, 0644);
+	if (mFile < 0) throw std::runtime_error("Could not open " + filename);
+	FileLock lock(mFile, true);
+	if (!refresh() && !(reset(mGeneration + 1) && refresh())) {
+		close(mFile);
+		throw std::runtime_error("Could not initialize the result store in " + filename);
+	}
+}
+
+ResultStore::~ResultStore() {
+	if (mData != nullptr) munmap(const_cast<char*>(mData), mMapped);
+	if (mFile >= 0) close(mFile);
+}
+
+bool ResultStore::remap(std::size_t size) {
+	if (mData != nullptr) munmap(const_cast<char*>(mData), mMapped);
+	mData = nullptr;
+	mMapped = 0;
+	if (size == 0) return true;
+	void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, mFile, 0);
+	if (data == MAP_FAILED) {
+		CARL_LOG_WARN("carl.util.resultstore", "Could not map " << mFilename << ": " << std::strerror(errno));
+		return false;
+	}
+	mData = static_cast<const char*>(data);
+	mMapped = size;
+	return true;
+}
+
+bool ResultStore::refresh() {
+	struct stat st;
+	if (fstat(mFile, &st) != 0) return false;
+	std::size_t size = std::size_t(st.st_size);
+	if (size != mMapped && !remap(size)) return false;
+	if (size < HEADER_SIZE) return false;
+	if (std::memcmp(mData, MAGIC, sizeof(MAGIC)) != 0) return false;
+	if (load<std::uint32_t>(mData + 8) != VERSION || load<std::uint32_t>(mData + 12) != serialization::VERSION) {
+		CARL_LOG_INFO("carl.util.resultstore", mFilename << " was written by an incompatible version.");
+		return false;
+	}
+	std::uint64_t generation = load<std::uint64_t>(mData + 16);
+	if (generation != mGeneration || mIndexed > size) {
+		mIndex.clear();
+		mIndexed = HEADER_SIZE;
+		mGeneration = generation;
+	}
+	indexEntries();
+	return true;
+}
+
+void ResultStore::indexEntries() {
+	while (mIndexed + ENTRY_HEADER_SIZE + PAYLOAD_HEADER_SIZE <= mMapped) {
+		const char* entry = mData + mIndexed;
+		std::size_t size = load<std::uint32_t>(entry);
+		if (size < PAYLOAD_HEADER_SIZE || size > mMapped - mIndexed - ENTRY_HEADER_SIZE) break;
+		const char* payload = entry + ENTRY_HEADER_SIZE;
+		if (load<std::uint32_t>(entry + 4) != checksum(payload, size)) break;
+		if (load<std::uint32_t>(payload + 8) > size - PAYLOAD_HEADER_SIZE) break;
+		mIndex.emplace(load<std::uint64_t>(payload), mIndexed);
+		mIndexed += ENTRY_HEADER_SIZE + size;
+	}
+}
+
+bool ResultStore::reset(std::uint64_t generation) {
+	std::string header(MAGIC, sizeof(MAGIC));
+	append(header, VERSION);
+	append(header, serialization::VERSION);
+	append(header, generation);
+	append(header, std::uint64_t(0));
+	assert(header.size() == HEADER_SIZE);
+	if (ftruncate(mFile, off_t(HEADER_SIZE)) != 0 || !writeAll(mFile, header, 0)) {
+		CARL_LOG_WARN("carl.util.resultstore", "Could not reset " << mFilename << ": " << std::strerror(errno));
+		return false;
+	}
+	return true;
+}
+
+bool ResultStore::compact(std::size_t size) {
+	std::vector<std::size_t> offsets;
+	for (const auto& entry: mIndex) offsets.push_back(entry.second);
+	std::sort(offsets.begin(), offsets.end());
+	// Keep the most recent entries, i.e. a suffix of the file.
+	std::size_t start = mIndexed;
+	for (auto it = offsets.rbegin(); it != offsets.rend() && mIndexed - *it <= size; ++it) {
+		start = *it;
+	}
+	std::string kept(mData + start, mIndexed - start);
+	CARL_LOG_DEBUG("carl.util.resultstore", "Compacting " << mFilename << " from " << mIndexed << " to " << HEADER_SIZE + kept.size() << " bytes.");
+	if (!reset(mGeneration + 1)) return false;
+	if (!writeAll(mFile, kept, HEADER_SIZE)) return false;
+	mStatistics.compactions++;
+	return refresh();
+}
+
+std::optional<std::string> ResultStore::find(std::uint64_t hash, const std::string& key) const {
+	auto range = mIndex.equal_range(hash);
+	for (auto it = range.first; it != range.second; ++it) {
+		const char* payload = mData + it->second + ENTRY_HEADER_SIZE;
+		std::size_t size = load<std::uint32_t>(mData + it->second);
+		std::size_t keySize = load<std::uint32_t>(payload + 8);
+		if (keySize != key.size() || std::memcmp(payload + PAYLOAD_HEADER_SIZE, key.data(), keySize) != 0) continue;
+		const char* value = payload + PAYLOAD_HEADER_SIZE + keySize;
+		return std::string(value, size - PAYLOAD_HEADER_SIZE - keySize);
+	}
+	return std::nullopt;
+}
+
+std::optional<std::string> ResultStore::lookup(const std::string& key) {
+	std::lock_guard<std::mutex> guard(mMutex);
+	mStatistics.lookups++;
+	FileLock lock(mFile, false);
+	if (!lock.locked() || !refresh()) return std::nullopt;
+	auto res = find(hash(key), key);
+	if (res) mStatistics.hits++;
+	return res;
+}
+
+void ResultStore::store(const std::string& key, const std::string& value) {
+	std::lock_guard<std::mutex> guard(mMutex);
+	std::size_t size = PAYLOAD_HEADER_SIZE + key.size() + value.size();
+	if (HEADER_SIZE + ENTRY_HEADER_SIZE + size > mMaxSize || size > std::numeric_limits<std::uint32_t>::max()) {
+		CARL_LOG_DEBUG("carl.util.resultstore", "Entry of " << size << " bytes exceeds the size limit.");
+		return;
+	}
+	FileLock lock(mFile, true);
+	if (!lock.locked()) return;
+	if (!refresh() && !(reset(mGeneration + 1) && refresh())) return;
+	std::uint64_t h = hash(key);
+	// Another process may have stored the same result in the meantime.
+	if (find(h, key)) return;
+	if (mIndexed + ENTRY_HEADER_SIZE + size > mMaxSize) {
+		if (!compact(mMaxSize / 2) || mIndexed + ENTRY_HEADER_SIZE + size > mMaxSize) {
+			if (!(reset(mGeneration + 1) && refresh())) return;
+		}
+	}
+	std::string payload;
+	payload.reserve(size);
+	append(payload, h);
+	append(payload, std::uint32_t(key.size()));
+	payload += key;
+	payload += value;
+	std::string entry;
+	entry.reserve(ENTRY_HEADER_SIZE + size);
+	append(entry, std::uint32_t(size));
+	append(entry, checksum(payload.data(), payload.size()));
+	entry += payload;
+	// Drop a partially written entry, e.g. of a process that crashed.
+	if (mMapped > mIndexed && ftruncate(mFile, off_t(mIndexed)) != 0) return;
+	if (!writeAll(mFile, entry, mIndexed)) {
+		CARL_LOG_WARN("carl.util.resultstore", "Could not write to " << mFilename << ": " << std::strerror(errno));
+		return;
+	}
+	mStatistics.stores++;
+	refresh();
+}
+
+void ResultStore::clear() {
+	std::lock_guard<std::mutex> guard(mMutex);
+	FileLock lock(mFile, true);
+	if (lock.locked() && reset(mGeneration + 1)) refresh();
+}
+
+std::size_t ResultStore::bytes() const {
+	std::lock_guard<std::mutex> guard(mMutex);
+	return mIndexed;
+}
+
+#else
+
+ResultStore::ResultStore(const std::string& filename, std::size_t maxSize):
+	mFilename(filename), mMaxSize(maxSize)
+{
+	throw std::runtime_error("The result store is not supported on this platform.");
+}
+ResultStore::~ResultStore() = default;
+bool ResultStore::remap(std::size_t) { return false; }
+bool ResultStore::refresh() { return false; }
+void ResultStore::indexEntries() {}
+bool ResultStore::reset(std::uint64_t) { return false; }
+bool ResultStore::compact(std::size_t) { return false; }
+std::optional<std::string> ResultStore::find(std::uint64_t, const std::string&) const { return std::nullopt; }
+std::optional<std::string> ResultStore::lookup(const std::string&) { return std::nullopt; }
+void ResultStore::store(const std::string&, const std::string&) {}
+void ResultStore::clear() {}
+std::size_t ResultStore::bytes() const { return 0; }
+
+#endif
+
+std::size_t ResultStore::size() const {
+	std::lock_guard<std::mutex> guard(mMutex);
+	return mIndex.size();
+}
+
+ResultStore::Statistics ResultStore::statistics() const {
+	std::lock_guard<std::mutex> guard(mMutex);
+	return mStatistics;
+}
+
+ResultStore* ResultStore::active() {
+	return activeStore.load(std::memory_order_acquire);
+}
+
+void ResultStore::activate(std::unique_ptr<ResultStore> store) {
+	activeStore.store(store.get(), std::memory_order_release);
+	activeStoreOwner = std::move(store);
+}
+
+}
@@ -0,0 +1,116 @@
+/**
+ * @file ResultStore.h
+ *
+ * A persistent store for results of expensive computations that is shared across runs and processes.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace carl {
+
+/**
+ * Maps binary keys to binary values in a file that is memory mapped for lookups.
+ *
+ * Entries are appended to the file and never modified. Each entry carries a checksum, such that a partially written
+ * entry, e.g. from a crashed process, is ignored and overwritten by the next one. The file starts with a header that
+ * holds the format version and the version of the binary encoding, a file with other versions is reset when it is
+ * opened.
+ *
+ * If an entry would make the file larger than the size limit, the file is compacted to the most recent entries that
+ * fill half of the limit. Compaction increments the generation in the header, which tells other processes to rebuild
+ * their index.
+ *
+ * Multiple processes may use the same file concurrently: lookups hold a shared lock and modifications an exclusive
+ * lock on the file. Within a process, all operations are serialized.
+ *
+ * Errors while reading or writing the file are logged and treated as cache misses, hence a broken store never makes
+ * a computation fail. Only the constructor throws, if the file can not be opened or mapped.
+ */
+class ResultStore {
+public:
+	/// Version of the file format.
+	static constexpr std::uint32_t VERSION = 1;
+	static constexpr std::size_t DEFAULT_MAX_SIZE = 256 * 1024 * 1024;
+
+	struct Statistics {
+		std::size_t lookups = 0;
+		std::size_t hits = 0;
+		std::size_t stores = 0;
+		std::size_t compactions = 0;
+	};
+private:
+	std::string mFilename;
+	std::size_t mMaxSize;
+	int mFile = -1;
+	const char* mData = nullptr;
+	std::size_t mMapped = 0;
+	/// The generation of the file the index was built for.
+	std::uint64_t mGeneration = 0;
+	/// End of the last valid entry that was indexed.
+	std::size_t mIndexed = 0;
+	/// Offsets of the entries by the hash of their keys.
+	std::unordered_multimap<std::uint64_t, std::size_t> mIndex;
+	Statistics mStatistics;
+	mutable std::mutex mMutex;
+
+	/// Maps the current contents of the file.
+	bool remap(std::size_t size);
+	/// Brings the index up to date with the file, assumes that the file is locked.
+	bool refresh();
+	/// Indexes all valid entries from mIndexed on.
+	void indexEntries();
+	/// Writes a fresh header, dropping all entries. Assumes that the file is locked exclusively.
+	bool reset(std::uint64_t generation);
+	/// Keeps only the most recent entries that fill at most the given size. Assumes that the file is locked exclusively.
+	bool compact(std::size_t size);
+	std::optional<std::string> find(std::uint64_t hash, const std::string& key) const;
+public:
+	/**
+	 * Opens or creates the store in the given file.
+	 * Throws std::runtime_error if the file can not be used.
+	 */
+	explicit ResultStore(const std::string& filename, std::size_t maxSize = DEFAULT_MAX_SIZE);
+	ResultStore(const ResultStore&) = delete;
+	ResultStore& operator=(const ResultStore&) = delete;
+	~ResultStore();
+
+	/// Returns the value stored for key, if any.
+	std::optional<std::string> lookup(const std::string& key);
+	/// Stores value for key, unless some value for key is already stored.
+	void store(const std::string& key, const std::string& value);
+	/// Removes all entries.
+	void clear();
+
+	/// The number of entries known to this process.
+	std::size_t size() const;
+	/// The size of the file in bytes.
+	std::size_t bytes() const;
+	const std::string& filename() const {
+		return mFilename;
+	}
+	Statistics statistics() const;
+
+	/// The 64 bit FNV-1a hash, which is used to address the entries.
+	static std::uint64_t hash(const std::string& data);
+
+	/**
+	 * Returns the store that is consulted by computations like resultant() and factorization(), or nullptr if there is
+	 * none, which is the default.
+	 */
+	static ResultStore* active();
+	/**
+	 * Makes the given store the active one, or disables the lookups if store is nullptr.
+	 * Should be called before any computations are done concurrently.
+	 */
+	static void activate(std::unique_ptr<ResultStore> store);
+};
+
+}
@@ -0,0 +1,76 @@
+/**
+ * @file StoredResult.h
+ *
+ * Consults the active ResultStore before running expensive computations.
+ */
+
+#pragma once
+
+#include "../core/logging.h"
+#include "../core/Variable.h"
+#include "../io/BinaryEncoding.h"
+#include "ResultStore.h"
+
+#include <set>
+#include <stdexcept>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace carl {
+
+namespace stored_result_detail {
+	template<typename T>
+	auto gatherVariables(const T& t, std::set<Variable>& vars, int) -> decltype(t.gatherVariables(), void()) {
+		auto tmp = t.gatherVariables();
+		vars.insert(tmp.begin(), tmp.end());
+	}
+	template<typename T>
+	void gatherVariables(const T&, std::set<Variable>&, long) {}
+}
+
+/**
+ * Returns the result of compute(), which must only depend on the given arguments.
+ *
+ * If a ResultStore is active and the arguments and the result can be encoded, the result is looked up in the store
+ * first and stored after computing it. Entries are addressed by the operation and the encoded arguments. Variables are
+ * encoded by their position among all variables of the arguments, hence a result is reused for all arguments that
+ * only differ by an order preserving renaming of their variables.
+ */
+template<typename Result, typename F, typename... Args>
+Result storedResult(const char* operation, F&& compute, const Args&... args) {
+	if constexpr (!(serialization::is_encodable<Result> && ... && serialization::is_encodable<Args>)) {
+		return compute();
+	} else {
+		ResultStore* store = ResultStore::active();
+		if (store == nullptr) return compute();
+		std::set<Variable> vars;
+		(stored_result_detail::gatherVariables(args, vars, 0), ...);
+		std::vector<Variable> table(vars.begin(), vars.end());
+		serialization::Encoder key(table);
+		key.bytes(operation);
+		key.bytes(typeid(Result).name());
+		(key << ... << args);
+		if (auto value = store->lookup(key.data())) {
+			try {
+				serialization::Decoder decoder(*value, table);
+				Result res = decoder.template read<Result>();
+				if (decoder.atEnd()) return res;
+				CARL_LOG_WARN("carl.util.resultstore", "Ignoring malformed entry for " << operation);
+			} catch (const serialization::DecodingError& e) {
+				CARL_LOG_WARN("carl.util.resultstore", "Ignoring malformed entry for " << operation << ": " << e.what());
+			}
+		}
+		Result res = compute();
+		try {
+			serialization::Encoder value(table);
+			value << res;
+			store->store(key.data(), value.data());
+		} catch (const std::invalid_argument&) {
+			CARL_LOG_DEBUG("carl.util.resultstore", "Result of " << operation << " contains new variables and is not stored.");
+		}
+		return res;
+	}
+}
+
+}
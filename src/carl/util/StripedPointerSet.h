@@ -0,0 +1,137 @@
+/**
+ * @file StripedPointerSet.h
+ *
+ * A hash set of pointers that is split into independently locked stripes.
+ */
+
+#pragma once
+
+#include "Common.h"
+#include "../config.h"
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace carl {
+
+/**
+ * A FastPointerSet that is split into a fixed number of stripes, each with its own mutex.
+ * An element is stored in the stripe determined by the hash of the pointed-to object, hence operations on elements
+ * with different hashes usually do not contend.
+ *
+ * The set does not lock by itself: callers obtain the lock of an element with lock() and keep it as long as the
+ * operation on the element, e.g. an insert-or-find followed by initializing the inserted element, must be atomic.
+ * Locking is only done if carl is built with THREAD_SAFE, otherwise lock() returns an empty lock.
+ * The stripe mutexes are recursive, such that the lock of an element can be acquired again while it is held.
+ * Callers must not hold the locks of two stripes at the same time unless this is serialized by some other mutex.
+ */
+template<typename T, std::size_t Stripes = 64>
+class StripedPointerSet {
+	static_assert((Stripes & (Stripes - 1)) == 0, "The number of stripes must be a power of two.");
+public:
+	using Lock = std::unique_lock<std::recursive_mutex>;
+private:
+	struct Stripe {
+		mutable std::recursive_mutex mutex;
+		FastPointerSet<T> set;
+	};
+	std::array<Stripe, Stripes> mStripes;
+
+	std::size_t stripe(const T* t) const {
+		// The stripes use the upper bits of the hash, the buckets within a stripe mostly use the lower bits.
+		std::uint64_t h = std::uint64_t(pointerHash<T>()(t)) * 0x9E3779B97F4A7C15ull;
+		return std::size_t(h >> 40) & (Stripes - 1);
+	}
+	Lock lockStripe(const Stripe& s) const {
+#ifdef THREAD_SAFE
+		return Lock(s.mutex);
+#else
+		(void)s;
+		return Lock();
+#endif
+	}
+public:
+	StripedPointerSet() = default;
+	StripedPointerSet(const StripedPointerSet&) = delete;
+	StripedPointerSet& operator=(const StripedPointerSet&) = delete;
+
+	/**
+	 * @return The lock of the stripe that stores elements equal to t.
+	 */
+	Lock lock(const T* t) const {
+		return lockStripe(mStripes[stripe(t)]);
+	}
+
+	/**
+	 * Inserts t, if no equal element is stored yet.
+	 * The caller must hold lock(t).
+	 * @return The stored element and whether it is t, i.e. t was inserted.
+	 */
+	std::pair<const T*, bool> insert(const T* t) {
+		auto res = mStripes[stripe(t)].set.insert(t);
+		return std::make_pair(*res.first, res.second);
+	}
+
+	/**
+	 * @return The stored element that equals t, or nullptr. The caller must hold lock(t).
+	 */
+	const T* find(const T* t) const {
+		const auto& set = mStripes[stripe(t)].set;
+		auto it = set.find(t);
+		return it == set.end() ? nullptr : *it;
+	}
+
+	/**
+	 * Removes the element that equals t. The caller must hold lock(t).
+	 * @return The number of removed elements.
+	 */
+	std::size_t erase(const T* t) {
+		return mStripes[stripe(t)].set.erase(t);
+	}
+
+	/**
+	 * @return The number of elements. The stripes are locked one after another, hence this is not a snapshot if other
+	 * threads modify the set concurrently.
+	 */
+	std::size_t size() const {
+		std::size_t res = 0;
+		for (const auto& s: mStripes) {
+			Lock l = lockStripe(s);
+			res += s.set.size();
+		}
+		return res;
+	}
+
+	/**
+	 * Reserves space for the given number of elements, assuming they are evenly spread.
+	 */
+	void reserve(std::size_t capacity) {
+		for (auto& s: mStripes) {
+			Lock l = lockStripe(s);
+			s.set.reserve(capacity / Stripes + 1);
+		}
+	}
+
+	void clear() {
+		for (auto& s: mStripes) {
+			Lock l = lockStripe(s);
+			s.set.clear();
+		}
+	}
+
+	/**
+	 * Calls f on all elements. Every stripe is locked while f is called on its elements, hence f must not insert or
+	 * erase elements.
+	 */
+	template<typename F>
+	void forEach(F&& f) const {
+		for (const auto& s: mStripes) {
+			Lock l = lockStripe(s);
+			for (const T* t: s.set) f(t);
+		}
+	}
+};
+
+}
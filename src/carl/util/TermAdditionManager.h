@@ -7,15 +7,18 @@
 
 #pragma once 
 
+#include <iterator>
 #include <list>
 #include <mutex>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
 #include "../config.h"
 #include "../core/Term.h"
 #include "../io/streamingOperators.h"
+#include "Instrumentation.h"
 #include "pointerOperations.h"
 
 namespace carl
@@ -74,6 +77,7 @@ public:
     #define SWAP_TERMS
 	
 	TAMId getId(std::size_t expectedSize = 0) {
+		CARL_COUNT("carl.core.tam.getId");
 		TAM_LOCK_GUARD
 		assert(mNextId != mData.end());
 		while (std::get<2>(*mNextId)) {
@@ -104,6 +108,7 @@ public:
 
     template<bool SizeUnknown, bool NewMonomials = true>
 	void addTerm(TAMId id, const TermPtr& term) {
+		CARL_COUNT("carl.core.tam.addTerm");
 		assert(!isZero(term));
         Tuple& data = *id;
 		assert(std::get<2>(data));
@@ -154,7 +159,12 @@ public:
 		else return terms[max];
 	}
     
-	void readTerms(TAMId id, Terms& terms) {
+	/**
+	 * Writes the terms of the given entry to terms.
+	 * If terms uses another allocator than the manager, the terms are moved instead of swapping the vectors.
+	 */
+	template<typename Container>
+	void readTerms(TAMId id, Container& terms) {
         Tuple& data = *id;
 		assert(std::get<2>(data));
 		Terms& t = std::get<1>(data);
@@ -178,7 +188,11 @@ public:
                 ++i;
             }
 		}
-		std::swap(t, terms);
+		if constexpr (std::is_same<Container, Terms>::value) {
+			std::swap(t, terms);
+		} else {
+			terms.assign(std::make_move_iterator(t.begin()), std::make_move_iterator(t.end()));
+		}
 		t.clear();
         #else
         terms.clear();
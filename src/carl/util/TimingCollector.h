@@ -1,47 +1,70 @@
 #pragma once
 
+#include "Instrumentation.h"
 #include "Singleton.h"
 #include "../config.h"
 
 #include <chrono>
 #include <iostream>
 #include <map>
+#include <mutex>
 
 namespace carl {
 
+/**
+ * Collects the overall time spent in named sections.
+ * Every section is also recorded as a timer in instrumentation::Registry, such that it shows up in its exports.
+ */
 class TimingCollector: public Singleton<TimingCollector> {
 public:
 	/// The clock type used here.
-	using clock = std::chrono::high_resolution_clock;
+	using clock = instrumentation::clock;
 	/// The duration type used here.
-	using duration = std::chrono::duration<std::size_t,std::milli>;
+	using duration = std::chrono::duration<std::size_t,std::nano>;
 	/// The type of a time point.
 	using time_point = clock::time_point;
 private:
 	struct TimingInformation {
 		std::size_t count = 0;
 		duration overall = duration::zero();
+		/// The id of the section in instrumentation::Registry.
+		std::size_t probe = 0;
 	};
 	std::map<std::string,TimingInformation> mData;
+	mutable std::mutex mMutex;
 public:
-	const auto& data() const {
+	/// Returns a copy of the collected data.
+	auto data() const {
+		std::lock_guard<std::mutex> lock(mMutex);
 		return mData;
 	}
 	time_point start() const {
 		return clock::now();
 	}
 	void finish(const std::string& name, clock::time_point start) {
-		auto diff = std::chrono::duration_cast<duration>(clock::now() - start);
-		auto& d = mData[name];
-		++d.count;
-		d.overall += diff;
+		auto end = clock::now();
+		auto diff = std::chrono::duration_cast<duration>(end - start);
+		auto& registry = instrumentation::Registry::getInstance();
+		std::size_t probe;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			auto it = mData.find(name);
+			if (it == mData.end()) {
+				// The probe is only looked up once per section.
+				it = mData.emplace(name, TimingInformation{0, duration::zero(), registry.probe(name)}).first;
+			}
+			++it->second.count;
+			it->second.overall += diff;
+			probe = it->second.probe;
+		}
+		registry.time(probe, start, end);
 	}
 };
 
 inline std::ostream& operator<<(std::ostream& os, const TimingCollector& tc) {
 	os << "Timings:" << std::endl;
 	for (const auto& d: tc.data()) {
-		os << "\t" << d.first << ": " << d.second.overall.count() << "ms (ran " << d.second.count << " times)" << std::endl;
+		os << "\t" << d.first << ": " << std::chrono::duration<double,std::milli>(d.second.overall).count() << "ms (ran " << d.second.count << " times)" << std::endl;
 	}
 	return os;
 }
@@ -4,6 +4,8 @@
 
 #include <boost/dynamic_bitset.hpp>
 
+#include <boost/version.hpp>
+#if BOOST_VERSION < 107100
 namespace std {
 
 template<typename Block, typename Allocator>
@@ -15,4 +17,5 @@ struct hash<boost::dynamic_bitset<Block,Allocator>> {
 	}
 };
 
-}
\ No newline at end of file
+}
+#endif
@@ -33,9 +33,6 @@ namespace boost { namespace spirit { namespace traits {
             r = acc / carl::pow(mpq_class(10), unsigned(-exp));
 		return true;
     }
-    template<> inline bool is_equal_to_one(const mpq_class& value) {
-        return value == 1;
-    }
     template<> inline mpq_class negate(bool neg, const mpq_class& n) {
         return neg ? mpq_class(-n) : n;
     }
@@ -61,9 +58,6 @@ namespace boost { namespace spirit { namespace traits {
         else
             n /= carl::pow(mpq_class(10), unsigned(-exp));
     }
-    template<> inline bool is_equal_to_one(const mpq_class& value) {
-        return value == 1;
-    }
     template<> inline mpq_class negate(bool neg, const mpq_class& n) {
         return neg ? mpq_class(-n) : n;
     }
@@ -0,0 +1,7 @@
+/**
+ * Auto generated file config.h from config.h.in.
+ */ 
+#pragma once
+
+/* #undef USE_GINAC */
+/* #undef COMPARE_WITH_Z3 */
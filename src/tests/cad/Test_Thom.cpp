@@ -6,9 +6,14 @@
 #include "carl/util/stringparser.h"
 
 #include "carl/thom/SignDetermination/SignDetermination.h"
+#include "carl/thom/TarskiQuery/TarskiQueryManager.h"
 #include "carl/thom/ThomRootFinder.h"
 #include "carl/thom/ThomEvaluation.h"
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+
 using namespace carl;
 
 TEST(Thom, SignDetermination) {
@@ -70,6 +75,91 @@ TEST(Thom, SignDetermination) {
 }
 
 
+TEST(Thom, SignDeterminationCache) {
+        typedef MultivariatePolynomial<Rational> MPolynomial;
+        Variable x = freshRealVariable("x");
+        Variable y = freshRealVariable("y");
+
+        MPolynomial circle = MPolynomial(x)*x + MPolynomial(y)*y - Rational(4);
+        MPolynomial line = MPolynomial(y) - MPolynomial(x);
+        std::vector<MPolynomial> zeroSet = {circle, line};
+        SignDetermination<Rational> sd(zeroSet.begin(), zeroSet.end());
+        EXPECT_EQ(2, sd.sizeOfZeroSet());
+
+        // the zero set consists of the points (sqrt(2), sqrt(2)) and (-sqrt(2), -sqrt(2))
+        EXPECT_EQ(2, sd.getSignsAndAdd(MPolynomial(x)).size());
+        EXPECT_EQ(2, sd.getSignsAndAdd(MPolynomial(y) - Rational(1)).size());
+        std::size_t misses = sd.cacheMisses();
+
+        // a copy shares the memoized tarski queries
+        SignDetermination<Rational> copy(sd);
+        auto signs = copy.getSigns(MPolynomial(x) + Rational(1));
+        EXPECT_EQ(2, signs.size());
+        EXPECT_LT(misses, sd.cacheMisses());
+        misses = sd.cacheMisses();
+        std::size_t hits = sd.cacheHits();
+        EXPECT_EQ(signs, sd.getSigns(MPolynomial(x) + Rational(1)));
+        EXPECT_EQ(misses, sd.cacheMisses());
+        EXPECT_LT(hits, sd.cacheHits());
+}
+
+TEST(Thom, IncrementalSignMatrix) {
+        typedef MultivariatePolynomial<Rational> MPolynomial;
+        Variable x = freshRealVariable("x");
+        std::mt19937 rng(17);
+        std::uniform_int_distribution<int> coeff(-3, 3);
+
+        for(int instance = 0; instance < 20; instance++) {
+                // a zero set of distinct integer roots
+                std::vector<int> roots(7);
+                std::iota(roots.begin(), roots.end(), -3);
+                std::shuffle(roots.begin(), roots.end(), rng);
+                roots.resize(std::size_t(2 + instance % 4));
+                MPolynomial z(Rational(1));
+                for(int r : roots) z *= MPolynomial(x) - Rational(r);
+                std::vector<MPolynomial> zeroSet = {z};
+                SignDetermination<Rational> sd(zeroSet.begin(), zeroSet.end());
+
+                for(int k = 0; k < 4; k++) {
+                        MPolynomial p(Rational(1 + k % 2));
+                        for(int d = 0; d <= 1 + k % 3; d++) p = p * MPolynomial(x) + Rational(coeff(rng));
+                        sd.getSignsAndAdd(p);
+                        // the matrix is updated lazily by the next query
+                        sd.getSigns(MPolynomial(x));
+                        ASSERT_FALSE(sd.needsUpdate());
+                        EXPECT_EQ(sd.recomputedMatrix(), sd.matrix()) << "instance " << instance << ", polynomial " << k;
+                }
+        }
+}
+
+TEST(Thom, CharPol) {
+        CoeffMatrix<Rational> m(3, 3);
+        m << 2, -1, 3,
+             Rational(1)/2, 0, 4,
+             7, -2, Rational(-5)/3;
+        EXPECT_EQ(charPol(m), charPolBerkowitz(m));
+
+        CoeffMatrix<Rational> id = CoeffMatrix<Rational>::Identity(4, 4);
+        std::vector<Rational> expected = {1, -4, 6, -4, 1};
+        EXPECT_EQ(expected, charPolBerkowitz(id));
+}
+
+TEST(Thom, MultivariateTarskiQuery) {
+        typedef MultivariatePolynomial<Rational> MPolynomial;
+        Variable x = freshRealVariable("x");
+        Variable y = freshRealVariable("y");
+
+        // the zero set consists of the four points (+-sqrt(2), +-sqrt(3))
+        std::vector<MPolynomial> zeroSet = {MPolynomial(x)*x - Rational(2), MPolynomial(y)*y - Rational(3)};
+        TarskiQueryManager<Rational> taq(zeroSet.begin(), zeroSet.end());
+        EXPECT_EQ(4, taq(MPolynomial(Rational(1))));
+        EXPECT_EQ(0, taq(MPolynomial(x)));
+        EXPECT_EQ(4, taq(MPolynomial(x) + Rational(2)));
+        EXPECT_EQ(-4, taq(MPolynomial(y) - Rational(2)));
+        EXPECT_EQ(2, taq(MPolynomial(x) + MPolynomial(y) + Rational(1)));
+        EXPECT_EQ(0, taq(MPolynomial(x)*y));
+}
+
 TEST(Thom, RootFinder) {
         typedef MultivariatePolynomial<Rational> Polynomial;
         typedef ThomEncoding<Rational> TE;
@@ -0,0 +1,125 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/CompiledPolynomial.h"
+#include "carl/core/MultivariateHorner.h"
+#include "carl/formula/model/ran/RealAlgebraicNumberEvaluation.h"
+#include "carl/interval/IntervalEvaluation.h"
+
+#include "../Common.h"
+
+#include <random>
+
+using namespace carl;
+
+namespace {
+	using Pol = MultivariatePolynomial<Rational>;
+
+	class CompiledPolynomialTest: public ::testing::Test {
+	protected:
+		Variable x = freshRealVariable("x");
+		Variable y = freshRealVariable("y");
+		Variable z = freshRealVariable("z");
+		Pol p = Rational(3)*x*x*y - Rational(1,2)*y*z*z*z + x*x*z + Rational(7)*y - Rational(5);
+	};
+}
+
+TEST_F(CompiledPolynomialTest, Structure)
+{
+	CompiledPolynomial<Pol> cp(p);
+	EXPECT_EQ(std::vector<Variable>({x, y, z}), cp.variables());
+	// x^2 is only computed once.
+	std::size_t pows = 0;
+	for (const auto& i: cp.program()) {
+		if (i.op == CompiledPolynomial<Pol>::OpCode::POW) pows++;
+	}
+	EXPECT_EQ(2u, pows);
+	EXPECT_EQ(p, cp.toPolynomial());
+
+	EXPECT_EQ(Pol(), CompiledPolynomial<Pol>(Pol()).toPolynomial());
+	EXPECT_EQ(Rational(4), CompiledPolynomial<Pol>(Pol(Rational(4))).evaluate(std::vector<Rational>()));
+	EXPECT_EQ(Pol(x), CompiledPolynomial<Pol>(Pol(x), {z, x}).toPolynomial());
+}
+
+TEST_F(CompiledPolynomialTest, Rational)
+{
+	CompiledPolynomial<Pol> cp(p, {z, y, x});
+	auto eval = cp.evaluator<Rational>();
+	std::mt19937 rand(4);
+	std::uniform_int_distribution<int> dist(-20, 20);
+	for (int i = 0; i < 50; ++i) {
+		Rational vx = Rational(dist(rand)) / 3;
+		Rational vy(dist(rand));
+		Rational vz = Rational(dist(rand)) / 7;
+		std::map<Variable, Rational> m = {{x, vx}, {y, vy}, {z, vz}};
+		EXPECT_EQ(p.evaluate(m), eval({vz, vy, vx}));
+	}
+}
+
+TEST_F(CompiledPolynomialTest, Double)
+{
+	CompiledPolynomial<Pol> cp(p);
+	auto eval = cp.evaluator<double>();
+	std::vector<double> points;
+	std::vector<double> expected;
+	for (int i = -10; i <= 10; ++i) {
+		Rational vx(i, 4);
+		Rational vy(i * i, 3);
+		Rational vz(-i, 5);
+		points.insert(points.end(), {toDouble(vx), toDouble(vy), toDouble(vz)});
+		expected.push_back(toDouble(p.evaluate(std::map<Variable, Rational>({{x, vx}, {y, vy}, {z, vz}}))));
+		EXPECT_NEAR(expected.back(), eval({toDouble(vx), toDouble(vy), toDouble(vz)}), 1e-9);
+	}
+	// More points than fit into a single block.
+	for (int r = 0; r < 5; ++r) {
+		points.insert(points.end(), points.begin(), points.end());
+		expected.insert(expected.end(), expected.begin(), expected.end());
+	}
+	std::vector<double> results;
+	eval(points, results);
+	ASSERT_EQ(expected.size(), results.size());
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		EXPECT_NEAR(expected[i], results[i], 1e-9);
+	}
+}
+
+TEST_F(CompiledPolynomialTest, Interval)
+{
+	CompiledPolynomial<Pol> cp(p);
+	auto eval = cp.evaluator<Interval<double>>();
+	std::vector<Interval<double>> point = {Interval<double>(-1, 2), Interval<double>(0, 1), Interval<double>(-3, -1)};
+	std::map<Variable, Interval<double>> map = {{x, point[0]}, {y, point[1]}, {z, point[2]}};
+	Interval<double> expected = IntervalEvaluation::evaluate(p, map);
+	EXPECT_EQ(expected, eval(point));
+
+	std::vector<Interval<double>> results;
+	eval({point[0], point[1], point[2], Interval<double>(1), Interval<double>(1), Interval<double>(1)}, results);
+	ASSERT_EQ(2u, results.size());
+	EXPECT_EQ(expected, results[0]);
+	EXPECT_EQ(Interval<double>(5.5), results[1]);
+}
+
+TEST_F(CompiledPolynomialTest, Horner)
+{
+	MultivariateHorner<Pol, strategy> h(p);
+	CompiledPolynomial<Pol> cp(h);
+	EXPECT_EQ(std::vector<Variable>({x, y, z}), cp.variables());
+	EXPECT_EQ(p, cp.toPolynomial());
+
+	std::vector<Interval<double>> point = {Interval<double>(-1, 2), Interval<double>(0, 1), Interval<double>(-3, -1)};
+	std::map<Variable, Interval<double>> map = {{x, point[0]}, {y, point[1]}, {z, point[2]}};
+	EXPECT_EQ(IntervalEvaluation::evaluate(h, map), cp.evaluate(point));
+}
+
+TEST_F(CompiledPolynomialTest, RealAlgebraicNumber)
+{
+	using RAN = RealAlgebraicNumber<Rational>;
+	CompiledPolynomial<Pol> cp(p);
+	RealAlgebraicPoint<Rational> numeric({RAN(Rational(1)), RAN(Rational(2)), RAN(Rational(-1))});
+	EXPECT_EQ(RAN(Rational(15)), RealAlgebraicNumberEvaluation::evaluate(cp, numeric));
+
+	// x = sqrt(2)
+	UnivariatePolynomial<Rational> sqr(x, {Rational(-2), Rational(0), Rational(1)});
+	RAN sqrt2(sqr, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	RealAlgebraicPoint<Rational> point({sqrt2, RAN(Rational(1)), RAN(Rational(1))});
+	EXPECT_EQ(RAN(Rational(19,2)), RealAlgebraicNumberEvaluation::evaluate(cp, point));
+}
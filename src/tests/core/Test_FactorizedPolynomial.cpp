@@ -653,3 +653,21 @@ TEST(FactorizedPolynomial, Derivation)
     FPol fp4( p3, pCache );
     EXPECT_EQ( fp4, derivation );
 }
+
+TEST(FactorizedPolynomial, CacheEviction)
+{
+    Variable x = freshRealVariable("x");
+    std::shared_ptr<CachePol> pCache( new CachePol( 64 ) );
+    FPol kept( Pol( x ) + Rational( -1 ), pCache );
+    for( int i = 0; i < 1000; ++i )
+    {
+        // Irreducible polynomials refer to themselves, which must not keep them in the cache.
+        FPol fp( Pol( x ) + Rational( i ), pCache );
+        FPol product = fp * kept;
+        EXPECT_EQ( computePolynomial( product ), ( Pol( x ) + Rational( i ) ) * ( Pol( x ) + Rational( -1 ) ) );
+    }
+    auto stats = pCache->statistics();
+    EXPECT_LE( stats.size, 64u );
+    EXPECT_GT( stats.evictions, 0u );
+    EXPECT_EQ( Pol( x ) + Rational( -1 ), computePolynomial( kept ) );
+}
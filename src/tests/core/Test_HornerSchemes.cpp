@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/HornerSchemes.h"
+#include "carl/interval/IntervalEvaluation.h"
+#include "carl/interval/set_theory.h"
+
+#include "../Common.h"
+
+#include <sstream>
+
+using namespace carl;
+
+namespace {
+	using Pol = MultivariatePolynomial<Rational>;
+
+	class HornerSchemesTest: public ::testing::Test {
+	protected:
+		Variable x = freshRealVariable("x");
+		Variable y = freshRealVariable("y");
+		Variable z = freshRealVariable("z");
+		std::vector<Pol> polys() const {
+			Pol s = Pol(x) + y + z + Rational(1);
+			return {
+				Rational(3)*x*x*y - Rational(Rational(1)/2)*y*z*z*z + x*x*z + Rational(7)*y - Rational(5),
+				s * s * s,
+				Pol(x)*x*x*x + Rational(2)*x*x + Rational(-1),
+				Pol(Rational(4)),
+				Pol(x)*y*z
+			};
+		}
+	};
+}
+
+TEST_F(HornerSchemesTest, Expansion)
+{
+	for (auto selection: {HornerVariableSelection::MOST_TERMS, HornerVariableSelection::OPERATION_COUNT}) {
+		HornerSchemes<Pol> schemes(selection);
+		for (const auto& p: polys()) {
+			auto id = schemes.add(p);
+			EXPECT_EQ(p, schemes.toPolynomial(id));
+			EXPECT_EQ(id, schemes.add(p));
+		}
+	}
+}
+
+TEST_F(HornerSchemesTest, Sharing)
+{
+	Pol common = Pol(y)*y + Rational(3)*y + Rational(1);
+	Pol p1 = Pol(x) * common;
+	Pol p2 = Pol(z) * common + Rational(2);
+	HornerSchemes<Pol> s1;
+	s1.add(p1);
+	HornerSchemes<Pol> s2;
+	s2.add(p2);
+	HornerSchemes<Pol> both;
+	auto id1 = both.add(p1);
+	auto id2 = both.add(p2);
+	EXPECT_LT(both.size(), s1.size() + s2.size());
+	EXPECT_EQ(both.node(id1).dependent, both.node(id2).dependent);
+	EXPECT_LT(both.operationCount({id1, id2}), both.operationCount({id1}) + both.operationCount({id2}));
+	std::stringstream ss;
+	both.print(ss, id1);
+	EXPECT_EQ("x * (y * (y + 3) + 1)", ss.str());
+}
+
+TEST_F(HornerSchemesTest, OperationCount)
+{
+	for (const auto& p: polys()) {
+		HornerSchemes<Pol> schemes;
+		auto id = schemes.add(p);
+		EXPECT_LE(schemes.operationCount({id}), arithmeticOperations(p)) << p;
+	}
+	Pol s = Pol(x) + y + z + Rational(1);
+	Pol cube = s * s * s;
+	HornerSchemes<Pol> schemes;
+	EXPECT_LT(schemes.operationCount({schemes.add(cube)}), arithmeticOperations(cube) * 2 / 3);
+}
+
+TEST_F(HornerSchemesTest, Evaluation)
+{
+	std::map<Variable, Interval<double>> map = {{x, Interval<double>(-1, 2)}, {y, Interval<double>(0.5, 1.5)}, {z, Interval<double>(-2, -1)}};
+	std::map<Variable, Interval<double>> point = {{x, Interval<double>(1.5)}, {y, Interval<double>(0.75)}, {z, Interval<double>(-1.25)}};
+	std::map<Variable, Rational> exact = {{x, Rational(3)/2}, {y, Rational(3)/4}, {z, Rational(-5)/4}};
+	HornerSchemes<Pol> schemes;
+	std::vector<HornerSchemes<Pol>::NodeID> roots;
+	auto ps = polys();
+	for (const auto& p: ps) roots.push_back(schemes.add(p));
+	auto res = schemes.evaluate(roots, map);
+	auto resPoint = schemes.evaluate(roots, IntervalBox<double>(point));
+	ASSERT_EQ(roots.size(), res.size());
+	for (std::size_t i = 0; i < roots.size(); ++i) {
+		const Pol& p = ps[i];
+		EXPECT_EQ(schemes.evaluate(roots[i], map), res[i]);
+		EXPECT_TRUE(set_is_subset(resPoint[i], res[i])) << p;
+		EXPECT_TRUE(resPoint[i].contains(carl::toDouble(p.evaluate(exact)))) << p;
+		MultivariateHorner<Pol, strategy> h(p);
+		// Both enclose the range, neither is necessarily tighter.
+		EXPECT_TRUE(set_have_intersection(res[i], IntervalEvaluation::evaluate(h, map))) << p;
+	}
+}
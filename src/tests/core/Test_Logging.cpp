@@ -5,7 +5,10 @@
 
 #include "../Common.h"
 
+#include <algorithm>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 TEST(Logging, LogLevelOutput)
 {
@@ -53,3 +56,75 @@ TEST(LoggingHelper, basename)
 {
 	EXPECT_EQ("abc.de", carl::basename("/foo/bar/abc.de"));
 }
+
+TEST(Logging, FilterLevel)
+{
+	carl::logging::Filter filter(carl::logging::LogLevel::LVL_WARN);
+	filter("carl.core", carl::logging::LogLevel::LVL_DEBUG);
+	EXPECT_EQ(carl::logging::LogLevel::LVL_WARN, filter.level("carl"));
+	EXPECT_EQ(carl::logging::LogLevel::LVL_DEBUG, filter.level("carl.core.monomial"));
+	EXPECT_TRUE(filter.check("carl.core", carl::logging::LogLevel::LVL_INFO));
+	EXPECT_FALSE(filter.check("carl.formula", carl::logging::LogLevel::LVL_INFO));
+}
+
+namespace {
+	void logDebug(int i) {
+		__CARL_LOG_DEBUG("carl.test.logging", "debug " << i);
+	}
+	void logInfo(int i) {
+		__CARL_LOG_INFO("carl.test.logging", "info " << i);
+	}
+	std::size_t lines(const std::string& s) {
+		return std::size_t(std::count(s.begin(), s.end(), '\n'));
+	}
+}
+
+TEST(Logging, LogSite)
+{
+	std::stringstream ss;
+	auto& logger = carl::logging::logger();
+	logger.configure("test_logsite", ss);
+	logger.filter("test_logsite")("", carl::logging::LogLevel::LVL_OFF)("carl.test", carl::logging::LogLevel::LVL_INFO);
+	logger.formatter("test_logsite")->printInformation = false;
+	logDebug(1);
+	logInfo(1);
+	EXPECT_EQ("info 1\n", ss.str());
+	// Changing the filter invalidates the cached levels.
+	logger.filter("test_logsite")("carl.test.logging", carl::logging::LogLevel::LVL_DEBUG);
+	logDebug(2);
+	EXPECT_EQ("info 1\ndebug 2\n", ss.str());
+	logger.filter("test_logsite")("carl.test.logging", carl::logging::LogLevel::LVL_WARN);
+	logDebug(3);
+	logInfo(3);
+	EXPECT_EQ("info 1\ndebug 2\n", ss.str());
+	logger.remove("test_logsite");
+	EXPECT_FALSE(logger.has("test_logsite"));
+	EXPECT_FALSE(logger.visible(carl::logging::LogLevel::LVL_FATAL, "carl.test.logging"));
+}
+
+TEST(Logging, Asynchronous)
+{
+	std::stringstream ss;
+	auto& logger = carl::logging::logger();
+	logger.configure("test_async", ss);
+	logger.filter("test_async")("", carl::logging::LogLevel::LVL_OFF)("carl.test", carl::logging::LogLevel::LVL_INFO);
+	logger.formatter("test_async")->printInformation = false;
+	logger.asynchronous(true);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([]() {
+			for (int i = 0; i < 1000; ++i) {
+				logDebug(i);
+				logInfo(i);
+			}
+		});
+	}
+	for (auto& t: threads) t.join();
+	logger.flush();
+	EXPECT_EQ(4000u, lines(ss.str()));
+	logInfo(-1);
+	logger.asynchronous(false);
+	EXPECT_EQ(4001u, lines(ss.str()));
+	EXPECT_EQ("info -1\n", ss.str().substr(ss.str().size() - 8));
+	logger.remove("test_async");
+}
@@ -0,0 +1,88 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/polynomialfunctions/GCD.h"
+#include "carl/core/polynomialfunctions/Resultant.h"
+#include "carl/core/VariablePool.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using StdPoly = MultivariatePolynomial<Rational>;
+using ArenaPoly = MultivariatePolynomial<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<NoReasons, ArenaAllocator>>;
+using CountingPoly = MultivariatePolynomial<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<NoReasons, CountingAllocator>>;
+
+namespace {
+	template<typename Poly>
+	std::pair<Poly,Poly> gcdInput(Variable x, Variable y) {
+		Poly c = Poly(x) * y + Rational(3);
+		Poly a = (Poly(x) * x - Poly(y)) * c;
+		Poly b = (Poly(y) * y * x + Rational(2)) * c;
+		return std::make_pair(a, b);
+	}
+}
+
+TEST(PolynomialAllocator, Counting)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	auto input = gcdInput<CountingPoly>(x, y);
+	allocation::Counter counter;
+	CountingPoly g = carl::gcd(input.first, input.second);
+	EXPECT_GT(counter.allocations(), 0);
+	EXPECT_GT(counter.bytes(), 0);
+	EXPECT_EQ(StdPoly(g), carl::gcd(StdPoly(input.first), StdPoly(input.second)));
+}
+
+TEST(PolynomialAllocator, Arena)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	auto input = gcdInput<ArenaPoly>(x, y);
+	EXPECT_EQ(nullptr, allocation::ComputationArena::active());
+	ArenaPoly g = allocation::inArena([&](){
+		EXPECT_NE(nullptr, allocation::ComputationArena::active());
+		return carl::gcd(input.first, input.second);
+	});
+	EXPECT_EQ(nullptr, allocation::ComputationArena::active());
+	EXPECT_EQ(nullptr, g.getTerms().get_allocator().arena());
+	EXPECT_EQ(StdPoly(g), carl::gcd(StdPoly(input.first), StdPoly(input.second)));
+}
+
+TEST(PolynomialAllocator, ArenaResultant)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	auto input = gcdInput<ArenaPoly>(x, y);
+	auto res = allocation::inArena([&](){
+		return carl::resultant(input.first.toUnivariatePolynomial(x), (input.second + Rational(1)).toUnivariatePolynomial(x));
+	});
+	auto expected = carl::resultant(StdPoly(input.first).toUnivariatePolynomial(x), StdPoly(input.second + Rational(1)).toUnivariatePolynomial(x));
+	ASSERT_EQ(expected.coefficients().size(), res.coefficients().size());
+	for (std::size_t i = 0; i < res.coefficients().size(); ++i) {
+		EXPECT_EQ(nullptr, res.coefficients()[i].getTerms().get_allocator().arena());
+		EXPECT_EQ(expected.coefficients()[i], StdPoly(res.coefficients()[i]));
+	}
+}
+
+TEST(PolynomialAllocator, NestedArenas)
+{
+	Variable x = freshRealVariable("x");
+	allocation::ComputationArena outer;
+	ArenaPoly p = ArenaPoly(x) + Rational(1);
+	EXPECT_EQ(&outer, p.getTerms().get_allocator().arena());
+	{
+		allocation::ComputationArena inner;
+		EXPECT_EQ(&inner, allocation::ComputationArena::active());
+		ArenaPoly q = p * p;
+		EXPECT_EQ(&inner, q.getTerms().get_allocator().arena());
+		// Assigning keeps the allocator of the target.
+		p = q;
+		EXPECT_EQ(&outer, p.getTerms().get_allocator().arena());
+		EXPECT_GT(inner.chunks(), 0);
+	}
+	EXPECT_EQ(&outer, allocation::ComputationArena::active());
+	EXPECT_EQ(3, p.nrTerms());
+	EXPECT_GT(outer.bytes(), 0);
+}
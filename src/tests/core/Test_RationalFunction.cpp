@@ -7,6 +7,8 @@
 
 #include "../Common.h"
 
+#include <thread>
+
 using namespace carl;
 
 typedef MultivariatePolynomial<Rational> Pol;
@@ -403,3 +405,97 @@ TEST(RationalFunction, AsNumber)
     Rational num = rf.nominatorAsNumber() / rf.denominatorAsNumber();
     EXPECT_EQ(num, 1);
 }
+
+TEST(RationalFunction, DeferredSimplification)
+{
+    using RF = RationalFunction<Pol,true>;
+    using RFF = RationalFunction<FPol,true>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    std::shared_ptr<CachePol> pCache( new CachePol );
+    // Every summand is (x+i)*y / ((x+i)*(x+1)) = y/(x+1).
+    auto sum = [&](bool defer, std::size_t threshold) {
+        RF::deferSimplification = defer;
+        RF::deferThreshold = threshold;
+        RF res(Rational(0));
+        for (int i = 1; i <= 5; ++i) {
+            res += RF(Pol(x) + Rational(i), Pol(1)) * RF(Pol(y), (Pol(x) + Rational(i)) * (Pol(x) + Rational(1)));
+        }
+        return res;
+    };
+    RF eager = sum(false, 64);
+    EXPECT_TRUE(eager.isSimplified());
+    RF deferred = sum(true, 64);
+    EXPECT_FALSE(deferred.isSimplified());
+    // Hashing, comparing and accessing the denominator simplify.
+    EXPECT_EQ(std::hash<RF>()(eager), std::hash<RF>()(deferred));
+    EXPECT_TRUE(deferred.isSimplified());
+    EXPECT_EQ(eager, deferred);
+    EXPECT_EQ(Pol(x) + Rational(1), deferred.denominator());
+    // A copy made before the simplification is simplified on its own.
+    RF copy = sum(true, 64);
+    RF inverse = copy.inverse();
+    EXPECT_EQ(eager.inverse(), inverse);
+    std::stringstream eagerString, copyString;
+    eagerString << eager;
+    copyString << copy;
+    EXPECT_EQ(eagerString.str(), copyString.str());
+    // Exceeding the threshold simplifies right away.
+    EXPECT_TRUE(sum(true, 0).isSimplified());
+
+    auto sumFactorized = [&](bool defer) {
+        RFF::deferSimplification = defer;
+        RFF res(Rational(0));
+        for (int i = 1; i <= 5; ++i) {
+            FPol factor(Pol(x) + Rational(i), pCache);
+            res += RFF(factor * FPol(Pol(y), pCache), factor * FPol(Pol(x) + Rational(1), pCache));
+        }
+        return res;
+    };
+    RFF eagerFactorized = sumFactorized(false);
+    RFF deferredFactorized = sumFactorized(true);
+    EXPECT_EQ(eagerFactorized, deferredFactorized);
+    EXPECT_EQ(Pol(x) + Rational(1), computePolynomial(deferredFactorized.denominator()));
+
+    RF::deferSimplification = false;
+    RF::deferThreshold = 64;
+    RFF::deferSimplification = false;
+}
+
+// Comparing polynomials concurrently requires THREAD_SAFE, which the CI build enables.
+#ifdef THREAD_SAFE
+TEST(RationalFunction, DeferredSharedObservation)
+{
+    using RF = RationalFunction<Pol,true>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    auto sum = [&]() {
+        RF res(Rational(0));
+        for (int i = 1; i <= 5; ++i) {
+            res += RF(Pol(x) + Rational(i), Pol(1)) * RF(Pol(y), (Pol(x) + Rational(i)) * (Pol(x) + Rational(1)));
+        }
+        return res;
+    };
+    RF eager = sum();
+    RF::deferSimplification = true;
+    for (int round = 0; round < 20; ++round) {
+        // Several threads observe, copy and use the same deferred rational function concurrently.
+        const RF shared = sum();
+        EXPECT_FALSE(shared.isSimplified());
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&shared, &eager]() {
+                RF copy = shared;
+                copy += shared;
+                EXPECT_EQ(eager.denominator(), shared.denominator());
+                EXPECT_EQ(eager + eager, copy);
+                EXPECT_EQ(eager, shared);
+            });
+        }
+        for (auto& t: threads) t.join();
+        EXPECT_TRUE(shared.isSimplified());
+        EXPECT_EQ(std::hash<RF>()(eager), std::hash<RF>()(shared));
+    }
+    RF::deferSimplification = false;
+}
+#endif
@@ -0,0 +1,118 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/RecursivePolynomial.h"
+#include "carl/core/polynomialfunctions/GCD.h"
+#include "carl/core/polynomialfunctions/Resultant.h"
+#include "carl/core/VariablePool.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+using RPoly = RecursivePolynomial<Rational>;
+
+namespace {
+	/// The variables are created such that x > y > z.
+	struct XYZ {
+		Variable z = freshRealVariable("z");
+		Variable y = freshRealVariable("y");
+		Variable x = freshRealVariable("x");
+	};
+
+	::testing::AssertionResult equalUpToConstant(const Poly& a, const Poly& b) {
+		if (a.isZero() && b.isZero()) return ::testing::AssertionSuccess();
+		if (a.isZero() || b.isZero() || a * b.lcoeff() != b * a.lcoeff()) {
+			return ::testing::AssertionFailure() << a << " and " << b << " differ by more than a constant";
+		}
+		return ::testing::AssertionSuccess();
+	}
+}
+
+TEST(RecursivePolynomial, Conversion)
+{
+	XYZ v;
+	Poly p = Poly(v.x) * v.x * v.y + Poly(v.x) * v.z - Poly(v.y) * v.z * v.z + Rational(3);
+	RPoly r(p);
+	EXPECT_EQ(v.x, r.mainVar());
+	EXPECT_EQ(2, r.degree());
+	EXPECT_EQ(RPoly(v.y), r.lcoeff());
+	EXPECT_EQ(Rational(1), r.numericLcoeff());
+	EXPECT_EQ(p, r.toMultivariatePolynomial<Poly>());
+	EXPECT_EQ(p.toUnivariatePolynomial(v.x), r.toUnivariatePolynomial<Poly>());
+	EXPECT_EQ(r, RPoly(p.toUnivariatePolynomial(v.x)));
+
+	RPoly c(Poly(v.z) * v.y + Rational(1));
+	EXPECT_EQ(v.y, c.mainVar());
+	EXPECT_TRUE(RPoly(Poly(Rational(2))).isNumber());
+	EXPECT_TRUE(RPoly(Poly()).isZero());
+}
+
+TEST(RecursivePolynomial, Arithmetic)
+{
+	XYZ v;
+	Poly p = Poly(v.x) * v.x * v.y - Poly(v.z) * v.y + Rational(2);
+	Poly q = Poly(v.x) * v.z + Poly(v.y) * v.y - Rational(1);
+	RPoly rp(p);
+	RPoly rq(q);
+	EXPECT_EQ(p + q, (rp + rq).toMultivariatePolynomial<Poly>());
+	EXPECT_EQ(p - q, (rp - rq).toMultivariatePolynomial<Poly>());
+	EXPECT_EQ(p * q, (rp * rq).toMultivariatePolynomial<Poly>());
+	EXPECT_EQ(p * Rational(-3), (rp * Rational(-3)).toMultivariatePolynomial<Poly>());
+	EXPECT_EQ(p * p * p, pow(rp, 3).toMultivariatePolynomial<Poly>());
+	EXPECT_TRUE((rp - rp).isZero());
+	// Cancelling the main variable yields a polynomial in a smaller variable.
+	RPoly diff = rp - RPoly(Poly(v.x) * v.x * v.y);
+	EXPECT_EQ(v.y, diff.mainVar());
+	EXPECT_EQ(p, divide(rp * rq, rq).toMultivariatePolynomial<Poly>());
+}
+
+TEST(RecursivePolynomial, Prem)
+{
+	XYZ v;
+	Poly p = Poly(v.x) * v.x * v.x * v.y + Poly(v.x) * v.z - Rational(1);
+	Poly q = Poly(v.x) * v.x * (Poly(v.y) + v.z) + Poly(v.y);
+	RPoly r = prem(RPoly(p), RPoly(q));
+	auto expected = p.toUnivariatePolynomial(v.x).prem(q.toUnivariatePolynomial(v.x));
+	EXPECT_TRUE(equalUpToConstant(Poly(expected), r.toMultivariatePolynomial<Poly>()));
+	EXPECT_LT(r.degree(v.x), 2);
+}
+
+TEST(RecursivePolynomial, GCD)
+{
+	XYZ v;
+	Poly c = Poly(v.x) * v.y + Poly(v.z) * Rational(2) + Rational(1);
+	Poly a = (Poly(v.x) * v.x - Poly(v.y)) * c * Rational(3);
+	Poly b = (Poly(v.y) * v.y * v.x + Poly(v.z)) * c;
+	Poly g = gcd(RPoly(a), RPoly(b)).toMultivariatePolynomial<Poly>();
+	EXPECT_TRUE(equalUpToConstant(c, g));
+	EXPECT_TRUE(equalUpToConstant(carl::gcd(a, b), g));
+
+	EXPECT_TRUE(gcd(RPoly(Poly(v.x) + v.y), RPoly(Poly(v.x) - v.y)).isNumber());
+	EXPECT_TRUE(equalUpToConstant(Poly(v.y), gcd(RPoly(Poly(v.x) * v.y), RPoly(Poly(v.y) * v.z)).toMultivariatePolynomial<Poly>()));
+	EXPECT_TRUE(equalUpToConstant(Poly(v.y) - v.z, content(RPoly((Poly(v.x) + Rational(1)) * (Poly(v.y) - v.z))).toMultivariatePolynomial<Poly>()));
+}
+
+TEST(RecursivePolynomial, Resultant)
+{
+	XYZ v;
+	std::vector<std::pair<Poly, Poly>> inputs = {
+		{ Poly(v.x) * v.x - Poly(v.y), Poly(v.x) * v.y - Rational(1) },
+		{ Poly(v.x) * v.x * v.x * v.z + Poly(v.x) * v.y - Rational(2), Poly(v.x) * v.x * v.y + Poly(v.z) * v.z },
+		{ (Poly(v.x) - v.y) * (Poly(v.x) + v.z), (Poly(v.x) - v.y) * Poly(v.x) },
+		{ Poly(v.x) * v.x * (Poly(v.y) + Rational(1)) + Poly(v.x) * v.z, Poly(v.x) * v.x * v.x - Poly(v.y) * v.z * Rational(3) + Rational(1) },
+	};
+	for (const auto& in: inputs) {
+		RPoly res = resultant(RPoly(in.first), RPoly(in.second));
+		auto expected = carl::resultant(in.first.toUnivariatePolynomial(v.x), in.second.toUnivariatePolynomial(v.x));
+		EXPECT_TRUE(equalUpToConstant(Poly(expected), res.toMultivariatePolynomial<Poly>())) << in.first << ", " << in.second;
+	}
+	// The resultant is exact, not only up to a constant.
+	RPoly res = resultant(RPoly(Poly(v.x) * v.x - Poly(v.y)), RPoly(Poly(v.x) * Rational(2) - Rational(1)));
+	EXPECT_EQ(Poly(Rational(1)) - Poly(v.y) * Rational(4), res.toMultivariatePolynomial<Poly>());
+	// A polynomial without the main variable has degree zero.
+	Poly c = Poly(v.y) * v.y * v.z - Rational(1);
+	res = resultant(RPoly(c), RPoly(Poly(v.x) * v.x + Poly(v.y)));
+	EXPECT_EQ(c * c, res.toMultivariatePolynomial<Poly>());
+}
@@ -0,0 +1,184 @@
+#include "gtest/gtest.h"
+
+#include <carl/formula/Formula.h>
+#include <carl/io/BinaryStream.h>
+#include <carl/util/MappedFile.h>
+
+#include "../Common.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+typedef Constraint<Pol> ConstraintT;
+typedef Formula<Pol> FormulaT;
+typedef serialization::BinaryWriter<Pol> Writer;
+typedef serialization::BinaryReader<Pol> Reader;
+
+namespace {
+	/// Reads all items of a stream.
+	std::vector<Reader::Item> items(Reader& reader) {
+		std::vector<Reader::Item> res;
+		while (auto item = reader.next()) res.push_back(*item);
+		return res;
+	}
+}
+
+TEST(BinaryStream, RoundTrip)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshIntegerVariable("y");
+	Variable b = freshBooleanVariable("b");
+	Pol p = Pol(x) * x - Pol(y) * Rational(3, 7) + Rational(mpz_class("123456789012345678901234567890"));
+	ConstraintT c1(p, Relation::LESS);
+	ConstraintT c2(Pol(x) - Pol(y), Relation::EQ);
+	FormulaT fc1(c1);
+	FormulaT fc2(c2);
+	FormulaT fb(b);
+	std::vector<FormulaT> formulas = {
+		FormulaT(FormulaType::TRUE),
+		FormulaT(FormulaType::FALSE),
+		fb,
+		FormulaT(FormulaType::AND, {fc1, FormulaT(FormulaType::NOT, fb)}),
+		FormulaT(FormulaType::OR, {fc1, fc2, fb}),
+		FormulaT(FormulaType::IMPLIES, fb, fc2),
+		FormulaT(FormulaType::ITE, fb, fc1, fc2),
+		FormulaT(FormulaType::XOR, {fc1, fb}),
+		FormulaT(FormulaType::IFF, {fc2, fb}),
+		FormulaT(FormulaType::EXISTS, std::vector<Variable>({x}), FormulaT(FormulaType::AND, {fc1, fc2}))
+	};
+
+	std::stringstream ss;
+	Writer writer(ss);
+	writer << p << Pol() << c1;
+	for (const auto& f: formulas) writer << f;
+
+	Reader reader(ss);
+	auto res = items(reader);
+	ASSERT_EQ(3 + formulas.size(), res.size());
+	EXPECT_EQ(p, std::get<Pol>(res[0]));
+	EXPECT_EQ(Pol(), std::get<Pol>(res[1]));
+	// Constraints and formulas are created through the pools and hence identical.
+	EXPECT_EQ(c1.id(), std::get<ConstraintT>(res[2]).id());
+	for (std::size_t i = 0; i < formulas.size(); ++i) {
+		EXPECT_EQ(formulas[i].getId(), std::get<FormulaT>(res[3 + i]).getId()) << formulas[i];
+	}
+	// Variables are identified by their names and numbered in the order of their first occurrence.
+	EXPECT_EQ(std::vector<Variable>({y, x, b}), reader.variables());
+}
+
+TEST(BinaryStream, Sharing)
+{
+	// The tree of the last formula has exponential size, but its DAG is linear.
+	FormulaT f(freshBooleanVariable("s"));
+	for (std::size_t i = 0; i < 40; ++i) {
+		Variable v = freshRealVariable("s" + std::to_string(i));
+		FormulaT atom(Pol(v) - Rational(i), Relation::GEQ);
+		f = FormulaT(FormulaType::OR, {FormulaT(FormulaType::AND, {atom, f}), FormulaT(FormulaType::AND, {FormulaT(FormulaType::NOT, atom), FormulaT(FormulaType::NOT, f)})});
+	}
+	std::stringstream ss;
+	Writer writer(ss);
+	writer << f;
+	std::size_t size = ss.str().size();
+	EXPECT_LT(size, 3000);
+	// Writing the formula again only adds a reference.
+	writer << f;
+	EXPECT_LT(ss.str().size(), size + 8);
+
+	Reader reader(ss);
+	auto res = items(reader);
+	ASSERT_EQ(2, res.size());
+	EXPECT_EQ(f, std::get<FormulaT>(res[0]));
+	EXPECT_EQ(f, std::get<FormulaT>(res[1]));
+}
+
+TEST(BinaryStream, MappedFile)
+{
+	std::string filename = (std::filesystem::temp_directory_path() / ("carl_binarystream_" + std::to_string(getpid()))).string();
+	Variable x = freshRealVariable("mx");
+	Variable y = freshRealVariable("my");
+	std::vector<FormulaT> formulas;
+	{
+		std::ofstream out(filename, std::ios::binary);
+		Writer writer(out);
+		for (int i = 0; i < 100; ++i) {
+			formulas.emplace_back(FormulaType::AND, FormulaT(Pol(x) * Rational(i) - Pol(y), Relation::LEQ), FormulaT(Pol(y) - Rational(Rational(i) / 3), Relation::NEQ));
+			writer << formulas.back();
+		}
+	}
+	{
+		MappedFile file(filename);
+		Reader reader(file);
+		auto res = items(reader);
+		ASSERT_EQ(formulas.size(), res.size());
+		for (std::size_t i = 0; i < formulas.size(); ++i) {
+			EXPECT_EQ(formulas[i], std::get<FormulaT>(res[i]));
+		}
+	}
+	std::remove(filename.c_str());
+}
+
+TEST(BinaryStream, VariableOrder)
+{
+	Variable x = freshRealVariable("order_wa");
+	Variable y = freshRealVariable("order_wb");
+	std::stringstream ss;
+	Writer writer(ss);
+	writer << Pol(x) * y * y + x;
+	std::string data = ss.str();
+	auto rename = [](std::string s, const std::string& from, const std::string& to) {
+		std::size_t pos = s.find(from);
+		EXPECT_NE(std::string::npos, pos);
+		return pos == std::string::npos ? s : s.replace(pos, from.size(), to);
+	};
+
+	// The reading context creates the variables in the opposite order.
+	Variable b = freshRealVariable("order_rb");
+	Variable a = freshRealVariable("order_ra");
+	ASSERT_LT(b, a);
+	std::string renamed = rename(rename(data, "order_wa", "order_ra"), "order_wb", "order_rb");
+	Reader reader(renamed.data(), renamed.data() + renamed.size());
+	auto res = items(reader);
+	ASSERT_EQ(1, res.size());
+	EXPECT_EQ(Pol(a) * b * b + a, std::get<Pol>(res[0]));
+
+	// Both variables of the monomial become the same one.
+	std::string merged = rename(rename(data, "order_wa", "order_rc"), "order_wb", "order_rc");
+	Reader mergedReader(merged.data(), merged.data() + merged.size());
+	EXPECT_THROW(items(mergedReader), serialization::DecodingError);
+}
+
+TEST(BinaryStream, MalformedData)
+{
+	Variable x = freshRealVariable("ex");
+	std::stringstream ss;
+	Writer writer(ss);
+	writer << FormulaT(Pol(x), Relation::GREATER);
+	std::string data = ss.str();
+
+	auto readAll = [](const std::string& s) {
+		Reader reader(s.data(), s.data() + s.size());
+		return items(reader).size();
+	};
+	EXPECT_EQ(1, readAll(data));
+	EXPECT_THROW(readAll("CARLSTOR"), serialization::DecodingError);
+	std::string version = data;
+	version[serialization::stream::MAGIC_SIZE] = char(serialization::VERSION + 1);
+	EXPECT_THROW(readAll(version), serialization::DecodingError);
+	// A stream that ends within a record is malformed, a stream that ends between records only lacks the later items.
+	std::string truncated = data.substr(0, data.size() - 1);
+	EXPECT_THROW(readAll(truncated), serialization::DecodingError);
+	std::stringstream in(truncated);
+	Reader reader(in);
+	EXPECT_THROW(items(reader), serialization::DecodingError);
+	for (std::size_t size = serialization::stream::MAGIC_SIZE + 1; size < data.size(); ++size) {
+		try {
+			EXPECT_EQ(0, readAll(data.substr(0, size)));
+		} catch (const serialization::DecodingError&) {}
+	}
+}
@@ -0,0 +1,200 @@
+#include "gtest/gtest.h"
+
+#include <carl/formula/CNFConverter.h>
+#include <carl/formula/Formula.h>
+
+#include "../Common.h"
+
+#include <map>
+#include <random>
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+typedef Formula<Pol> FormulaT;
+
+namespace {
+	bool evaluate(const FormulaT& f, const std::map<Variable, bool>& assignment) {
+		switch (f.getType()) {
+			case TRUE: return true;
+			case FALSE: return false;
+			case BOOL: return assignment.at(f.boolean());
+			case NOT: return !evaluate(f.subformula(), assignment);
+			case IMPLIES: return !evaluate(f.premise(), assignment) || evaluate(f.conclusion(), assignment);
+			case ITE: return evaluate(f.condition(), assignment) ? evaluate(f.firstCase(), assignment) : evaluate(f.secondCase(), assignment);
+			case AND:
+				for (const auto& sub: f.subformulas()) if (!evaluate(sub, assignment)) return false;
+				return true;
+			case OR:
+				for (const auto& sub: f.subformulas()) if (evaluate(sub, assignment)) return true;
+				return false;
+			case XOR: {
+				bool res = false;
+				for (const auto& sub: f.subformulas()) res ^= evaluate(sub, assignment);
+				return res;
+			}
+			case IFF: {
+				bool first = evaluate(f.subformulas().front(), assignment);
+				for (const auto& sub: f.subformulas()) if (evaluate(sub, assignment) != first) return false;
+				return true;
+			}
+			default:
+				assert(false);
+				return false;
+		}
+	}
+
+	/// Checks whether the assignment of the atoms can be extended to a model of the clauses.
+	bool extensible(const CNFConverter<Pol>& converter, const ClauseArray& clauses, const std::map<Variable, bool>& assignment) {
+		std::vector<int> fixed(converter.size() + 1, -1);
+		std::vector<std::size_t> open;
+		for (std::size_t v = 1; v <= converter.size(); ++v) {
+			const FormulaT& def = converter.definition(int(v));
+			if (converter.kind(int(v)) == cnf::VariableKind::ATOM && def.getType() == BOOL) fixed[v] = assignment.at(def.boolean());
+			else open.push_back(v);
+		}
+		for (std::size_t bits = 0; bits < (std::size_t(1) << open.size()); ++bits) {
+			for (std::size_t i = 0; i < open.size(); ++i) fixed[open[i]] = int((bits >> i) & 1);
+			bool sat = true;
+			for (std::size_t c = 0; sat && c < clauses.size(); ++c) {
+				sat = std::any_of(clauses.begin(c), clauses.end(c), [&fixed](int l) {
+					return l > 0 ? fixed[std::size_t(l)] == 1 : fixed[std::size_t(-l)] == 0;
+				});
+			}
+			if (sat) return true;
+		}
+		return false;
+	}
+
+	FormulaT randomFormula(std::mt19937& rand, const std::vector<FormulaT>& atoms, std::size_t size) {
+		std::vector<FormulaT> pool(atoms);
+		for (std::size_t i = 0; i < size; ++i) {
+			auto pick = [&]() { return pool[rand() % pool.size()]; };
+			switch (rand() % 7) {
+				case 0: pool.push_back(FormulaT(AND, {pick(), pick()})); break;
+				case 1: pool.push_back(FormulaT(OR, {pick(), pick(), pick()})); break;
+				case 2: pool.push_back(pick().negated()); break;
+				case 3: pool.push_back(FormulaT(IMPLIES, pick(), pick())); break;
+				case 4: pool.push_back(FormulaT(IFF, {pick(), pick()})); break;
+				case 5: pool.push_back(FormulaT(XOR, {pick(), pick(), pick()})); break;
+				case 6: pool.push_back(FormulaT(ITE, pick(), pick(), pick())); break;
+			}
+		}
+		return pool.back();
+	}
+}
+
+TEST(CNFConverter, Clauses)
+{
+	FormulaT a(freshBooleanVariable());
+	FormulaT b(freshBooleanVariable());
+	FormulaT c(freshBooleanVariable());
+	CNFConverter<Pol> converter;
+	ClauseArray res = converter.convert(FormulaT(AND, {FormulaT(OR, {a, b}), FormulaT(OR, {a.negated(), c}), c}));
+	// A formula in CNF does not need any Tseitin variables.
+	EXPECT_EQ(3u, res.variables);
+	EXPECT_EQ(3u, res.size());
+	for (std::size_t v = 1; v <= converter.size(); ++v) {
+		EXPECT_EQ(cnf::VariableKind::ATOM, converter.kind(int(v)));
+	}
+}
+
+TEST(CNFConverter, Polarity)
+{
+	FormulaT a(freshBooleanVariable());
+	FormulaT b(freshBooleanVariable());
+	FormulaT c(freshBooleanVariable());
+	FormulaT conj(AND, {b, c});
+	CNFConverter<Pol> converter;
+	// The conjunction only occurs positively: (or a x), (or (not x) b), (or (not x) c).
+	ClauseArray res = converter.convert(FormulaT(OR, {a, conj}));
+	EXPECT_EQ(4u, res.variables);
+	EXPECT_EQ(3u, res.size());
+	// Now it also occurs negatively, only the missing direction (or x (not b) (not c)) is added.
+	ClauseArray res2 = converter.convert(FormulaT(OR, {a, conj.negated()}));
+	EXPECT_EQ(4u, res2.variables);
+	EXPECT_EQ(2u, res2.size());
+	// Both directions are encoded now, only the implication itself is added.
+	ClauseArray res3 = converter.convert(FormulaT(IMPLIES, conj, a));
+	EXPECT_EQ(5u, res3.variables);
+	EXPECT_EQ(2u, res3.size());
+}
+
+TEST(CNFConverter, Sharing)
+{
+	FormulaT a(freshBooleanVariable());
+	FormulaT b(freshBooleanVariable());
+	FormulaT shared(XOR, {a, b});
+	FormulaT c(freshBooleanVariable());
+	CNFConverter<Pol> converter;
+	converter.convert(FormulaT(AND, {FormulaT(OR, {shared, c}), FormulaT(OR, {shared, c.negated()}), FormulaT(IMPLIES, c, shared)}));
+	std::size_t tseitin = 0;
+	for (std::size_t v = 1; v <= converter.size(); ++v) {
+		if (converter.kind(int(v)) == cnf::VariableKind::TSEITIN) tseitin++;
+	}
+	EXPECT_EQ(2u, tseitin);
+}
+
+TEST(CNFConverter, Equisatisfiable)
+{
+	std::vector<FormulaT> atoms;
+	for (std::size_t i = 0; i < 4; ++i) atoms.emplace_back(freshBooleanVariable());
+	std::mt19937 rand(42);
+	for (std::size_t round = 0; round < 30; ++round) {
+		FormulaT f = randomFormula(rand, atoms, 6);
+		CNFConverter<Pol> converter;
+		ClauseArray clauses = converter.convert(f);
+		for (std::size_t bits = 0; bits < 16; ++bits) {
+			std::map<Variable, bool> assignment;
+			for (std::size_t i = 0; i < atoms.size(); ++i) assignment[atoms[i].boolean()] = (bits >> i) & 1;
+			EXPECT_EQ(evaluate(f, assignment), extensible(converter, clauses, assignment)) << f;
+		}
+	}
+}
+
+TEST(CNFConverter, Parallel)
+{
+	std::vector<FormulaT> atoms;
+	for (std::size_t i = 0; i < 20; ++i) atoms.emplace_back(freshBooleanVariable());
+	std::mt19937 rand(7);
+	Formulas<Pol> conjuncts;
+	for (std::size_t i = 0; i < 2000; ++i) conjuncts.push_back(randomFormula(rand, atoms, 4));
+	FormulaT f(AND, std::move(conjuncts));
+	CNFConverter<Pol> sequential(1);
+	CNFConverter<Pol> parallel(4);
+	ClauseArray s = sequential.convert(f);
+	ClauseArray p = parallel.convert(f);
+	// Every subformula gets a single variable, only definitions may be duplicated.
+	EXPECT_EQ(s.variables, p.variables);
+	EXPECT_LE(s.size(), p.size());
+	EXPECT_EQ(sequential.toCNF(f).variables(), parallel.toCNF(f).variables());
+}
+
+TEST(CNFConverter, DeepNesting)
+{
+	FormulaT a(freshBooleanVariable());
+	FormulaT b(freshBooleanVariable());
+	FormulaT f = a;
+	for (std::size_t i = 0; i < 10000; ++i) {
+		f = (i % 2 == 0) ? FormulaT(OR, {f.negated(), b}) : FormulaT(AND, {f, a.negated()});
+	}
+	CNFConverter<Pol> converter;
+	ClauseArray res = converter.convert(f);
+	// a, b and one Tseitin variable per level but the top-level conjunction and disjunction.
+	EXPECT_EQ(10000u, res.variables);
+}
+
+TEST(CNFConverter, ToFormula)
+{
+	FormulaT a(freshBooleanVariable());
+	FormulaT b(freshBooleanVariable());
+	FormulaT c(freshBooleanVariable());
+	FormulaT ite(ITE, a, b, c);
+	CNFConverter<Pol> converter;
+	FormulaT res = converter.toCNF(FormulaT(OR, {ite, FormulaT(IFF, {a, c})}));
+	EXPECT_TRUE(res.propertyHolds(PROP_IS_IN_CNF));
+	FormulaT tseitin = FormulaPool<Pol>::getInstance().getTseitinVar(ite);
+	EXPECT_EQ(BOOL, tseitin.getType());
+	EXPECT_EQ(5u, res.variables().size());
+	EXPECT_TRUE(CNFConverter<Pol>().toCNF(FormulaT(FALSE)).isFalse());
+}
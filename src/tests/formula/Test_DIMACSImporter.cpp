@@ -0,0 +1,115 @@
+#include "gtest/gtest.h"
+
+#include <carl/formula/Formula.h>
+#include <carl/formula/parser/DIMACSImporter.h>
+
+#include "../Common.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+typedef Formula<Pol> FormulaT;
+
+namespace {
+	/// Writes the content to a temporary file that is removed on destruction.
+	struct TempFile {
+		std::string name;
+		TempFile(const std::string& n, const std::string& content): name(n) {
+			std::ofstream out(name);
+			out << content;
+		}
+		~TempFile() {
+			std::remove(name.c_str());
+		}
+	};
+	std::vector<std::vector<int>> clauses(const ClauseArray& ca) {
+		std::vector<std::vector<int>> res;
+		for (std::size_t i = 0; i < ca.size(); ++i) res.emplace_back(ca.begin(i), ca.end(i));
+		return res;
+	}
+}
+
+TEST(DIMACSImporter, Clauses)
+{
+	TempFile file("carl_test_dimacs_clauses.cnf", "c comment\np cnf 5 3\n1 -2 0\n 3\n-1 0 2 0\n");
+	DIMACSImporter<Pol> importer(file.name);
+	ASSERT_TRUE(importer.hasNext());
+	ClauseArray ca = importer.nextClauses();
+	EXPECT_FALSE(importer.hasNext());
+	EXPECT_EQ(5u, ca.variables);
+	EXPECT_EQ(std::vector<std::vector<int>>({{1, -2}, {3, -1}, {2}}), clauses(ca));
+}
+
+TEST(DIMACSImporter, LargeLiterals)
+{
+	// Literals beyond the range of int are skipped as errors instead of being truncated.
+	std::string input = "1 2147483647 -2147483647 0\n2147483648 -1 0\n-99999999999999999999999 3 0\n";
+	dimacs::Chunk chunk;
+	dimacs::parseChunk(input.data(), input.data() + input.size(), chunk);
+	EXPECT_EQ(2u, chunk.errors);
+	EXPECT_EQ(std::vector<int>({1, 2147483647, -2147483647, -1, 3}), chunk.literals);
+	EXPECT_EQ(std::vector<std::size_t>({3, 4, 5}), chunk.ends);
+	EXPECT_EQ(2147483647u, chunk.maxVariable);
+}
+
+TEST(DIMACSImporter, Chunks)
+{
+	std::string input = "p cnf 4 0\n";
+	std::vector<std::vector<int>> expected;
+	for (int i = 1; i < 2000; ++i) {
+		// Clauses span several lines to test clauses that are split between chunks.
+		input += std::to_string(i % 4 + 1) + "\nc " + std::to_string(i) + "\n-" + std::to_string((i * 3) % 4 + 1) + " 0\n";
+		expected.push_back({i % 4 + 1, -((i * 3) % 4 + 1)});
+	}
+	auto chunks = splitAtLines(input.data(), input.data() + input.size(), 7, 100);
+	EXPECT_EQ(7u, chunks.size());
+	std::vector<dimacs::Chunk> parsed(chunks.size());
+	forEachChunk(chunks, [&parsed](std::size_t i, const LineChunk& c) {
+		dimacs::parseChunk(c.first, c.second, parsed[i]);
+	});
+	std::vector<std::vector<int>> res;
+	std::vector<int> clause;
+	for (const auto& c: parsed) {
+		EXPECT_EQ(0u, c.errors);
+		std::size_t pos = 0;
+		for (std::size_t e: c.ends) {
+			clause.insert(clause.end(), c.literals.begin() + long(pos), c.literals.begin() + long(e));
+			res.push_back(clause);
+			clause.clear();
+			pos = e;
+		}
+		clause.insert(clause.end(), c.literals.begin() + long(pos), c.literals.end());
+	}
+	EXPECT_TRUE(clause.empty());
+	EXPECT_EQ(expected, res);
+}
+
+TEST(DIMACSImporter, Formula)
+{
+	TempFile file("carl_test_dimacs_formula.cnf", "p cnf 3 2\n1 -2 0\n2 3 0\nreset\np cnf 2 1\n-1 -2 0\n%\n0\n");
+	DIMACSImporter<Pol> importer(file.name);
+	ASSERT_TRUE(importer.hasNext());
+	FormulaT first = importer.next();
+	const auto& vars = importer.getVariables();
+	ASSERT_EQ(3u, vars.size());
+	EXPECT_EQ(FormulaT(AND, {FormulaT(OR, {vars[0], vars[1].negated()}), FormulaT(OR, {vars[1], vars[2]})}), first);
+	ASSERT_TRUE(importer.hasNext());
+	FormulaT second = importer.next();
+	EXPECT_EQ(FormulaT(OR, {vars[0].negated(), vars[1].negated()}), second);
+	EXPECT_FALSE(importer.hasNext());
+}
+
+TEST(DIMACSImporter, CreateBatch)
+{
+	FormulaT a(freshBooleanVariable());
+	FormulaT b(freshBooleanVariable());
+	std::vector<Formulas<Pol>> batch = {{a, b}, {b, a, b}, {a.negated()}};
+	auto res = FormulaPool<Pol>::getInstance().createBatch(OR, std::move(batch), 4);
+	ASSERT_EQ(3u, res.size());
+	EXPECT_EQ(FormulaT(OR, {a, b}), res[0]);
+	EXPECT_EQ(res[0], res[1]);
+	EXPECT_EQ(a.negated(), res[2]);
+}
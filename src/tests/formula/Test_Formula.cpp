@@ -5,6 +5,8 @@
 
 #include "../Common.h"
 
+#include <thread>
+
 using namespace carl;
 
 typedef MultivariatePolynomial<Rational> Pol;
@@ -404,3 +406,76 @@ TEST(Formula, Uniqueness)
 	FormulaT f2 = FormulaT(vc);
 	EXPECT_EQ(f1, f2);
 }
+
+TEST(Formula, PoolRelease)
+{
+	Variable x = freshRealVariable("x");
+	Variable b = freshBooleanVariable("b");
+	std::size_t formulas = FormulaPool<Pol>::getInstance().size();
+	std::size_t constraints = ConstraintPool<Pol>::getInstance().size();
+	{
+		FormulaT c(Pol(x) - Rational(3), Relation::LESS);
+		FormulaT f(FormulaType::AND, c, FormulaT(b));
+		FormulaT g(FormulaType::OR, f, FormulaT(FormulaType::NOT, c));
+		EXPECT_EQ(f, FormulaT(FormulaType::AND, FormulaT(b), c));
+		EXPECT_LT(formulas, FormulaPool<Pol>::getInstance().size());
+		EXPECT_LT(constraints, ConstraintPool<Pol>::getInstance().size());
+	}
+	// Releasing the last reference to a formula also releases all its sub-formulas.
+	EXPECT_EQ(formulas, FormulaPool<Pol>::getInstance().size());
+	EXPECT_EQ(constraints, ConstraintPool<Pol>::getInstance().size());
+}
+
+TEST(Formula, AdoptedUsages)
+{
+	Variable x = freshRealVariable("x");
+	Variable b = freshBooleanVariable("b");
+	std::size_t formulas = FormulaPool<Pol>::getInstance().size();
+	std::size_t constraints = ConstraintPool<Pol>::getInstance().size();
+	for (int round = 0; round < 3; ++round) {
+		FormulaT c(Pol(x) - Rational(3), Relation::LESS);
+		// Found in the pool, simplified and constant constraints.
+		FormulaT d(Pol(x) - Rational(3), Relation::LESS);
+		FormulaT e(Rational(2) * Pol(x) - Rational(6), Relation::LESS);
+		FormulaT t(Pol(Rational(1)), Relation::GREATER);
+		EXPECT_EQ(c, d);
+		EXPECT_TRUE(t.isTrue());
+		// Shortcuts returning an existing formula instead of a new one.
+		FormulaT n(FormulaType::NOT, FormulaT(FormulaType::NOT, c));
+		FormulaT a(FormulaType::AND, c, c);
+		FormulaT o(FormulaType::OR, FormulaT(b), FormulaT(FormulaType::NOT, FormulaT(b)));
+		FormulaT i(FormulaType::ITE, FormulaT(FormulaType::TRUE), c, FormulaT(b));
+		EXPECT_EQ(c, n);
+		EXPECT_EQ(c, a);
+		EXPECT_TRUE(o.isTrue());
+		EXPECT_EQ(c, i);
+	}
+	EXPECT_EQ(formulas, FormulaPool<Pol>::getInstance().size());
+	EXPECT_EQ(constraints, ConstraintPool<Pol>::getInstance().size());
+}
+
+// The CI build configures with THREAD_SAFE=ON, which runs this test as well.
+#ifdef THREAD_SAFE
+TEST(Formula, ConcurrentConstruction)
+{
+	std::vector<Variable> vars;
+	for (int i = 0; i < 8; ++i) vars.push_back(freshRealVariable());
+	std::size_t formulas = FormulaPool<Pol>::getInstance().size();
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&vars]() {
+			for (int round = 0; round < 50; ++round) {
+				Formulas<Pol> conjuncts;
+				for (std::size_t i = 0; i < vars.size(); ++i) {
+					conjuncts.emplace_back(Pol(vars[i]) - Rational(round), Relation::LEQ);
+				}
+				FormulaT f(FormulaType::AND, conjuncts);
+				FormulaT g(FormulaType::AND, conjuncts);
+				EXPECT_EQ(f, g);
+			}
+		});
+	}
+	for (auto& t: threads) t.join();
+	EXPECT_EQ(formulas, FormulaPool<Pol>::getInstance().size());
+}
+#endif
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+
+#include <carl/core/VariablePool.h>
+#include <carl/formula/Formula.h>
+#include <carl/formula/GarbageCollection.h>
+#include <carl/formula/SortManager.h>
+#include <carl/formula/uninterpreted/UFManager.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+typedef Formula<Pol> FormulaT;
+
+namespace {
+	const PoolStatistics& find(const std::vector<PoolStatistics>& stats, const std::string& name) {
+		auto it = std::find_if(stats.begin(), stats.end(), [&name](const PoolStatistics& s){ return s.name == name; });
+		assert(it != stats.end());
+		return *it;
+	}
+}
+
+TEST(GarbageCollection, BitVector)
+{
+	GarbageCollector<Pol> gc;
+	gc.collect();
+	SortManager::getInstance().clear();
+	Sort bvSort = SortManager::getInstance().addSort("BitVec");
+	SortManager::getInstance().makeSortIndexable(bvSort, 1, VariableType::VT_BITVECTOR);
+	Sort bv8Sort = SortManager::getInstance().index(bvSort, {8});
+	BVTerm a(BVTermType::VARIABLE, BVVariable(freshBitvectorVariable("a"), bv8Sort));
+	BVTerm b(BVTermType::VARIABLE, BVVariable(freshBitvectorVariable("b"), bv8Sort));
+
+	FormulaT f(BVConstraint::create(BVCompareRelation::ULT, BVTerm(BVTermType::ADD, a, b), b));
+	{
+		// Neither the term nor the constraint are part of a formula.
+		BVTerm dead(BVTermType::MUL, a, BVTerm(BVTermType::CONSTANT, BVValue(8, 3)));
+		BVConstraint::create(BVCompareRelation::EQ, dead, a);
+	}
+	auto stats = gc.statistics();
+	EXPECT_EQ(1u, find(stats, "BVConstraintPool").dead);
+	EXPECT_EQ(2u, find(stats, "BVTermPool").dead);
+	auto collected = gc.collect();
+	EXPECT_EQ(find(stats, "BVTermPool").dead, find(collected, "BVTermPool").dead);
+	stats = gc.statistics();
+	EXPECT_EQ(0u, find(stats, "BVConstraintPool").dead);
+	EXPECT_EQ(0u, find(stats, "BVTermPool").dead);
+	// The atoms of f survived.
+	EXPECT_EQ(FormulaT(BVConstraint::create(BVCompareRelation::ULT, BVTerm(BVTermType::ADD, a, b), b)), f);
+}
+
+TEST(GarbageCollection, Uninterpreted)
+{
+	SortManager::getInstance().clear();
+	Sort sort = SortManager::getInstance().addSort("S", VariableType::VT_UNINTERPRETED);
+	UVariable x(freshUninterpretedVariable("x"), sort);
+	UninterpretedFunction uf = newUninterpretedFunction("f", {sort}, sort);
+	UFInstance fx = newUFInstance(uf, {UTerm(x)});
+	UFInstance ffx = newUFInstance(uf, {UTerm(fx)});
+
+	GarbageCollector<Pol> gc;
+	FormulaT f(UEquality(UTerm(ffx), UTerm(x), false));
+	newUFInstance(uf, {UTerm(ffx)});
+	auto stats = gc.statistics();
+	// f(f(f(x))) is not part of any formula, f(x) is reachable as an argument of f(f(x)).
+	EXPECT_EQ(1u, find(stats, "UFInstanceManager").dead);
+	gc.collect();
+	EXPECT_EQ(0u, find(gc.statistics(), "UFInstanceManager").dead);
+	EXPECT_EQ(std::vector<UTerm>({UTerm(fx)}), ffx.args());
+}
+
+TEST(GarbageCollection, Tseitin)
+{
+	Variable x = freshRealVariable("x");
+	Variable b = freshBooleanVariable("b");
+	GarbageCollector<Pol> gc;
+	gc.collect();
+	std::size_t formulas = FormulaPool<Pol>::getInstance().size();
+	FormulaT tseitinVar;
+	{
+		FormulaT f(FormulaType::OR, FormulaT(b), FormulaT(Pol(x) - Rational(2), Relation::GEQ));
+		tseitinVar = FormulaPool<Pol>::getInstance().createTseitinVar(f);
+	}
+	// The disjunction is only kept alive by its Tseitin variable.
+	auto stats = FormulaPool<Pol>::getInstance().statistics();
+	EXPECT_EQ(1u, stats.dead);
+	auto collected = gc.collect();
+	EXPECT_EQ(1u, find(collected, "FormulaPool").dead);
+	EXPECT_EQ(0u, FormulaPool<Pol>::getInstance().statistics().dead);
+	// The Tseitin variable itself is still used.
+	EXPECT_EQ(formulas + 1, FormulaPool<Pol>::getInstance().size());
+}
+
+TEST(GarbageCollection, Threshold)
+{
+	GarbageCollector<Pol> gc;
+	EXPECT_FALSE(gc.collectIfNeeded());
+	gc.setThreshold(1);
+	EXPECT_TRUE(gc.collectIfNeeded());
+	// Nothing was allocated since the last collection.
+	EXPECT_FALSE(gc.collectIfNeeded());
+	EXPECT_LT(0u, gc.estimatedBytes());
+}
@@ -43,3 +43,61 @@ TYPED_TEST(Model, ModelSubstitution)
 	EXPECT_TRUE(m.at(x).asRational() == TypeParam(3));
 	EXPECT_TRUE(m.at(y).isSubstitution());
 }
+
+TYPED_TEST(Model, SubstitutionCache)
+{
+	using Poly = carl::MultivariatePolynomial<TypeParam>;
+	using ModelPolySubs = carl::ModelPolynomialSubstitution<TypeParam,Poly>;
+
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	carl::Variable z = carl::freshRealVariable("z");
+	carl::Variable w = carl::freshRealVariable("w");
+	carl::Model<TypeParam,Poly> m;
+	m.emplace(carl::ModelVariable(x), TypeParam(3));
+	m.emplace(carl::ModelVariable(y), carl::createSubstitution<TypeParam,Poly,ModelPolySubs>(Poly(TypeParam(2) * x*x)));
+	m.emplace(carl::ModelVariable(w), carl::createSubstitution<TypeParam,Poly,ModelPolySubs>(Poly(y) + Poly(TypeParam(1))));
+	EXPECT_EQ(TypeParam(18), m.evaluated(y).asRational());
+	EXPECT_EQ(TypeParam(19), m.evaluated(w).asRational());
+	std::size_t revision = m.revision();
+	// An unrelated assignment keeps the cached values.
+	m.emplace(carl::ModelVariable(z), TypeParam(5));
+	EXPECT_LT(revision, m.revision());
+	EXPECT_FALSE(m.changedSince(*m.at(w).asSubstitution(), revision));
+	// Changing x invalidates y and, through y, also w.
+	m.assign(x, TypeParam(1));
+	EXPECT_TRUE(m.changedSince(*m.at(y).asSubstitution(), revision));
+	EXPECT_TRUE(m.changedSince(*m.at(w).asSubstitution(), revision));
+	EXPECT_EQ(TypeParam(2), m.evaluated(y).asRational());
+	EXPECT_EQ(TypeParam(3), m.evaluated(w).asRational());
+	// Erasing x replaces the substitutions by their values.
+	m.erase(x);
+	EXPECT_TRUE(m.at(y).isRational());
+	EXPECT_EQ(TypeParam(3), m.evaluated(w).asRational());
+}
+
+TYPED_TEST(Model, SubstitutionCacheModels)
+{
+	using Poly = carl::MultivariatePolynomial<TypeParam>;
+	using ModelPolySubs = carl::ModelPolynomialSubstitution<TypeParam,Poly>;
+
+	carl::Variable x = carl::freshRealVariable("x");
+	auto subs = carl::createSubstitutionPtr<TypeParam,Poly,ModelPolySubs>(Poly(x) + Poly(TypeParam(1)));
+	// Models with the same revision, possibly at the same address, do not share the cached value.
+	{
+		carl::Model<TypeParam,Poly> m;
+		m.emplace(carl::ModelVariable(x), TypeParam(1));
+		EXPECT_EQ(TypeParam(2), subs->evaluate(m).asRational());
+	}
+	{
+		carl::Model<TypeParam,Poly> m;
+		m.emplace(carl::ModelVariable(x), TypeParam(5));
+		EXPECT_EQ(TypeParam(6), subs->evaluate(m).asRational());
+		carl::Model<TypeParam,Poly> copy(m);
+		EXPECT_NE(m.id(), copy.id());
+		copy.assign(x, TypeParam(7));
+		m.assign(x, TypeParam(9));
+		EXPECT_EQ(TypeParam(8), subs->evaluate(copy).asRational());
+		EXPECT_EQ(TypeParam(10), subs->evaluate(m).asRational());
+	}
+}
@@ -2,10 +2,13 @@
 
 #include <carl/formula/Formula.h>
 #include <carl/formula/model/Model.h>
+#include <carl/formula/model/evaluation/IncrementalEvaluation.h>
 #include <carl/formula/model/evaluation/ModelEvaluation.h>
 
 #include "../Common.h"
 
+#include <random>
+
 using namespace carl;
 
 typedef MultivariatePolynomial<Rational> Pol;
@@ -116,3 +119,46 @@ TEST(ModelEvaluation, EvaluateBV)
 	auto res = carl::model::evaluate(f, m);
 	std::cout << res << std::endl;
 }
+
+TEST(ModelEvaluation, Incremental)
+{
+	std::vector<Variable> reals = { freshRealVariable("x"), freshRealVariable("y"), freshRealVariable("z") };
+	std::vector<Variable> bools = { freshBooleanVariable("a"), freshBooleanVariable("b") };
+	std::vector<FormulaT> pool;
+	for (std::size_t i = 0; i < reals.size(); ++i) {
+		pool.emplace_back(ConstraintT(Pol(reals[i]) * reals[(i + 1) % reals.size()] - Pol(Rational(2)), Relation::LESS));
+		pool.emplace_back(ConstraintT(Pol(reals[i]) - Pol(Rational(1)), Relation::GEQ));
+	}
+	for (auto b: bools) pool.emplace_back(b);
+	std::mt19937 rand(3);
+	auto pick = [&]() { return pool[rand() % pool.size()]; };
+	for (std::size_t i = 0; i < 40; ++i) {
+		switch (rand() % 5) {
+			case 0: pool.push_back(FormulaT(FormulaType::AND, {pick(), pick()})); break;
+			case 1: pool.push_back(FormulaT(FormulaType::OR, {pick(), pick(), pick()})); break;
+			case 2: pool.push_back(pick().negated()); break;
+			case 3: pool.push_back(FormulaT(FormulaType::IFF, {pick(), pick()})); break;
+			case 4: pool.push_back(FormulaT(FormulaType::ITE, pick(), pick(), pick())); break;
+		}
+	}
+	FormulaT f(FormulaType::AND, {pool.back(), pool[pool.size() - 2]});
+	model::IncrementalEvaluator<Rational,Pol> evaluator(f);
+
+	ModelT m;
+	EXPECT_EQ(model::satisfiedBy(f, m), evaluator.evaluate(m));
+	std::size_t full = evaluator.atomEvaluations();
+	for (std::size_t step = 0; step < 200; ++step) {
+		Variable changed;
+		if (rand() % 3 == 0) {
+			changed = bools[rand() % bools.size()];
+			m.assign(changed, rand() % 2 == 0);
+		} else {
+			changed = reals[rand() % reals.size()];
+			if (rand() % 10 == 0) m.erase(changed);
+			else m.assign(changed, Rational(int(rand() % 5) - 2));
+		}
+		EXPECT_EQ(model::satisfiedBy(f, m), evaluator.update(m, changed)) << f << " on " << m;
+	}
+	// Only the atoms mentioning the changed variable have been evaluated again.
+	EXPECT_LT(evaluator.atomEvaluations(), full * 200);
+}
@@ -4,11 +4,68 @@
 
 #include <carl/formula/parser/OPBImporter.h>
 
+#include <cstdio>
+#include <fstream>
+
 using namespace carl;
 using Poly = carl::MultivariatePolynomial<mpq_class>;
 
 TEST(OPBParser, Basic)
 {
-	//OPBImporter<Poly> importer("../sep6.5.opb");
-	//importer.parse();
+	std::string input = "* #variable= 3 #constraint= 2\nmin: +1 x1 -2 x2 ;\n+1 x1 +1 x2 +1 x3 >= 2 ;\n* comment\n3 x1 -1 x3\n != -4;\n";
+	auto file = parseOPB(input.data(), input.data() + input.size());
+	ASSERT_TRUE(file);
+	ASSERT_EQ(2u, file->objective.size());
+	EXPECT_EQ(-2, file->objective[1].first);
+	ASSERT_EQ(2u, file->constraints.size());
+	EXPECT_EQ(3u, std::get<0>(file->constraints[0]).size());
+	EXPECT_EQ(Relation::GEQ, std::get<1>(file->constraints[0]));
+	EXPECT_EQ(2, std::get<2>(file->constraints[0]));
+	EXPECT_EQ(Relation::NEQ, std::get<1>(file->constraints[1]));
+	EXPECT_EQ(-4, std::get<2>(file->constraints[1]));
+	// Variables are identified by their name.
+	EXPECT_EQ(file->objective[0].second, std::get<0>(file->constraints[1])[0].second);
+}
+
+TEST(OPBParser, Errors)
+{
+	for (std::string input: {"1 x1 >= ;", "1 x1 => 1 ;", "1 x1 >= 1", "1 x1 >= 3000000000 ;", "x1 >= 1 ;"}) {
+		EXPECT_FALSE(parseOPB(input.data(), input.data() + input.size())) << input;
+	}
+}
+
+TEST(OPBParser, Chunks)
+{
+	std::string input = "min: 1 y ;\n";
+	for (std::size_t i = 0; i < 200000; ++i) {
+		input += "+1 x" + std::to_string(i % 100) + " -2 y\n>= " + std::to_string(i % 7) + " ;\n";
+	}
+	auto sequential = parseOPB(input.data(), input.data() + input.size(), 1);
+	auto parallel = parseOPB(input.data(), input.data() + input.size(), 4);
+	ASSERT_TRUE(sequential);
+	ASSERT_TRUE(parallel);
+	ASSERT_EQ(200000u, parallel->constraints.size());
+	for (std::size_t i = 0; i < 200000; i += 997) {
+		EXPECT_EQ(std::get<2>(sequential->constraints[i]), std::get<2>(parallel->constraints[i]));
+		EXPECT_EQ(std::get<0>(sequential->constraints[i]).size(), std::get<0>(parallel->constraints[i]).size());
+	}
+}
+
+TEST(OPBParser, Importer)
+{
+	std::string filename = "carl_test_opb_parser.opb";
+	{
+		std::ofstream out(filename);
+		out << "min: 1 a ;\n2 a +3 b >= 3 ;\n1 a 1 b = 1 ;\n";
+	}
+	OPBImporter<Poly> importer(filename);
+	auto res = importer.parse();
+	std::remove(filename.c_str());
+	ASSERT_TRUE(res);
+	EXPECT_EQ(FormulaType::AND, res->first.getType());
+	EXPECT_EQ(2u, res->first.size());
+	EXPECT_EQ(2u, res->first.variables().size());
+	EXPECT_EQ(1u, res->second.gatherVariables().size());
+
+	EXPECT_FALSE(OPBImporter<Poly>("carl_test_opb_missing.opb").parse());
 }
@@ -0,0 +1,213 @@
+#include "gtest/gtest.h"
+
+#include <carl/formula/Formula.h>
+#include <carl/formula/parser/SMTLIBParser.h>
+
+#include "../Common.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+typedef Formula<Pol> FormulaT;
+typedef SMTLIBParser<Pol> Parser;
+
+namespace {
+	/// Parses all commands and returns the asserted formulas.
+	std::vector<FormulaT> assertions(Parser& parser) {
+		std::vector<FormulaT> res;
+		Parser::Command cmd;
+		while (parser.next(cmd)) {
+			if (cmd.type == Parser::Command::Type::ASSERT) res.push_back(cmd.formula);
+		}
+		return res;
+	}
+	Variable variable(const Parser& parser, const std::string& name) {
+		return std::get<Pol>(parser.constant(name)).lmon()->getSingleVariable();
+	}
+}
+
+TEST(SMTLIBParser, Commands)
+{
+	std::stringstream ss("(set-info :status sat)\n(set-option :produce-models true)\n(set-logic QF_LRA)\n(declare-fun x () Real)\n(push 1)\n(check-sat)\n(get-model)\n(pop)\n(exit)");
+	Parser parser(ss);
+	Parser::Command cmd;
+	std::vector<Parser::Command::Type> types;
+	while (parser.next(cmd)) types.push_back(cmd.type);
+	using Type = Parser::Command::Type;
+	EXPECT_EQ(std::vector<Type>({Type::SET_INFO, Type::SET_OPTION, Type::SET_LOGIC, Type::DECLARE_FUN, Type::PUSH, Type::CHECK_SAT, Type::OTHER, Type::POP, Type::EXIT}), types);
+}
+
+TEST(SMTLIBParser, Arithmetic)
+{
+	std::stringstream ss("(declare-fun x () Real) (declare-const |y z| Int)\n; comment\n(assert (and (< x 1) (>= (+ x (* 2 |y z|) (- 1.5)) (/ 7 2)) (distinct x |y z|)))");
+	Parser parser(ss);
+	auto res = assertions(parser);
+	ASSERT_EQ(1u, res.size());
+	Variable x = variable(parser, "x");
+	Variable y = variable(parser, "y z");
+	EXPECT_EQ(VariableType::VT_REAL, x.type());
+	EXPECT_EQ(VariableType::VT_INT, y.type());
+	FormulaT expected(AND, {
+		FormulaT(Pol(x) - Rational(1), Relation::LESS),
+		FormulaT(Pol(x) + Rational(2)*y - Rational(5), Relation::GEQ),
+		FormulaT(Pol(x) - y, Relation::NEQ)
+	});
+	EXPECT_EQ(expected, res.front());
+}
+
+TEST(SMTLIBParser, Let)
+{
+	std::stringstream ss("(declare-fun x () Real) (declare-fun b () Bool)\n(assert (let ((a (+ x 1)) (c b)) (let ((a (* a a))) (and c (< a 2) (> a 0)))))");
+	Parser parser(ss);
+	auto res = assertions(parser);
+	ASSERT_EQ(1u, res.size());
+	Pol a = (Pol(variable(parser, "x")) + Rational(1)) * (Pol(variable(parser, "x")) + Rational(1));
+	FormulaT b = std::get<FormulaT>(parser.constant("b"));
+	EXPECT_EQ(FormulaT(AND, {b, FormulaT(a - Rational(2), Relation::LESS), FormulaT(a, Relation::GREATER)}), res.front());
+}
+
+TEST(SMTLIBParser, Boolean)
+{
+	std::stringstream ss("(declare-const a Bool) (declare-const b Bool)\n(assert (=> a b (not a)))\n(assert (= a b (xor a b)))\n(assert (ite a true (or a b)))");
+	Parser parser(ss);
+	auto res = assertions(parser);
+	ASSERT_EQ(3u, res.size());
+	FormulaT a = std::get<FormulaT>(parser.constant("a"));
+	FormulaT b = std::get<FormulaT>(parser.constant("b"));
+	EXPECT_EQ(FormulaT(IMPLIES, a, FormulaT(IMPLIES, b, a.negated())), res[0]);
+	EXPECT_EQ(FormulaT(IFF, {a, b, FormulaT(XOR, {a, b})}), res[1]);
+	EXPECT_EQ(FormulaT(ITE, a, FormulaT(TRUE), FormulaT(OR, {a, b})), res[2]);
+}
+
+TEST(SMTLIBParser, ArithmeticIte)
+{
+	std::stringstream ss("(declare-fun x () Real) (declare-fun b () Bool)\n(assert (> (ite b x 1) 0))");
+	Parser parser(ss);
+	auto res = assertions(parser);
+	ASSERT_EQ(1u, res.size());
+	// The ite is replaced by a fresh variable whose definition is part of the assertion.
+	EXPECT_EQ(FormulaType::AND, res.front().getType());
+	EXPECT_EQ(2u, res.front().size());
+	EXPECT_EQ(3u, res.front().variables().size());
+}
+
+TEST(SMTLIBParser, IteScopes)
+{
+	// The definition of the fresh variable of an ite must survive pop and be added wherever the variable is used.
+	std::stringstream ss("(declare-fun x () Real) (declare-fun b () Bool)\n(define-fun y () Real (ite b x 1))\n(push 1)\n(assert (> y 0))\n(pop 1)\n(assert (< y 0))\n(assert (> x 0))");
+	Parser parser(ss);
+	auto res = assertions(parser);
+	ASSERT_EQ(3u, res.size());
+	for (std::size_t i = 0; i < 2; ++i) {
+		ASSERT_EQ(FormulaType::AND, res[i].getType());
+		ASSERT_EQ(2u, res[i].size());
+		EXPECT_EQ(res[0].subformulas().front(), res[i].subformulas().front());
+		EXPECT_EQ(FormulaType::ITE, res[i].subformulas().front().getType());
+	}
+	EXPECT_EQ(FormulaType::CONSTRAINT, res[2].getType());
+}
+
+TEST(SMTLIBParser, Definitions)
+{
+	std::stringstream ss("(declare-fun x () Real)\n(define-fun sq ((a Real)) Real (* a a))\n(define-fun c () Real (sq x))\n(assert (! (< (sq (+ x 1)) c) :named n))\n(assert n)");
+	Parser parser(ss);
+	auto res = assertions(parser);
+	ASSERT_EQ(2u, res.size());
+	Pol x(variable(parser, "x"));
+	EXPECT_EQ(FormulaT((x + Rational(1)) * (x + Rational(1)) - x * x, Relation::LESS), res[0]);
+	EXPECT_EQ(res[0], res[1]);
+}
+
+TEST(SMTLIBParser, BitVector)
+{
+	std::stringstream ss("(declare-fun a () (_ BitVec 8))\n(assert (bvult (bvadd a #x01 #b00000010) (_ bv5 8)))\n(assert (= ((_ extract 3 0) a) #b1010))\n(assert (= (concat a a) ((_ zero_extend 8) a)))");
+	Parser parser(ss);
+	auto res = assertions(parser);
+	ASSERT_EQ(3u, res.size());
+	BVTerm a = std::get<BVTerm>(parser.constant("a"));
+	EXPECT_EQ(8u, a.width());
+	BVTerm sum(BVTermType::ADD, BVTerm(BVTermType::ADD, a, BVTerm(BVTermType::CONSTANT, BVValue(8, 1))), BVTerm(BVTermType::CONSTANT, BVValue(8, 2)));
+	EXPECT_EQ(FormulaT(BVConstraint::create(BVCompareRelation::ULT, sum, BVTerm(BVTermType::CONSTANT, BVValue(8, 5)))), res[0]);
+	EXPECT_EQ(FormulaT(BVConstraint::create(BVCompareRelation::EQ, BVTerm(BVTermType::EXTRACT, a, 3, 0), BVTerm(BVTermType::CONSTANT, BVValue(4, 10)))), res[1]);
+	EXPECT_EQ(FormulaType::BITVECTOR, res[2].getType());
+}
+
+TEST(SMTLIBParser, Uninterpreted)
+{
+	std::stringstream ss("(declare-sort U 0)\n(declare-fun x () U)\n(declare-fun f (U) U)\n(declare-fun p (U U) Bool)\n(assert (and (= (f x) x) (p x (f x)) (distinct x (f (f x)))))");
+	Parser parser(ss);
+	auto res = assertions(parser);
+	ASSERT_EQ(1u, res.size());
+	ASSERT_EQ(FormulaType::AND, res.front().getType());
+	ASSERT_EQ(3u, res.front().size());
+	for (const auto& f: res.front().subformulas()) {
+		EXPECT_EQ(FormulaType::UEQ, f.getType());
+	}
+	UTerm x = std::get<UTerm>(parser.constant("x"));
+	EXPECT_TRUE(x.isUVariable());
+}
+
+TEST(SMTLIBParser, Scopes)
+{
+	std::stringstream ss("(push 1)\n(declare-fun x () Real)\n(assert (> x 0))\n(pop 1)\n(declare-fun x () Int)\n(assert (> x 0))");
+	Parser parser(ss);
+	auto res = assertions(parser);
+	ASSERT_EQ(2u, res.size());
+	EXPECT_NE(res[0], res[1]);
+	EXPECT_EQ(VariableType::VT_INT, variable(parser, "x").type());
+}
+
+TEST(SMTLIBParser, DeepNesting)
+{
+	std::string input = "(declare-fun b () Bool)\n(assert ";
+	std::size_t depth = 100000;
+	for (std::size_t i = 0; i < depth; ++i) input += "(not ";
+	input += "b";
+	input += std::string(depth, ')');
+	input += ")";
+	Parser parser(input.data(), input.size());
+	auto res = assertions(parser);
+	ASSERT_EQ(1u, res.size());
+	EXPECT_EQ(std::get<FormulaT>(parser.constant("b")), res.front());
+}
+
+TEST(SMTLIBParser, Errors)
+{
+	std::stringstream unknown("(declare-fun x () Real)\n(assert (< x y))");
+	Parser p1(unknown);
+	Parser::Command cmd;
+	EXPECT_TRUE(p1.next(cmd));
+	try {
+		p1.next(cmd);
+		FAIL();
+	} catch (const std::runtime_error& e) {
+		EXPECT_EQ(0, std::string(e.what()).find("2:14: Unknown constant y"));
+	}
+
+	std::stringstream sorts("(declare-fun x () Real)\n(assert (and x true))");
+	Parser p2(sorts);
+	EXPECT_TRUE(p2.next(cmd));
+	EXPECT_THROW(p2.next(cmd), std::runtime_error);
+
+	std::stringstream unbalanced("(assert (and true false)");
+	Parser p3(unbalanced);
+	EXPECT_THROW(p3.next(cmd), std::runtime_error);
+}
+
+TEST(SMTLIBParser, File)
+{
+	std::string filename = "carl_test_smtlib_parser.smt2";
+	{
+		std::ofstream out(filename);
+		out << "(set-logic QF_NRA)\n(declare-fun x () Real)\n(assert (= (* x x) 2))\n(assert (> x 0))\n(check-sat)\n(exit)\n";
+	}
+	FormulaT res = parseSMTLIBFile<Pol>(filename);
+	std::remove(filename.c_str());
+	EXPECT_EQ(FormulaType::AND, res.getType());
+	EXPECT_EQ(2u, res.size());
+	EXPECT_EQ(1u, res.variables().size());
+}
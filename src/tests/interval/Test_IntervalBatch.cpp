@@ -0,0 +1,193 @@
+#include "gtest/gtest.h"
+#include "carl/interval/Interval.h"
+#include "carl/interval/IntervalBatch.h"
+#include "carl/interval/IntervalEvaluation.h"
+#include "carl/interval/Contraction.h"
+
+#include "../Common.h"
+
+#include <cfenv>
+#include <random>
+
+using namespace carl;
+
+namespace {
+	std::vector<Interval<double>> randomIntervals(std::size_t n, unsigned seed) {
+		std::mt19937 rand(seed);
+		std::uniform_real_distribution<double> dist(-10, 10);
+		std::vector<Interval<double>> res;
+		for (std::size_t i = 0; i < n; ++i) {
+			double a = dist(rand);
+			double b = dist(rand);
+			res.emplace_back(std::min(a, b), std::max(a, b));
+		}
+		res.emplace_back(0.0, 0.0);
+		res.emplace_back(0.0, BoundType::WEAK, 0.0, BoundType::INFTY);
+		res.emplace_back(-3.0, BoundType::INFTY, -1.0, BoundType::WEAK);
+		res.emplace_back(Interval<double>::unboundedInterval());
+		res.emplace_back(Interval<double>::emptyInterval());
+		return res;
+	}
+
+	::testing::AssertionResult contains(const Interval<double>& outer, const Interval<double>& inner) {
+		if (inner.isEmpty() || set_is_subset(inner, outer)) return ::testing::AssertionSuccess();
+		return ::testing::AssertionFailure() << outer << " does not contain " << inner;
+	}
+
+	/// Checks that res contains the exact values of x^exp at the finite endpoints of x.
+	::testing::AssertionResult containsPower(const Interval<double>& res, const Interval<double>& x, carl::uint exp) {
+		std::vector<double> points;
+		if (x.lowerBoundType() != BoundType::INFTY) points.push_back(x.lower());
+		if (x.upperBoundType() != BoundType::INFTY) points.push_back(x.upper());
+		for (double p: points) {
+			Rational value = carl::pow(carl::rationalize<Rational>(p), exp);
+			bool aboveLower = res.lowerBoundType() == BoundType::INFTY || carl::rationalize<Rational>(res.lower()) <= value;
+			bool belowUpper = res.upperBoundType() == BoundType::INFTY || value <= carl::rationalize<Rational>(res.upper());
+			if (!aboveLower || !belowUpper) {
+				return ::testing::AssertionFailure() << res << " does not contain " << p << "^" << exp;
+			}
+		}
+		return ::testing::AssertionSuccess();
+	}
+}
+
+TEST(IntervalBatch, Conversion)
+{
+	std::vector<Interval<double>> intervals = {
+		Interval<double>(1, 2),
+		Interval<double>(1.0, BoundType::STRICT, 2.0, BoundType::WEAK),
+		Interval<double>(0.0, BoundType::INFTY, 2.0, BoundType::WEAK),
+		Interval<double>::emptyInterval()
+	};
+	IntervalBatch b(intervals);
+	EXPECT_EQ(4u, b.size());
+	EXPECT_EQ(Interval<double>(1, 2), b[0]);
+	// Strict bounds are closed.
+	EXPECT_EQ(Interval<double>(1, 2), b[1]);
+	EXPECT_EQ(intervals[2], b[2]);
+	EXPECT_TRUE(b[3].isEmpty());
+	EXPECT_TRUE(b.isEmpty(3));
+}
+
+TEST(IntervalBatch, Arithmetic)
+{
+	auto lhs = randomIntervals(100, 1);
+	auto rhs = randomIntervals(100, 2);
+	std::rotate(rhs.begin(), rhs.end() - 3, rhs.end());
+	IntervalBatch a(lhs);
+	IntervalBatch b(rhs);
+	IntervalBatch sum = a + b;
+	IntervalBatch diff = a - b;
+	IntervalBatch prod = a * b;
+	IntervalBatch quot = a / b;
+	IntervalBatch neg = -a;
+	IntervalBatch square = sqr(a);
+	IntervalBatch cube = pow(a, 3);
+	IntervalBatch fourth = pow(a, 4);
+	IntervalBatch meet = set_intersection(a, b);
+	EXPECT_EQ(FE_TONEAREST, std::fegetround());
+	for (std::size_t i = 0; i < lhs.size(); ++i) {
+		const auto& x = lhs[i];
+		const auto& y = rhs[i];
+		if (x.isEmpty() || y.isEmpty()) {
+			EXPECT_TRUE(sum.isEmpty(i));
+			EXPECT_TRUE(prod.isEmpty(i));
+			EXPECT_TRUE(quot.isEmpty(i));
+			EXPECT_TRUE(meet.isEmpty(i));
+			continue;
+		}
+		EXPECT_TRUE(contains(sum[i], x + y));
+		EXPECT_TRUE(contains(diff[i], x - y));
+		EXPECT_TRUE(contains(prod[i], x * y));
+		EXPECT_TRUE(contains(neg[i], -x));
+		EXPECT_TRUE(contains(square[i], carl::pow(x, 2)));
+		EXPECT_TRUE(containsPower(cube[i], x, 3));
+		EXPECT_TRUE(containsPower(fourth[i], x, 4));
+		if (x.contains(0)) EXPECT_EQ(0, fourth[i].lower());
+		EXPECT_TRUE(contains(meet[i], set_intersection(x, y)));
+		if (x.isClosedInterval() && y.isClosedInterval()) {
+			// Both compute correctly rounded bounds.
+			EXPECT_EQ(x + y, sum[i]);
+			EXPECT_EQ(x * y, prod[i]);
+			EXPECT_EQ(carl::pow(x, 2), square[i]);
+		}
+		if (!y.contains(0)) {
+			Interval<double> resA, resB;
+			x.div_ext(y, resA, resB);
+			EXPECT_TRUE(contains(quot[i], resA));
+		} else {
+			EXPECT_TRUE(quot[i].isInfinite());
+		}
+	}
+}
+
+TEST(IntervalBatch, Rounding)
+{
+	IntervalBatch a(std::vector<Interval<double>>({Interval<double>(0.1)}));
+	IntervalBatch b(std::vector<Interval<double>>({Interval<double>(0.2)}));
+	IntervalBatch sum = a + b;
+	EXPECT_LT(sum.lower()[0], sum.upper()[0]);
+	EXPECT_TRUE(sum[0].contains(0.1 + 0.2));
+	IntervalBatch prod = a * b;
+	EXPECT_LT(prod.lower()[0], prod.upper()[0]);
+}
+
+TEST(IntervalBatch, Evaluation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	MultivariatePolynomial<Rational> p = Rational(3)*x*x*y - Rational(1,2)*y*y*y + x + Rational(2);
+	auto xs = randomIntervals(50, 3);
+	auto ys = randomIntervals(50, 4);
+	std::map<Variable, IntervalBatch> batch = {{x, IntervalBatch(xs)}, {y, IntervalBatch(ys)}};
+	IntervalBatch res = IntervalEvaluation::evaluate(p, batch);
+	MultivariateHorner<MultivariatePolynomial<Rational>, strategy> h(p);
+	IntervalBatch resHorner = IntervalEvaluation::evaluate(h, batch);
+	ASSERT_EQ(xs.size(), res.size());
+	for (std::size_t i = 0; i < xs.size(); ++i) {
+		if (xs[i].isEmpty() || ys[i].isEmpty()) continue;
+		std::map<Variable, Interval<double>> map = {{x, xs[i]}, {y, ys[i]}};
+		EXPECT_TRUE(contains(res[i], IntervalEvaluation::evaluate(p, map)));
+		EXPECT_TRUE(contains(resHorner[i], IntervalEvaluation::evaluate(h, map)));
+	}
+}
+
+TEST(IntervalBatch, Contraction)
+{
+	Variable a = freshRealVariable("a");
+	Variable b = freshRealVariable("b");
+	Variable c = freshRealVariable("c");
+	MultivariatePolynomial<Rational> e1({(Rational)1*a, (Rational)1*b, (Rational)1*c});
+	MultivariatePolynomial<Rational> e2({(Rational)12*a, (Rational)3*b, (Rational)1*c*c});
+	Contraction<SimpleNewton, MultivariatePolynomial<Rational>> e1_contractor(e1);
+	Contraction<SimpleNewton, MultivariatePolynomial<Rational>> e2_contractor(e2);
+
+	std::vector<std::map<Variable, Interval<double>>> boxes = {
+		{{a, Interval<double>(1, 4)}, {b, Interval<double>(2, 5)}, {c, Interval<double>(-2, 3)}},
+		{{a, Interval<double>(-4, 4)}, {b, Interval<double>(-1, 5)}, {c, Interval<double>(-2, 3)}},
+		{{a, Interval<double>(-1, 0)}, {b, Interval<double>(0, 1)}, {c, Interval<double>(1, 2)}},
+	};
+	std::map<Variable, IntervalBatch> batch;
+	for (Variable v: {a, b, c}) {
+		std::vector<Interval<double>> intervals;
+		for (const auto& box: boxes) intervals.push_back(box.at(v));
+		batch.emplace(v, IntervalBatch(intervals));
+	}
+	for (auto* contractor: {&e1_contractor, &e2_contractor}) {
+		for (Variable v: {a, b, c}) {
+			IntervalBatch result;
+			(*contractor)(batch, v, result);
+			ASSERT_EQ(boxes.size(), result.size());
+			for (std::size_t i = 0; i < boxes.size(); ++i) {
+				Interval<double> resA, resB;
+				(*contractor)(boxes[i], v, resA, resB);
+				EXPECT_TRUE(contains(result[i], resA));
+				EXPECT_TRUE(contains(result[i], resB));
+				EXPECT_TRUE(contains(boxes[i].at(v), result[i]));
+			}
+		}
+	}
+	IntervalBatch result;
+	e1_contractor(batch, a, result);
+	EXPECT_TRUE(result.isEmpty(0));
+}
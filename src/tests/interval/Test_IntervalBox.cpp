@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+#include "carl/interval/Interval.h"
+#include "carl/interval/IntervalBox.h"
+#include "carl/interval/IntervalEvaluation.h"
+#include "carl/interval/Contraction.h"
+#include "carl/interval/Contractor.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(IntervalBox, Basics)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshIntegerVariable("y");
+	IntervalBox<double> box;
+	EXPECT_TRUE(box.empty());
+	EXPECT_FALSE(box.has(x));
+	box.set(x, Interval<double>(1, 2));
+	box[y] = Interval<double>(-3, 3);
+	EXPECT_EQ(2u, box.size());
+	EXPECT_EQ(1u, box.count(x));
+	EXPECT_EQ(Interval<double>(1, 2), box.at(x));
+	EXPECT_EQ(Interval<double>(-3, 3), box.at(y));
+	std::map<Variable, Interval<double>> map = {{x, Interval<double>(1, 2)}, {y, Interval<double>(-3, 3)}};
+	EXPECT_EQ(map, box.toMap());
+	EXPECT_EQ(box, IntervalBox<double>(map));
+}
+
+TEST(IntervalBox, Snapshots)
+{
+	std::vector<Variable> vars;
+	IntervalBox<double> box;
+	for (int i = 0; i < 200; ++i) {
+		vars.push_back(freshRealVariable());
+		box.set(vars.back(), Interval<double>(double(i), double(i + 1)));
+	}
+	IntervalBox<double> snapshot = box;
+	box.set(vars[0], Interval<double>(0.0, 0.5));
+	box.set(vars[199], Interval<double>(199.5, 200.0));
+	EXPECT_EQ(Interval<double>(0, 1), snapshot.at(vars[0]));
+	EXPECT_EQ(Interval<double>(199, 200), snapshot.at(vars[199]));
+	EXPECT_EQ(Interval<double>(0.0, 0.5), box.at(vars[0]));
+	EXPECT_EQ(Interval<double>(199.5, 200.0), box.at(vars[199]));
+	for (int i = 1; i < 199; ++i) {
+		EXPECT_EQ(snapshot.at(vars[std::size_t(i)]), box.at(vars[std::size_t(i)]));
+	}
+	EXPECT_NE(snapshot, box);
+}
+
+TEST(IntervalBox, Changed)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	IntervalBox<double> box({{x, Interval<double>(0, 1)}, {y, Interval<double>(0, 1)}, {z, Interval<double>(0, 1)}});
+	EXPECT_FALSE(box.anyChanged());
+	// Assigning the same interval is not a change.
+	box.set(x, Interval<double>(0, 1));
+	EXPECT_FALSE(box.anyChanged());
+	box.set(y, Interval<double>(0.0, 0.5));
+	box.set(z, Interval<double>(0.5, 1.0));
+	EXPECT_FALSE(box.changed(x));
+	EXPECT_TRUE(box.changed(y));
+	EXPECT_EQ(std::vector<Variable>({y, z}), box.changedVariables());
+	IntervalBox<double> snapshot = box;
+	EXPECT_TRUE(snapshot.changed(y));
+	box.clearChanged();
+	EXPECT_FALSE(box.anyChanged());
+	EXPECT_TRUE(snapshot.anyChanged());
+}
+
+TEST(IntervalBox, Evaluation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	MultivariatePolynomial<Rational> p = Rational(3)*x*x*y - Rational(Rational(1)/2)*y*y*y + x + Rational(2);
+	std::map<Variable, Interval<double>> map = {{x, Interval<double>(-1, 2)}, {y, Interval<double>(0.5, BoundType::STRICT, 3.0, BoundType::WEAK)}};
+	IntervalBox<double> box(map);
+	EXPECT_EQ(IntervalEvaluation::evaluate(p, map), IntervalEvaluation::evaluate(p, box));
+	MultivariateHorner<MultivariatePolynomial<Rational>, strategy> h(p);
+	EXPECT_EQ(IntervalEvaluation::evaluate(h, map), IntervalEvaluation::evaluate(h, box));
+	UnivariatePolynomial<double> q(x, {1.0, -2.0, 1.0});
+	EXPECT_EQ(IntervalEvaluation::evaluate(q, map), IntervalEvaluation::evaluate(q, box));
+}
+
+TEST(IntervalBox, Contraction)
+{
+	Variable a = freshRealVariable("a");
+	Variable b = freshRealVariable("b");
+	Variable c = freshRealVariable("c");
+	MultivariatePolynomial<Rational> e1({(Rational)1*a, (Rational)1*b, (Rational)1*c});
+	MultivariatePolynomial<Rational> e2({(Rational)12*a, (Rational)3*b, (Rational)1*c*c});
+	Contraction<SimpleNewton, MultivariatePolynomial<Rational>> e1_contractor(e1);
+	Contraction<SimpleNewton, MultivariatePolynomial<Rational>> e2_contractor(e2);
+	std::map<Variable, Interval<double>> map = {{a, Interval<double>(-4, 4)}, {b, Interval<double>(-1, 5)}, {c, Interval<double>(-2, 3)}};
+	IntervalBox<double> box(map);
+	for (auto* contractor: {&e1_contractor, &e2_contractor}) {
+		for (Variable v: {a, b, c}) {
+			Interval<double> mapA, mapB, boxA, boxB;
+			EXPECT_EQ((*contractor)(map, v, mapA, mapB), (*contractor)(box, v, boxA, boxB));
+			EXPECT_EQ(mapA, boxA);
+			EXPECT_EQ(mapB, boxB);
+		}
+	}
+	// Contraction works on a copy of the box, the box itself is not changed.
+	EXPECT_FALSE(box.anyChanged());
+
+	contractor::Contractor<int, MultivariatePolynomial<Rational>> contractor(0, Constraint<MultivariatePolynomial<Rational>>(e2, Relation::LEQ), a);
+	EXPECT_EQ(contractor.contract(map), contractor.contract(box));
+}
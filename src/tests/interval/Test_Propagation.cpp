@@ -0,0 +1,127 @@
+#include "gtest/gtest.h"
+#include "carl/interval/Interval.h"
+#include "carl/interval/IntervalBox.h"
+#include "carl/interval/Propagation.h"
+
+#include "../Common.h"
+
+#include <cmath>
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+using Propagation = contractor::Propagation<Poly>;
+
+TEST(Propagation, Linear)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Propagation p({
+		Constraint<Poly>(Poly(x) + y - Rational(10), Relation::EQ)
+	});
+	IntervalBox<double> box;
+	box.set(x, Interval<double>(0, 100));
+	box.set(y, Interval<double>(8, 9));
+	box.clearChanged();
+	EXPECT_TRUE(p.propagate(box));
+	EXPECT_EQ(Interval<double>(1, 2), box.at(x));
+	EXPECT_EQ(Interval<double>(8, 9), box.at(y));
+	EXPECT_EQ(std::vector<Variable>({x}), box.changedVariables());
+	EXPECT_FALSE(p.budgetExhausted());
+}
+
+TEST(Propagation, Chain)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Propagation p({
+		Constraint<Poly>(Poly(x) - y, Relation::LEQ),
+		Constraint<Poly>(Poly(y) - z, Relation::LEQ),
+		Constraint<Poly>(Poly(z) - Rational(3), Relation::LEQ),
+	});
+	std::map<Variable, Interval<double>> map = {{x, Interval<double>(0, 10)}};
+	EXPECT_TRUE(p.propagate(map));
+	EXPECT_EQ(3u, map.size());
+	EXPECT_EQ(Interval<double>(0, 3), map.at(x));
+	EXPECT_EQ(Interval<double>(0.0, BoundType::WEAK, 3.0, BoundType::WEAK), map.at(y));
+	EXPECT_EQ(Interval<double>(0.0, BoundType::WEAK, 3.0, BoundType::WEAK), map.at(z));
+}
+
+TEST(Propagation, Conflict)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Propagation p({
+		Constraint<Poly>(Poly(x)*x + Poly(y)*y - Rational(1), Relation::LEQ),
+		Constraint<Poly>(Poly(x) - Rational(2), Relation::GEQ),
+	});
+	IntervalBox<double> box;
+	EXPECT_FALSE(p.propagate(box));
+	std::size_t conflicts = 0;
+	for (const auto& c: p.contractors()) conflicts += c.statistics.conflicts;
+	EXPECT_EQ(1u, conflicts);
+}
+
+TEST(Propagation, Newton)
+{
+	Variable x = freshRealVariable("x");
+	contractor::PropagationSettings settings;
+	settings.epsilon = 1e-6;
+	Propagation p({
+		Constraint<Poly>(Poly(x)*x - Rational(2), Relation::EQ)
+	}, settings);
+	ASSERT_EQ(2u, p.contractors().size());
+	IntervalBox<double> box;
+	box.set(x, Interval<double>(1, 2));
+	EXPECT_TRUE(p.propagate(box));
+	EXPECT_TRUE(box.at(x).contains(std::sqrt(2.0)));
+	EXPECT_LT(box.at(x).diameter(), 1e-6);
+	std::size_t calls = 0;
+	for (const auto& c: p.contractors()) calls += c.statistics.calls;
+	EXPECT_EQ(p.iterations(), calls);
+}
+
+TEST(Propagation, Budget)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	contractor::PropagationSettings settings;
+	settings.epsilon = 0;
+	settings.maxIterations = 5;
+	// Every contraction halves one of the intervals, hence this only converges to the origin in the limit.
+	Propagation p({
+		Constraint<Poly>(Rational(2)*x - y, Relation::EQ),
+		Constraint<Poly>(Rational(2)*y - x, Relation::EQ)
+	}, settings);
+	IntervalBox<double> box;
+	box.set(x, Interval<double>(-1, 1));
+	box.set(y, Interval<double>(-1, 1));
+	EXPECT_TRUE(p.propagate(box));
+	EXPECT_TRUE(p.budgetExhausted());
+	EXPECT_EQ(5u, p.iterations());
+	EXPECT_TRUE(box.at(x).contains(0.0));
+	EXPECT_TRUE(box.at(y).contains(0.0));
+	EXPECT_LT(box.at(x).diameter() + box.at(y).diameter(), 4.0);
+}
+
+TEST(Propagation, Incremental)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Propagation p({
+		Constraint<Poly>(Poly(x) - y, Relation::EQ)
+	});
+	IntervalBox<double> box;
+	box.set(x, Interval<double>(0, 10));
+	box.set(y, Interval<double>(0, 10));
+	EXPECT_TRUE(p.propagate(box));
+	EXPECT_EQ(Interval<double>(0, 10), box.at(y));
+	// Branch on x.
+	IntervalBox<double> left = box;
+	left.clearChanged();
+	left.set(x, Interval<double>(0, 5));
+	EXPECT_TRUE(p.propagateChanged(left));
+	EXPECT_EQ(Interval<double>(0, 5), left.at(y));
+	EXPECT_EQ(Interval<double>(0, 10), box.at(y));
+}
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/formula/parser/SMTLIBParser.h>
+#include <carl/io/BinaryStream.h>
+#include <carl/numbers/numbers.h>
+
+#include <sstream>
+#include <string>
+
+#include "Generators.h"
+
+/*
+ * Writing and reading the formulas of the SMTLIBParser_LRA benchmark in the binary format.
+ */
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using Parser = carl::SMTLIBParser<MVP>;
+
+namespace {
+	std::vector<carl::Formula<MVP>> assertions(std::size_t n) {
+		std::string input = benchmarks::smtlibScript(n);
+		Parser parser(input.data(), input.size());
+		Parser::Command cmd;
+		std::vector<carl::Formula<MVP>> res;
+		while (parser.next(cmd)) {
+			if (cmd.type == Parser::Command::Type::ASSERT) res.push_back(cmd.formula);
+		}
+		return res;
+	}
+	std::string binary(const std::vector<carl::Formula<MVP>>& formulas) {
+		std::stringstream ss;
+		carl::serialization::BinaryWriter<MVP> writer(ss);
+		for (const auto& f: formulas) writer << f;
+		return ss.str();
+	}
+}
+
+static void BinaryStream_Write(benchmark::State& state) {
+	auto formulas = assertions(std::size_t(state.range(0)));
+	std::size_t size = 0;
+	for (auto _ : state) {
+		size = binary(formulas).size();
+		benchmark::DoNotOptimize(size);
+	}
+	state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(size));
+}
+BENCHMARK(BinaryStream_Write)->Arg(1000)->Arg(10000);
+
+static void BinaryStream_Read(benchmark::State& state) {
+	std::string input = binary(assertions(std::size_t(state.range(0))));
+	for (auto _ : state) {
+		carl::serialization::BinaryReader<MVP> reader(input.data(), input.data() + input.size());
+		std::size_t n = 0;
+		while (reader.next()) n++;
+		benchmark::DoNotOptimize(n);
+	}
+	state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(input.size()));
+	state.counters["text_ratio"] = double(benchmarks::smtlibScript(std::size_t(state.range(0))).size()) / double(input.size());
+}
+BENCHMARK(BinaryStream_Read)->Arg(1000)->Arg(10000);
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/cad/CAD.h>
+#include <carl/cad/Constraint.h>
+#include <carl/numbers/numbers.h>
+
+/*
+ * Complete CAD checks on the standard problems from the CAD tests, from projection to lifting.
+ */
+
+using Poly = carl::CAD<mpq_class>::MPolynomial;
+using CADConstraint = carl::cad::Constraint<mpq_class>;
+
+namespace {
+	struct Problem {
+		std::vector<carl::Variable> variables;
+		std::vector<Poly> polynomials;
+		std::vector<carl::Sign> signs;
+	};
+
+	Problem problem(int id) {
+		static carl::Variable x = carl::freshRealVariable("x");
+		static carl::Variable y = carl::freshRealVariable("y");
+		static carl::Variable z = carl::freshRealVariable("z");
+		static carl::Variable w = carl::freshRealVariable("w");
+		switch (id) {
+			// x^2 + y^2 = 1, x + 1 = y, satisfiable with rational points.
+			case 0: return Problem{ {x, y}, { Poly(x)*x + Poly(y)*y - mpq_class(1), Poly(x) + mpq_class(1) - y }, { carl::Sign::ZERO, carl::Sign::ZERO } };
+			// x^2 + y^2 = 1, x = y, satisfiable with irrational points.
+			case 1: return Problem{ {x, y}, { Poly(x)*x + Poly(y)*y - mpq_class(1), Poly(x) - y }, { carl::Sign::ZERO, carl::Sign::ZERO } };
+			// x^2 + y^2 + z^2 < 1, x^2 + y^2 > 0, z^3 > 1/2.
+			case 2: return Problem{ {x, y, z},
+				{ Poly(x)*x + Poly(y)*y + Poly(z)*z - mpq_class(1), Poly(x)*x + Poly(y)*y, Poly(z)*z*z - mpq_class(1, 2) },
+				{ carl::Sign::NEGATIVE, carl::Sign::POSITIVE, carl::Sign::POSITIVE } };
+			// x^2 + y^2 < 0, x^3 + y^3 + z^3 = 1, unsatisfiable.
+			case 3: return Problem{ {x, y, z},
+				{ Poly(x)*x + Poly(y)*y, Poly(x)*x*x + Poly(y)*y*y + Poly(z)*z*z - mpq_class(1) },
+				{ carl::Sign::NEGATIVE, carl::Sign::ZERO } };
+			// x^2 < 2, y^2 = 2, z^2 > 2, w^2 = 2.
+			default: return Problem{ {x, y, z, w},
+				{ Poly(x)*x - mpq_class(2), Poly(y)*y - mpq_class(2), Poly(z)*z - mpq_class(2), Poly(w)*w - mpq_class(2) },
+				{ carl::Sign::NEGATIVE, carl::Sign::ZERO, carl::Sign::POSITIVE, carl::Sign::ZERO } };
+		}
+	}
+}
+
+static void CAD_Check(benchmark::State& state) {
+	Problem pr = problem(int(state.range(0)));
+	for (auto _ : state) {
+		carl::CAD<mpq_class> cad;
+		std::vector<CADConstraint> constraints;
+		for (std::size_t i = 0; i < pr.polynomials.size(); ++i) {
+			cad.addPolynomial(pr.polynomials[i], pr.variables);
+			constraints.emplace_back(pr.polynomials[i], pr.signs[i], pr.variables);
+		}
+		cad.prepareElimination();
+		carl::RealAlgebraicPoint<mpq_class> r;
+		carl::CAD<mpq_class>::BoundMap bounds;
+		benchmark::DoNotOptimize(cad.check(constraints, r, bounds));
+	}
+}
+BENCHMARK(CAD_Check)->DenseRange(0, 4)->ArgName("problem")->Unit(benchmark::kMillisecond);
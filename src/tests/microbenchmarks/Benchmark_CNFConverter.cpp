@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/formula/CNFConverter.h>
+#include <carl/numbers/numbers.h>
+
+#include <random>
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using FormulaT = carl::Formula<MVP>;
+
+namespace {
+    /// A conjunction of random Boolean combinations that share subformulas.
+    FormulaT formula(std::size_t conjuncts) {
+        std::mt19937 rand(42);
+        std::vector<FormulaT> pool;
+        for (std::size_t i = 0; i < 100; ++i) pool.emplace_back(carl::freshBooleanVariable());
+        auto pick = [&]() { return pool[rand() % pool.size()]; };
+        carl::Formulas<MVP> res;
+        for (std::size_t i = 0; i < conjuncts; ++i) {
+            switch (rand() % 4) {
+                case 0: pool.push_back(FormulaT(carl::AND, {pick(), pick().negated()})); break;
+                case 1: pool.push_back(FormulaT(carl::OR, {pick(), pick(), pick()})); break;
+                case 2: pool.push_back(FormulaT(carl::IFF, {pick(), pick()})); break;
+                case 3: pool.push_back(FormulaT(carl::ITE, pick(), pick(), pick())); break;
+            }
+            res.push_back(FormulaT(carl::OR, {pool.back(), pick()}));
+        }
+        return FormulaT(carl::AND, std::move(res));
+    }
+}
+
+static void CNF_toCNF(benchmark::State& state) {
+    FormulaT f = formula(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f.toCNF());
+    }
+}
+// Formula::toCNF() unfolds shared subformulas, larger instances do not finish in reasonable time.
+BENCHMARK(CNF_toCNF)->Arg(200)->Unit(benchmark::kMillisecond);
+
+static void CNF_Converter(benchmark::State& state) {
+    FormulaT f = formula(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        carl::CNFConverter<MVP> converter;
+        benchmark::DoNotOptimize(converter.convert(f).size());
+    }
+}
+BENCHMARK(CNF_Converter)->Arg(200)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void CNF_ConverterToFormula(benchmark::State& state) {
+    FormulaT f = formula(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        carl::CNFConverter<MVP> converter;
+        benchmark::DoNotOptimize(converter.toCNF(f));
+    }
+}
+BENCHMARK(CNF_ConverterToFormula)->Arg(200)->Arg(10000)->Unit(benchmark::kMillisecond);
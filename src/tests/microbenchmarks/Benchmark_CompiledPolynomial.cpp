@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/CompiledPolynomial.h>
+#include <carl/interval/IntervalEvaluation.h>
+#include <carl/numbers/numbers.h>
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+
+class CompiledPolynomial_Fixture: public benchmark::Fixture {
+public:
+    carl::Variable x = carl::freshRealVariable("x");
+    carl::Variable y = carl::freshRealVariable("y");
+    carl::Variable z = carl::freshRealVariable("z");
+    MVP p = mpq_class(3)*x*x*y - mpq_class(1,2)*y*z*z*z + MVP(x)*x*z*z + mpq_class(7)*y*z - mpq_class(5)*x + mpq_class(1);
+    carl::CompiledPolynomial<MVP> cp = carl::CompiledPolynomial<MVP>(p);
+};
+
+BENCHMARK_F(CompiledPolynomial_Fixture, Interval_Map)(benchmark::State& state) {
+    std::map<carl::Variable, carl::Interval<double>> map = {
+        {x, carl::Interval<double>(-1, 2)}, {y, carl::Interval<double>(0, 1)}, {z, carl::Interval<double>(-3, -1)}
+    };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carl::IntervalEvaluation::evaluate(p, map));
+    }
+}
+
+BENCHMARK_F(CompiledPolynomial_Fixture, Interval_Compiled)(benchmark::State& state) {
+    auto eval = cp.evaluator<carl::Interval<double>>();
+    std::vector<carl::Interval<double>> point = {
+        carl::Interval<double>(-1, 2), carl::Interval<double>(0, 1), carl::Interval<double>(-3, -1)
+    };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(eval(point));
+    }
+}
+
+BENCHMARK_F(CompiledPolynomial_Fixture, Double_Compiled)(benchmark::State& state) {
+    auto eval = cp.evaluator<double>();
+    std::vector<double> point = { 0.5, -1.25, 3.0 };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(eval(point));
+    }
+}
+
+BENCHMARK_F(CompiledPolynomial_Fixture, Double_Batch)(benchmark::State& state) {
+    auto eval = cp.evaluator<double>();
+    std::vector<double> points;
+    for (int i = 0; i < 1024; ++i) {
+        points.insert(points.end(), { i / 1024.0, 1.0 - i / 512.0, i / 256.0 });
+    }
+    std::vector<double> results;
+    for (auto _ : state) {
+        eval(points, results);
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/formula/parser/DIMACSImporter.h>
+#include <carl/numbers/numbers.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+
+namespace {
+    /// Writes a random 3-SAT instance and returns its size in bytes.
+    std::size_t write3SAT(const std::string& filename, std::size_t variables, std::size_t clauses) {
+        std::ofstream out(filename);
+        out << "p cnf " << variables << " " << clauses << "\n";
+        std::size_t seed = 1;
+        for (std::size_t i = 0; i < clauses * 3; ++i) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            long lit = long((seed >> 33) % variables) + 1;
+            out << ((seed >> 20) & 1 ? -lit : lit) << ((i % 3 == 2) ? " 0\n" : " ");
+        }
+        return std::size_t(out.tellp());
+    }
+}
+
+static void DIMACSImporter_Clauses(benchmark::State& state) {
+    std::string filename = "carl_benchmark_dimacs.cnf";
+    std::size_t bytes = write3SAT(filename, 100000, 2000000);
+    for (auto _ : state) {
+        carl::DIMACSImporter<MVP> importer(filename, std::size_t(state.range(0)));
+        benchmark::DoNotOptimize(importer.nextClauses().size());
+    }
+    std::remove(filename.c_str());
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(bytes));
+}
+BENCHMARK(DIMACSImporter_Clauses)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+
+static void DIMACSImporter_Formula(benchmark::State& state) {
+    std::string filename = "carl_benchmark_dimacs_formula.cnf";
+    std::size_t bytes = write3SAT(filename, 10000, 200000);
+    for (auto _ : state) {
+        carl::DIMACSImporter<MVP> importer(filename, 1);
+        benchmark::DoNotOptimize(importer.next().size());
+    }
+    std::remove(filename.c_str());
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(bytes));
+}
+BENCHMARK(DIMACSImporter_Formula)->Unit(benchmark::kMillisecond);
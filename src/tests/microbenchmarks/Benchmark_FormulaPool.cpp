@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/formula/Formula.h>
+
+#include "Generators.h"
+
+/*
+ * Construction of constraints and formulas through their pools.
+ * A pool hit only looks up an existing entry, while a pool miss creates and eventually frees the entry.
+ */
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using FormulaT = carl::Formula<MVP>;
+
+namespace {
+	std::vector<MVP> polynomials(std::size_t n) {
+		std::mt19937 rng(42);
+		std::vector<MVP> res;
+		for (std::size_t i = 0; i < n; ++i) {
+			res.push_back(benchmarks::polynomial<MVP>(benchmarks::Shape{ 4, 2, 30, 8 }, rng));
+		}
+		return res;
+	}
+}
+
+static void FormulaPool_ConstraintMiss(benchmark::State& state) {
+	auto polys = polynomials(std::size_t(state.range(0)));
+	for (auto _ : state) {
+		for (const auto& p: polys) {
+			benchmark::DoNotOptimize(FormulaT(p, carl::Relation::LEQ));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(FormulaPool_ConstraintMiss)->Arg(1000)->ArgName("n")->Unit(benchmark::kMicrosecond);
+
+static void FormulaPool_ConstraintHit(benchmark::State& state) {
+	auto polys = polynomials(std::size_t(state.range(0)));
+	std::vector<FormulaT> alive;
+	for (const auto& p: polys) alive.emplace_back(p, carl::Relation::LEQ);
+	for (auto _ : state) {
+		for (const auto& p: polys) {
+			benchmark::DoNotOptimize(FormulaT(p, carl::Relation::LEQ));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(FormulaPool_ConstraintHit)->Arg(1000)->ArgName("n")->Unit(benchmark::kMicrosecond);
+
+/// Builds binary conjunctions and disjunctions of existing atoms, which are freed again after every iteration.
+static void FormulaPool_Connectives(benchmark::State& state) {
+	auto polys = polynomials(std::size_t(state.range(0)));
+	std::vector<FormulaT> atoms;
+	for (const auto& p: polys) atoms.emplace_back(p, carl::Relation::LESS);
+	for (auto _ : state) {
+		for (std::size_t i = 1; i < atoms.size(); ++i) {
+			benchmark::DoNotOptimize(FormulaT(carl::AND, atoms[i - 1], atoms[i]));
+			benchmark::DoNotOptimize(FormulaT(carl::OR, atoms[i - 1], atoms[i].negated()));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * 2 * (state.range(0) - 1));
+}
+BENCHMARK(FormulaPool_Connectives)->Arg(1000)->ArgName("n")->Unit(benchmark::kMicrosecond);
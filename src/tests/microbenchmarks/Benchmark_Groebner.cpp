@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/groebner/groebner.h>
+#include <carl/groebner/benchmarks/cyclic.h>
+#include <carl/groebner/benchmarks/eco.h>
+#include <carl/groebner/benchmarks/katsura.h>
+#include <carl/groebner/benchmarks/noon.h>
+#include <carl/groebner/benchmarks/random.h>
+#include <carl/numbers/numbers.h>
+
+#ifndef BUCHBERGER_STATISTICS
+#error "The Groebner benchmarks require BUCHBERGER_STATISTICS for their reduction counters."
+#endif
+
+/*
+ * Groebner basis benchmarks on standard problem families.
+ *
+ * Every benchmark reports the size of the basis, the number of reductions, zero reductions and the peak number of
+ * terms as counters. The latter are collected by BUCHBERGER_STATISTICS, which the build defines for this target.
+ * Run with --benchmark_filter=GB_ --benchmark_format=json to obtain a machine-readable report,
+ * the make target run-groebner-benchmarks writes such a report to groebner-benchmarks.json.
+ */
+
+struct Cyclic {
+	template<typename C, typename O, typename P>
+	static std::vector<carl::MultivariatePolynomial<C, O, P>> generate(unsigned n) {
+		return carl::benchmarks::cyclic<C, O, P>(n);
+	}
+};
+struct Katsura {
+	template<typename C, typename O, typename P>
+	static std::vector<carl::MultivariatePolynomial<C, O, P>> generate(unsigned n) {
+		return carl::benchmarks::katsura<C, O, P>(n);
+	}
+};
+struct Eco {
+	template<typename C, typename O, typename P>
+	static std::vector<carl::MultivariatePolynomial<C, O, P>> generate(unsigned n) {
+		return carl::benchmarks::eco<C, O, P>(n);
+	}
+};
+struct Noon {
+	template<typename C, typename O, typename P>
+	static std::vector<carl::MultivariatePolynomial<C, O, P>> generate(unsigned n) {
+		return carl::benchmarks::noon<C, O, P>(n);
+	}
+};
+/// Dense random quadratic systems with n variables and n polynomials.
+struct RandomDense {
+	template<typename C, typename O, typename P>
+	static std::vector<carl::MultivariatePolynomial<C, O, P>> generate(unsigned n) {
+		return carl::benchmarks::randomSystem<C, O, P>(n, n, 2, 1.0);
+	}
+};
+/// Sparse random cubic systems with n variables and n polynomials.
+struct RandomSparse {
+	template<typename C, typename O, typename P>
+	static std::vector<carl::MultivariatePolynomial<C, O, P>> generate(unsigned n) {
+		return carl::benchmarks::randomSystem<C, O, P>(n, n, 3, 0.2);
+	}
+};
+
+template<typename Family, typename Coeff, typename Ordering, template<typename> class Adding>
+static void GB_Buchberger(benchmark::State& state) {
+	using Poly = carl::MultivariatePolynomial<Coeff, Ordering>;
+	auto input = Family::template generate<Coeff, Ordering, carl::StdMultivariatePolynomialPolicies<>>(unsigned(state.range(0)));
+	std::size_t basisSize = 0;
+	auto& stats = *carl::BuchbergerStats::getInstance();
+	stats.reset();
+	for (auto _ : state) {
+		carl::GBProcedure<Poly, carl::Buchberger, Adding> gb;
+		for (const auto& p: input) {
+			gb.addPolynomial(p);
+		}
+		gb.reduceInput();
+		gb.calculate();
+		basisSize = gb.getIdeal().nrGenerators();
+		benchmark::DoNotOptimize(basisSize);
+	}
+	auto iterations = double(state.iterations());
+	state.counters["reductions"] = double(stats.getNrReductions()) / iterations;
+	state.counters["zero_reductions"] = double(stats.getNrZeroReductions()) / iterations;
+	state.counters["peak_terms"] = double(stats.getPeakTermCount());
+	state.counters["basis_size"] = double(basisSize);
+}
+
+#define GB_BENCHMARK(FAMILY, COEFF, ORDERING, ADDING, FROM, TO) \
+	BENCHMARK_TEMPLATE(GB_Buchberger, FAMILY, COEFF, carl::ORDERING, carl::ADDING)->DenseRange(FROM, TO)->Unit(benchmark::kMillisecond)->UseRealTime()
+
+GB_BENCHMARK(Cyclic, mpq_class, GrLexOrdering, StdAdding, 3, 5);
+GB_BENCHMARK(Cyclic, mpq_class, GrLexOrdering, RealRadicalAwareAdding, 3, 5);
+GB_BENCHMARK(Katsura, mpq_class, GrLexOrdering, StdAdding, 3, 5);
+GB_BENCHMARK(Katsura, mpq_class, GrLexOrdering, RealRadicalAwareAdding, 3, 5);
+GB_BENCHMARK(Eco, mpq_class, GrLexOrdering, StdAdding, 4, 6);
+GB_BENCHMARK(Noon, mpq_class, GrLexOrdering, StdAdding, 3, 4);
+GB_BENCHMARK(RandomDense, mpq_class, GrLexOrdering, StdAdding, 2, 3);
+GB_BENCHMARK(RandomSparse, mpq_class, GrLexOrdering, StdAdding, 3, 3);
+
+// LexOrdering compares exponents of the same variable inversely (x^2 < x) and is thus not a monomial ordering.
+// The Buchberger procedure only terminates on small instances, hence larger ones are not part of the suite.
+GB_BENCHMARK(Cyclic, mpq_class, LexOrdering, StdAdding, 3, 3);
+
+#ifdef USE_CLN_NUMBERS
+GB_BENCHMARK(Cyclic, cln::cl_RA, GrLexOrdering, StdAdding, 3, 5);
+GB_BENCHMARK(Katsura, cln::cl_RA, GrLexOrdering, StdAdding, 3, 5);
+GB_BENCHMARK(Eco, cln::cl_RA, GrLexOrdering, StdAdding, 4, 6);
+#endif
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/HornerSchemes.h>
+#include <carl/core/MultivariateHorner.h>
+#include <carl/interval/IntervalEvaluation.h>
+#include <carl/numbers/numbers.h>
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using Horner = carl::MultivariateHorner<MVP, carl::strategy>;
+
+class HornerSchemes_Fixture: public benchmark::Fixture {
+public:
+    carl::Variable x = carl::freshRealVariable("x");
+    carl::Variable y = carl::freshRealVariable("y");
+    carl::Variable z = carl::freshRealVariable("z");
+    std::vector<MVP> polys;
+    std::map<carl::Variable, carl::Interval<double>> map = {
+        {x, carl::Interval<double>(-1, 2)}, {y, carl::Interval<double>(0, 1)}, {z, carl::Interval<double>(-3, -1)}
+    };
+    HornerSchemes_Fixture() {
+        // A polynomial and its partial derivatives, as used by the interval Newton operator.
+        MVP s = MVP(x) + mpq_class(2)*y - z + mpq_class(1);
+        MVP p = s * s * s * s + MVP(x) * y * z;
+        polys = { p, carl::derivative(p, x), carl::derivative(p, y), carl::derivative(p, z) };
+    }
+};
+
+BENCHMARK_F(HornerSchemes_Fixture, Build_MultivariateHorner)(benchmark::State& state) {
+    for (auto _ : state) {
+        for (const auto& p: polys) {
+            Horner h(p);
+            benchmark::DoNotOptimize(h.getVariable());
+        }
+    }
+}
+
+BENCHMARK_F(HornerSchemes_Fixture, Build_HornerSchemes)(benchmark::State& state) {
+    for (auto _ : state) {
+        carl::HornerSchemes<MVP> schemes;
+        for (const auto& p: polys) {
+            benchmark::DoNotOptimize(schemes.add(p));
+        }
+    }
+}
+
+BENCHMARK_F(HornerSchemes_Fixture, Build_HornerSchemes_MostTerms)(benchmark::State& state) {
+    for (auto _ : state) {
+        carl::HornerSchemes<MVP> schemes(carl::HornerVariableSelection::MOST_TERMS);
+        for (const auto& p: polys) {
+            benchmark::DoNotOptimize(schemes.add(p));
+        }
+    }
+}
+
+BENCHMARK_F(HornerSchemes_Fixture, Evaluate_MultivariateHorner)(benchmark::State& state) {
+    std::vector<Horner> hs;
+    for (const auto& p: polys) hs.emplace_back(p);
+    for (auto _ : state) {
+        for (const auto& h: hs) {
+            benchmark::DoNotOptimize(carl::IntervalEvaluation::evaluate(h, map));
+        }
+    }
+}
+
+BENCHMARK_F(HornerSchemes_Fixture, Evaluate_HornerSchemes)(benchmark::State& state) {
+    carl::HornerSchemes<MVP> schemes;
+    std::vector<carl::HornerSchemes<MVP>::NodeID> roots;
+    for (const auto& p: polys) roots.push_back(schemes.add(p));
+    state.counters["nodes"] = double(schemes.size());
+    state.counters["operations"] = double(schemes.operationCount(roots));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(schemes.evaluate(roots, map));
+    }
+}
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/interval/Interval.h>
+#include <carl/interval/IntervalBatch.h>
+
+#include <random>
+
+class IntervalBatch_Fixture: public benchmark::Fixture {
+public:
+    std::vector<carl::Interval<double>> lhs;
+    std::vector<carl::Interval<double>> rhs;
+    IntervalBatch_Fixture() {
+        std::mt19937 rand(42);
+        std::uniform_real_distribution<double> dist(-10, 10);
+        for (int i = 0; i < 4096; ++i) {
+            double a = dist(rand);
+            double b = dist(rand);
+            lhs.emplace_back(std::min(a, b), std::max(a, b));
+            a = dist(rand);
+            b = dist(rand);
+            rhs.emplace_back(std::min(a, b), std::max(a, b));
+        }
+    }
+};
+
+BENCHMARK_F(IntervalBatch_Fixture, Mul_Interval)(benchmark::State& state) {
+    std::vector<carl::Interval<double>> res(lhs.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            res[i] = lhs[i] * rhs[i] + lhs[i];
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * std::int64_t(lhs.size()));
+}
+
+BENCHMARK_F(IntervalBatch_Fixture, Mul_Batch)(benchmark::State& state) {
+    carl::IntervalBatch a(lhs);
+    carl::IntervalBatch b(rhs);
+    for (auto _ : state) {
+        carl::IntervalBatch res = a * b + a;
+        benchmark::DoNotOptimize(res.lower());
+    }
+    state.SetItemsProcessed(state.iterations() * std::int64_t(lhs.size()));
+}
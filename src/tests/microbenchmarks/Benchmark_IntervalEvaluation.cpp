@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/interval/IntervalEvaluation.h>
+
+#include "Generators.h"
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using IntervalMap = std::map<carl::Variable, carl::Interval<double>>;
+
+/// Evaluates a random polynomial of the given shape on a box, given as a map or as an IntervalBox.
+template<typename Box>
+static void IntervalEvaluation_Random(benchmark::State& state) {
+	auto s = benchmarks::shape(state);
+	std::mt19937 rng(42);
+	MVP p = benchmarks::polynomial<MVP>(s, rng);
+	std::uniform_real_distribution<double> dist(-10, 10);
+	IntervalMap map;
+	for (auto v: benchmarks::variables(s.variables)) {
+		double a = dist(rng);
+		double b = dist(rng);
+		map.emplace(v, carl::Interval<double>(std::min(a, b), std::max(a, b)));
+	}
+	Box box(map);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::IntervalEvaluation::evaluate(p, box));
+	}
+	state.counters["terms"] = double(p.nrTerms());
+}
+BENCHMARK_TEMPLATE(IntervalEvaluation_Random, IntervalMap)
+	->Args({3, 4, 100, 8})->Args({6, 4, 20, 64})->Args({10, 3, 10, 8})
+	->ArgNames(benchmarks::shapeNames());
+BENCHMARK_TEMPLATE(IntervalEvaluation_Random, carl::IntervalBox<double>)
+	->Args({3, 4, 100, 8})->Args({6, 4, 20, 64})->Args({10, 3, 10, 8})
+	->ArgNames(benchmarks::shapeNames());
@@ -0,0 +1,25 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/carlLogging.h>
+
+/// A disabled log statement, as used in hot paths.
+static void Logging_Disabled(benchmark::State& state) {
+    int i = 0;
+    for (auto _ : state) {
+        __CARL_LOG_TRACE("carl.core.monomial", "value " << i);
+        benchmark::DoNotOptimize(++i);
+    }
+}
+BENCHMARK(Logging_Disabled);
+
+/// Asking the Logger for every statement, as the log statements did before caching the level per site.
+static void Logging_DisabledUncached(benchmark::State& state) {
+    int i = 0;
+    for (auto _ : state) {
+        if (carl::logging::logger().visible(carl::logging::LogLevel::LVL_TRACE, "carl.core.monomial")) {
+            benchmark::DoNotOptimize(i);
+        }
+        benchmark::DoNotOptimize(++i);
+    }
+}
+BENCHMARK(Logging_DisabledUncached);
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/formula/Formula.h>
+#include <carl/formula/model/evaluation/IncrementalEvaluation.h>
+#include <carl/formula/model/evaluation/ModelEvaluation.h>
+#include <carl/numbers/numbers.h>
+
+#include <vector>
+
+using Rational = mpq_class;
+using Pol = carl::MultivariatePolynomial<Rational>;
+using FormulaT = carl::Formula<Pol>;
+using ModelT = carl::Model<Rational,Pol>;
+
+namespace {
+    /// A conjunction of x_i * x_{i+1} < 2 and a full assignment.
+    struct Chain {
+        std::vector<carl::Variable> variables;
+        FormulaT formula;
+        ModelT model;
+        explicit Chain(std::size_t size) {
+            for (std::size_t i = 0; i <= size; ++i) {
+                variables.push_back(carl::freshRealVariable());
+                model.assign(variables.back(), Rational(1));
+            }
+            carl::Formulas<Pol> constraints;
+            for (std::size_t i = 0; i < size; ++i) {
+                constraints.emplace_back(Pol(variables[i]) * variables[i + 1] - Rational(2), carl::Relation::LESS);
+            }
+            formula = FormulaT(carl::FormulaType::AND, std::move(constraints));
+        }
+    };
+}
+
+/// Changes a single variable and evaluates the whole formula.
+static void ModelEvaluation_SatisfiedBy(benchmark::State& state) {
+    Chain chain(std::size_t(state.range(0)));
+    std::size_t i = 0;
+    for (auto _ : state) {
+        chain.model.assign(chain.variables[i % chain.variables.size()], Rational(int(i % 3)));
+        benchmark::DoNotOptimize(carl::model::satisfiedBy(chain.formula, chain.model));
+        ++i;
+    }
+}
+BENCHMARK(ModelEvaluation_SatisfiedBy)->Arg(10)->Arg(100)->Arg(1000);
+
+/// Changes a single variable and only re-evaluates the constraints mentioning it.
+static void ModelEvaluation_Incremental(benchmark::State& state) {
+    Chain chain(std::size_t(state.range(0)));
+    carl::model::IncrementalEvaluator<Rational,Pol> evaluator(chain.formula);
+    evaluator.evaluate(chain.model);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        carl::Variable v = chain.variables[i % chain.variables.size()];
+        chain.model.assign(v, Rational(int(i % 3)));
+        benchmark::DoNotOptimize(evaluator.update(chain.model, v));
+        ++i;
+    }
+}
+BENCHMARK(ModelEvaluation_Incremental)->Arg(10)->Arg(100)->Arg(1000);
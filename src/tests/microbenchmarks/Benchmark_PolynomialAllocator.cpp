@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/GCD.h>
+#include <carl/core/polynomialfunctions/Resultant.h>
+#include <carl/numbers/numbers.h>
+
+#include "Generators.h"
+
+/*
+ * Polynomial operations with the different term allocators.
+ * The counting allocator reports the number of allocations per operation, the arena runs every operation in its own
+ * computation arena.
+ */
+
+template<typename Allocator>
+using Poly = carl::MultivariatePolynomial<mpq_class, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<carl::NoReasons, Allocator>>;
+
+struct Multiplication {
+	template<typename P>
+	static auto run(const P& a, const P& b) {
+		return a * b;
+	}
+};
+struct GCD {
+	template<typename P>
+	static auto run(const P& a, const P& b) {
+		return carl::gcd(a, b);
+	}
+};
+struct Resultant {
+	template<typename P>
+	static auto run(const P& a, const P& b) {
+		carl::Variable x = benchmarks::variables(1).front();
+		return carl::resultant(a.toUnivariatePolynomial(x), b.toUnivariatePolynomial(x));
+	}
+};
+
+template<typename Operation, typename Allocator>
+static void Alloc(benchmark::State& state) {
+	using P = Poly<Allocator>;
+	auto s = benchmarks::shape(state);
+	std::mt19937 rng(42);
+	carl::Variable x = benchmarks::variables(1).front();
+	P c = P(benchmarks::polynomial<carl::MultivariatePolynomial<mpq_class>>(s, rng));
+	P a = P(benchmarks::polynomial<carl::MultivariatePolynomial<mpq_class>>(s, rng)) * c + P(x);
+	P b = P(benchmarks::polynomial<carl::MultivariatePolynomial<mpq_class>>(s, rng)) * c;
+	carl::allocation::Counter counter;
+	for (auto _ : state) {
+		if (std::is_same<Allocator, carl::ArenaAllocator>::value) {
+			benchmark::DoNotOptimize(carl::allocation::inArena([&](){ return Operation::run(a, b); }));
+		} else {
+			benchmark::DoNotOptimize(Operation::run(a, b));
+		}
+	}
+	if (std::is_same<Allocator, carl::CountingAllocator>::value) {
+		state.counters["allocations"] = double(counter.allocations()) / double(state.iterations());
+		state.counters["bytes"] = double(counter.bytes()) / double(state.iterations());
+	}
+}
+#define ALLOCATION_BENCHMARK(Operation) \
+	BENCHMARK_TEMPLATE(Alloc, Operation, carl::NoAllocator)->Args({2, 3, 100, 8})->ArgNames(benchmarks::shapeNames())->Unit(benchmark::kMicrosecond); \
+	BENCHMARK_TEMPLATE(Alloc, Operation, carl::CountingAllocator)->Args({2, 3, 100, 8})->ArgNames(benchmarks::shapeNames())->Unit(benchmark::kMicrosecond); \
+	BENCHMARK_TEMPLATE(Alloc, Operation, carl::ArenaAllocator)->Args({2, 3, 100, 8})->ArgNames(benchmarks::shapeNames())->Unit(benchmark::kMicrosecond);
+
+ALLOCATION_BENCHMARK(Multiplication)
+ALLOCATION_BENCHMARK(GCD)
+ALLOCATION_BENCHMARK(Resultant)
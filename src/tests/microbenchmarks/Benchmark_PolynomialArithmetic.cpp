@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/Factorization_univariate.h>
+#include <carl/core/polynomialfunctions/GCD.h>
+#include <carl/core/polynomialfunctions/Resultant.h>
+#include <carl/numbers/numbers.h>
+
+#include "Generators.h"
+
+/*
+ * Polynomial arithmetic on random polynomials, parametrized by the number of variables, the degree, the density in
+ * percent and the bit size of the coefficients.
+ */
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using UPoly = carl::UnivariatePolynomial<mpq_class>;
+
+namespace {
+	/// Makes sure that p has the given degree in x.
+	MVP withDegree(MVP p, carl::Variable x, unsigned degree) {
+		return p + MVP(carl::Term<mpq_class>(1, carl::createMonomial(x, carl::exponent(degree))));
+	}
+}
+
+/// Creates and immediately releases monomials that are not yet in the pool.
+static void Poly_MonomialChurn(benchmark::State& state) {
+	auto vars = benchmarks::variables(std::size_t(state.range(0)));
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<carl::exponent> exp(0, 3);
+	std::vector<std::vector<std::pair<carl::Variable, carl::exponent>>> monomials(1000);
+	for (auto& m: monomials) {
+		// The first variable occurs with an exponent that is not used elsewhere,
+		// hence the monomials are not kept alive by other benchmarks.
+		m.emplace_back(vars[0], carl::exponent(100));
+		for (std::size_t v = 1; v < vars.size(); ++v) {
+			carl::exponent e = exp(rng);
+			if (e > 0) m.emplace_back(vars[v], e);
+		}
+	}
+	for (auto _ : state) {
+		for (const auto& m: monomials) {
+			benchmark::DoNotOptimize(carl::createMonomial(std::vector<std::pair<carl::Variable, carl::exponent>>(m)));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * std::int64_t(monomials.size()));
+}
+BENCHMARK(Poly_MonomialChurn)->Arg(3)->Arg(10)->ArgName("vars");
+
+/// Looks up monomials that are already in the pool.
+static void Poly_MonomialLookup(benchmark::State& state) {
+	auto vars = benchmarks::variables(std::size_t(state.range(0)));
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<carl::exponent> exp(0, 3);
+	std::vector<std::vector<std::pair<carl::Variable, carl::exponent>>> monomials(1000);
+	std::vector<carl::Monomial::Arg> alive;
+	for (auto& m: monomials) {
+		m.emplace_back(vars[0], carl::exponent(1) + exp(rng));
+		for (std::size_t v = 1; v < vars.size(); ++v) {
+			carl::exponent e = exp(rng);
+			if (e > 0) m.emplace_back(vars[v], e);
+		}
+		alive.push_back(carl::createMonomial(std::vector<std::pair<carl::Variable, carl::exponent>>(m)));
+	}
+	for (auto _ : state) {
+		for (const auto& m: monomials) {
+			benchmark::DoNotOptimize(carl::createMonomial(std::vector<std::pair<carl::Variable, carl::exponent>>(m)));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * std::int64_t(monomials.size()));
+}
+BENCHMARK(Poly_MonomialLookup)->Arg(3)->Arg(10)->ArgName("vars");
+
+static void Poly_Multiplication(benchmark::State& state) {
+	auto s = benchmarks::shape(state);
+	std::mt19937 rng(42);
+	MVP a = benchmarks::polynomial<MVP>(s, rng);
+	MVP b = benchmarks::polynomial<MVP>(s, rng);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a * b);
+	}
+	state.counters["terms"] = double(a.nrTerms() + b.nrTerms());
+}
+BENCHMARK(Poly_Multiplication)
+	->Args({3, 4, 100, 8})->Args({3, 4, 100, 256})
+	->Args({6, 4, 20, 8})->Args({6, 4, 20, 256})
+	->Args({10, 3, 10, 64})
+	->ArgNames(benchmarks::shapeNames());
+
+/// Computes the gcd of a*c and b*c for random a, b and c.
+static void Poly_GCD(benchmark::State& state) {
+	auto s = benchmarks::shape(state);
+	std::mt19937 rng(42);
+	MVP c = benchmarks::polynomial<MVP>(s, rng);
+	MVP a = benchmarks::polynomial<MVP>(s, rng) * c;
+	MVP b = benchmarks::polynomial<MVP>(s, rng) * c;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::gcd(a, b));
+	}
+}
+BENCHMARK(Poly_GCD)
+	->Args({1, 6, 100, 8})->Args({1, 6, 100, 64})
+	->Args({2, 2, 100, 8})->Args({3, 2, 50, 8})
+	->ArgNames(benchmarks::shapeNames())
+	->Unit(benchmark::kMicrosecond);
+
+/// Computes the resultant of two random polynomials with respect to their first variable.
+static void Poly_Resultant(benchmark::State& state) {
+	auto s = benchmarks::shape(state);
+	std::mt19937 rng(42);
+	carl::Variable x = benchmarks::variables(1).front();
+	auto a = withDegree(benchmarks::polynomial<MVP>(s, rng), x, s.degree).toUnivariatePolynomial(x);
+	auto b = withDegree(benchmarks::polynomial<MVP>(s, rng), x, s.degree).toUnivariatePolynomial(x);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::resultant(a, b));
+	}
+}
+BENCHMARK(Poly_Resultant)
+	->Args({1, 8, 100, 8})->Args({1, 8, 100, 64})
+	->Args({2, 3, 100, 8})->Args({3, 2, 100, 8})
+	->ArgNames(benchmarks::shapeNames())
+	->Unit(benchmark::kMicrosecond);
+
+/// Factorizes a univariate polynomial with a repeated factor and a linear factor.
+static void Poly_Factorization(benchmark::State& state) {
+	unsigned degree = unsigned(state.range(0));
+	unsigned bits = unsigned(state.range(1));
+	std::mt19937 rng(42);
+	carl::Variable x = benchmarks::variables(1).front();
+	UPoly a = benchmarks::univariate<mpq_class>(x, degree, bits, rng);
+	UPoly b = benchmarks::univariate<mpq_class>(x, degree, bits, rng);
+	UPoly p = a * a * b * UPoly(x, {-3, 2});
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::factorization(p));
+	}
+}
+BENCHMARK(Poly_Factorization)->Args({2, 8})->Args({4, 8})->Args({4, 64})->ArgNames({"deg", "bits"})->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/RationalFunction.h>
+#include <carl/numbers/numbers.h>
+
+using Rational = mpq_class;
+using Pol = carl::MultivariatePolynomial<Rational>;
+using RFunc = carl::RationalFunction<Pol, true>;
+
+namespace {
+    /// Sums up (x^i + i*y) / ((x+1)*(y+1)), where no summand has a common factor.
+    RFunc sum(carl::Variable x, carl::Variable y, std::size_t n) {
+        Pol denominator = (Pol(x) + Rational(1)) * (Pol(y) + Rational(1));
+        RFunc res(Rational(0));
+        for (std::size_t i = 1; i <= n; ++i) {
+            res += RFunc(Pol(x).pow(i) + Rational(i) * y, denominator);
+        }
+        return res;
+    }
+}
+
+/// Eliminates common factors after every addition.
+static void RationalFunction_SumEager(benchmark::State& state) {
+    carl::Variable x = carl::freshRealVariable();
+    carl::Variable y = carl::freshRealVariable();
+    RFunc::deferSimplification = false;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(x, y, std::size_t(state.range(0))).denominator());
+    }
+}
+BENCHMARK(RationalFunction_SumEager)->Arg(4)->Arg(8)->Arg(16);
+
+/// Eliminates common factors only when the denominator is accessed or the threshold is exceeded.
+static void RationalFunction_SumDeferred(benchmark::State& state) {
+    carl::Variable x = carl::freshRealVariable();
+    carl::Variable y = carl::freshRealVariable();
+    RFunc::deferSimplification = true;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(x, y, std::size_t(state.range(0))).denominator());
+    }
+    RFunc::deferSimplification = false;
+}
+BENCHMARK(RationalFunction_SumDeferred)->Arg(4)->Arg(8)->Arg(16);
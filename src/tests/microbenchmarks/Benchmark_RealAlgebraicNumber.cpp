@@ -39,3 +39,18 @@ BENCHMARK_F(RAN_Fixture, RAN_CreateRefineNew)(benchmark::State& state) {
 		ran.refine(true);
 	}
 }
+
+/// Compares the square roots of 2 and of 2 + 10^-k, which needs more refinement the larger k is.
+static void RAN_Compare(benchmark::State& state) {
+	carl::Variable x = carl::freshRealVariable("x");
+	mpq_class eps = mpq_class(1) / carl::pow(mpq_class(10), unsigned(state.range(0)));
+	auto lhs = carl::rootfinder::realRoots(Poly(x, {-2, 0, 1})).back();
+	auto rhs = carl::rootfinder::realRoots(Poly(x, std::vector<mpq_class>{mpq_class(-2 - eps), 0, 1})).back();
+	for (auto _ : state) {
+		// Comparing refines both numbers in place, hence they are recreated every time.
+		auto a = carl::RealAlgebraicNumber<mpq_class>(lhs.getIRPolynomial(), lhs.getInterval());
+		auto b = carl::RealAlgebraicNumber<mpq_class>(rhs.getIRPolynomial(), rhs.getInterval());
+		benchmark::DoNotOptimize(a < b);
+	}
+}
+BENCHMARK(RAN_Compare)->Arg(2)->Arg(10)->Arg(50)->ArgName("k")->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/RecursivePolynomial.h>
+#include <carl/core/polynomialfunctions/GCD.h>
+#include <carl/core/polynomialfunctions/Resultant.h>
+#include <carl/numbers/numbers.h>
+
+#include "Generators.h"
+
+/*
+ * Resultants and gcds in the recursive representation compared to the univariate view on distributed polynomials.
+ * Both variants start from and return distributed polynomials, hence the conversions are part of the measurement.
+ */
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using RPoly = carl::RecursivePolynomial<mpq_class>;
+
+struct Distributed {
+	static MVP resultant(const MVP& a, const MVP& b, carl::Variable x) {
+		return MVP(carl::resultant(a.toUnivariatePolynomial(x), b.toUnivariatePolynomial(x)));
+	}
+	static MVP gcd(const MVP& a, const MVP& b) {
+		return carl::gcd(a, b);
+	}
+};
+struct Recursive {
+	static MVP resultant(const MVP& a, const MVP& b, carl::Variable) {
+		return carl::resultant(RPoly(a), RPoly(b)).toMultivariatePolynomial<MVP>();
+	}
+	static MVP gcd(const MVP& a, const MVP& b) {
+		return carl::gcd(RPoly(a), RPoly(b)).toMultivariatePolynomial<MVP>();
+	}
+};
+
+/// Computes the resultant with respect to the largest variable, which is the main variable of the recursive form.
+template<typename Representation>
+static void Recursive_Resultant(benchmark::State& state) {
+	auto s = benchmarks::shape(state);
+	std::mt19937 rng(42);
+	carl::Variable x = benchmarks::variables(s.variables).back();
+	MVP a = benchmarks::polynomial<MVP>(s, rng) + MVP(carl::Term<mpq_class>(1, x, carl::exponent(s.degree)));
+	MVP b = benchmarks::polynomial<MVP>(s, rng) + MVP(carl::Term<mpq_class>(1, x, carl::exponent(s.degree)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(Representation::resultant(a, b, x));
+	}
+}
+BENCHMARK_TEMPLATE(Recursive_Resultant, Distributed)
+	->Args({2, 3, 100, 8})->Args({3, 2, 100, 8})->Args({3, 3, 50, 8})
+	->ArgNames(benchmarks::shapeNames())
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(Recursive_Resultant, Recursive)
+	->Args({2, 3, 100, 8})->Args({3, 2, 100, 8})->Args({3, 3, 50, 8})
+	->ArgNames(benchmarks::shapeNames())
+	->Unit(benchmark::kMicrosecond);
+
+/// Computes the gcd of a*c and b*c for random a, b and c.
+template<typename Representation>
+static void Recursive_GCD(benchmark::State& state) {
+	auto s = benchmarks::shape(state);
+	std::mt19937 rng(42);
+	MVP c = benchmarks::polynomial<MVP>(s, rng);
+	MVP a = benchmarks::polynomial<MVP>(s, rng) * c;
+	MVP b = benchmarks::polynomial<MVP>(s, rng) * c;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(Representation::gcd(a, b));
+	}
+}
+BENCHMARK_TEMPLATE(Recursive_GCD, Distributed)
+	->Args({2, 2, 100, 8})->Args({3, 2, 50, 8})
+	->ArgNames(benchmarks::shapeNames())
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(Recursive_GCD, Recursive)
+	->Args({2, 2, 100, 8})->Args({3, 2, 50, 8})
+	->ArgNames(benchmarks::shapeNames())
+	->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/Resultant.h>
+#include <carl/numbers/numbers.h>
+#include <carl/util/ResultStore.h>
+
+#include <cstdio>
+#include <filesystem>
+
+#include "Generators.h"
+
+/*
+ * Resultants that are computed compared to resultants that are found in the persistent result store.
+ */
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+
+static void Stored_Resultant(benchmark::State& state) {
+	bool stored = state.range(0) != 0;
+	benchmarks::Shape s{ std::size_t(state.range(1)), unsigned(state.range(2)), 100, 8 };
+	std::mt19937 rng(42);
+	carl::Variable x = benchmarks::variables(1).front();
+	auto a = benchmarks::polynomial<MVP>(s, rng).toUnivariatePolynomial(x);
+	auto b = benchmarks::polynomial<MVP>(s, rng).toUnivariatePolynomial(x);
+	std::string filename = (std::filesystem::temp_directory_path() / "carl_benchmark_resultstore").string();
+	std::remove(filename.c_str());
+	if (stored) {
+		carl::ResultStore::activate(std::make_unique<carl::ResultStore>(filename));
+		carl::resultant(a, b);
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::resultant(a, b));
+	}
+	carl::ResultStore::activate(nullptr);
+	std::remove(filename.c_str());
+}
+BENCHMARK(Stored_Resultant)
+	->Args({0, 2, 3})->Args({1, 2, 3})->Args({0, 3, 3})->Args({1, 3, 3})
+	->ArgNames({"stored", "vars", "deg"})
+	->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/rootfinder/RootFinder.h>
+#include <carl/formula/model/ran/RealAlgebraicNumber.h>
+
+#include "Generators.h"
+
+using UPoly = carl::UnivariatePolynomial<mpq_class>;
+
+/// Isolates the real roots of a random polynomial, parametrized by the degree and the bit size of the coefficients.
+static void RootIsolation_Random(benchmark::State& state) {
+	std::mt19937 rng(42);
+	carl::Variable x = benchmarks::variables(1).front();
+	UPoly p = benchmarks::univariate<mpq_class>(x, unsigned(state.range(0)), unsigned(state.range(1)), rng);
+	std::size_t roots = 0;
+	for (auto _ : state) {
+		roots = carl::rootfinder::realRoots(p).size();
+		benchmark::DoNotOptimize(roots);
+	}
+	state.counters["roots"] = double(roots);
+}
+BENCHMARK(RootIsolation_Random)
+	->Args({5, 8})->Args({10, 8})->Args({10, 64})->Args({20, 8})
+	->ArgNames({"deg", "bits"})
+	->Unit(benchmark::kMicrosecond);
+
+/// Isolates the roots of a product of linear factors, i.e. many rational roots that are close to each other.
+static void RootIsolation_Wilkinson(benchmark::State& state) {
+	carl::Variable x = benchmarks::variables(1).front();
+	UPoly p(x, {1});
+	for (long i = 1; i <= state.range(0); ++i) {
+		p *= UPoly(x, {-i, 1});
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::rootfinder::realRoots(p));
+	}
+}
+BENCHMARK(RootIsolation_Wilkinson)->Arg(5)->Arg(10)->Arg(20)->ArgName("deg")->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,24 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/formula/parser/SMTLIBParser.h>
+#include <carl/numbers/numbers.h>
+
+#include <string>
+
+#include "Generators.h"
+
+using MVP = carl::MultivariatePolynomial<mpq_class>;
+using Parser = carl::SMTLIBParser<MVP>;
+
+static void SMTLIBParser_LRA(benchmark::State& state) {
+    std::string input = benchmarks::smtlibScript(std::size_t(state.range(0)));
+    for (auto _ : state) {
+        Parser parser(input.data(), input.size());
+        Parser::Command cmd;
+        std::size_t n = 0;
+        while (parser.next(cmd)) n++;
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(input.size()));
+}
+BENCHMARK(SMTLIBParser_LRA)->Arg(1000)->Arg(10000);
@@ -0,0 +1,122 @@
+#pragma once
+
+/*
+ * Parametrized generators for the microbenchmarks.
+ *
+ * Random inputs are described by a Shape: the number of variables, the maximal total degree, the density, i.e. the
+ * probability for every monomial up to the degree to occur, and the bit size of the coefficients. All generators are
+ * deterministic for a given seed, hence the benchmarks measure the same inputs on every run and on every machine.
+ */
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/VariablePool.h>
+#include <carl/numbers/numbers.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cassert>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace benchmarks {
+
+struct Shape {
+	std::size_t variables;
+	unsigned degree;
+	/// Density in percent, as benchmark arguments are integers.
+	unsigned density;
+	unsigned coefficientBits;
+};
+
+/// Reads a shape from the first four arguments of a benchmark.
+inline Shape shape(const benchmark::State& state) {
+	return Shape{ std::size_t(state.range(0)), unsigned(state.range(1)), unsigned(state.range(2)), unsigned(state.range(3)) };
+}
+
+/// Names of the arguments of benchmarks that are parametrized by a shape.
+inline std::vector<std::string> shapeNames() {
+	return { "vars", "deg", "density", "bits" };
+}
+
+/// Returns the first n variables of a pool that is shared by all benchmarks, such that repeated runs do not create new variables.
+inline std::vector<carl::Variable> variables(std::size_t n) {
+	static std::vector<carl::Variable> pool;
+	while (pool.size() < n) {
+		pool.push_back(carl::freshRealVariable("b" + std::to_string(pool.size())));
+	}
+	return std::vector<carl::Variable>(pool.begin(), pool.begin() + std::ptrdiff_t(n));
+}
+
+/// Returns a nonzero integer coefficient with exactly the given number of bits and a random sign.
+template<typename C>
+C coefficient(unsigned bits, std::mt19937& rng) {
+	assert(bits > 0);
+	C res(1);
+	for (unsigned b = 1; b < bits; ++b) {
+		res = res * 2 + C(int(rng() & 1));
+	}
+	return (rng() & 1) ? C(-res) : res;
+}
+
+/// Returns a random polynomial of the given shape in the first variables of the shared pool.
+template<typename Poly>
+Poly polynomial(const Shape& s, std::mt19937& rng) {
+	assert(s.variables > 0);
+	using C = typename Poly::CoeffType;
+	auto vars = variables(s.variables);
+	std::bernoulli_distribution keep(double(s.density) / 100);
+	std::vector<carl::exponent> exps(s.variables, 0);
+	Poly res;
+	// Enumerates all exponent vectors with total degree at most s.degree.
+	auto visit = [&](std::size_t var, unsigned remaining, const auto& self) -> void {
+		if (var == s.variables) {
+			if (!keep(rng)) return;
+			std::vector<std::pair<carl::Variable, carl::exponent>> m;
+			for (std::size_t v = 0; v < s.variables; ++v) {
+				if (exps[v] > 0) m.emplace_back(vars[v], exps[v]);
+			}
+			C c = coefficient<C>(s.coefficientBits, rng);
+			if (m.empty()) res += c;
+			else res += carl::Term<C>(c, carl::createMonomial(std::move(m)));
+			return;
+		}
+		for (unsigned e = 0; e <= remaining; ++e) {
+			exps[var] = e;
+			self(var + 1, remaining - e, self);
+		}
+		exps[var] = 0;
+	};
+	visit(0, s.degree, visit);
+	if (res.isConstant()) {
+		// Every polynomial should actually depend on some variable.
+		res += vars.front();
+	}
+	return res;
+}
+
+/// Returns a random univariate polynomial of exactly the given degree, where every coefficient has the given bit size.
+template<typename C>
+carl::UnivariatePolynomial<C> univariate(carl::Variable x, unsigned degree, unsigned bits, std::mt19937& rng) {
+	std::vector<C> coeffs;
+	for (unsigned d = 0; d <= degree; ++d) {
+		coeffs.push_back(coefficient<C>(bits, rng));
+	}
+	return carl::UnivariatePolynomial<C>(x, coeffs);
+}
+
+/// A QF_LRA script with many linear constraints, some of them sharing subterms via let.
+inline std::string smtlibScript(std::size_t assertions) {
+	std::string res = "(set-logic QF_LRA)\n";
+	for (std::size_t i = 0; i < 20; ++i) res += "(declare-fun x" + std::to_string(i) + " () Real)\n";
+	for (std::size_t i = 0; i < assertions; ++i) {
+		std::string a = "x" + std::to_string(i % 20);
+		std::string b = "x" + std::to_string((i * 7 + 3) % 20);
+		std::string c = std::to_string(i % 97);
+		res += "(assert (let ((s (+ " + a + " (* 3 " + b + ") (- " + c + ".5)))) (or (< s " + c + ") (and (>= s (- " + b + " 1)) (not (= " + a + " " + b + "))))))\n";
+	}
+	return res + "(check-sat)\n(exit)\n";
+}
+
+}
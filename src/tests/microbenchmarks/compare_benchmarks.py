@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+
+"""
+Compares two Google Benchmark JSON reports and flags regressions.
+
+Both reports should be obtained with repetitions and aggregates, as done by the make target run-benchmarks.
+A benchmark regresses if its mean time increases by more than the threshold and by more than the noise. The noise is
+a number of standard errors of the difference of the means, estimated from the standard deviations of the repetitions
+in both reports. Benchmarks without repetitions only use the threshold.
+
+The reports are usually recorded on different machines, hence times are compared relative to the run they belong to:
+the change of every benchmark is divided by the geometric mean of the changes of all common benchmarks, which is the
+speed of the current machine relative to the baseline. This does not detect regressions affecting all benchmarks
+alike, use --absolute to compare reports recorded on the same machine.
+
+With --update, the current report is written to the baseline instead, without the context specific to the machine.
+
+Exits with 1 if some benchmark regressed, 0 otherwise.
+"""
+
+import argparse
+import json
+import math
+import sys
+
+def load(filename, metric):
+	"""Returns a dict from benchmark names to (mean, relative standard error of the mean, time unit)."""
+	with open(filename) as f:
+		report = json.load(f)
+	means = {}
+	errors = {}
+	units = {}
+	for b in report["benchmarks"]:
+		if b.get("error_occurred"):
+			continue
+		name = b.get("run_name", b["name"])
+		kind = b.get("aggregate_name")
+		if kind == "mean" or kind is None:
+			means.setdefault(name, b[metric])
+			units.setdefault(name, b.get("time_unit", "ns"))
+		elif kind == "stddev":
+			errors[name] = b[metric] / math.sqrt(max(b.get("repetitions", 1), 1))
+	res = {}
+	for name, mean in means.items():
+		error = errors[name] / mean if name in errors and mean > 0 else 0.0
+		res[name] = (mean, error, units[name])
+	return res
+
+# Context entries that only describe the machine and the run a report was recorded on.
+MACHINE_CONTEXT = ["date", "host_name", "executable", "load_avg"]
+
+def update(baseline, current):
+	"""Writes the current report to the baseline without the context specific to the machine."""
+	with open(current) as f:
+		report = json.load(f)
+	for key in MACHINE_CONTEXT:
+		report.get("context", {}).pop(key, None)
+	with open(baseline, "w") as f:
+		json.dump(report, f, indent = 2)
+		f.write("\n")
+
+def common(baseline, current):
+	"""Yields (name, baseline, current) for all benchmarks that are comparable."""
+	for name in sorted(baseline):
+		if name not in current:
+			continue
+		if baseline[name][0] <= 0 or current[name][0] <= 0 or baseline[name][2] != current[name][2]:
+			continue
+		yield name, baseline[name], current[name]
+
+def speed(baseline, current):
+	"""Returns the geometric mean of the ratios of the current and the baseline means."""
+	logs = [math.log(cur[0] / base[0]) for _, base, cur in common(baseline, current)]
+	return math.exp(sum(logs) / len(logs)) if logs else 1.0
+
+def compare(baseline, current, threshold, sigmas, scale = 1.0):
+	"""Yields (name, baseline mean, current mean, time unit, relative change, allowed change) for all common benchmarks."""
+	for name, (base, base_error, unit), (cur, cur_error, _) in common(baseline, current):
+		change = cur / (base * scale) - 1
+		allowed = max(threshold, sigmas * math.sqrt(base_error ** 2 + cur_error ** 2))
+		yield name, base, cur, unit, change, allowed
+
+def main():
+	parser = argparse.ArgumentParser(description = "Compares two Google Benchmark JSON reports.")
+	parser.add_argument("baseline", help = "baseline report")
+	parser.add_argument("current", help = "current report")
+	parser.add_argument("--threshold", type = float, default = 0.1, help = "minimal relative change that is reported (default: 0.1)")
+	parser.add_argument("--sigmas", type = float, default = 3, help = "number of standard errors that are considered noise (default: 3)")
+	parser.add_argument("--metric", default = "cpu_time", choices = ["cpu_time", "real_time"], help = "time to compare (default: cpu_time)")
+	parser.add_argument("--absolute", action = "store_true", help = "compare absolute times instead of times relative to the run")
+	parser.add_argument("--update", action = "store_true", help = "write the current report to the baseline instead of comparing")
+	args = parser.parse_args()
+
+	if args.update:
+		update(args.baseline, args.current)
+		return 0
+
+	baseline = load(args.baseline, args.metric)
+	current = load(args.current, args.metric)
+
+	scale = 1.0
+	if not args.absolute:
+		scale = speed(baseline, current)
+		print("The current run is {:.2f} times as slow as the baseline, changes are relative to this.".format(scale))
+
+	regressions = 0
+	improvements = 0
+	for name, base, cur, unit, change, allowed in compare(baseline, current, args.threshold, args.sigmas, scale):
+		if change > allowed:
+			status = "REGRESSION"
+			regressions += 1
+		elif change < -allowed:
+			status = "improvement"
+			improvements += 1
+		else:
+			continue
+		print("{:<12} {:<70} {:>12.1f} {} -> {:>12.1f} {} ({:+.1%}, noise {:.1%})".format(status, name, base, unit, cur, unit, change, allowed))
+	for name in sorted(set(baseline) - set(current)):
+		print("{:<12} {}".format("missing", name))
+	for name in sorted(set(current) - set(baseline)):
+		print("{:<12} {}".format("new", name))
+	print("{} regressions, {} improvements, {} benchmarks compared.".format(regressions, improvements, len(list(common(baseline, current)))))
+	return 1 if regressions > 0 else 0
+
+if __name__ == "__main__":
+	sys.exit(main())
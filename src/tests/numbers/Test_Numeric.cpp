@@ -2,55 +2,71 @@
 
 #include "carl/numbers/numbers.h"
 #include "carl/numbers/Numeric.h"
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/UnivariatePolynomial.h"
 #include "carl/util/platform.h"
 
 #include "../Common.h"
 
+#include <thread>
+#include <unordered_set>
+
 using namespace carl;
 
 TEST(Numeric, withinNativeRange)
 {
 	EXPECT_TRUE(Rational(5) > -carl::fromInt<Rational>(carl::HIGHTEST_INTEGER_VALUE));
 	EXPECT_TRUE(Rational(5) < carl::fromInt<Rational>(carl::HIGHTEST_INTEGER_VALUE));
+	EXPECT_TRUE(Numeric<Rational>::withinNativeRange(Rational(1)/Rational(3)));
+	EXPECT_TRUE(Numeric<Rational>::withinNativeRange(carl::fromInt<Rational>(HIGHTEST_INTEGER_VALUE - 1)));
+	EXPECT_FALSE(Numeric<Rational>::withinNativeRange(carl::fromInt<Rational>(HIGHTEST_INTEGER_VALUE)));
+	EXPECT_FALSE(Numeric<Rational>::withinNativeRange(Rational(1)/carl::fromInt<Rational>(HIGHTEST_INTEGER_VALUE)));
 }
 
 TEST(Numeric, constructors)
 {
-    std::size_t num_of_allocated_elements = Numeric<Rational>::mRationalPool.size();
     Numeric<Rational> n0;
-    EXPECT_EQ( num_of_allocated_elements, Numeric<Rational>::mRationalPool.size() );
+    EXPECT_TRUE( n0.isNative() );
     EXPECT_EQ( Rational(0), n0.toRational());
-    Numeric<Rational> n1( 2, true );
-    EXPECT_EQ( num_of_allocated_elements, Numeric<Rational>::mRationalPool.size() );
+    Numeric<Rational> n1( 2 );
+    EXPECT_TRUE( n1.isNative() );
     EXPECT_EQ( Rational(2), n1.toRational());
-    Numeric<Rational> n2( 4 );
-    EXPECT_EQ( num_of_allocated_elements, Numeric<Rational>::mRationalPool.size() );
+    Numeric<Rational> n2( 4u );
+    EXPECT_TRUE( n2.isNative() );
     EXPECT_EQ( Rational(4), n2.toRational());
     Numeric<Rational> n3( Rational( 5 ) );
-    EXPECT_EQ( num_of_allocated_elements, Numeric<Rational>::mRationalPool.size() );
+    EXPECT_TRUE( n3.isNative() );
     EXPECT_EQ( Rational(5), n3.toRational());
     Numeric<Rational> n4( n2 );
     EXPECT_EQ( Rational(4), n4.toRational());
     Numeric<Rational> n5( n3 );
-    EXPECT_EQ( num_of_allocated_elements, Numeric<Rational>::mRationalPool.size() );
+    EXPECT_TRUE( n5.isNative() );
     EXPECT_EQ( Rational(5), n5.toRational());
     Numeric<Rational> n6 = carl::fromInt<Rational>(HIGHTEST_INTEGER_VALUE - 1);
-    EXPECT_EQ( num_of_allocated_elements, Numeric<Rational>::mRationalPool.size() );
+    EXPECT_TRUE( n6.isNative() );
     EXPECT_EQ( carl::fromInt<Rational>(HIGHTEST_INTEGER_VALUE - 1), n6.toRational());
     Numeric<Rational> n7( HIGHTEST_INTEGER_VALUE );
-    ++num_of_allocated_elements;
-    EXPECT_EQ( num_of_allocated_elements, Numeric<Rational>::mRationalPool.size() );
+    EXPECT_FALSE( n7.isNative() );
     EXPECT_EQ( carl::fromInt<Rational>( HIGHTEST_INTEGER_VALUE ), n7.toRational());
     Numeric<Rational> n8( -(HIGHTEST_INTEGER_VALUE - 1) );
+    EXPECT_TRUE( n8.isNative() );
     EXPECT_EQ( carl::fromInt<Rational>( -(HIGHTEST_INTEGER_VALUE - 1) ), n8.toRational());
     Numeric<Rational> n9( -HIGHTEST_INTEGER_VALUE );
-    ++num_of_allocated_elements;
-    EXPECT_EQ( num_of_allocated_elements, Numeric<Rational>::mRationalPool.size() );
+    EXPECT_FALSE( n9.isNative() );
     EXPECT_EQ( carl::fromInt<Rational>( -HIGHTEST_INTEGER_VALUE ), n9.toRational());
     Numeric<Rational> n10( (Rational( 1 )/Rational( 3 )) );
-    ++num_of_allocated_elements;
-    EXPECT_EQ( num_of_allocated_elements, Numeric<Rational>::mRationalPool.size() );
+    EXPECT_TRUE( n10.isNative() );
     EXPECT_EQ( (Rational( 1 )/Rational( 3 )), n10.toRational());
+    Numeric<Rational> n11( 6, -4 );
+    EXPECT_TRUE( n11.isNative() );
+    EXPECT_EQ( -3, n11.nativeNumerator() );
+    EXPECT_EQ( 2, n11.nativeDenominator() );
+    Numeric<Rational> n12( std::numeric_limits<sint>::min(), 4 );
+    EXPECT_TRUE( n12.isNative() );
+    EXPECT_EQ( carl::fromInt<Rational>( std::numeric_limits<sint>::min() ) / Rational( 4 ), n12.toRational() );
+    Numeric<Rational> n13( std::numeric_limits<carl::uint>::max() );
+    EXPECT_FALSE( n13.isNative() );
+    EXPECT_EQ( carl::fromInt<Rational>( std::numeric_limits<carl::uint>::max() ), n13.toRational() );
 }
 
 TEST(Numeric, operations)
@@ -75,6 +91,7 @@ TEST(Numeric, operations)
 
     n -= Numeric<Rational>( (HIGHTEST_INTEGER_VALUE - 1) );
     EXPECT_EQ( carl::fromInt<Rational>( ( -921102 - (HIGHTEST_INTEGER_VALUE - 1) ) ), n.toRational());
+    EXPECT_FALSE( n.isNative() );
 
     Numeric<Rational> n2;
     n2 -= Numeric<Rational>( HIGHTEST_INTEGER_VALUE );
@@ -82,61 +99,85 @@ TEST(Numeric, operations)
 
     n -= n2;
     EXPECT_EQ( carl::fromInt<Rational>( ( -921102 - (HIGHTEST_INTEGER_VALUE - 1) - (-HIGHTEST_INTEGER_VALUE) ) ), n.toRational());
+    EXPECT_TRUE( n.isNative() );
 
     Numeric<Rational> n3( (HIGHTEST_INTEGER_VALUE - 1) );
     n3 *= Numeric<Rational>( 2 );
     EXPECT_EQ( carl::fromInt<Rational>( (HIGHTEST_INTEGER_VALUE - 1) ) * Rational( 2 ), n3.toRational());
+    EXPECT_FALSE( n3.isNative() );
 
     Numeric<Rational> n4( (Rational(1)/Rational(3)) );
     n4 *= Numeric<Rational>( 9 );
     EXPECT_EQ( Rational( 3 ), n4.toRational() );
-    EXPECT_TRUE( IS_INT( n4.content() ) );
+    EXPECT_TRUE( n4.isNative() );
+    EXPECT_TRUE( carl::isInteger( n4 ) );
 
     Numeric<Rational> n5( 2 );
     n5 *= Numeric<Rational>( (Rational(1)/Rational(3)) );
     EXPECT_EQ( (Rational( 2 )/Rational( 3 )), n5.toRational() );
-    EXPECT_FALSE( IS_INT( n5.content() ) );
+    EXPECT_TRUE( n5.isNative() );
+    EXPECT_FALSE( carl::isInteger( n5 ) );
 
-    Numeric<Rational> n6( HIGHTEST_INTEGER_VALUE + 1 );
+    Numeric<Rational> n6( HIGHTEST_INTEGER_VALUE + 2 );
     n6 /= Numeric<Rational>( 3 );
-    EXPECT_EQ( carl::fromInt<Rational>( HIGHTEST_INTEGER_VALUE + 1 )/Rational( 3 ), n6.toRational() );
+    EXPECT_EQ( carl::fromInt<Rational>( HIGHTEST_INTEGER_VALUE + 2 )/Rational( 3 ), n6.toRational() );
+    EXPECT_TRUE( n6.isNative() );
 
     Numeric<Rational> n7( 44 );
     n7 /= Numeric<Rational>( 11 );
     EXPECT_EQ( Rational( 4 ), n7.toRational() );
-    EXPECT_TRUE( IS_INT( n7.content() ) );
+    EXPECT_TRUE( carl::isInteger( n7 ) );
 
     Numeric<Rational> n8( HIGHTEST_INTEGER_VALUE - 3 );
     EXPECT_EQ( carl::fromInt<Rational>( HIGHTEST_INTEGER_VALUE - 3 ), carl::abs( n8 ).toRational() );
     ++n8;
-    EXPECT_TRUE( IS_INT( n8.content() ) );
+    EXPECT_TRUE( n8.isNative() );
     ++n8;
-    EXPECT_TRUE( IS_INT( n8.content() ) );
+    EXPECT_TRUE( n8.isNative() );
     ++n8;
-    EXPECT_FALSE( IS_INT( n8.content() ) );
+    EXPECT_FALSE( n8.isNative() );
     ++n8;
-    EXPECT_FALSE( IS_INT( n8.content() ) );
+    EXPECT_FALSE( n8.isNative() );
     EXPECT_EQ( carl::fromInt<Rational>( HIGHTEST_INTEGER_VALUE + 1 ), carl::abs( n8 ).toRational() );
+    --n8;
+    --n8;
+    EXPECT_TRUE( n8.isNative() );
 
     Numeric<Rational> n9( -HIGHTEST_INTEGER_VALUE + 3 );
     EXPECT_EQ( carl::fromInt<Rational>( HIGHTEST_INTEGER_VALUE - 3 ), carl::abs( n9 ).toRational() );
     --n9;
-    EXPECT_TRUE( IS_INT( n9.content() ) );
+    EXPECT_TRUE( n9.isNative() );
     --n9;
-    EXPECT_TRUE( IS_INT( n9.content() ) );
+    EXPECT_TRUE( n9.isNative() );
     --n9;
-    EXPECT_FALSE( IS_INT( n9.content() ) );
+    EXPECT_FALSE( n9.isNative() );
     --n9;
-    EXPECT_FALSE( IS_INT( n9.content() ) );
+    EXPECT_FALSE( n9.isNative() );
     EXPECT_EQ( carl::fromInt<Rational>( HIGHTEST_INTEGER_VALUE + 1 ), carl::abs( n9 ).toRational() );
 
+    // Overflowing fractions are promoted and demoted again.
+    Numeric<Rational> f1( 1, HIGHTEST_INTEGER_VALUE - 1 );
+    Numeric<Rational> f2( 1, HIGHTEST_INTEGER_VALUE - 3 );
+    Numeric<Rational> f3 = f1 * f2;
+    EXPECT_FALSE( f3.isNative() );
+    EXPECT_EQ( f1.toRational() * f2.toRational(), f3.toRational() );
+    f3 *= Numeric<Rational>( HIGHTEST_INTEGER_VALUE - 1 );
+    EXPECT_TRUE( f3.isNative() );
+    EXPECT_EQ( f2, f3 );
+    Numeric<Rational> f4 = f1 + f2;
+    EXPECT_EQ( f1.toRational() + f2.toRational(), f4.toRational() );
+    f4 -= f2;
+    EXPECT_TRUE( f4.isNative() );
+    EXPECT_EQ( f1, f4 );
+
     Numeric<Rational> c1;
     Numeric<Rational> c2( 12 );
     Numeric<Rational> c3( -(HIGHTEST_INTEGER_VALUE - 1) );
-    Numeric<Rational> c4( HIGHTEST_INTEGER_VALUE+HIGHTEST_INTEGER_VALUE-2 );
+    Numeric<Rational> c4( HIGHTEST_INTEGER_VALUE+(HIGHTEST_INTEGER_VALUE-2) );
     Numeric<Rational> c5( (Rational(1)/Rational(3)) );
     Numeric<Rational> c6( (Rational(-90)/Rational(5)) );
-    EXPECT_TRUE( IS_INT( c6.content() ) );
+    EXPECT_TRUE( c6.isNative() );
+    EXPECT_TRUE( carl::isInteger( c6 ) );
     Numeric<Rational> c7( c4 );
     EXPECT_FALSE( c1 < c1 );
     EXPECT_TRUE( c1 == c1 );
@@ -153,9 +194,12 @@ TEST(Numeric, operations)
     EXPECT_TRUE( c7 == c4 );
     EXPECT_FALSE( c7 != c4 );
     EXPECT_FALSE( c7 > c4 );
+    EXPECT_TRUE( f2 > f1 );
+    EXPECT_TRUE( c2 == 12 );
+    EXPECT_TRUE( 12 == c2 );
 
     Numeric<Rational> c8( 144 );
-    Numeric<Rational> c9( HIGHTEST_INTEGER_VALUE+HIGHTEST_INTEGER_VALUE+HIGHTEST_INTEGER_VALUE-3 );
+    Numeric<Rational> c9( HIGHTEST_INTEGER_VALUE+(HIGHTEST_INTEGER_VALUE-3) );
     Numeric<Rational> c10( 3 );
     EXPECT_EQ( carl::div( c2, c2 ), (c2 / c2) );
     EXPECT_EQ( carl::div( c8, c2 ), (c8 / c2) );
@@ -169,6 +213,14 @@ TEST(Numeric, operations)
     EXPECT_EQ( carl::div( c9, c10 ), carl::div_assign( d3, c10 ) );
     Numeric<Rational> d4( c9 );
     EXPECT_EQ( carl::div( c9, c3 ), carl::div_assign( d4, c3 ) );
+
+    EXPECT_EQ( Rational(-2), Rational( carl::floor( Numeric<Rational>( -3, 2 ) ) ) );
+    EXPECT_EQ( Rational(-1), Rational( carl::ceil( Numeric<Rational>( -3, 2 ) ) ) );
+    EXPECT_EQ( Rational(1), Rational( carl::floor( Numeric<Rational>( 3, 2 ) ) ) );
+    EXPECT_EQ( Rational(2), Rational( carl::ceil( Numeric<Rational>( 3, 2 ) ) ) );
+    EXPECT_EQ( Numeric<Rational>( 27, 8 ), carl::pow( Numeric<Rational>( 3, 2 ), 3 ) );
+    EXPECT_EQ( carl::pow( c9.toRational(), 3 ), carl::pow( c9, 3 ).toRational() );
+    EXPECT_EQ( "-3/2", getOutput( Numeric<Rational>( -3, 2 ) ) );
 }
 
 TEST(Numeric, gcd)
@@ -177,8 +229,12 @@ TEST(Numeric, gcd)
     Numeric<Rational> b( 2*5*5*11*23 );
     Numeric<Rational> c( 2*11 );
     Numeric<Rational> d( 2*2*3*5*5*11*17*23 );
-    Numeric<Rational> e( HIGHTEST_INTEGER_VALUE+HIGHTEST_INTEGER_VALUE+HIGHTEST_INTEGER_VALUE-3 );
-    Numeric<Rational> f( HIGHTEST_INTEGER_VALUE+HIGHTEST_INTEGER_VALUE+HIGHTEST_INTEGER_VALUE+HIGHTEST_INTEGER_VALUE-4 );
+    // Values beyond the range of machine integers, obtained by overflowing additions.
+    Numeric<Rational> highest( HIGHTEST_INTEGER_VALUE );
+    Numeric<Rational> e = highest + highest + Numeric<Rational>( HIGHTEST_INTEGER_VALUE-3 );
+    Numeric<Rational> f = highest + highest + highest + Numeric<Rational>( HIGHTEST_INTEGER_VALUE-4 );
+    EXPECT_EQ( carl::fromInt<Rational>( HIGHTEST_INTEGER_VALUE ) * 3 - 3, e.toRational() );
+    EXPECT_EQ( carl::fromInt<Rational>( HIGHTEST_INTEGER_VALUE ) * 4 - 4, f.toRational() );
     EXPECT_EQ( c, carl::gcd( a, b ) );
     EXPECT_EQ( c, carl::gcd( b, a ) );
     EXPECT_EQ( c, carl::gcd( -a, b ) );
@@ -203,10 +259,91 @@ TEST(Numeric, gcd)
     EXPECT_EQ( carl::lcm( e.toRational(), d.toRational() ), carl::lcm( -d, e ).toRational() );
     EXPECT_EQ( carl::lcm( e.toRational(), d.toRational() ), carl::lcm( e, -d ).toRational() );
     EXPECT_EQ( carl::lcm( e.toRational(), d.toRational() ), carl::lcm( d, -e ).toRational() );
+    EXPECT_EQ( carl::gcd( f.toRational(), e.toRational() ), carl::gcd( f, e ).toRational() );
 
     Numeric<Rational> g( 997002998000 );
     Numeric<Rational> h( 996005994003 );
     Numeric<Rational> j = g * h;
     Numeric<Rational> i( -997002998000 );
     EXPECT_EQ( carl::gcd( j.toRational(), i.toRational() ), carl::gcd( j, i ).toRational() );
+
+    Numeric<Rational> k( 4, 9 );
+    Numeric<Rational> l( 6, 15 );
+    EXPECT_EQ( carl::gcd( k.toRational(), l.toRational() ), carl::gcd( k, l ).toRational() );
+    EXPECT_EQ( carl::lcm( k.toRational(), l.toRational() ), carl::lcm( k, l ).toRational() );
+}
+
+TEST(Numeric, hash)
+{
+    std::hash<Numeric<Rational>> h;
+    Numeric<Rational> a( HIGHTEST_INTEGER_VALUE );
+    Numeric<Rational> b( HIGHTEST_INTEGER_VALUE - 1 );
+    ++b;
+    EXPECT_EQ( a, b );
+    EXPECT_EQ( h( a ), h( b ) );
+    std::unordered_set<Numeric<Rational>> set = { Numeric<Rational>( 1, 2 ), Numeric<Rational>( 2, 4 ), a, b };
+    EXPECT_EQ( 2, set.size() );
+}
+
+TEST(Numeric, typetraits)
+{
+    EXPECT_TRUE( carl::is_rational<Numeric<Rational>>::value );
+    EXPECT_TRUE( carl::is_field<Numeric<Rational>>::value );
+    EXPECT_TRUE( carl::is_number<Numeric<Rational>>::value );
+    EXPECT_TRUE( (std::is_same<mpz_class, carl::IntegralType<Numeric<Rational>>::type>::value) );
+    EXPECT_EQ( Numeric<Rational>( 1, 4 ), carl::rationalize<Numeric<Rational>>( 0.25 ) );
+    EXPECT_EQ( Numeric<Rational>( -7 ), carl::fromInt<Numeric<Rational>>( sint(-7) ) );
+    EXPECT_EQ( Numeric<Rational>( 3, 7 ), carl::parse<Numeric<Rational>>( "3/7" ) );
+    EXPECT_EQ( 5, carl::toInt<sint>( Numeric<Rational>( 5 ) ) );
+    EXPECT_DOUBLE_EQ( 0.75, carl::toDouble( Numeric<Rational>( 3, 4 ) ) );
+}
+
+TEST(Numeric, Polynomial)
+{
+    using Coeff = Numeric<Rational>;
+    using Pol = MultivariatePolynomial<Coeff>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Pol p = Pol(x) * Coeff(1, 2) + Pol(y) * Coeff(3);
+    Pol q = p * p;
+    Pol expected = Pol(x) * Pol(x) * Coeff(1, 4) + Pol(x) * Pol(y) * Coeff(3) + Pol(y) * Pol(y) * Coeff(9);
+    EXPECT_EQ( expected, q );
+    EXPECT_EQ( Coeff(4), q.coprimeFactor() );
+    EXPECT_EQ( Coeff(4), q.evaluate({{x, Coeff(1)}, {y, Coeff(1, 2)}}) );
+    EXPECT_TRUE( (q - expected).isZero() );
+
+    // Coefficients beyond the native range are promoted transparently.
+    Pol big = p * Coeff(HIGHTEST_INTEGER_VALUE - 1);
+    big *= big;
+    EXPECT_EQ( q * Coeff(HIGHTEST_INTEGER_VALUE - 1) * Coeff(HIGHTEST_INTEGER_VALUE - 1), big );
+
+    UnivariatePolynomial<Coeff> u(x, {Coeff(-2), Coeff(0), Coeff(1)});
+    UnivariatePolynomial<Coeff> v(x, {Coeff(1), Coeff(1)});
+    auto prod = u * v;
+    EXPECT_EQ( u, prod.divideBy(v).quotient );
+    EXPECT_EQ( UnivariatePolynomial<Coeff>(x, {Coeff(0), Coeff(2)}), u.derivative() );
+}
+
+TEST(Numeric, ThreadSafety)
+{
+    // Every thread works on its own values, some of which exceed the native range.
+    std::vector<Rational> results(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([t,&results](){
+            Numeric<Rational> sum;
+            for (sint i = 1; i <= 1000; ++i) {
+                sum += Numeric<Rational>(HIGHTEST_INTEGER_VALUE - sint(t), i);
+            }
+            results[t] = sum.toRational();
+        });
+    }
+    for (auto& t: threads) t.join();
+    for (std::size_t t = 0; t < results.size(); ++t) {
+        Rational expected;
+        for (sint i = 1; i <= 1000; ++i) {
+            expected += carl::fromInt<Rational>(HIGHTEST_INTEGER_VALUE - sint(t)) / Rational(i);
+        }
+        EXPECT_EQ( expected, results[t] );
+    }
 }
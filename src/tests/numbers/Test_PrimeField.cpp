@@ -0,0 +1,165 @@
+#include "gtest/gtest.h"
+
+#include "carl/numbers/numbers.h"
+#include "carl/core/UnivariatePolynomial.h"
+#include "carl/core/polynomialfunctions/Derivative.h"
+#include "carl/core/polynomialfunctions/GCD_univariate.h"
+
+#include <random>
+
+using namespace carl;
+
+namespace {
+	using Word = PrimeField::Word;
+	constexpr Word P61 = (Word(1) << 61) - 1;
+
+	Word mulmod(Word a, Word b, Word p) {
+		return Word((unsigned __int128)a * b % p);
+	}
+}
+
+TEST(PrimeField, Arithmetic)
+{
+	for (Word p: {Word(3), Word(5), Word(65537), Word(4294967291u), P61}) {
+		PrimeField f(p);
+		std::mt19937_64 rand(p);
+		for (int i = 0; i < 200; ++i) {
+			Word a = rand() % p;
+			Word b = rand() % p;
+			Word ma = f.toMontgomery(a);
+			Word mb = f.toMontgomery(b);
+			EXPECT_EQ(a, f.fromMontgomery(ma));
+			EXPECT_EQ((a + b) % p, f.fromMontgomery(f.add(ma, mb)));
+			EXPECT_EQ((a + p - b) % p, f.fromMontgomery(f.sub(ma, mb)));
+			EXPECT_EQ(mulmod(a, b, p), f.fromMontgomery(f.mul(ma, mb)));
+			if (a != 0) {
+				EXPECT_EQ(f.one(), f.mul(ma, f.inverse(ma)));
+				EXPECT_EQ(f.inverse(ma), f.pow(ma, std::size_t(p - 2)));
+			}
+		}
+		EXPECT_EQ(p - 1, f.fromMontgomery(f.fromInt(-1)));
+		EXPECT_EQ(-1, f.symmetric(f.fromInt(-1)));
+	}
+}
+
+TEST(PrimeField, Constexpr)
+{
+	constexpr PrimeField f(7);
+	static_assert(f.fromMontgomery(f.mul(f.toMontgomery(3), f.toMontgomery(5))) == 1, "3 * 5 = 1 mod 7");
+	static_assert(f.fromMontgomery(f.inverse(f.toMontgomery(3))) == 5, "3^-1 = 5 mod 7");
+}
+
+TEST(PrimeField, Kernels)
+{
+	PrimeField f(P61);
+	auto dense = [&f](std::initializer_list<sint> coeffs) {
+		PrimeField::Polynomial res;
+		for (auto c: coeffs) res.push_back(f.fromInt(c));
+		return res;
+	};
+	// (x - 1) * (x + 2) = x^2 + x - 2
+	auto a = dense({-1, 1});
+	auto b = dense({2, 1});
+	auto prod = f.multiply(a, b);
+	EXPECT_EQ(dense({-2, 1, 1}), prod);
+	EXPECT_EQ(f.fromInt(4), f.evaluate(prod, f.fromInt(2)));
+
+	auto rem = prod;
+	EXPECT_EQ(b, f.divide(rem, a));
+	EXPECT_TRUE(rem.empty());
+	rem = dense({1, 0, 1});
+	auto q = f.divide(rem, a);
+	EXPECT_EQ(dense({1, 1}), q);
+	EXPECT_EQ(dense({2}), rem);
+
+	EXPECT_EQ(a, f.gcd(prod, f.multiply(a, dense({5, 0, 3}))));
+	EXPECT_EQ(dense({1}), f.gcd(a, b));
+
+	auto sum = a;
+	f.addAssign(sum, b);
+	EXPECT_EQ(dense({1, 2}), sum);
+	f.subAssign(sum, b);
+	EXPECT_EQ(a, sum);
+	f.scaleAssign(sum, f.fromInt(3));
+	EXPECT_EQ(dense({-3, 3}), sum);
+}
+
+TEST(PrimeFieldNumber, Static)
+{
+	using F7 = PrimeFieldNumber<7>;
+	F7 a(3);
+	F7 b(5);
+	EXPECT_TRUE((a * b).isOne());
+	EXPECT_EQ(F7(1), a + b);
+	EXPECT_EQ(F7(5), a - F7(5));
+	EXPECT_EQ(b, F7(1) / a);
+	EXPECT_EQ(F7(-2), b);
+	EXPECT_EQ(Word(5), b.value());
+	EXPECT_EQ(-2, b.symmetricValue());
+	EXPECT_TRUE(F7(7).isZero());
+	EXPECT_EQ(7u, carl::characteristic<F7>::value);
+	EXPECT_TRUE(carl::is_field<F7>::value);
+	EXPECT_EQ(sizeof(Word), sizeof(F7));
+}
+
+TEST(PrimeFieldNumber, Runtime)
+{
+	const PrimeField* f = PrimeFieldManager::getInstance().getField(P61);
+	EXPECT_EQ(f, PrimeFieldManager::getInstance().getField(P61));
+	using F = PrimeFieldNumber<>;
+	F a(12345, f);
+	F b(-1, f);
+	EXPECT_EQ(F(12344, f), a + b);
+	// Numbers without a field adopt the field of the other operand.
+	EXPECT_EQ(F(12346, f), a + F(1));
+	EXPECT_EQ(F(12346, f), F(1) + a);
+	EXPECT_EQ(F(1), a / a);
+	EXPECT_EQ(F(-12345, f), a * F(-1));
+	EXPECT_EQ(F(P61 - 12345, f), -a);
+	EXPECT_TRUE(F(0).isZero());
+	EXPECT_EQ(a, (a * a) / a);
+	// An integer equals a field element only as its symmetric representative, consistent with the hash.
+	std::hash<F> hasher;
+	EXPECT_EQ(F(-1), b);
+	EXPECT_EQ(hasher(F(-1)), hasher(b));
+	EXPECT_NE(F(P61 - 1), b);
+	// Integers without a field wrap around instead of overflowing.
+	F big(Word(1) << 62);
+	EXPECT_TRUE((big * F(4)).isZero());
+}
+
+TEST(PrimeFieldNumber, GFNumber)
+{
+	const GaloisField<mpz_class>* gf = GaloisFieldManager<mpz_class>::getInstance().getField(7);
+	for (int i = -10; i <= 10; ++i) {
+		GFNumber<mpz_class> n(i, gf);
+		auto s = toPrimeFieldNumber<7>(n);
+		EXPECT_EQ(PrimeFieldNumber<7>(i), s);
+		auto r = toPrimeFieldNumber(n);
+		EXPECT_EQ(Word(7), r.field()->p());
+		EXPECT_EQ(s.value(), r.value());
+		EXPECT_EQ(n, toGFNumber(s, gf));
+		EXPECT_EQ(n, toGFNumber(r, gf));
+	}
+}
+
+TEST(PrimeFieldNumber, UnivariatePolynomial)
+{
+	using F = PrimeFieldNumber<P61>;
+	using UPol = UnivariatePolynomial<F>;
+	Variable x = freshRealVariable("x");
+	UPol a(x, {F(-1), F(1)});
+	UPol b(x, {F(2), F(1)});
+	UPol c(x, {F(5), F(0), F(3)});
+	UPol ab = a * b;
+	EXPECT_EQ(UPol(x, {F(-2), F(1), F(1)}), ab);
+	EXPECT_EQ(b, ab.divideBy(a).quotient);
+	EXPECT_TRUE(ab.divideBy(a).remainder.isZero());
+	EXPECT_EQ(a, carl::gcd(ab, a * c).normalized());
+	EXPECT_EQ(UPol(x, {F(1), F(2)}), carl::derivative(ab));
+
+	// The dense kernels agree with the generic implementation.
+	const PrimeField* f = F().field();
+	auto prod = f->multiply(F::toDense(ab.coefficients(), f), F::toDense(c.coefficients(), f));
+	EXPECT_EQ((ab * c).coefficients(), F::fromDense(prod, f));
+}
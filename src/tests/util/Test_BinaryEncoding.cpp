@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/UnivariatePolynomial.h"
+#include "carl/core/VariablePool.h"
+#include "carl/io/BinaryEncoding.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+namespace {
+	template<typename T>
+	T roundTrip(const T& t, const std::vector<Variable>& vars = {}) {
+		serialization::Encoder e(vars);
+		e << t;
+		serialization::Decoder d(e.data(), vars);
+		T res = d.read<T>();
+		EXPECT_TRUE(d.atEnd());
+		return res;
+	}
+}
+
+TEST(BinaryEncoding, Integers)
+{
+	for (std::uint64_t n: {0ull, 1ull, 127ull, 128ull, 300ull, 1ull << 63}) {
+		EXPECT_EQ(n, roundTrip(n));
+	}
+	for (std::int64_t n: {std::int64_t(0), std::int64_t(-1), std::int64_t(64), std::int64_t(-65), std::numeric_limits<std::int64_t>::min()}) {
+		EXPECT_EQ(n, roundTrip(n));
+	}
+	serialization::Encoder e;
+	e.varint(127);
+	EXPECT_EQ(1, e.data().size());
+	e.varint(128);
+	EXPECT_EQ(3, e.data().size());
+}
+
+TEST(BinaryEncoding, Numbers)
+{
+	mpz_class big("-123456789012345678901234567890123456789");
+	EXPECT_EQ(big, roundTrip(big));
+	EXPECT_EQ(mpz_class(0), roundTrip(mpz_class(0)));
+	mpz_class limit = mpz_class(1) << 62;
+	for (const mpz_class& z: std::vector<mpz_class>({limit - 1, limit, -limit + 1, -limit, limit * limit})) {
+		EXPECT_EQ(z, roundTrip(z));
+	}
+	serialization::Encoder small;
+	small << mpz_class(-21);
+	EXPECT_EQ(1, small.data().size());
+	mpq_class q(mpz_class("98765432109876543210"), mpz_class(-7));
+	q.canonicalize();
+	EXPECT_EQ(q, roundTrip(q));
+
+	serialization::Encoder e;
+	e << big;
+	std::string truncated = e.data().substr(0, e.data().size() - 1);
+	serialization::Decoder d(truncated);
+	EXPECT_THROW(d.read<mpz_class>(), serialization::DecodingError);
+}
+
+TEST(BinaryEncoding, Polynomials)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Poly p = Poly(x) * x * y - Poly(z) * Rational(3, 2) + Rational(7);
+	std::vector<Variable> vars = { x, y, z };
+	EXPECT_EQ(p, roundTrip(p, vars));
+	EXPECT_EQ(Poly(), roundTrip(Poly(), vars));
+
+	UnivariatePolynomial<Poly> up = p.toUnivariatePolynomial(x);
+	EXPECT_EQ(up, roundTrip(up, vars));
+	UnivariatePolynomial<Rational> uq(y, {Rational(1), Rational(0), Rational(-1, 3)});
+	EXPECT_EQ(uq, roundTrip(uq, vars));
+
+	// Decoding with another variable table renames the variables.
+	Variable a = freshRealVariable("a");
+	Variable b = freshRealVariable("b");
+	Variable c = freshRealVariable("c");
+	serialization::Encoder e(vars);
+	e << p;
+	serialization::Decoder d(e.data(), { a, b, c });
+	EXPECT_EQ(p.substitute(x, Poly(a)).substitute(y, Poly(b)).substitute(z, Poly(c)), d.read<Poly>());
+
+	serialization::Encoder missing({ x });
+	EXPECT_THROW(missing << p, std::invalid_argument);
+}
@@ -0,0 +1,132 @@
+#include "../Common.h"
+
+#include <carl/util/Cache.h>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace {
+	std::atomic<int> liveEntries(0);
+	struct Entry {
+		int value;
+		explicit Entry(int v): value(v) { ++liveEntries; }
+		~Entry() { --liveEntries; }
+		std::size_t getHash() const {
+			return std::hash<int>()(value);
+		}
+		void rehash() {}
+		bool operator==(const Entry& e) const {
+			return value == e.value;
+		}
+	};
+	std::ostream& operator<<(std::ostream& os, const Entry& e) {
+		return os << e.value;
+	}
+}
+
+TEST(Cache, HitsAndMisses)
+{
+	carl::Cache<Entry> cache;
+	auto first = cache.cache(new Entry(1));
+	EXPECT_TRUE(first.second);
+	Entry* duplicate = new Entry(1);
+	auto second = cache.cache(duplicate);
+	EXPECT_FALSE(second.second);
+	delete duplicate;
+	EXPECT_EQ(first.first, second.first);
+	EXPECT_EQ(1, cache.get(first.first).value);
+
+	auto stats = cache.statistics();
+	EXPECT_EQ(1u, stats.hits);
+	EXPECT_EQ(1u, stats.misses);
+	EXPECT_EQ(1u, stats.size);
+	cache.dereg(first.first);
+	cache.dereg(second.first);
+}
+
+TEST(Cache, Merge)
+{
+	// Updating the entry 2 to 1 merges it into the entry 1.
+	carl::Cache<Entry> cache;
+	auto one = cache.cache(new Entry(1));
+	auto two = cache.cache(new Entry(2));
+	const Entry& before = cache.get(two.first);
+	Entry* update = new Entry(2);
+	auto res = cache.cache(update, [](const Entry&, const Entry&) { return true; }, [](const Entry& e, const Entry&) { const_cast<Entry&>(e).value = 1; });
+	delete update;
+	EXPECT_EQ(two.first, res.first);
+	EXPECT_EQ(1u, cache.statistics().size);
+	EXPECT_EQ(&cache.get(one.first), &cache.get(two.first));
+	// The merged entry stays valid for threads that resolved it before.
+	EXPECT_EQ(1, before.value);
+	cache.dereg(one.first);
+	cache.dereg(two.first);
+	cache.dereg(res.first);
+}
+
+TEST(Cache, ReclaimMerged)
+{
+	int live = liveEntries;
+	carl::Cache<Entry> cache(16);
+	auto one = cache.cache(new Entry(1));
+	auto two = cache.cache(new Entry(2));
+	Entry* update = new Entry(2);
+	auto res = cache.cache(update, [](const Entry&, const Entry&) { return true; }, [](const Entry& e, const Entry&) { const_cast<Entry&>(e).value = 1; });
+	delete update;
+	EXPECT_EQ(live + 2, liveEntries);
+	cache.dereg(one.first);
+	cache.dereg(two.first);
+	cache.dereg(res.first);
+	// Evicting also destroys the merged entry, as its references have drained.
+	for (int i = 100; i < 200; ++i) {
+		cache.dereg(cache.cache(new Entry(i)).first);
+	}
+	EXPECT_EQ(live + int(cache.statistics().size), liveEntries);
+}
+
+TEST(Cache, Eviction)
+{
+	carl::Cache<Entry> cache(32);
+	auto live = cache.cache(new Entry(-1));
+	for (int i = 0; i < 1000; ++i) {
+		auto ref = cache.cache(new Entry(i));
+		cache.strengthenActivity(ref.first);
+		cache.dereg(ref.first);
+	}
+	auto stats = cache.statistics();
+	EXPECT_LE(stats.size, 32u);
+	EXPECT_GE(stats.evictions, 1000u - 32u);
+	// Entries in use are never evicted.
+	EXPECT_EQ(-1, cache.get(live.first).value);
+	cache.dereg(live.first);
+}
+
+TEST(Cache, Concurrent)
+{
+	carl::Cache<Entry> cache(64);
+	std::atomic<std::size_t> inserted(0);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&cache, &inserted, t]() {
+			for (int i = 0; i < 5000; ++i) {
+				Entry* e = new Entry((i * 7 + t) % 300);
+				auto ref = cache.cache(e);
+				if (ref.second) inserted++;
+				else delete e;
+				cache.reg(ref.first);
+				EXPECT_EQ((i * 7 + t) % 300, cache.get(ref.first).value);
+				cache.strengthenActivity(ref.first);
+				cache.dereg(ref.first);
+				cache.dereg(ref.first);
+			}
+		});
+	}
+	for (auto& t: threads) t.join();
+	auto stats = cache.statistics();
+	EXPECT_EQ(20000u, stats.hits + stats.misses);
+	EXPECT_EQ(inserted.load(), stats.misses);
+	EXPECT_EQ(stats.misses, stats.size + stats.evictions);
+	EXPECT_LE(stats.size, 64u);
+}
@@ -0,0 +1,194 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/polynomialfunctions/Factorization_univariate.h"
+#include "carl/core/polynomialfunctions/Resultant.h"
+#include "carl/core/VariablePool.h"
+#include "carl/util/ResultStore.h"
+#include "carl/util/StoredResult.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+namespace {
+	/// A file name in the temporary directory that is removed before and after the test.
+	class TemporaryFile {
+		std::string mName;
+	public:
+		explicit TemporaryFile(const std::string& name):
+			mName((std::filesystem::temp_directory_path() / ("carl_" + name + "_" + std::to_string(getpid()))).string())
+		{
+			std::remove(mName.c_str());
+		}
+		~TemporaryFile() {
+			std::remove(mName.c_str());
+		}
+		const std::string& name() const {
+			return mName;
+		}
+	};
+}
+
+TEST(ResultStore, Persistence)
+{
+	TemporaryFile file("persistence");
+	{
+		ResultStore store(file.name());
+		EXPECT_FALSE(store.lookup("a"));
+		store.store("a", "1");
+		store.store("b", std::string("\0\1\2", 3));
+		store.store("a", "2");
+		EXPECT_EQ(std::string("1"), *store.lookup("a"));
+		EXPECT_EQ(2, store.size());
+		EXPECT_EQ(1, store.statistics().hits);
+	}
+	ResultStore store(file.name());
+	EXPECT_EQ(2, store.size());
+	EXPECT_EQ(std::string("1"), *store.lookup("a"));
+	EXPECT_EQ(std::string("\0\1\2", 3), *store.lookup("b"));
+	store.clear();
+	EXPECT_FALSE(store.lookup("a"));
+	EXPECT_EQ(0, store.size());
+}
+
+TEST(ResultStore, Versioning)
+{
+	TemporaryFile file("versioning");
+	{
+		ResultStore store(file.name());
+		store.store("a", "1");
+	}
+	{
+		// Overwrite the version of the file format.
+		std::fstream f(file.name(), std::ios::in | std::ios::out | std::ios::binary);
+		f.seekp(8);
+		std::uint32_t version = ResultStore::VERSION + 1;
+		f.write(reinterpret_cast<const char*>(&version), sizeof(version));
+	}
+	ResultStore store(file.name());
+	EXPECT_EQ(0, store.size());
+	EXPECT_FALSE(store.lookup("a"));
+}
+
+TEST(ResultStore, TruncatedEntry)
+{
+	TemporaryFile file("truncated");
+	std::size_t size;
+	{
+		ResultStore store(file.name());
+		store.store("a", "1");
+		size = store.bytes();
+		store.store("b", "2");
+	}
+	std::filesystem::resize_file(file.name(), size + 5);
+	ResultStore store(file.name());
+	EXPECT_EQ(1, store.size());
+	EXPECT_FALSE(store.lookup("b"));
+	store.store("c", "3");
+	EXPECT_EQ(std::string("3"), *store.lookup("c"));
+	EXPECT_EQ(std::string("1"), *store.lookup("a"));
+}
+
+TEST(ResultStore, SizeLimit)
+{
+	TemporaryFile file("limit");
+	ResultStore store(file.name(), 4096);
+	std::string value(100, 'x');
+	for (int i = 0; i < 100; ++i) {
+		store.store("key" + std::to_string(i), value);
+		EXPECT_LE(store.bytes(), 4096);
+	}
+	EXPECT_GT(store.statistics().compactions, 0);
+	// The most recent entries are kept.
+	EXPECT_TRUE(store.lookup("key99"));
+	EXPECT_FALSE(store.lookup("key0"));
+	// Entries that never fit are not stored.
+	store.store("large", std::string(8192, 'x'));
+	EXPECT_FALSE(store.lookup("large"));
+}
+
+TEST(ResultStore, ConcurrentProcesses)
+{
+	TemporaryFile file("concurrent");
+	ResultStore(file.name()).store("initial", "0");
+	std::vector<pid_t> children;
+	for (int c = 0; c < 4; ++c) {
+		pid_t pid = fork();
+		ASSERT_GE(pid, 0);
+		if (pid == 0) {
+			ResultStore store(file.name(), 64 * 1024);
+			for (int i = 0; i < 50; ++i) {
+				store.store(std::to_string(c) + "/" + std::to_string(i), std::string(std::size_t(i), 'a'));
+			}
+			_exit(0);
+		}
+		children.push_back(pid);
+	}
+	for (pid_t pid: children) {
+		int status;
+		waitpid(pid, &status, 0);
+		EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+	}
+	ResultStore store(file.name());
+	EXPECT_EQ(201, store.size());
+	for (int c = 0; c < 4; ++c) {
+		for (int i = 0; i < 50; ++i) {
+			auto value = store.lookup(std::to_string(c) + "/" + std::to_string(i));
+			ASSERT_TRUE(value);
+			EXPECT_EQ(std::string(std::size_t(i), 'a'), *value);
+		}
+	}
+}
+
+TEST(ResultStore, StoredResults)
+{
+	TemporaryFile file("results");
+	ResultStore::activate(std::make_unique<ResultStore>(file.name()));
+	ResultStore* store = ResultStore::active();
+	ASSERT_NE(nullptr, store);
+
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Poly p = Poly(x) * x - Poly(y);
+	Poly q = Poly(x) * y - Rational(1);
+	auto expected = carl::resultant(p.toUnivariatePolynomial(x), q.toUnivariatePolynomial(x));
+	EXPECT_EQ(1, store->size());
+	EXPECT_EQ(expected, carl::resultant(p.toUnivariatePolynomial(x), q.toUnivariatePolynomial(x)));
+	EXPECT_EQ(1, store->statistics().hits);
+
+	// Renaming the variables in an order preserving way reuses the result.
+	Variable a = freshRealVariable("a");
+	Variable b = freshRealVariable("b");
+	Poly pr = Poly(a) * a - Poly(b);
+	Poly qr = Poly(a) * b - Rational(1);
+	auto renamed = carl::resultant(pr.toUnivariatePolynomial(a), qr.toUnivariatePolynomial(a));
+	EXPECT_EQ(2, store->statistics().hits);
+	EXPECT_EQ(Poly(expected).substitute(y, Poly(b)), Poly(renamed));
+
+	UnivariatePolynomial<Rational> u(x, {Rational(-2), Rational(1)});
+	u = u * u * UnivariatePolynomial<Rational>(x, {Rational(1), Rational(0), Rational(1)});
+	auto factors = carl::factorization(u);
+	EXPECT_EQ(factors, carl::factorization(u));
+	EXPECT_EQ(3, store->statistics().hits);
+
+	// Any computation with encodable arguments and result can be stored.
+	std::size_t calls = 0;
+	auto compute = [&calls](){ calls++; return Poly(Rational(5)); };
+	EXPECT_EQ(Poly(Rational(5)), storedResult<Poly>("test", compute, p));
+	EXPECT_EQ(Poly(Rational(5)), storedResult<Poly>("test", compute, p));
+	EXPECT_EQ(1, calls);
+
+	ResultStore::activate(nullptr);
+	EXPECT_EQ(nullptr, ResultStore::active());
+	EXPECT_EQ(Poly(Rational(5)), storedResult<Poly>("test", compute, p));
+	EXPECT_EQ(2, calls);
+}
@@ -0,0 +1,38 @@
+#include "../Common.h"
+
+#include <carl/util/StripedPointerSet.h>
+
+#include <memory>
+#include <vector>
+
+TEST(StripedPointerSet, InsertFindErase)
+{
+	carl::StripedPointerSet<int, 8> set;
+	std::vector<std::unique_ptr<int>> values;
+	for (int i = 0; i < 100; ++i) {
+		values.emplace_back(new int(i));
+		auto lock = set.lock(values.back().get());
+		auto res = set.insert(values.back().get());
+		EXPECT_TRUE(res.second);
+		EXPECT_EQ(values.back().get(), res.first);
+	}
+	EXPECT_EQ(100u, set.size());
+
+	// Equal elements are found, no matter which pointer is used.
+	int five = 5;
+	auto res = set.insert(&five);
+	EXPECT_FALSE(res.second);
+	EXPECT_EQ(values[5].get(), res.first);
+	EXPECT_EQ(values[5].get(), set.find(&five));
+
+	EXPECT_EQ(1u, set.erase(&five));
+	EXPECT_EQ(nullptr, set.find(&five));
+	EXPECT_EQ(99u, set.size());
+
+	int sum = 0;
+	set.forEach([&sum](const int* i) { sum += *i; });
+	EXPECT_EQ(99 * 100 / 2 - 5, sum);
+
+	set.clear();
+	EXPECT_EQ(0u, set.size());
+}
@@ -1,8 +1,16 @@
 #include "../Common.h"
 
 #define TIMING
+#include <carl/util/Instrumentation.h>
 #include <carl/util/TimingCollector.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
 #include <thread>
+#include <vector>
+
+using namespace carl::instrumentation;
 
 TEST(TimingCollector, Basics)
 {
@@ -11,4 +19,115 @@ TEST(TimingCollector, Basics)
 	CARL_TIME_FINISH("dummy", start);
 	
 	std::cout << carl::TimingCollector::getInstance() << std::endl;
+	EXPECT_EQ(1u, Registry::getInstance().get("dummy").count);
+	EXPECT_LE(50000000u, Registry::getInstance().get("dummy").nanoseconds);
+}
+
+TEST(Instrumentation, Counters)
+{
+	Registry::getInstance().reset();
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < 4; ++i) {
+		threads.emplace_back([]() {
+			for (std::size_t j = 0; j < 1000; ++j) {
+				CARL_COUNT("test.counter");
+			}
+			CARL_COUNT_ADD("test.added", 5);
+		});
+	}
+	for (auto& t: threads) t.join();
+	EXPECT_EQ(4000u, Registry::getInstance().get("test.counter").count);
+	EXPECT_EQ(0u, Registry::getInstance().get("test.counter").nanoseconds);
+	EXPECT_EQ(20u, Registry::getInstance().get("test.added").count);
+	Registry::getInstance().reset();
+	EXPECT_EQ(0u, Registry::getInstance().get("test.counter").count);
+}
+
+TEST(Instrumentation, ScopedTimer)
+{
+	Registry::getInstance().reset();
+	for (std::size_t i = 0; i < 3; ++i) {
+		CARL_TIME_SCOPE("test.timer");
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	}
+	Entry e = Registry::getInstance().get("test.timer");
+	EXPECT_EQ(3u, e.count);
+	EXPECT_LE(6000000u, e.nanoseconds);
+}
+
+TEST(Instrumentation, JSON)
+{
+	Registry::getInstance().reset();
+	CARL_COUNT("test.json.a");
+	CARL_COUNT_ADD("test.json.b", 2);
+	CARL_COUNT("test.json");
+	std::stringstream ss;
+	Registry::getInstance().writeJSON(ss);
+	std::string expected = "{\n\t\"test\": {\n\t\t\"json\": {\n\t\t\t\"count\": 1,\n\t\t\t\"a\": {\n\t\t\t\t\"count\": 1\n\t\t\t},\n\t\t\t\"b\": {\n\t\t\t\t\"count\": 2\n\t\t\t}\n\t\t}\n\t}\n}\n";
+	EXPECT_EQ(expected, ss.str());
+}
+
+TEST(Instrumentation, ChromeTrace)
+{
+	Registry::getInstance().reset();
+	Registry::getInstance().tracing(true);
+	{
+		CARL_TIME_SCOPE("test.outer");
+		CARL_TIME_SCOPE("test.inner");
+	}
+	Registry::getInstance().tracing(false);
+	{
+		CARL_TIME_SCOPE("test.untraced");
+	}
+	std::stringstream ss;
+	Registry::getInstance().writeChromeTrace(ss);
+	std::string trace = ss.str();
+	EXPECT_EQ(0u, trace.find("{\"traceEvents\": ["));
+	EXPECT_NE(std::string::npos, trace.find("\"name\": \"test.outer\""));
+	EXPECT_NE(std::string::npos, trace.find("\"name\": \"test.inner\""));
+	EXPECT_EQ(std::string::npos, trace.find("test.untraced"));
+	EXPECT_EQ(1u, Registry::getInstance().get("test.untraced").count);
+}
+
+TEST(Instrumentation, ExitedThreads)
+{
+	Registry& r = Registry::getInstance();
+	r.reset();
+	r.tracing(true);
+	std::thread([]() { CARL_COUNT("test.exited"); }).join();
+	std::size_t allocated = r.allocatedThreads();
+	for (std::size_t i = 0; i < 20; ++i) {
+		std::thread([]() {
+			CARL_COUNT("test.exited");
+			CARL_TIME_SCOPE("test.exited.timer");
+		}).join();
+	}
+	r.tracing(false);
+	EXPECT_EQ(allocated, r.allocatedThreads());
+	EXPECT_EQ(21u, r.get("test.exited").count);
+	EXPECT_EQ(20u, r.get("test.exited.timer").count);
+	std::stringstream ss;
+	r.writeChromeTrace(ss);
+	EXPECT_NE(std::string::npos, ss.str().find("\"name\": \"test.exited.timer\""));
+	r.reset();
+	EXPECT_EQ(0u, r.get("test.exited").count);
+}
+
+TEST(Instrumentation, Overflow)
+{
+	// Uses up all probes, hence this has to be the last test using probes.
+	Registry& r = Registry::getInstance();
+	r.reset();
+	std::vector<std::size_t> ids;
+	for (std::size_t i = 0; i < maxProbes + 10; ++i) {
+		ids.push_back(r.probe("test.overflow." + std::to_string(i)));
+	}
+	EXPECT_EQ(maxProbes - 1, ids.back());
+	EXPECT_EQ(maxProbes - 1, r.probe(overflowProbe));
+	EXPECT_EQ(ids[0], r.probe("test.overflow.0"));
+	std::size_t shared = std::size_t(std::count(ids.begin(), ids.end(), maxProbes - 1));
+	EXPECT_LE(11u, shared);
+	for (auto id: ids) r.count(id);
+	EXPECT_EQ(shared, r.get(overflowProbe).count);
+	EXPECT_EQ(1u, r.get("test.overflow.0").count);
 }